@@ -4,22 +4,41 @@
 #include "FFTConfig.h"
 
 #include <complex>
+#include <memory>
 #include <vector>
 #include <cstddef>
 
 namespace SharedMath::DSP {
 
+namespace detail { struct MixedRadixPlan; struct BluesteinPlan; }
+
 /// ─────────────────────────────────────────────────────────────────────────────
 /// CPUBackend
 ///
 /// Pure-C++ FFT backend.  No external dependencies.
 ///
 /// Algorithms:
-///   • Cooley-Tukey radix-2 DIT  — O(N log N), requires N = 2^k
-///   • Bluestein chirp-z          — O(N log N), works for any N
+///   • Mixed-radix Stockham      — O(N log N), N = 2^a·3^b·5^c·7^d·11^e·13^f
+///       radix-8/4/2, 3 and 5 butterflies (generic butterflies for 7, 11, 13)
+///       on a split real/imaginary layout; no bit-reversal pass, and every
+///       stage reads its own contiguous twiddle table.  The butterfly loops
+///       are compiled twice and the AVX2 build is picked at runtime (it
+///       follows Core::simdLevel()).  Large N runs as a recursive four-step
+///       N1 × N2 decomposition so each sub-transform stays in cache.
+///   • Bluestein chirp-z         — O(N log N), for sizes with a larger prime
+///       factor; its internal convolution uses the Stockham engine at the
+///       smallest 2^a·3^b·5^c length ≥ 2N−1.  The chirp and the spectrum of
+///       the convolution kernel are precomputed, so a transform costs two
+///       FFTs of that length.
+///
+/// All expensive table computation (stage twiddles, Bluestein chirp and
+/// kernel spectrum) is done once in prepare(); execute() is then a pure
+/// arithmetic operation on per-thread scratch.  The tables are immutable and
+/// shared between copies of the backend.
 ///
-/// All expensive table computation (bit-reversal, twiddle factors) is done
-/// once in prepare(); execute() is then a pure arithmetic operation.
+/// executeBatch() runs small Stockham transforms several at a time,
+/// interleaved element by element so each SIMD lane carries a different
+/// transform, and spreads large batches over the shared thread pool.
 /// ─────────────────────────────────────────────────────────────────────────────
 class CPUBackend final : public IFFTBackend {
 public:
@@ -31,25 +50,31 @@ public:
     /// ── IFFTBackend::execute ─────────────────────────────────────────────
     void execute(std::complex<double>* data) const override;
 
+    /// ── IFFTBackend::executeBatch ────────────────────────────────────────
+    void executeBatch(std::complex<double>* data, size_t n, size_t howmany,
+                      size_t stride, size_t dist) const override;
+
     /// ── IFFTBackend::name ────────────────────────────────────────────────
     const char* name() const noexcept override;
 
+    /// Whether prepare() accepts `algorithm` for a transform of size n
+    /// (CooleyTukey needs a power of two, MixedRadix a 13-smooth N).
+    static bool supports(size_t n, FFTAlgorithm algorithm) noexcept;
+
 private:
-    size_t   n_       = 0;
-    bool     inverse_ = false;
-    bool     usePow2_ = false;
-    size_t   M_       = 0;        // Bluestein padding length
-    FFTNorm  norm_    = FFTNorm::None;
+    size_t   n_         = 0;
+    bool     inverse_   = false;
+    bool     bluestein_ = false;
+    FFTNorm  norm_      = FFTNorm::None;
 
-    // Radix-2 tables for the main transform (power-of-2 path)
-    std::vector<size_t>               bitrev_;
-    std::vector<std::complex<double>> twiddles_;
+    // Stockham plan for n_ (mixed-radix path) or for Bluestein's padded
+    // length, always forward (Bluestein path).
+    std::shared_ptr<const detail::MixedRadixPlan> plan_;
 
-    // Radix-2 tables for Bluestein's internal convolution FFT
-    std::vector<size_t>               bitrevM_;
-    std::vector<std::complex<double>> twiddlesM_;
+    // Chirp and kernel spectrum (Bluestein path only).
+    std::shared_ptr<const detail::BluesteinPlan>  chirp_;
 
-    void applyNorm(std::complex<double>* data) const;
+    double normScale() const noexcept;
 };
 
-} // namespace SharedMath::DSP
\ No newline at end of file
+} // namespace SharedMath::DSP
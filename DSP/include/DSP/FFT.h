@@ -13,9 +13,10 @@ namespace SharedMath::DSP {
 // ─────────────────────────────────────────────────────────────────────────────
 // High-level FFT convenience API
 //
-// These free functions create a temporary FFTPlan, execute it, and return.
-// For repeated transforms of the same size, create an FFTPlan directly and
-// reuse it — that avoids re-allocating twiddle-factor tables.
+// These free functions take their plans from FFTPlanCache (FFTPlan::cached,
+// RealFFTPlan::cached), so repeated calls at one size plan only once.
+// rfft / irfft run real-input plans: an N/2-point complex transform plus a
+// twiddle pass, rather than a full N-point transform of a real signal.
 // ─────────────────────────────────────────────────────────────────────────────
 
 // ── In-place forward FFT ─────────────────────────────────────────────────────
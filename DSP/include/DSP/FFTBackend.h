@@ -3,6 +3,7 @@
 #include "FFTConfig.h"
 #include <complex>
 #include <cstddef>
+#include <vector>
 
 namespace SharedMath::DSP {
 
@@ -47,6 +48,26 @@ public:
     /// On exit:   data contains the transform result.
     virtual void execute(std::complex<double>* data) const = 0;
 
+    /// Execute `howmany` in-place transforms of length n (the n from prepare())
+    /// laid out FFTW-style: element j of transform b is data[b·dist + j·stride].
+    /// The default runs execute() on each transform in turn, through a
+    /// contiguous copy when stride ≠ 1; backends with a native batched path
+    /// override it.
+    virtual void executeBatch(std::complex<double>* data, size_t n, size_t howmany,
+                              size_t stride, size_t dist) const {
+        if (stride == 1) {
+            for (size_t b = 0; b < howmany; ++b) execute(data + b * dist);
+            return;
+        }
+        std::vector<std::complex<double>> tmp(n);
+        for (size_t b = 0; b < howmany; ++b) {
+            std::complex<double>* x = data + b * dist;
+            for (size_t j = 0; j < n; ++j) tmp[j] = x[j * stride];
+            execute(tmp.data());
+            for (size_t j = 0; j < n; ++j) x[j * stride] = tmp[j];
+        }
+    }
+
     /// Human-readable identifier for logging and diagnostics.
     virtual const char* name() const noexcept = 0;
 };
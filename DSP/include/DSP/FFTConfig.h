@@ -28,14 +28,17 @@ enum class FFTNorm {
 
 /// ── Algorithm selection hint ──────────────────────────────────────────────────
 ///
-///   Auto         — Cooley-Tukey when N is a power of 2, Bluestein otherwise
-///   CooleyTukey  — radix-2 DIT; throws if N is not a power of 2
+///   Auto         — mixed-radix when N = 2^a·3^b·5^c·7^d·11^e·13^f,
+///                  Bluestein otherwise (a larger prime factor)
+///   CooleyTukey  — power-of-2 sizes only (radix-8/4/2 stages); throws otherwise
+///   MixedRadix   — Stockham mixed-radix; throws if N has a prime factor above 13
 ///   Bluestein    — chirp-z; works for any N (incl. prime sizes)
 ///
 enum class FFTAlgorithm {
     Auto,
     CooleyTukey,
-    Bluestein
+    Bluestein,
+    MixedRadix
 };
 
 /// ── Aggregate plan configuration ─────────────────────────────────────────────
@@ -18,6 +18,12 @@ namespace SharedMath::DSP {
 /// The resulting object can be executed on any number of different buffers of
 /// the same length without recomputation.
 ///
+/// Plans are cheap handles: copies share the prepared backend, and execute()
+/// is const (the CPU backend may be executed from several threads at once).
+/// Code that transforms the same length repeatedly without keeping a plan
+/// around should use FFTPlan::cached(), which goes through the process-wide
+/// FFTPlanCache instead of planning on every call.
+///
 /// ── Quick-start ──────────────────────────────────────────────────────────────
 ///
 ///   // Forward FFT (no normalization):
@@ -35,6 +41,12 @@ namespace SharedMath::DSP {
 ///   // Custom backend (e.g., future CUDA):
 ///   auto cuda = FFTPlan::create(1024, {}, std::make_unique<CUDABackend>());
 ///
+///   // Plan once per process, not once per call:
+///   FFTPlan::cached(1024).execute(signal);
+///
+///   // 64 channels interleaved sample by sample (FFTW advanced layout):
+///   plan.executeBatch(iq.data(), /*howmany=*/64, /*stride=*/64, /*dist=*/1);
+///
 /// ─────────────────────────────────────────────────────────────────────────────
 class FFTPlan {
 public:
@@ -48,6 +60,9 @@ public:
     static FFTPlan create(size_t n, FFTConfig cfg,
                           std::unique_ptr<IFFTBackend> backend);
 
+    // CPU plan from FFTPlanCache::global(): planned on first use, then shared.
+    static FFTPlan cached(size_t n, FFTConfig cfg = {});
+
     /// ── Execution ─────────────────────────────────────────────────────────
 
     /// In-place transform on a raw pointer (length must equal size()).
@@ -60,6 +75,23 @@ public:
     std::vector<std::complex<double>>
     executeConst(std::vector<std::complex<double>> data) const;
 
+    /// ── Batched execution ─────────────────────────────────────────────────
+
+    /// `howmany` in-place transforms, FFTW "advanced" layout: element j of
+    /// transform b is data[b·dist + j·stride].  Frames back to back are
+    /// (stride 1, dist size()); channels interleaved sample by sample are
+    /// (stride howmany, dist 1).  The backend may run the transforms
+    /// together (the CPU backend interleaves small ones in SIMD lanes and
+    /// splits large batches across the thread pool).
+    void executeBatch(std::complex<double>* data, size_t howmany,
+                      size_t stride, size_t dist) const;
+
+    /// `howmany` contiguous transforms back to back.
+    void executeBatch(std::complex<double>* data, size_t howmany) const;
+
+    /// Contiguous transforms filling `data` (size a multiple of size()).
+    void executeBatch(std::vector<std::complex<double>>& data) const;
+
     /// ── Paired forward / inverse factory helpers ──────────────────────────
 
     /// Returns a matching inverse plan (same size, direction flipped, ByN norm).
@@ -81,7 +113,7 @@ private:
 
     size_t                       n_ = 0;
     FFTConfig                    cfg_;
-    std::unique_ptr<IFFTBackend> backend_;
+    std::shared_ptr<IFFTBackend> backend_;
 };
 
 } // namespace SharedMath::DSP
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "FFTConfig.h"
+#include "FFTBackend.h"
+#include "FFTPlan.h"
+#include "RealFFTPlan.h"
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace SharedMath::DSP {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// FFTPlanCache — process-wide LRU cache of prepared FFT plans
+///
+/// Planning builds twiddle tables; a helper that plans on every call (or on
+/// every frame) spends more time planning than transforming.  The cache
+/// hands out plans keyed by (N, FFTConfig, backend), complex and real-input
+/// (RealFFTPlan) alike; a real plan shares the cached complex plan it runs
+/// on.  A plan is a handle on
+/// a shared, immutable backend, so a hit costs a map lookup and a reference
+/// count, and a handle stays valid after its entry is evicted.
+///
+/// Thread-safe.  Plans are built outside the lock: two threads missing on the
+/// same key at the same time both plan, and the first insert wins.
+///
+/// ── Wisdom ───────────────────────────────────────────────────────────────────
+///
+/// FFTAlgorithm::Auto picks an algorithm from the factorisation of N.  With
+/// wisdom measuring enabled, a CPU-backend miss on an Auto config instead
+/// times every algorithm the backend accepts for N and plans the fastest.
+/// The choice is remembered per (N, direction), and can be saved to a text
+/// file and loaded by a later process so it starts with the measurements
+/// already made.  Loaded or measured wisdom is used whether or not
+/// measuring is currently enabled, for plans built from then on (clear()
+/// drops plans that were built without it).
+///
+///   auto& cache = FFTPlanCache::global();
+///   cache.loadWisdom("fft.wisdom");           // false if there is none yet
+///   cache.setMeasure(true);
+///   ...                                       // run the workload
+///   cache.saveWisdom("fft.wisdom");
+///
+/// ─────────────────────────────────────────────────────────────────────────────
+class FFTPlanCache {
+public:
+    using BackendFactory = std::function<std::unique_ptr<IFFTBackend>()>;
+
+    struct Stats {
+        size_t hits      = 0;
+        size_t misses    = 0;
+        size_t evictions = 0;
+    };
+
+    static constexpr size_t kDefaultCapacity = 64;
+
+    /// Up to `capacity` complex and `capacity` real plans are kept; 0
+    /// disables caching (every lookup plans).
+    explicit FFTPlanCache(size_t capacity = kDefaultCapacity);
+
+    FFTPlanCache(const FFTPlanCache&)            = delete;
+    FFTPlanCache& operator=(const FFTPlanCache&) = delete;
+
+    /// The cache behind FFTPlan::cached().
+    static FFTPlanCache& global();
+
+    /// ── Lookup ────────────────────────────────────────────────────────────
+
+    /// Plan on the default CPU backend.
+    FFTPlan get(size_t n, FFTConfig cfg = {});
+
+    /// Plan on a custom backend.  `backendKey` names the kind of backend
+    /// (plans with equal keys are interchangeable); `factory` makes a fresh
+    /// backend on a miss.  The key "cpu" is reserved for CPUBackend.
+    FFTPlan get(size_t n, FFTConfig cfg, const std::string& backendKey,
+                const BackendFactory& factory);
+
+    /// Real-input (R2C) or real-output (C2R) plan on the CPU backend.
+    RealFFTPlan getReal(size_t n, FFTConfig cfg = {});
+
+    /// ── Capacity and statistics ───────────────────────────────────────────
+
+    size_t capacity() const;
+    void   setCapacity(size_t capacity);     // evicts down to the new size
+    size_t size() const;                     // complex + real plans held
+    void   clear();                          // drops plans, keeps wisdom
+    Stats  stats() const;
+
+    /// ── Wisdom ────────────────────────────────────────────────────────────
+
+    bool measure() const;
+    void setMeasure(bool on);
+
+    /// The remembered algorithm for (n, direction); Auto if there is none.
+    FFTAlgorithm wisdom(size_t n, FFTDirection direction) const;
+
+    /// Writes the remembered choices; throws std::runtime_error on I/O failure.
+    void saveWisdom(const std::string& path) const;
+
+    /// Merges the choices stored in `path` into the cache's wisdom, skipping
+    /// any the CPU backend cannot run for their N.  Returns false if the
+    /// file cannot be opened; throws std::runtime_error if it is not a
+    /// wisdom file.
+    bool loadWisdom(const std::string& path);
+
+    void forgetWisdom();
+
+private:
+    using Key = std::tuple<size_t, FFTDirection, FFTNorm, FFTAlgorithm, std::string>;
+
+    template<typename Plan>
+    struct Slots {
+        using List = std::list<std::pair<Key, Plan>>;
+        List                                  lru;      // most recent first
+        std::map<Key, typename List::iterator> index;
+    };
+
+    template<typename Plan, typename Make>
+    Plan lookup(Slots<Plan>& slots, const Key& key, Make&& make);
+    template<typename Plan>
+    void evictLocked(Slots<Plan>& slots);
+
+    FFTConfig resolve(size_t n, FFTConfig cfg);
+
+    mutable std::mutex                              mutex_;
+    size_t                                          capacity_;
+    Slots<FFTPlan>                                  complex_;
+    Slots<RealFFTPlan>                              real_;
+    Stats                                           stats_;
+    bool                                            measure_ = false;
+    std::map<std::pair<size_t, FFTDirection>, FFTAlgorithm> wisdom_;
+};
+
+} // namespace SharedMath::DSP
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "FFTConfig.h"
+#include "FFTPlan.h"
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace SharedMath::DSP {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// RealFFTPlan — real-input (R2C) and real-output (C2R) transforms
+///
+/// A length-N real signal has a Hermitian spectrum, so only the N/2+1 bins
+/// X[0..N/2] are stored.  For even N the plan runs one complex FFT of length
+/// N/2 on the samples packed as z[n] = x[2n] + i·x[2n+1] and separates the
+/// even/odd half-spectra with a twiddle pass:
+///
+///   X[k] = ½(Z[k] + Z*[N/2−k]) − ½i·W^k·(Z[k] − Z*[N/2−k]),  W = e^{−2πi/N}
+///
+/// (C2R runs the same steps backwards).  That is half the arithmetic and
+/// half the memory of a complex transform of the zero-imaginary signal.
+/// Odd N falls back to a full complex transform.
+///
+///   // Forward: N reals → N/2+1 bins
+///   auto r2c = RealFFTPlan::create(1024);
+///   r2c.execute(samples.data(), bins.data());
+///
+///   // Inverse: N/2+1 bins → N reals, with 1/N normalization
+///   auto c2r = RealFFTPlan::create(1024, {FFTDirection::Inverse, FFTNorm::ByN});
+///   c2r.execute(bins.data(), samples.data());
+///
+/// The imaginary parts of X[0] (and of X[N/2] for even N) are ignored by
+/// C2R, as they are for any Hermitian spectrum.  Plans are cheap handles on
+/// shared tables; RealFFTPlan::cached() returns them from FFTPlanCache.
+/// ─────────────────────────────────────────────────────────────────────────────
+class RealFFTPlan {
+public:
+    // ── Factory ───────────────────────────────────────────────────────────
+
+    // cfg.direction selects R2C (Forward) or C2R (Inverse); the algorithm
+    // hint applies to the internal complex transform.
+    static RealFFTPlan create(size_t n, FFTConfig cfg = {});
+
+    // Plan from FFTPlanCache::global(): planned on first use, then shared.
+    static RealFFTPlan cached(size_t n, FFTConfig cfg = {});
+
+    /// ── Execution ─────────────────────────────────────────────────────────
+
+    /// R2C: `in` holds size() reals, `out` receives bins() values.
+    void execute(const double* in, std::complex<double>* out) const;
+
+    /// C2R: `in` holds bins() values, `out` receives size() reals.
+    /// `in` and `out` must not overlap.
+    void execute(const std::complex<double>* in, double* out) const;
+
+    /// Vector forms (throw on size mismatch; the output is resized).
+    void execute(const std::vector<double>& in,
+                 std::vector<std::complex<double>>& out) const;
+    void execute(const std::vector<std::complex<double>>& in,
+                 std::vector<double>& out) const;
+
+    /// ── Metadata ──────────────────────────────────────────────────────────
+
+    size_t           size()      const noexcept { return n_; }
+    size_t           bins()      const noexcept { return n_ / 2 + 1; }
+    bool             isInverse() const noexcept { return cfg_.direction == FFTDirection::Inverse; }
+    const FFTConfig& config()    const noexcept { return cfg_; }
+
+private:
+    friend class FFTPlanCache;
+
+    RealFFTPlan(size_t n, FFTConfig cfg, FFTPlan inner);
+
+    struct Twiddles;
+
+    size_t                          n_ = 0;
+    FFTConfig                       cfg_;
+    FFTPlan                         inner_;     // N/2 (even N) or N (odd N), unnormalized
+    std::shared_ptr<const Twiddles> tw_;        // W^k, k = 0..N/4 (even N only)
+    double                          scale_ = 1.0;
+};
+
+} // namespace SharedMath::DSP
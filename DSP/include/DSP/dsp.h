@@ -7,6 +7,8 @@
 #include "FFTBackend.h"
 #include "CPUBackend.h"
 #include "FFTPlan.h"
+#include "RealFFTPlan.h"
+#include "FFTPlanCache.h"
 #include "FFT.h"
 #include "Window.h"
 #include "Convolution.h"
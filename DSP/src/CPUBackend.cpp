@@ -1,15 +1,35 @@
 /**
- * @file FFTBackend.cpp
+ * @file CPUBackend.cpp
  * @brief Implementation of CPUBackend FFT algorithms.
  */
 
 #include "CPUBackend.h"
 #include "FFTConfig.h"
 
+#include "core/CpuFeatures.h"
+#include "core/Memory.h"
+#include "core/ThreadPool.h"
+
 #include <cmath>
 #include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SM_FFT_X86 1
+#  define SM_TARGET_AVX2    __attribute__((target("avx2,fma")))
+#  define SM_ALWAYS_INLINE  inline __attribute__((always_inline))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define SM_FFT_X86 1
+#  define SM_TARGET_AVX2
+#  define SM_ALWAYS_INLINE  __forceinline
+#else
+#  define SM_ALWAYS_INLINE  inline
+#endif
 
 namespace SharedMath::DSP {
 
@@ -17,81 +37,511 @@ namespace detail {
 
 constexpr double DSP_PI = 3.14159265358979323846;
 
-/// ── Bit manipulation helpers ─────────────────────────────────────────────────
+/// Largest prime factor the Stockham engine handles (with the generic
+/// radix-p butterfly above 5).  Sizes with a larger prime factor go through
+/// Bluestein.
+constexpr size_t kMaxRadix = 13;
+
+/// Transforms longer than this run as a four-step N1 × N2 decomposition.
+/// 2^15 points are 512 KiB in split layout, about one L2.
+constexpr size_t kFourStepThreshold = size_t{1} << 15;
+
+/// executeBatch interleaves up to kBatchLanes transforms of length at most
+/// kBatchLaneMaxN.  Longer transforms already have long unit-stride stage
+/// loops, and the gather/scatter then costs more than the lanes save.
+constexpr size_t kBatchLanes    = 8;
+constexpr size_t kBatchLaneMaxN = 32;
+
+/// Batches smaller than this many points stay on the calling thread.
+constexpr size_t kBatchParallelPoints = size_t{1} << 15;
+
+/// ── Size helpers ─────────────────────────────────────────────────────────────
 
 inline bool isPow2(size_t n) noexcept { return n > 0 && (n & (n - 1)) == 0; }
 
-inline size_t nextPow2(size_t n) noexcept {
-    size_t p = 1;
-    while (p < n) p <<= 1;
-    return p;
+/// Butterfly radices for n, applied in order (8s first, then 4/2, 3, 5 and
+/// the generic primes).  Empty with ok = false if n has a prime factor
+/// larger than kMaxRadix.
+std::vector<size_t> factorRadices(size_t n, bool& ok) {
+    std::vector<size_t> radices;
+    size_t twos = 0;
+    while (n % 2 == 0) { n /= 2; ++twos; }
+    // 2^a as 8s, with the remainder folded into one or two 4s (2^4 = 4·4
+    // beats 8·2; a single 2 only when a == 1).
+    size_t eights = twos / 3, rest = twos % 3;
+    if (rest == 1 && eights > 0) { --eights; rest = 4; }
+    radices.insert(radices.end(), eights, 8);
+    if (rest == 4)      { radices.push_back(4); radices.push_back(4); }
+    else if (rest == 2) radices.push_back(4);
+    else if (rest == 1) radices.push_back(2);
+
+    for (size_t p = 3; p <= kMaxRadix; p += 2)
+        while (n % p == 0) { n /= p; radices.push_back(p); }
+
+    ok = (n == 1);
+    if (!ok) radices.clear();
+    return radices;
+}
+
+inline bool isSmooth(size_t n) {
+    bool ok = false;
+    factorRadices(n, ok);
+    return ok;
+}
+
+/// Smallest 2^a·3^b·5^c ≥ n.
+size_t nextFastSize(size_t n) {
+    for (size_t m = std::max<size_t>(n, 1);; ++m) {
+        size_t r = m;
+        for (size_t p : {2, 3, 5})
+            while (r % p == 0) r /= p;
+        if (r == 1) return m;
+    }
+}
+
+/// exp(sign·2πi·k/n) with k reduced mod n first.
+inline void unitRoot(size_t k, size_t n, bool inverse, double& re, double& im) {
+    const double angle = (inverse ? 2.0 : -2.0) * DSP_PI
+                       * static_cast<double>(k % n) / static_cast<double>(n);
+    re = std::cos(angle);
+    im = std::sin(angle);
+}
+
+/// Cache-blocked dst = srcᵀ for a rows × cols row-major src.
+void transpose(const double* src, double* dst, size_t rows, size_t cols) {
+    constexpr size_t B = 8;
+    for (size_t r0 = 0; r0 < rows; r0 += B)
+        for (size_t c0 = 0; c0 < cols; c0 += B) {
+            const size_t r1 = std::min(r0 + B, rows), c1 = std::min(c0 + B, cols);
+            for (size_t r = r0; r < r1; ++r)
+                for (size_t c = c0; c < c1; ++c) dst[c * rows + r] = src[r * cols + c];
+        }
+}
+
+// ── Butterflies ──────────────────────────────────────────────────────────────
+//
+// In-place length-R DFTs on R complex values in natural order:
+//   b[k] = Σ_j a[j]·ω^{jk},  ω = exp(∓2πi/R)  (− forward, + inverse).
+// `j` below is ω^{R/4} = ∓i, applied by mulJ().
+
+struct Cx { double re, im; };
+
+SM_ALWAYS_INLINE Cx operator+(Cx a, Cx b) { return {a.re + b.re, a.im + b.im}; }
+SM_ALWAYS_INLINE Cx operator-(Cx a, Cx b) { return {a.re - b.re, a.im - b.im}; }
+SM_ALWAYS_INLINE Cx operator*(double s, Cx a) { return {s * a.re, s * a.im}; }
+
+template<bool Inv>
+SM_ALWAYS_INLINE Cx mulJ(Cx a) {
+    return Inv ? Cx{-a.im, a.re} : Cx{a.im, -a.re};
+}
+
+template<bool Inv>
+SM_ALWAYS_INLINE void butterfly2(Cx* a) {
+    const Cx t = a[1];
+    a[1] = a[0] - t;
+    a[0] = a[0] + t;
+}
+
+template<bool Inv>
+SM_ALWAYS_INLINE void butterfly3(Cx* a) {
+    constexpr double c = -0.5;
+    constexpr double s = 0.86602540378443864676;   // sin(2π/3)
+    const Cx t1 = a[1] + a[2];
+    const Cx t2 = a[0] + c * t1;
+    const Cx t3 = s * mulJ<Inv>(a[1] - a[2]);
+    a[0] = a[0] + t1;
+    a[1] = t2 + t3;
+    a[2] = t2 - t3;
+}
+
+template<bool Inv>
+SM_ALWAYS_INLINE void butterfly4(Cx* a) {
+    const Cx s02 = a[0] + a[2], d02 = a[0] - a[2];
+    const Cx s13 = a[1] + a[3], d13 = mulJ<Inv>(a[1] - a[3]);
+    a[0] = s02 + s13;
+    a[2] = s02 - s13;
+    a[1] = d02 + d13;
+    a[3] = d02 - d13;
+}
+
+template<bool Inv>
+SM_ALWAYS_INLINE void butterfly5(Cx* a) {
+    constexpr double c1 =  0.30901699437494742410;   // cos(2π/5)
+    constexpr double c2 = -0.80901699437494742410;   // cos(4π/5)
+    constexpr double s1 =  0.95105651629515357212;   // sin(2π/5)
+    constexpr double s2 =  0.58778525229247312917;   // sin(4π/5)
+    const Cx p14 = a[1] + a[4], m14 = a[1] - a[4];
+    const Cx p23 = a[2] + a[3], m23 = a[2] - a[3];
+    const Cx r1 = a[0] + c1 * p14 + c2 * p23;
+    const Cx r2 = a[0] + c2 * p14 + c1 * p23;
+    const Cx i1 = mulJ<Inv>(s1 * m14 + s2 * m23);
+    const Cx i2 = mulJ<Inv>(s2 * m14 - s1 * m23);
+    a[0] = a[0] + p14 + p23;
+    a[1] = r1 + i1;
+    a[4] = r1 - i1;
+    a[2] = r2 + i2;
+    a[3] = r2 - i2;
+}
+
+template<bool Inv>
+SM_ALWAYS_INLINE void butterfly8(Cx* a) {
+    constexpr double h = 0.70710678118654752440;     // 1/√2
+    Cx e[4] = {a[0], a[2], a[4], a[6]};
+    Cx o[4] = {a[1], a[3], a[5], a[7]};
+    butterfly4<Inv>(e);
+    butterfly4<Inv>(o);
+    // o[k] *= ω8^k, ω8 = (1 ∓ i)/√2
+    const Cx j1 = mulJ<Inv>(o[1]), j3 = mulJ<Inv>(o[3]);
+    o[1] = h * (o[1] + j1);
+    o[2] = mulJ<Inv>(o[2]);
+    o[3] = h * (j3 - o[3]);
+    for (size_t k = 0; k < 4; ++k) {
+        a[k]     = e[k] + o[k];
+        a[k + 4] = e[k] - o[k];
+    }
 }
 
-/// ── Bit-reversal permutation table ───────────────────────────────────────────
+template<size_t R, bool Inv>
+SM_ALWAYS_INLINE void butterfly(Cx* a) {
+    if constexpr (R == 2) butterfly2<Inv>(a);
+    else if constexpr (R == 3) butterfly3<Inv>(a);
+    else if constexpr (R == 4) butterfly4<Inv>(a);
+    else if constexpr (R == 5) butterfly5<Inv>(a);
+    else butterfly8<Inv>(a);
+}
 
-std::vector<size_t> makeBitrev(size_t n) {
-    size_t bits = 0;
-    while ((size_t{1} << bits) < n) ++bits;
-    std::vector<size_t> rev(n);
-    for (size_t i = 0; i < n; ++i) {
-        size_t r = 0, x = i;
-        for (size_t b = 0; b < bits; ++b) { r = (r << 1) | (x & 1); x >>= 1; }
-        rev[i] = r;
+// ── Stockham stage ───────────────────────────────────────────────────────────
+//
+// One radix-R pass of the self-sorting (Stockham) DIF FFT.  With L the
+// current sub-transform length, m = L/R and s the stride (product of the
+// radices already applied):
+//
+//   a_j = x[q + s·(p + j·m)],  j = 0..R−1
+//   y[q + s·(R·p + k)] = DFT_R(a)_k · w_L^{p·k}
+//
+// for p < m, q < s.  The twiddles of a stage are stored as R−1 contiguous
+// rows tw[(k−1)·m + p].  Both the q loop (s > 1) and the p loop (first
+// stage, s = 1) are unit-stride in the input, so they vectorise over the
+// split re/im arrays.
+
+using StageFn = void (*)(const double* xr, const double* xi, double* yr, double* yi,
+                         size_t m, size_t s, const double* twr, const double* twi);
+
+template<size_t R, bool Inv>
+SM_ALWAYS_INLINE void stageBody(const double* __restrict xr, const double* __restrict xi,
+                                double* __restrict yr, double* __restrict yi,
+                                size_t m, size_t s,
+                                const double* __restrict twr, const double* __restrict twi)
+{
+    if (s == 1) {
+        for (size_t p = 0; p < m; ++p) {
+            Cx a[R];
+            for (size_t j = 0; j < R; ++j) a[j] = {xr[p + j * m], xi[p + j * m]};
+            butterfly<R, Inv>(a);
+            yr[R * p] = a[0].re;
+            yi[R * p] = a[0].im;
+            for (size_t k = 1; k < R; ++k) {
+                const double wr = twr[(k - 1) * m + p], wi = twi[(k - 1) * m + p];
+                yr[R * p + k] = a[k].re * wr - a[k].im * wi;
+                yi[R * p + k] = a[k].re * wi + a[k].im * wr;
+            }
+        }
+        return;
+    }
+    for (size_t p = 0; p < m; ++p) {
+        double wr[R], wi[R];
+        for (size_t k = 1; k < R; ++k) {
+            wr[k] = twr[(k - 1) * m + p];
+            wi[k] = twi[(k - 1) * m + p];
+        }
+        const double* __restrict inR = xr + s * p;
+        const double* __restrict inI = xi + s * p;
+        double* __restrict outR = yr + s * R * p;
+        double* __restrict outI = yi + s * R * p;
+        for (size_t q = 0; q < s; ++q) {
+            Cx a[R];
+            for (size_t j = 0; j < R; ++j) a[j] = {inR[q + j * s * m], inI[q + j * s * m]};
+            butterfly<R, Inv>(a);
+            outR[q] = a[0].re;
+            outI[q] = a[0].im;
+            for (size_t k = 1; k < R; ++k) {
+                outR[q + k * s] = a[k].re * wr[k] - a[k].im * wi[k];
+                outI[q + k * s] = a[k].re * wi[k] + a[k].im * wr[k];
+            }
+        }
     }
-    return rev;
 }
 
-/// ── Twiddle-factor table ─────────────────────────────────────────────────────
-/// Returns n/2 entries: tw[k] = exp(sign·2πi·k/n), where sign = -1 (forward)
-/// or +1 (inverse).  Stored for the butterfly: x[i+k] ± tw[k*stride]*x[i+k+half].
+template<size_t R, bool Inv>
+void stageScalar(const double* xr, const double* xi, double* yr, double* yi,
+                 size_t m, size_t s, const double* twr, const double* twi) {
+    stageBody<R, Inv>(xr, xi, yr, yi, m, s, twr, twi);
+}
 
-std::vector<std::complex<double>> makeTwiddles(size_t n, bool inverse) {
-    std::vector<std::complex<double>> tw(n / 2);
-    double sign = inverse ? 1.0 : -1.0;
-    for (size_t k = 0; k < n / 2; ++k) {
-        double angle = sign * 2.0 * DSP_PI * static_cast<double>(k)
-                                           / static_cast<double>(n);
-        tw[k] = {std::cos(angle), std::sin(angle)};
+#ifdef SM_FFT_X86
+template<size_t R, bool Inv>
+SM_TARGET_AVX2 void stageAvx2(const double* xr, const double* xi, double* yr, double* yi,
+                              size_t m, size_t s, const double* twr, const double* twi) {
+    stageBody<R, Inv>(xr, xi, yr, yi, m, s, twr, twi);
+}
+#endif
+
+template<bool Inv>
+StageFn pickStage(size_t radix, bool avx2) {
+#ifdef SM_FFT_X86
+    if (avx2) {
+        switch (radix) {
+            case 2: return &stageAvx2<2, Inv>;
+            case 3: return &stageAvx2<3, Inv>;
+            case 4: return &stageAvx2<4, Inv>;
+            case 5: return &stageAvx2<5, Inv>;
+            case 8: return &stageAvx2<8, Inv>;
+            default: return nullptr;
+        }
     }
-    return tw;
+#else
+    (void)avx2;
+#endif
+    switch (radix) {
+        case 2: return &stageScalar<2, Inv>;
+        case 3: return &stageScalar<3, Inv>;
+        case 4: return &stageScalar<4, Inv>;
+        case 5: return &stageScalar<5, Inv>;
+        case 8: return &stageScalar<8, Inv>;
+        default: return nullptr;
+    }
+}
+
+/// Radix-p stage for the primes without a hand-written butterfly:
+/// b_k = Σ_j a_j·ω_p^{jk mod p} from the p-th roots table.
+void stageGeneric(const double* xr, const double* xi, double* yr, double* yi,
+                  size_t R, size_t m, size_t s, const double* twr, const double* twi,
+                  const double* rootRe, const double* rootIm)
+{
+    double ar[kMaxRadix], ai[kMaxRadix];
+    for (size_t p = 0; p < m; ++p)
+        for (size_t q = 0; q < s; ++q) {
+            for (size_t j = 0; j < R; ++j) {
+                ar[j] = xr[q + s * (p + j * m)];
+                ai[j] = xi[q + s * (p + j * m)];
+            }
+            for (size_t k = 0; k < R; ++k) {
+                double br = 0.0, bi = 0.0;
+                for (size_t j = 0, jk = 0; j < R; ++j, jk = (jk + k) % R) {
+                    br += ar[j] * rootRe[jk] - ai[j] * rootIm[jk];
+                    bi += ar[j] * rootIm[jk] + ai[j] * rootRe[jk];
+                }
+                double wr = 1.0, wi = 0.0;
+                if (k > 0) { wr = twr[(k - 1) * m + p]; wi = twi[(k - 1) * m + p]; }
+                yr[q + s * (R * p + k)] = br * wr - bi * wi;
+                yi[q + s * (R * p + k)] = br * wi + bi * wr;
+            }
+        }
 }
 
-// ── Cooley-Tukey radix-2 DIT (in-place, power-of-2 only) ────────────────────
+inline bool useAvx2() noexcept {
+#ifdef SM_FFT_X86
+    return Core::simdLevel() != Core::SimdLevel::Scalar;
+#else
+    return false;
+#endif
+}
+
+// ── Mixed-radix plan ─────────────────────────────────────────────────────────
+//
+// Either a list of Stockham stages or, for n > kFourStepThreshold, the
+// four-step split n = n1·n2 (n1 ≈ √n):
 //
-// Algorithm (Decimation In Time):
-//   1. Bit-reversal permutation rearranges input into DIT order.
-//   2. log2(n) butterfly stages, each combining pairs with twiddle factors.
+//   1. n2 transforms of length n1 down the columns of x viewed as n1 × n2
+//      (transposed first so they are contiguous),
+//   2. multiply by w_n^{n2·k1},
+//   3. n1 transforms of length n2 along the rows, then transpose out.
 //
-// Twiddle index stride: for stage with block length `len`, the stride through
-// the precomputed table is n/len, so tw[k*(n/len)] = exp(−2πi·k/len).
+// The sub-plans recurse, so every level works on pieces that fit in cache.
+// Data is split complex: re[0..n) and im[0..n) in separate arrays.
+
+struct MixedRadixPlan {
+    struct Stage {
+        size_t radix, m, s;
+        size_t tw;        // offset of the (radix−1)·m twiddles in twRe/twIm
+        size_t roots;     // offset of the radix-th roots (generic radices)
+    };
+
+    size_t n       = 0;
+    bool   inverse = false;
+
+    std::vector<Stage>  stages;
+    std::vector<double> twRe, twIm, rootRe, rootIm;
+
+    size_t n1 = 0, n2 = 0;
+    std::shared_ptr<const MixedRadixPlan> sub1, sub2;
+    std::vector<double> ftRe, ftIm;           // w_n^{r·k1} at [r·n1 + k1]
+
+    size_t workspace = 0;                     // doubles of scratch run() needs
 
-void cooleyTukeyDIT(std::complex<double>* x, size_t n,
-                    const std::vector<size_t>&               bitrev,
-                    const std::vector<std::complex<double>>& twiddles)
+    static std::shared_ptr<const MixedRadixPlan> create(size_t n, bool inverse);
+
+    /// create() through a process-wide table of live plans, so every
+    /// backend (and sub-plan) of the same (n, direction) shares one copy of
+    /// the tables.  Thread-safe.
+    static std::shared_ptr<const MixedRadixPlan> shared(size_t n, bool inverse);
+
+    /// In-place transform of (re, im); `work` holds `workspace` doubles.
+    void run(double* re, double* im, double* work) const;
+
+    /// `lanes` Stockham transforms at once, interleaved element-wise
+    /// (element j of transform b at [j·lanes + b]); `work` holds
+    /// 2·n·lanes doubles.  Not for four-step plans.
+    ///
+    /// Interleaving is the same as scaling every stage's stride s by
+    /// `lanes`, so the stage kernels run unchanged with a longer unit-stride
+    /// q loop.
+    void runLanes(double* re, double* im, double* work, size_t lanes) const;
+};
+
+std::shared_ptr<const MixedRadixPlan> MixedRadixPlan::create(size_t n, bool inverse)
 {
-    // Step 1: Bit-reversal permutation
-    for (size_t i = 0; i < n; ++i)
-        if (i < bitrev[i]) std::swap(x[i], x[bitrev[i]]);
-
-    // Step 2: Butterfly stages
-    for (size_t len = 2; len <= n; len <<= 1) {
-        size_t half   = len >> 1;
-        size_t stride = n / len;
-        for (size_t i = 0; i < n; i += len) {
-            for (size_t k = 0; k < half; ++k) {
-                std::complex<double> t = twiddles[k * stride] * x[i + k + half];
-                std::complex<double> u = x[i + k];
-                x[i + k]        = u + t;
-                x[i + k + half] = u - t;
+    auto plan = std::make_shared<MixedRadixPlan>();
+    plan->n       = n;
+    plan->inverse = inverse;
+
+    if (n > kFourStepThreshold) {
+        size_t n1 = 1;
+        for (size_t d = 2; d * d <= n; ++d)
+            if (n % d == 0) n1 = d;
+        if (n1 > 1) {
+            plan->n1   = n1;
+            plan->n2   = n / n1;
+            plan->sub1 = shared(plan->n1, inverse);
+            plan->sub2 = shared(plan->n2, inverse);
+            plan->ftRe.resize(n);
+            plan->ftIm.resize(n);
+            for (size_t r = 0; r < plan->n2; ++r)
+                for (size_t k1 = 0; k1 < n1; ++k1)
+                    unitRoot(r * k1, n, inverse, plan->ftRe[r * n1 + k1], plan->ftIm[r * n1 + k1]);
+            plan->workspace = 2 * n + std::max(plan->sub1->workspace, plan->sub2->workspace);
+            return plan;
+        }
+    }
+
+    bool ok = false;
+    const std::vector<size_t> radices = factorRadices(n, ok);
+    if (!ok)
+        throw std::invalid_argument(
+            "CPUBackend: N=" + std::to_string(n) + " has a prime factor above "
+            + std::to_string(kMaxRadix));
+
+    size_t L = n, s = 1;
+    for (size_t R : radices) {
+        const size_t m = L / R;
+        Stage st{R, m, s, plan->twRe.size(), plan->rootRe.size()};
+        for (size_t k = 1; k < R; ++k)
+            for (size_t p = 0; p < m; ++p) {
+                double re, im;
+                unitRoot(p * k, L, inverse, re, im);
+                plan->twRe.push_back(re);
+                plan->twIm.push_back(im);
             }
+        if (R != 2 && R != 3 && R != 4 && R != 5 && R != 8)
+            for (size_t t = 0; t < R; ++t) {
+                double re, im;
+                unitRoot(t, R, inverse, re, im);
+                plan->rootRe.push_back(re);
+                plan->rootIm.push_back(im);
+            }
+        plan->stages.push_back(st);
+        L = m;
+        s *= R;
+    }
+    plan->workspace = 2 * n;
+    return plan;
+}
+
+std::shared_ptr<const MixedRadixPlan> MixedRadixPlan::shared(size_t n, bool inverse)
+{
+    // Weak references: tables live exactly as long as some plan uses them.
+    static std::mutex mutex;
+    static std::map<std::pair<size_t, bool>, std::weak_ptr<const MixedRadixPlan>> live;
+
+    const auto key = std::make_pair(n, inverse);
+    {
+        std::lock_guard<std::mutex> lk(mutex);
+        auto it = live.find(key);
+        if (it != live.end())
+            if (auto plan = it->second.lock()) return plan;
+    }
+
+    // Built unlocked (create() recurses into shared() for four-step plans);
+    // if another thread got there first, use its copy.
+    auto plan = create(n, inverse);
+    std::lock_guard<std::mutex> lk(mutex);
+    auto& slot = live[key];
+    if (auto existing = slot.lock()) return existing;
+    slot = plan;
+    for (auto it = live.begin(); it != live.end();)
+        it = it->second.expired() ? live.erase(it) : std::next(it);
+    return plan;
+}
+
+void MixedRadixPlan::run(double* re, double* im, double* work) const
+{
+    if (n1 != 0) {
+        double* tr = work;
+        double* ti = work + n;
+        double* sub = work + 2 * n;
+
+        transpose(re, tr, n1, n2);
+        transpose(im, ti, n1, n2);
+        for (size_t r = 0; r < n2; ++r) sub1->run(tr + r * n1, ti + r * n1, sub);
+        for (size_t i = 0; i < n; ++i) {
+            const double a = tr[i], b = ti[i];
+            tr[i] = a * ftRe[i] - b * ftIm[i];
+            ti[i] = a * ftIm[i] + b * ftRe[i];
         }
+        transpose(tr, re, n2, n1);
+        transpose(ti, im, n2, n1);
+        for (size_t r = 0; r < n1; ++r) sub2->run(re + r * n2, im + r * n2, sub);
+        transpose(re, tr, n1, n2);
+        transpose(im, ti, n1, n2);
+        std::memcpy(re, tr, n * sizeof(double));
+        std::memcpy(im, ti, n * sizeof(double));
+        return;
+    }
+
+    runLanes(re, im, work, 1);
+}
+
+void MixedRadixPlan::runLanes(double* re, double* im, double* work, size_t lanes) const
+{
+    const size_t len = n * lanes;
+    const bool avx2 = useAvx2();
+    double* xr = re;
+    double* xi = im;
+    double* yr = work;
+    double* yi = work + len;
+    for (const Stage& st : stages) {
+        const size_t s = st.s * lanes;
+        StageFn fn = inverse ? pickStage<true>(st.radix, avx2) : pickStage<false>(st.radix, avx2);
+        if (fn)
+            fn(xr, xi, yr, yi, st.m, s, twRe.data() + st.tw, twIm.data() + st.tw);
+        else
+            stageGeneric(xr, xi, yr, yi, st.radix, st.m, s,
+                         twRe.data() + st.tw, twIm.data() + st.tw,
+                         rootRe.data() + st.roots, rootIm.data() + st.roots);
+        // Ping-pong: the output becomes the next stage's input.
+        std::swap(xr, yr);
+        std::swap(xi, yi);
+    }
+    if (xr != re) {
+        std::memcpy(re, xr, len * sizeof(double));
+        std::memcpy(im, xi, len * sizeof(double));
     }
 }
 
 // ── Bluestein's chirp-z transform (arbitrary N) ───────────────────────────────
 //
-// Converts an arbitrary-length DFT into a convolution of length M (power of 2,
-// M ≥ 2N−1), then evaluates the convolution via two radix-2 FFTs.
+// Converts an arbitrary-length DFT into a circular convolution of length M
+// (M ≥ 2N−1, a 2^a·3^b·5^c size), evaluated with the Stockham engine.
 //
 // For the forward DFT  X[k] = Σ x[n]·exp(−2πi·nk/N):
 //   Using nk = (n² + k² − (k−n)²)/2:
@@ -99,56 +549,104 @@ void cooleyTukeyDIT(std::complex<double>* x, size_t n,
 //   where chirp[n] = exp(−πi·n²/N)
 //
 // The sum is a linear convolution of a[n]=x[n]·chirp[n] with b[n]=conj(chirp[n]).
-//
-// bitrevM / twiddlesM are precomputed for size M (always forward / inverse
-// internally uses the conj trick).
+// Only `a` depends on the input, so the chirp and the spectrum of `b` are
+// built once per plan; run() is then two M-point FFTs (forward, and the
+// inverse via the conj trick) plus three pointwise passes.
 
-void bluestein(std::complex<double>* x, size_t n, bool inverse,
-               const std::vector<size_t>&               bitrevM,
-               const std::vector<std::complex<double>>& twiddlesM)
-{
-    double sign = inverse ? 1.0 : -1.0;
-    double piOverN = DSP_PI / static_cast<double>(n);
+struct BluesteinPlan {
+    size_t n = 0;
+    std::vector<double> chirpRe, chirpIm;     // chirp[k], k = 0..N−1
+    std::vector<double> kernelRe, kernelIm;   // FFT_M(b) / M
+    std::shared_ptr<const MixedRadixPlan> planM;
 
-    /// Chirp sequence: chirp[k] = exp(sign·πi·k²/N)
-    std::vector<std::complex<double>> chirp(n);
-    for (size_t k = 0; k < n; ++k) {
-        double ang = sign * piOverN * static_cast<double>(k) * static_cast<double>(k);
-        chirp[k] = {std::cos(ang), std::sin(ang)};
-    }
+    static std::shared_ptr<const BluesteinPlan> create(size_t n, bool inverse);
 
-    size_t M = nextPow2(2 * n - 1);
+    /// In-place DFT of x[0..n), every output scaled by `scale`.
+    void run(std::complex<double>* x, double scale) const;
+};
 
-    // a[k] = x[k] · chirp[k], zero-padded to M
-    std::vector<std::complex<double>> a(M, {0.0, 0.0});
-    for (size_t k = 0; k < n; ++k)
-        a[k] = x[k] * chirp[k];
+std::shared_ptr<const BluesteinPlan> BluesteinPlan::create(size_t n, bool inverse)
+{
+    auto p = std::make_shared<BluesteinPlan>();
+    p->n     = n;
+    p->planM = MixedRadixPlan::shared(nextFastSize(2 * n - 1), /*inverse=*/false);
+    const size_t M = p->planM->n;
+    const double sign = inverse ? 1.0 : -1.0;
+
+    /// Chirp sequence: chirp[k] = exp(sign·πi·k²/N), with k² reduced mod 2N
+    p->chirpRe.resize(n);
+    p->chirpIm.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        const size_t k2 = (k * k) % (2 * n);
+        double ang = sign * DSP_PI * static_cast<double>(k2) / static_cast<double>(n);
+        p->chirpRe[k] = std::cos(ang);
+        p->chirpIm[k] = std::sin(ang);
+    }
 
     // b = conj(chirp), stored for circular convolution:
     //   b[0..N-1]       = conj(chirp[0..N-1])
     //   b[M-N+1..M-1]   = conj(chirp[N-1..1])   (wrap-around)
-    std::vector<std::complex<double>> b(M, {0.0, 0.0});
+    // and transformed here, with the 1/M of the inverse FFT folded in.
+    p->kernelRe.assign(M, 0.0);
+    p->kernelIm.assign(M, 0.0);
+    double* br = p->kernelRe.data();
+    double* bi = p->kernelIm.data();
     for (size_t k = 0; k < n; ++k) {
-        b[k] = std::conj(chirp[k]);
-        if (k > 0) b[M - k] = std::conj(chirp[k]);
+        br[k] =  p->chirpRe[k];
+        bi[k] = -p->chirpIm[k];
+        if (k > 0) { br[M - k] = br[k]; bi[M - k] = bi[k]; }
     }
+    std::vector<double> work(p->planM->workspace);
+    p->planM->run(br, bi, work.data());
+    const double invM = 1.0 / static_cast<double>(M);
+    for (size_t k = 0; k < M; ++k) {
+        br[k] *= invM;
+        bi[k] *= invM;
+    }
+    return p;
+}
 
-    /// Forward FFT of a and b (size M, always forward)
-    cooleyTukeyDIT(a.data(), M, bitrevM, twiddlesM);
-    cooleyTukeyDIT(b.data(), M, bitrevM, twiddlesM);
-
-    // Pointwise multiply in frequency domain (= convolution in time)
-    for (size_t k = 0; k < M; ++k) a[k] *= b[k];
+void BluesteinPlan::run(std::complex<double>* x, double scale) const
+{
+    const size_t M = planM->n;
+    const double* cr = chirpRe.data();
+    const double* ci = chirpIm.data();
+    const double* br = kernelRe.data();
+    const double* bi = kernelIm.data();
+
+    Core::ArenaScope scratch;
+    Core::ScratchVector<double> buf(2 * M + planM->workspace);
+    double* ar = buf.data();
+    double* ai = ar + M;
+    double* d  = reinterpret_cast<double*>(x);
 
-    // IFFT via the conj trick: IFFT(x) = conj(FFT(conj(x))) / M
-    for (size_t k = 0; k < M; ++k) a[k] = std::conj(a[k]);
-    cooleyTukeyDIT(a.data(), M, bitrevM, twiddlesM);
-    double invM = 1.0 / static_cast<double>(M);
-    for (size_t k = 0; k < M; ++k) a[k] = std::conj(a[k]) * invM;
+    // a[k] = x[k] · chirp[k], zero-padded to M
+    for (size_t k = 0; k < n; ++k) {
+        const double xr = d[2 * k], xi = d[2 * k + 1];
+        ar[k] = xr * cr[k] - xi * ci[k];
+        ai[k] = xr * ci[k] + xi * cr[k];
+    }
+    std::fill(ar + n, ar + M, 0.0);
+    std::fill(ai + n, ai + M, 0.0);
+
+    planM->run(ar, ai, ai + M);
+
+    // Pointwise multiply in frequency domain (= convolution in time), then
+    // conjugate for the conj-trick inverse: IFFT(x) = conj(FFT(conj(x))) / M
+    for (size_t k = 0; k < M; ++k) {
+        const double re = ar[k] * br[k] - ai[k] * bi[k];
+        const double im = ar[k] * bi[k] + ai[k] * br[k];
+        ar[k] = re;
+        ai[k] = -im;
+    }
+    planM->run(ar, ai, ai + M);
 
-    // X[k] = chirp[k] · a[k]  for k = 0..N-1
-    for (size_t k = 0; k < n; ++k)
-        x[k] = chirp[k] * a[k];
+    // X[k] = chirp[k] · conj(a[k])  for k = 0..N-1 (1/M is in the kernel)
+    for (size_t k = 0; k < n; ++k) {
+        const double yr = ar[k] * scale, yi = -ai[k] * scale;
+        d[2 * k]     = cr[k] * yr - ci[k] * yi;
+        d[2 * k + 1] = cr[k] * yi + ci[k] * yr;
+    }
 }
 
 } // namespace detail
@@ -157,6 +655,16 @@ void bluestein(std::complex<double>* x, size_t n, bool inverse,
 // CPUBackend Implementation
 // ─────────────────────────────────────────────────────────────────────────────
 
+bool CPUBackend::supports(size_t n, FFTAlgorithm algorithm) noexcept
+{
+    if (n == 0) return false;
+    switch (algorithm) {
+        case FFTAlgorithm::CooleyTukey: return detail::isPow2(n);
+        case FFTAlgorithm::MixedRadix:  return detail::isSmooth(n);
+        default:                        return true;
+    }
+}
+
 void CPUBackend::prepare(size_t n, const FFTConfig& cfg)
 {
     if (n == 0) throw std::invalid_argument("CPUBackend: n must be > 0");
@@ -170,44 +678,119 @@ void CPUBackend::prepare(size_t n, const FFTConfig& cfg)
             "CPUBackend: CooleyTukey requires a power-of-2 transform size; "
             "use FFTAlgorithm::Auto or FFTAlgorithm::Bluestein for N=" + std::to_string(n));
 
-    usePow2_ = detail::isPow2(n) && (cfg.algorithm != FFTAlgorithm::Bluestein);
+    const bool smooth = detail::isSmooth(n);
+    if (cfg.algorithm == FFTAlgorithm::MixedRadix && !smooth)
+        throw std::invalid_argument(
+            "CPUBackend: MixedRadix requires N with no prime factor above "
+            + std::to_string(detail::kMaxRadix)
+            + "; use FFTAlgorithm::Auto or FFTAlgorithm::Bluestein for N=" + std::to_string(n));
+
+    bluestein_ = cfg.algorithm == FFTAlgorithm::Bluestein || !smooth;
 
-    if (usePow2_) {
-        // Precompute radix-2 tables for N
-        bitrev_   = detail::makeBitrev(n);
-        twiddles_ = detail::makeTwiddles(n, inverse_);
+    if (bluestein_) {
+        chirp_ = detail::BluesteinPlan::create(n, inverse_);
+        plan_  = chirp_->planM;
     } else {
-        // Precompute radix-2 tables for M (Bluestein's internal FFT)
-        M_         = detail::nextPow2(2 * n - 1);
-        bitrevM_   = detail::makeBitrev(M_);
-        twiddlesM_ = detail::makeTwiddles(M_, /*inverse=*/false);
+        chirp_.reset();
+        plan_ = detail::MixedRadixPlan::shared(n, inverse_);
     }
 }
 
 void CPUBackend::execute(std::complex<double>* data) const
 {
-    if (usePow2_)
-        detail::cooleyTukeyDIT(data, n_, bitrev_, twiddles_);
-    else
-        detail::bluestein(data, n_, inverse_, bitrevM_, twiddlesM_);
+    if (bluestein_) {
+        chirp_->run(data, normScale());
+        return;
+    }
 
-    applyNorm(data);
+    // Split into re / im, transform, and interleave back with the
+    // normalisation folded in.
+    Core::ArenaScope scratch;
+    Core::ScratchVector<double> buf(2 * n_ + plan_->workspace);
+    double* re = buf.data();
+    double* im = re + n_;
+    double* d  = reinterpret_cast<double*>(data);
+    for (size_t i = 0; i < n_; ++i) {
+        re[i] = d[2 * i];
+        im[i] = d[2 * i + 1];
+    }
+    plan_->run(re, im, buf.data() + 2 * n_);
+    const double scale = normScale();
+    for (size_t i = 0; i < n_; ++i) {
+        d[2 * i]     = re[i] * scale;
+        d[2 * i + 1] = im[i] * scale;
+    }
 }
 
-const char* CPUBackend::name() const noexcept
+void CPUBackend::executeBatch(std::complex<double>* data, size_t n, size_t howmany,
+                              size_t stride, size_t dist) const
 {
-    return usePow2_ ? "CPU – Cooley-Tukey radix-2 DIT"
-                    : "CPU – Bluestein chirp-z";
+    if (n != n_)
+        throw std::invalid_argument("CPUBackend::executeBatch: length does not match the plan");
+
+    const bool   lanes  = !bluestein_ && plan_->n1 == 0 && n_ <= detail::kBatchLaneMaxN
+                          && howmany > 1;
+    const size_t group  = lanes ? detail::kBatchLanes : 1;
+    const size_t groups = (howmany + group - 1) / group;
+    const size_t grain  = std::max<size_t>(1, detail::kBatchParallelPoints / (n_ * group));
+    const double scale  = normScale();
+
+    Core::parallel_for(0, groups, grain, [&](size_t lo, size_t hi) {
+        Core::ArenaScope scratch;
+        if (!lanes) {
+            Core::ScratchVector<std::complex<double>> tmp(stride == 1 ? 0 : n_);
+            for (size_t b = lo; b < hi; ++b) {
+                std::complex<double>* x = data + b * dist;
+                if (stride == 1) {
+                    execute(x);
+                    continue;
+                }
+                for (size_t j = 0; j < n_; ++j) tmp[j] = x[j * stride];
+                execute(tmp.data());
+                for (size_t j = 0; j < n_; ++j) x[j * stride] = tmp[j];
+            }
+            return;
+        }
+
+        // Gather `L` transforms into lane-interleaved split arrays, run the
+        // stages once for all of them, and scatter back with the norm.
+        Core::ScratchVector<double> buf(4 * n_ * group);
+        for (size_t g = lo; g < hi; ++g) {
+            const size_t b0 = g * group;
+            const size_t L  = std::min(group, howmany - b0);
+            double* re   = buf.data();
+            double* im   = re + n_ * L;
+            double* work = im + n_ * L;
+            for (size_t b = 0; b < L; ++b) {
+                const double* x = reinterpret_cast<const double*>(data + (b0 + b) * dist);
+                for (size_t j = 0; j < n_; ++j) {
+                    re[j * L + b] = x[2 * j * stride];
+                    im[j * L + b] = x[2 * j * stride + 1];
+                }
+            }
+            plan_->runLanes(re, im, work, L);
+            for (size_t b = 0; b < L; ++b) {
+                double* x = reinterpret_cast<double*>(data + (b0 + b) * dist);
+                for (size_t j = 0; j < n_; ++j) {
+                    x[2 * j * stride]     = re[j * L + b] * scale;
+                    x[2 * j * stride + 1] = im[j * L + b] * scale;
+                }
+            }
+        }
+    });
 }
 
-void CPUBackend::applyNorm(std::complex<double>* data) const
+const char* CPUBackend::name() const noexcept
 {
-    double scale = 1.0;
-    if      (norm_ == FFTNorm::ByN)    scale = 1.0 / static_cast<double>(n_);
-    else if (norm_ == FFTNorm::BySqrtN) scale = 1.0 / std::sqrt(static_cast<double>(n_));
-    else return;
+    return bluestein_ ? "CPU – Bluestein chirp-z"
+                      : "CPU – Cooley-Tukey mixed-radix Stockham";
+}
 
-    for (size_t i = 0; i < n_; ++i) data[i] *= scale;
+double CPUBackend::normScale() const noexcept
+{
+    if (norm_ == FFTNorm::ByN)     return 1.0 / static_cast<double>(n_);
+    if (norm_ == FFTNorm::BySqrtN) return 1.0 / std::sqrt(static_cast<double>(n_));
+    return 1.0;
 }
 
-} // namespace SharedMath::DSP
\ No newline at end of file
+} // namespace SharedMath::DSP
@@ -4,7 +4,7 @@
  */
 
 #include "Convolution.h"
-#include "FFTPlan.h"
+#include "RealFFTPlan.h"
 #include "FFTConfig.h"
 
 #include <cmath>
@@ -22,13 +22,22 @@ size_t nextPow2C(size_t n) {
     return p;
 }
 
-// Build complex buffer of length fftN from a real vector (zero-padded)
+// Copy of v zero-padded (or truncated) to length fftN
+std::vector<double> toRealPadded(const std::vector<double>& v, size_t fftN)
+{
+    std::vector<double> r(fftN, 0.0);
+    std::copy(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(std::min(v.size(), fftN)),
+              r.begin());
+    return r;
+}
+
+// Half spectrum (fftN/2+1 bins) of v zero-padded to fftN
 std::vector<std::complex<double>>
-toComplexPadded(const std::vector<double>& v, size_t fftN)
+halfSpectrum(const RealFFTPlan& r2c, const std::vector<double>& v)
 {
-    std::vector<std::complex<double>> c(fftN, {0.0, 0.0});
-    for (size_t i = 0; i < v.size() && i < fftN; ++i) c[i] = v[i];
-    return c;
+    std::vector<std::complex<double>> X;
+    r2c.execute(toRealPadded(v, r2c.size()), X);
+    return X;
 }
 
 // Trim a Full-length result (la + lb − 1) to Same or Valid.
@@ -75,19 +84,15 @@ std::vector<double> convolveLinear(
     size_t outLen = la + lb - 1;
     size_t fftN   = detail::nextPow2C(outLen);
 
-    auto ca = detail::toComplexPadded(a, fftN);
-    auto cb = detail::toComplexPadded(b, fftN);
+    // Real inputs: half-spectrum products through the R2C / C2R plans.
+    const auto r2c = RealFFTPlan::cached(fftN);
+    auto A = detail::halfSpectrum(r2c, a);
+    const auto B = detail::halfSpectrum(r2c, b);
+    for (size_t k = 0; k < A.size(); ++k) A[k] *= B[k];
 
-    auto fwdPlan = FFTPlan::create(fftN);
-    fwdPlan.execute(ca);
-    fwdPlan.execute(cb);
-
-    for (size_t i = 0; i < fftN; ++i) ca[i] *= cb[i];
-
-    FFTPlan::create(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(ca);
-
-    std::vector<double> full(outLen);
-    for (size_t i = 0; i < outLen; ++i) full[i] = ca[i].real();
+    std::vector<double> full;
+    RealFFTPlan::cached(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A, full);
+    full.resize(outLen);
 
     return detail::trimOutput(full, la, lb, mode);
 }
@@ -117,21 +122,18 @@ std::vector<double> convolveCircular(
     if (n == 0 || a.empty() || b.empty()) return {};
 
     // Fold each input into a length-n buffer (handles truncation and aliasing)
-    std::vector<std::complex<double>> ca(n, {0.0, 0.0});
-    std::vector<std::complex<double>> cb(n, {0.0, 0.0});
-    for (size_t i = 0; i < a.size(); ++i) ca[i % n] += a[i];
-    for (size_t i = 0; i < b.size(); ++i) cb[i % n] += b[i];
-
-    auto fwdPlan = FFTPlan::create(n);
-    fwdPlan.execute(ca);
-    fwdPlan.execute(cb);
-
-    for (size_t i = 0; i < n; ++i) ca[i] *= cb[i];
+    std::vector<double> fa(n, 0.0), fb(n, 0.0);
+    for (size_t i = 0; i < a.size(); ++i) fa[i % n] += a[i];
+    for (size_t i = 0; i < b.size(); ++i) fb[i % n] += b[i];
 
-    FFTPlan::create(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(ca);
+    const auto r2c = RealFFTPlan::cached(n);
+    std::vector<std::complex<double>> A, B;
+    r2c.execute(fa, A);
+    r2c.execute(fb, B);
+    for (size_t k = 0; k < A.size(); ++k) A[k] *= B[k];
 
-    std::vector<double> out(n);
-    for (size_t i = 0; i < n; ++i) out[i] = ca[i].real();
+    std::vector<double> out;
+    RealFFTPlan::cached(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A, out);
     return out;
 }
 
@@ -153,26 +155,28 @@ std::vector<double> convolveOverlapAdd(
     std::vector<double> out(outLen, 0.0);
 
     // Pre-transform the kernel once
-    auto K = detail::toComplexPadded(kernel, fftN);
-    auto fwdPlan = FFTPlan::create(fftN);
-    auto invPlan = FFTPlan::create(fftN, {FFTDirection::Inverse, FFTNorm::ByN});
-    fwdPlan.execute(K);
+    const auto fwdPlan = RealFFTPlan::cached(fftN);
+    const auto invPlan = RealFFTPlan::cached(fftN, {FFTDirection::Inverse, FFTNorm::ByN});
+    const auto K = detail::halfSpectrum(fwdPlan, kernel);
 
+    std::vector<double> block(fftN);
+    std::vector<std::complex<double>> spec(fwdPlan.bins());
     for (size_t start = 0; start < signal.size(); start += blockSize) {
         size_t len = std::min(blockSize, signal.size() - start);
 
         // Zero-padded block
-        std::vector<std::complex<double>> block(fftN, {0.0, 0.0});
-        for (size_t i = 0; i < len; ++i) block[i] = signal[start + i];
+        std::fill(block.begin(), block.end(), 0.0);
+        std::copy(signal.begin() + static_cast<std::ptrdiff_t>(start),
+                  signal.begin() + static_cast<std::ptrdiff_t>(start + len), block.begin());
 
-        fwdPlan.execute(block);
-        for (size_t i = 0; i < fftN; ++i) block[i] *= K[i];
-        invPlan.execute(block);
+        fwdPlan.execute(block.data(), spec.data());
+        for (size_t k = 0; k < spec.size(); ++k) spec[k] *= K[k];
+        invPlan.execute(spec.data(), block.data());
 
         // Overlap-add: block result has length len + kLen − 1
         size_t blockOutLen = len + kLen - 1;
         for (size_t i = 0; i < blockOutLen && (start + i) < outLen; ++i)
-            out[start + i] += block[i].real();
+            out[start + i] += block[i];
     }
 
     return out;
@@ -199,10 +203,9 @@ std::vector<double> convolveOverlapSave(
     if (step == 0) step = 1;
 
     // Pre-transform the kernel (zero-padded to fftN)
-    auto K = detail::toComplexPadded(kernel, fftN);
-    auto fwdPlan = FFTPlan::create(fftN);
-    auto invPlan = FFTPlan::create(fftN, {FFTDirection::Inverse, FFTNorm::ByN});
-    fwdPlan.execute(K);
+    const auto fwdPlan = RealFFTPlan::cached(fftN);
+    const auto invPlan = RealFFTPlan::cached(fftN, {FFTDirection::Inverse, FFTNorm::ByN});
+    const auto K = detail::halfSpectrum(fwdPlan, kernel);
 
     size_t outLen   = signal.size() + kLen - 1;
     size_t pad      = kLen - 1;           // zeros prepended
@@ -216,20 +219,21 @@ std::vector<double> convolveOverlapSave(
     std::vector<double> out;
     out.reserve(outLen);
 
+    std::vector<double> block(fftN);
+    std::vector<std::complex<double>> spec(fwdPlan.bins());
     for (size_t b = 0; b < numBlocks; ++b) {
         size_t pos = b * step;
 
-        std::vector<std::complex<double>> block(fftN, {0.0, 0.0});
         for (size_t i = 0; i < fftN; ++i)
             block[i] = (pos + i < totalPad) ? padded[pos + i] : 0.0;
 
-        fwdPlan.execute(block);
-        for (size_t i = 0; i < fftN; ++i) block[i] *= K[i];
-        invPlan.execute(block);
+        fwdPlan.execute(block.data(), spec.data());
+        for (size_t k = 0; k < spec.size(); ++k) spec[k] *= K[k];
+        invPlan.execute(spec.data(), block.data());
 
         // Discard first (kLen−1) samples; keep the rest
         for (size_t i = pad; i < fftN && out.size() < outLen; ++i)
-            out.push_back(block[i].real());
+            out.push_back(block[i]);
     }
 
     out.resize(outLen, 0.0);
@@ -250,17 +254,15 @@ std::vector<double> crossCorrelate(
     size_t outLen = la + lb - 1;
     size_t fftN   = detail::nextPow2C(outLen);
 
-    auto ca = detail::toComplexPadded(a, fftN);
-    auto cb = detail::toComplexPadded(b, fftN);
-
-    auto fwdPlan = FFTPlan::create(fftN);
-    fwdPlan.execute(ca);
-    fwdPlan.execute(cb);
+    const auto r2c = RealFFTPlan::cached(fftN);
+    auto A = detail::halfSpectrum(r2c, a);
+    const auto B = detail::halfSpectrum(r2c, b);
 
     // Correlation theorem: IFFT(conj(A) · B)
-    for (size_t i = 0; i < fftN; ++i) ca[i] = std::conj(ca[i]) * cb[i];
+    for (size_t k = 0; k < A.size(); ++k) A[k] = std::conj(A[k]) * B[k];
 
-    FFTPlan::create(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(ca);
+    std::vector<double> ca;
+    RealFFTPlan::cached(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A, ca);
 
     /// After IFFT, ca[k] = corr at lag k (positive), ca[fftN-k] = corr at lag -k.
     /// Rearrange so that index 0 = most-negative lag -(la-1).
@@ -268,10 +270,10 @@ std::vector<double> crossCorrelate(
     //   Negative lags -(la-1)..−1 live in ca[fftN-(la-1)..fftN-1]
     size_t negStart = fftN - (la - 1);
     for (size_t i = 0; i + 1 < la; ++i)          // la-1 negative-lag samples
-        full[i] = ca[negStart + i].real();
+        full[i] = ca[negStart + i];
     //   Zero lag + positive lags live in ca[0..lb-1]
     for (size_t i = 0; i < lb; ++i)
-        full[la - 1 + i] = ca[i].real();
+        full[la - 1 + i] = ca[i];
 
     return detail::trimOutput(full, la, lb, mode);
 }
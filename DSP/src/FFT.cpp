@@ -5,6 +5,7 @@
 
 #include "FFT.h"
 #include "FFTPlan.h"
+#include "RealFFTPlan.h"
 #include "FFTConfig.h"
 
 #include <algorithm>
@@ -18,28 +19,23 @@ namespace SharedMath::DSP {
 void fft(std::vector<std::complex<double>>& x, FFTNorm norm)
 {
     if (x.empty()) return;
-    FFTPlan::create(x.size(), {FFTDirection::Forward, norm}).execute(x);
+    FFTPlan::cached(x.size(), {FFTDirection::Forward, norm}).execute(x);
 }
 
 // ── In-place inverse FFT ─────────────────────────────────────────────────────
 void ifft(std::vector<std::complex<double>>& X, FFTNorm norm)
 {
     if (X.empty()) return;
-    FFTPlan::create(X.size(), {FFTDirection::Inverse, norm}).execute(X);
+    FFTPlan::cached(X.size(), {FFTDirection::Inverse, norm}).execute(X);
 }
 
 // ── Real FFT (half-spectrum) ─────────────────────────────────────────────────
 std::vector<std::complex<double>> rfft(const std::vector<double>& x, FFTNorm norm)
 {
     if (x.empty()) return {};
-    size_t n = x.size();
-    std::vector<std::complex<double>> cx(n);
-    for (size_t i = 0; i < n; ++i) cx[i] = x[i];
-
-    FFTPlan::create(n, {FFTDirection::Forward, norm}).execute(cx);
-
-    cx.resize(n / 2 + 1);
-    return cx;
+    std::vector<std::complex<double>> X;
+    RealFFTPlan::cached(x.size(), {FFTDirection::Forward, norm}).execute(x, X);
+    return X;
 }
 
 // ── Inverse real FFT ─────────────────────────────────────────────────────────
@@ -49,23 +45,16 @@ std::vector<double> irfft(const std::vector<std::complex<double>>& X,
 {
     if (X.empty() || n == 0) return {};
 
-    std::vector<std::complex<double>> full(n, {0.0, 0.0});
-    const size_t half = n / 2 + 1;
-    
-    for (size_t k = 0; k < half && k < X.size(); ++k)
-        full[k] = X[k];
-
-    const size_t last_pair = (n % 2 == 0) ? (n / 2 - 1) : ((n - 1) / 2);
-    
-    for (size_t k = 1; k <= last_pair; ++k) {
-        full[n - k] = std::conj(X[k]);
-    }
-
-    FFTPlan::create(n, {FFTDirection::Inverse, norm}).execute(full);
-
+    const auto plan = RealFFTPlan::cached(n, {FFTDirection::Inverse, norm});
     std::vector<double> out(n);
-    for (size_t i = 0; i < n; ++i)
-        out[i] = full[i].real();
+    if (X.size() == plan.bins()) {
+        plan.execute(X.data(), out.data());
+    } else {
+        // Missing bins are zero, extra ones are ignored.
+        std::vector<std::complex<double>> half(plan.bins(), {0.0, 0.0});
+        std::copy_n(X.begin(), std::min(X.size(), half.size()), half.begin());
+        plan.execute(half.data(), out.data());
+    }
     return out;
 }
 
@@ -169,7 +158,7 @@ windowedFFT(const std::vector<double>& signal,
     auto windowed = applyWindow(signal, window);
     std::vector<std::complex<double>> cx(windowed.size());
     for (size_t i = 0; i < windowed.size(); ++i) cx[i] = windowed[i];
-    FFTPlan::create(cx.size(), {FFTDirection::Forward, norm}).execute(cx);
+    FFTPlan::cached(cx.size(), {FFTDirection::Forward, norm}).execute(cx);
     return cx;
 }
 
@@ -187,25 +176,23 @@ std::vector<double> convolve(const std::vector<double>& a,
     size_t n = 1;
     while (n < outLen) n <<= 1;
 
-    auto toComplex = [&](const std::vector<double>& v) {
-        std::vector<std::complex<double>> c(n, {0.0, 0.0});
-        for (size_t i = 0; i < v.size(); ++i) c[i] = v[i];
-        return c;
+    // Real inputs: multiply half spectra through the R2C / C2R plans.
+    const auto r2c = RealFFTPlan::cached(n);
+    auto spectrum = [&](const std::vector<double>& v) {
+        std::vector<double> padded(n, 0.0);
+        std::copy(v.begin(), v.end(), padded.begin());
+        std::vector<std::complex<double>> X;
+        r2c.execute(padded, X);
+        return X;
     };
 
-    auto ca = toComplex(a);
-    auto cb = toComplex(b);
-
-    auto fwdPlan = FFTPlan::create(n);
-    fwdPlan.execute(ca);
-    fwdPlan.execute(cb);
-
-    for (size_t i = 0; i < n; ++i) ca[i] *= cb[i];
+    auto A = spectrum(a);
+    const auto B = spectrum(b);
+    for (size_t k = 0; k < A.size(); ++k) A[k] *= B[k];
 
-    FFTPlan::create(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(ca);
-
-    std::vector<double> out(outLen);
-    for (size_t i = 0; i < outLen; ++i) out[i] = ca[i].real();
+    std::vector<double> out;
+    RealFFTPlan::cached(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A, out);
+    out.resize(outLen);
     return out;
 }
 
@@ -217,31 +204,31 @@ std::vector<double> correlate(const std::vector<double>& a,
     size_t n = 1;
     while (n < outLen) n <<= 1;
 
-    auto toComplex = [&](const std::vector<double>& v) {
-        std::vector<std::complex<double>> c(n, {0.0, 0.0});
-        for (size_t i = 0; i < v.size(); ++i) c[i] = v[i];
-        return c;
+    const auto r2c = RealFFTPlan::cached(n);
+    auto spectrum = [&](const std::vector<double>& v) {
+        std::vector<double> padded(n, 0.0);
+        std::copy(v.begin(), v.end(), padded.begin());
+        std::vector<std::complex<double>> X;
+        r2c.execute(padded, X);
+        return X;
     };
 
-    auto ca = toComplex(a);
-    auto cb = toComplex(b);
-
-    auto fwdPlan = FFTPlan::create(n);
-    fwdPlan.execute(ca);
-    fwdPlan.execute(cb);
+    auto A = spectrum(a);
+    const auto B = spectrum(b);
 
     // Correlation theorem: IFFT(conj(A) · B)
-    for (size_t i = 0; i < n; ++i) ca[i] = std::conj(ca[i]) * cb[i];
+    for (size_t k = 0; k < A.size(); ++k) A[k] = std::conj(A[k]) * B[k];
 
-    FFTPlan::create(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(ca);
+    std::vector<double> ca;
+    RealFFTPlan::cached(n, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A, ca);
 
     /// Rearrange: negative lags first, then positive lags
     std::vector<double> out(outLen);
     size_t negStart = n - (a.size() - 1);
     for (size_t i = 0; i < a.size() - 1; ++i)
-        out[i] = ca[negStart + i].real();
+        out[i] = ca[negStart + i];
     for (size_t i = 0; i < b.size(); ++i)
-        out[a.size() - 1 + i] = ca[i].real();
+        out[a.size() - 1 + i] = ca[i];
     return out;
 }
 
@@ -7,6 +7,7 @@
 #include "FFTConfig.h"
 #include "FFTBackend.h"
 #include "CPUBackend.h"
+#include "FFTPlanCache.h"
 
 #include <stdexcept>
 #include <string>
@@ -36,6 +37,11 @@ FFTPlan FFTPlan::create(size_t n, FFTConfig cfg,
     return p;
 }
 
+FFTPlan FFTPlan::cached(size_t n, FFTConfig cfg)
+{
+    return FFTPlanCache::global().get(n, cfg);
+}
+
 /// ── Execution ─────────────────────────────────────────────────────────
 
 void FFTPlan::execute(std::complex<double>* data) const
@@ -59,6 +65,33 @@ FFTPlan::executeConst(std::vector<std::complex<double>> data) const
     return data;
 }
 
+/// ── Batched execution ─────────────────────────────────────────────────
+
+void FFTPlan::executeBatch(std::complex<double>* data, size_t howmany,
+                           size_t stride, size_t dist) const
+{
+    if (howmany == 0) return;
+    if (stride == 0)
+        throw std::invalid_argument("FFTPlan::executeBatch: stride must be > 0");
+    if (howmany > 1 && dist == 0)
+        throw std::invalid_argument("FFTPlan::executeBatch: dist must be > 0 for more than one transform");
+    backend_->executeBatch(data, n_, howmany, stride, dist);
+}
+
+void FFTPlan::executeBatch(std::complex<double>* data, size_t howmany) const
+{
+    executeBatch(data, howmany, 1, n_);
+}
+
+void FFTPlan::executeBatch(std::vector<std::complex<double>>& data) const
+{
+    if (data.size() % n_ != 0)
+        throw std::invalid_argument(
+            "FFTPlan::executeBatch: data size (" + std::to_string(data.size()) +
+            ") is not a multiple of plan size (" + std::to_string(n_) + ")");
+    executeBatch(data.data(), data.size() / n_);
+}
+
 /// ── Paired forward / inverse factory helpers ──────────────────────────
 
 FFTPlan FFTPlan::inversePlan(FFTNorm norm) const
@@ -0,0 +1,316 @@
+/**
+ * @file FFTPlanCache.cpp
+ * @brief Implementation of the process-wide FFT plan cache and wisdom.
+ */
+
+#include "FFTPlanCache.h"
+#include "CPUBackend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace SharedMath::DSP {
+
+namespace {
+
+constexpr const char* kCpuKey       = "cpu";
+constexpr const char* kWisdomHeader = "sharedmath-fft-wisdom 1";
+
+/// Points transformed per timing sample while measuring (at least one
+/// transform); keeps a measurement around a millisecond for small N.
+constexpr size_t kMeasurePoints = size_t{1} << 16;
+
+/// Best-of-three seconds per execution of `plan` on a fixed input.
+double timePlan(const FFTPlan& plan)
+{
+    const size_t n = plan.size();
+    std::vector<std::complex<double>> input(n), buf(n);
+    for (size_t i = 0; i < n; ++i)
+        input[i] = {std::cos(0.1 * static_cast<double>(i)),
+                    std::sin(0.37 * static_cast<double>(i))};
+
+    const size_t inner = std::max<size_t>(1, kMeasurePoints / n);
+    plan.execute(buf.data());                           // warm-up
+    double best = 1e300;
+    for (int r = 0; r < 3; ++r) {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < inner; ++i) {
+            // Fresh input each time so repeated transforms cannot overflow.
+            std::copy(input.begin(), input.end(), buf.begin());
+            plan.execute(buf.data());
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best / static_cast<double>(inner);
+}
+
+const char* directionName(FFTDirection d)
+{
+    return d == FFTDirection::Inverse ? "inverse" : "forward";
+}
+
+const char* algorithmName(FFTAlgorithm a)
+{
+    switch (a) {
+        case FFTAlgorithm::CooleyTukey: return "cooley-tukey";
+        case FFTAlgorithm::Bluestein:   return "bluestein";
+        case FFTAlgorithm::MixedRadix:  return "mixed-radix";
+        default:                        return "auto";
+    }
+}
+
+bool parseDirection(const std::string& s, FFTDirection& d)
+{
+    if (s == "forward") { d = FFTDirection::Forward; return true; }
+    if (s == "inverse") { d = FFTDirection::Inverse; return true; }
+    return false;
+}
+
+bool parseAlgorithm(const std::string& s, FFTAlgorithm& a)
+{
+    for (FFTAlgorithm c : {FFTAlgorithm::Auto, FFTAlgorithm::CooleyTukey,
+                           FFTAlgorithm::Bluestein, FFTAlgorithm::MixedRadix})
+        if (s == algorithmName(c)) { a = c; return true; }
+    return false;
+}
+
+} // namespace
+
+FFTPlanCache::FFTPlanCache(size_t capacity) : capacity_(capacity) {}
+
+FFTPlanCache& FFTPlanCache::global()
+{
+    static FFTPlanCache cache;
+    return cache;
+}
+
+// ── Lookup ───────────────────────────────────────────────────────────────────
+
+FFTPlan FFTPlanCache::get(size_t n, FFTConfig cfg)
+{
+    return get(n, cfg, kCpuKey, [] { return std::make_unique<CPUBackend>(); });
+}
+
+FFTPlan FFTPlanCache::get(size_t n, FFTConfig cfg, const std::string& backendKey,
+                          const BackendFactory& factory)
+{
+    if (n == 0)
+        throw std::invalid_argument("FFTPlanCache::get: transform size must be > 0");
+    if (!factory)
+        throw std::invalid_argument("FFTPlanCache::get: backend factory must not be empty");
+
+    return lookup(complex_, Key{n, cfg.direction, cfg.norm, cfg.algorithm, backendKey}, [&] {
+        const FFTConfig planCfg =
+            (backendKey == kCpuKey && cfg.algorithm == FFTAlgorithm::Auto) ? resolve(n, cfg) : cfg;
+        return FFTPlan::create(n, planCfg, factory());
+    });
+}
+
+RealFFTPlan FFTPlanCache::getReal(size_t n, FFTConfig cfg)
+{
+    if (n == 0)
+        throw std::invalid_argument("FFTPlanCache::getReal: transform size must be > 0");
+
+    return lookup(real_, Key{n, cfg.direction, cfg.norm, cfg.algorithm, kCpuKey}, [&] {
+        const size_t inner = (n % 2 == 0) ? n / 2 : n;
+        return RealFFTPlan(n, cfg, get(inner, {cfg.direction, FFTNorm::None, cfg.algorithm}));
+    });
+}
+
+template<typename Plan, typename Make>
+Plan FFTPlanCache::lookup(Slots<Plan>& slots, const Key& key, Make&& make)
+{
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto it = slots.index.find(key);
+        if (it != slots.index.end()) {
+            slots.lru.splice(slots.lru.begin(), slots.lru, it->second);
+            ++stats_.hits;
+            return it->second->second;
+        }
+        ++stats_.misses;
+    }
+
+    // Planning (and measuring) happens unlocked.
+    Plan plan = make();
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (capacity_ == 0) return plan;
+    auto it = slots.index.find(key);
+    if (it != slots.index.end()) {               // another thread won the race
+        slots.lru.splice(slots.lru.begin(), slots.lru, it->second);
+        return it->second->second;
+    }
+    slots.lru.emplace_front(key, plan);
+    slots.index.emplace(key, slots.lru.begin());
+    evictLocked(slots);
+    return plan;
+}
+
+FFTConfig FFTPlanCache::resolve(size_t n, FFTConfig cfg)
+{
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto it = wisdom_.find({n, cfg.direction});
+        if (it != wisdom_.end()) {
+            cfg.algorithm = it->second;
+            return cfg;
+        }
+        if (!measure_) return cfg;
+    }
+
+    // CooleyTukey runs the same Stockham engine as MixedRadix on the CPU
+    // backend, so the real choice is between the two engines.
+    FFTAlgorithm best  = FFTAlgorithm::Auto;
+    double       bestT = 0.0;
+    for (FFTAlgorithm a : {FFTAlgorithm::MixedRadix, FFTAlgorithm::Bluestein}) {
+        FFTConfig c = cfg;
+        c.algorithm = a;
+        double t;
+        try {
+            t = timePlan(FFTPlan::create(n, c));
+        } catch (const std::invalid_argument&) {
+            continue;                            // not applicable to this N
+        }
+        if (best == FFTAlgorithm::Auto || t < bestT) { best = a; bestT = t; }
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    wisdom_[{n, cfg.direction}] = best;
+    cfg.algorithm = best;
+    return cfg;
+}
+
+template<typename Plan>
+void FFTPlanCache::evictLocked(Slots<Plan>& slots)
+{
+    while (slots.lru.size() > capacity_) {
+        slots.index.erase(slots.lru.back().first);
+        slots.lru.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+// ── Capacity and statistics ──────────────────────────────────────────────────
+
+size_t FFTPlanCache::capacity() const
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    return capacity_;
+}
+
+void FFTPlanCache::setCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    capacity_ = capacity;
+    evictLocked(complex_);
+    evictLocked(real_);
+}
+
+size_t FFTPlanCache::size() const
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    return complex_.lru.size() + real_.lru.size();
+}
+
+void FFTPlanCache::clear()
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    complex_ = {};
+    real_    = {};
+}
+
+FFTPlanCache::Stats FFTPlanCache::stats() const
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    return stats_;
+}
+
+// ── Wisdom ───────────────────────────────────────────────────────────────────
+
+bool FFTPlanCache::measure() const
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    return measure_;
+}
+
+void FFTPlanCache::setMeasure(bool on)
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    measure_ = on;
+}
+
+FFTAlgorithm FFTPlanCache::wisdom(size_t n, FFTDirection direction) const
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto it = wisdom_.find({n, direction});
+    return it == wisdom_.end() ? FFTAlgorithm::Auto : it->second;
+}
+
+void FFTPlanCache::saveWisdom(const std::string& path) const
+{
+    std::ostringstream text;
+    text << kWisdomHeader << '\n';
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (const auto& [key, algo] : wisdom_)
+            text << key.first << ' ' << directionName(key.second) << ' '
+                 << algorithmName(algo) << '\n';
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    out << text.str();
+    out.flush();
+    if (!out)
+        throw std::runtime_error("FFTPlanCache::saveWisdom: cannot write '" + path + "'");
+}
+
+bool FFTPlanCache::loadWisdom(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::string line;
+    if (!std::getline(in, line) || line != kWisdomHeader)
+        throw std::runtime_error("FFTPlanCache::loadWisdom: '" + path
+                                 + "' is not an FFT wisdom file");
+
+    // Parse everything first so a bad file leaves the wisdom untouched.
+    std::map<std::pair<size_t, FFTDirection>, FFTAlgorithm> loaded;
+    for (size_t lineNo = 2; std::getline(in, line); ++lineNo) {
+        if (line.empty()) continue;
+        std::istringstream fields(line);
+        size_t       n = 0;
+        std::string  dir, algo, extra;
+        FFTDirection d;
+        FFTAlgorithm a;
+        if (!(fields >> n >> dir >> algo) || (fields >> extra) || n == 0
+            || !parseDirection(dir, d) || !parseAlgorithm(algo, a))
+            throw std::runtime_error("FFTPlanCache::loadWisdom: malformed line "
+                                     + std::to_string(lineNo) + " in '" + path + "'");
+        // A choice the CPU backend cannot plan for this N (a hand-edited
+        // file, or one written by another build) is dropped rather than
+        // left to make every later plan for N throw.
+        if (!CPUBackend::supports(n, a)) continue;
+        loaded[{n, d}] = a;
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    for (const auto& [key, algo] : loaded) wisdom_[key] = algo;
+    return true;
+}
+
+void FFTPlanCache::forgetWisdom()
+{
+    std::lock_guard<std::mutex> lk(mutex_);
+    wisdom_.clear();
+}
+
+} // namespace SharedMath::DSP
@@ -5,6 +5,7 @@
 
 #include "DSP/FilterResponse.h"
 #include "DSP/FFT.h"
+#include "DSP/RealFFTPlan.h"
 
 #include <cmath>
 #include <complex>
@@ -27,11 +28,11 @@ std::vector<std::complex<double>> frequencyResponseFIR(
     size_t n = 1;
     while (n < nfft || n < h.size()) n <<= 1;
 
-    std::vector<std::complex<double>> H(n, {0.0, 0.0});
-    for (size_t i = 0; i < h.size(); ++i) H[i] = h[i];
+    std::vector<double> padded(n, 0.0);
+    std::copy(h.begin(), h.end(), padded.begin());
 
-    FFTPlan::create(n, {FFTDirection::Forward, FFTNorm::None}).execute(H);
-    H.resize(n / 2 + 1);
+    std::vector<std::complex<double>> H;
+    RealFFTPlan::cached(n).execute(padded, H);
     return H;
 }
 
@@ -95,16 +96,17 @@ std::vector<double> groupDelayFIR(
     size_t n = 1;
     while (n < nfft || n < h.size()) n <<= 1;
 
-    std::vector<std::complex<double>> H(n, {0.0, 0.0});
-    std::vector<std::complex<double>> Z(n, {0.0, 0.0});  // DFT of {i·h[i]}
+    std::vector<double> hp(n, 0.0);
+    std::vector<double> zp(n, 0.0);                    // {i·h[i]}
     for (size_t i = 0; i < h.size(); ++i) {
-        H[i] = h[i];
-        Z[i] = static_cast<double>(i) * h[i];
+        hp[i] = h[i];
+        zp[i] = static_cast<double>(i) * h[i];
     }
 
-    auto plan = FFTPlan::create(n, {FFTDirection::Forward, FFTNorm::None});
-    plan.execute(H);
-    plan.execute(Z);
+    const auto plan = RealFFTPlan::cached(n);
+    std::vector<std::complex<double>> H, Z;
+    plan.execute(hp, H);
+    plan.execute(zp, Z);
 
     size_t m = n / 2 + 1;
     std::vector<double> gd(m);
@@ -64,7 +64,7 @@ double estimateFrequencyOffsetFromPeak(
     for (size_t i = 0; i < winLen; ++i)
         frame[i] = iq[i] * win[i];
 
-    FFTPlan::create(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
+    FFTPlan::cached(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
 
     // Find peak bin index (unshifted FFT output)
     size_t peakBin = 0;
@@ -5,6 +5,7 @@
 
 #include "Hilbert.h"
 #include "FFTPlan.h"
+#include "RealFFTPlan.h"
 #include "FFTConfig.h"
 
 #include <cmath>
@@ -40,24 +41,22 @@ std::vector<std::complex<double>> analyticSignal(const std::vector<double>& x)
     if (x.empty()) return {};
     size_t N = x.size();
 
-    std::vector<std::complex<double>> X(N);
-    for (size_t i = 0; i < N; ++i) X[i] = x[i];
-
-    FFTPlan::create(N).execute(X);
+    // Only bins 0..N/2 survive, so the real-input transform writes them
+    // straight into X and the negative-frequency half stays zero.
+    std::vector<std::complex<double>> X(N, {0.0, 0.0});
+    RealFFTPlan::cached(N).execute(x.data(), X.data());
 
     if (N > 1) {
         if (N % 2 == 0) {
-            // Even N: DC at 0, Nyquist at N/2 — keep both; double 1..N/2-1; zero N/2+1..N-1
-            for (size_t k = 1;         k < N / 2;      ++k) X[k] *= 2.0;
-            for (size_t k = N / 2 + 1; k < N;          ++k) X[k]  = 0.0;
+            // Even N: DC at 0, Nyquist at N/2 — keep both; double 1..N/2-1
+            for (size_t k = 1; k < N / 2; ++k) X[k] *= 2.0;
         } else {
-            // Odd N: DC at 0 — keep; double 1..(N-1)/2; zero (N+1)/2..N-1
-            for (size_t k = 1;           k <= (N - 1) / 2; ++k) X[k] *= 2.0;
-            for (size_t k = (N + 1) / 2; k < N;            ++k) X[k]  = 0.0;
+            // Odd N: DC at 0 — keep; double 1..(N-1)/2
+            for (size_t k = 1; k <= (N - 1) / 2; ++k) X[k] *= 2.0;
         }
     }
 
-    FFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::ByN}).execute(X);
+    FFTPlan::cached(N, {FFTDirection::Inverse, FFTNorm::ByN}).execute(X);
     return X;
 }
 
@@ -0,0 +1,168 @@
+/**
+ * @file RealFFTPlan.cpp
+ * @brief Real-input / real-output FFT via a half-length complex transform.
+ */
+
+#include "RealFFTPlan.h"
+#include "FFTPlanCache.h"
+
+#include "core/Memory.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace SharedMath::DSP {
+
+namespace {
+
+constexpr double DSP_PI = 3.14159265358979323846;
+
+double normScale(FFTNorm norm, size_t n)
+{
+    if (norm == FFTNorm::ByN)     return 1.0 / static_cast<double>(n);
+    if (norm == FFTNorm::BySqrtN) return 1.0 / std::sqrt(static_cast<double>(n));
+    return 1.0;
+}
+
+} // namespace
+
+struct RealFFTPlan::Twiddles {
+    std::vector<std::complex<double>> w;      // W^k = e^{−2πik/N}, k = 0..N/4
+};
+
+// ── Factory ───────────────────────────────────────────────────────────
+
+RealFFTPlan::RealFFTPlan(size_t n, FFTConfig cfg, FFTPlan inner)
+    : n_(n), cfg_(cfg), inner_(std::move(inner)), scale_(normScale(cfg.norm, n))
+{
+    if (n % 2 == 0) {
+        auto tw = std::make_shared<Twiddles>();
+        tw->w.resize(n / 4 + 1);
+        for (size_t k = 0; k < tw->w.size(); ++k) {
+            const double a = -2.0 * DSP_PI * static_cast<double>(k) / static_cast<double>(n);
+            tw->w[k] = {std::cos(a), std::sin(a)};
+        }
+        tw_ = std::move(tw);
+    }
+}
+
+RealFFTPlan RealFFTPlan::create(size_t n, FFTConfig cfg)
+{
+    if (n == 0)
+        throw std::invalid_argument("RealFFTPlan: transform size must be > 0");
+    const size_t inner = (n % 2 == 0) ? n / 2 : n;
+    return RealFFTPlan(n, cfg, FFTPlan::create(inner, {cfg.direction, FFTNorm::None,
+                                                       cfg.algorithm}));
+}
+
+RealFFTPlan RealFFTPlan::cached(size_t n, FFTConfig cfg)
+{
+    return FFTPlanCache::global().getReal(n, cfg);
+}
+
+/// ── Execution ─────────────────────────────────────────────────────────
+
+void RealFFTPlan::execute(const double* in, std::complex<double>* out) const
+{
+    if (isInverse())
+        throw std::logic_error("RealFFTPlan::execute: real input needs a forward plan");
+
+    if (n_ % 2 != 0) {
+        // Odd N: full complex transform, keep the first N/2+1 bins.
+        Core::ArenaScope scratch;
+        Core::ScratchVector<std::complex<double>> full(n_);
+        for (size_t i = 0; i < n_; ++i) full[i] = in[i];
+        inner_.execute(full.data());
+        for (size_t k = 0; k < bins(); ++k) out[k] = full[k] * scale_;
+        return;
+    }
+
+    // Pack z[m] = x[2m] + i·x[2m+1] into out[0..h) and transform in place.
+    const size_t h = n_ / 2;
+    for (size_t m = 0; m < h; ++m) out[m] = {in[2 * m], in[2 * m + 1]};
+    inner_.execute(out);
+
+    // Split: with A = Z[k], B = conj(Z[h−k]),
+    //   Fe = (A + B)/2,  Fo = −i(A − B)/2,  t = W^k·Fo
+    //   X[k] = Fe + t,   X[h−k] = conj(Fe − t)
+    const auto& w = tw_->w;
+    const double half = 0.5 * scale_;
+    const std::complex<double> z0 = out[0];
+    out[0] = {(z0.real() + z0.imag()) * scale_, 0.0};
+    out[h] = {(z0.real() - z0.imag()) * scale_, 0.0};
+    for (size_t k = 1, j = h - 1; k <= j; ++k, --j) {
+        const std::complex<double> a = out[k];
+        const std::complex<double> b = std::conj(out[j]);
+        const std::complex<double> fe = (a + b) * half;
+        const std::complex<double> d  = (a - b) * half;
+        const std::complex<double> fo{d.imag(), -d.real()};
+        const std::complex<double> t  = w[k] * fo;
+        out[j] = std::conj(fe - t);
+        out[k] = fe + t;
+    }
+}
+
+void RealFFTPlan::execute(const std::complex<double>* in, double* out) const
+{
+    if (!isInverse())
+        throw std::logic_error("RealFFTPlan::execute: complex input needs an inverse plan");
+
+    if (n_ % 2 != 0) {
+        // Odd N: rebuild the Hermitian spectrum and run the full transform.
+        Core::ArenaScope scratch;
+        Core::ScratchVector<std::complex<double>> full(n_);
+        full[0] = in[0].real();
+        for (size_t k = 1; k < bins(); ++k) {
+            full[k]      = in[k];
+            full[n_ - k] = std::conj(in[k]);
+        }
+        inner_.execute(full.data());
+        for (size_t i = 0; i < n_; ++i) out[i] = full[i].real() * scale_;
+        return;
+    }
+
+    // Merge: with A = X[k], B = conj(X[h−k]),
+    //   Fe = A + B,  Fo = (A − B)·conj(W^k)
+    //   Z[k] = Fe + i·Fo,  Z[h−k] = conj(Fe − i·Fo)
+    // then z = IDFT_h(Z) holds N·(x[2m] + i·x[2m+1]).
+    const size_t h = n_ / 2;
+    auto* z = reinterpret_cast<std::complex<double>*>(out);
+    const auto& w = tw_->w;
+    const double x0 = in[0].real(), xh = in[h].real();
+    z[0] = {(x0 + xh) * scale_, (x0 - xh) * scale_};
+    for (size_t k = 1, j = h - 1; k <= j; ++k, --j) {
+        const std::complex<double> a = in[k];
+        const std::complex<double> b = std::conj(in[j]);
+        const std::complex<double> fe = (a + b) * scale_;
+        const std::complex<double> fo = (a - b) * std::conj(w[k]) * scale_;
+        const std::complex<double> ifo{-fo.imag(), fo.real()};
+        z[k] = fe + ifo;
+        if (j != k) z[j] = std::conj(fe - ifo);
+    }
+    inner_.execute(z);
+}
+
+void RealFFTPlan::execute(const std::vector<double>& in,
+                          std::vector<std::complex<double>>& out) const
+{
+    if (in.size() != n_)
+        throw std::invalid_argument(
+            "RealFFTPlan::execute: input size (" + std::to_string(in.size()) +
+            ") does not match plan size (" + std::to_string(n_) + ")");
+    out.resize(bins());
+    execute(in.data(), out.data());
+}
+
+void RealFFTPlan::execute(const std::vector<std::complex<double>>& in,
+                          std::vector<double>& out) const
+{
+    if (in.size() != bins())
+        throw std::invalid_argument(
+            "RealFFTPlan::execute: input size (" + std::to_string(in.size()) +
+            ") does not match bin count (" + std::to_string(bins()) + ")");
+    out.resize(n_);
+    execute(in.data(), out.data());
+}
+
+} // namespace SharedMath::DSP
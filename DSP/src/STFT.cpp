@@ -4,11 +4,13 @@
  */
 
 #include "STFT.h"
-#include "FFTPlan.h"
+#include "RealFFTPlan.h"
 #include "FFTConfig.h"
 #include "FFT.h"
 #include "Window.h"
 
+#include "core/ThreadPool.h"
+
 #include <complex>
 #include <vector>
 #include <cmath>
@@ -62,19 +64,23 @@ STFTResult stft(
     size_t numFrames = 1 + (signal.size() - fftSize) / hopSize;
     result.frames.resize(numFrames);
 
-    auto fwdPlan   = FFTPlan::create(fftSize);
+    auto fwdPlan   = RealFFTPlan::cached(fftSize);
     size_t halfBins = fftSize / 2 + 1;
 
-    std::vector<std::complex<double>> frame(fftSize);
-
-    for (size_t i = 0; i < numFrames; ++i) {
-        size_t start = i * hopSize;
-        for (size_t k = 0; k < fftSize; ++k)
-            frame[k] = signal[start + k] * window[k];
-
-        fwdPlan.execute(frame);
-        result.frames[i].assign(frame.begin(), frame.begin() + halfBins);
-    }
+    // Frames are independent and FFTPlan::execute is const, so the batch of
+    // frame transforms is split across the shared thread pool.
+    size_t grain = std::max<size_t>(1, 16384 / fftSize);
+    Core::parallel_for(0, numFrames, grain, [&](size_t lo, size_t hi) {
+        std::vector<double> frame(fftSize);
+        for (size_t i = lo; i < hi; ++i) {
+            size_t start = i * hopSize;
+            for (size_t k = 0; k < fftSize; ++k)
+                frame[k] = signal[start + k] * window[k];
+
+            result.frames[i].resize(halfBins);
+            fwdPlan.execute(frame.data(), result.frames[i].data());
+        }
+    });
 
     return result;
 }
@@ -106,31 +112,27 @@ std::vector<double> istft(const STFTResult& result) {
     const auto& win  = result.window;
 
     size_t outLen  = (numFrames - 1) * hopSize + fftSize;
-    size_t lastPair = (fftSize % 2 == 0) ? (fftSize / 2 - 1)
-                                          : ((fftSize - 1) / 2);
     size_t halfBins = fftSize / 2 + 1;
 
     std::vector<double> output(outLen, 0.0);
     std::vector<double> norm(outLen, 0.0);
 
-    auto invPlan = FFTPlan::create(fftSize, {FFTDirection::Inverse, FFTNorm::ByN});
-    std::vector<std::complex<double>> full(fftSize);
+    auto invPlan = RealFFTPlan::cached(fftSize, {FFTDirection::Inverse, FFTNorm::ByN});
+    std::vector<std::complex<double>> bins(halfBins);
+    std::vector<double> frame(fftSize);
 
     for (size_t i = 0; i < numFrames; ++i) {
         const auto& half = result.frames[i];
 
-        // Reconstruct full Hermitian spectrum
-        std::fill(full.begin(), full.end(), std::complex<double>{0.0, 0.0});
-        for (size_t k = 0; k < halfBins && k < half.size(); ++k)
-            full[k] = half[k];
-        for (size_t k = 1; k <= lastPair; ++k)
-            full[fftSize - k] = std::conj(half[k]);
+        // Half spectrum in, real frame out (missing bins are zero)
+        std::fill(bins.begin(), bins.end(), std::complex<double>{0.0, 0.0});
+        std::copy_n(half.begin(), std::min(half.size(), halfBins), bins.begin());
 
-        invPlan.execute(full);
+        invPlan.execute(bins.data(), frame.data());
 
         size_t start = i * hopSize;
         for (size_t k = 0; k < fftSize; ++k) {
-            output[start + k] += full[k].real();
+            output[start + k] += frame[k];
             norm[start + k]   += win[k];
         }
     }
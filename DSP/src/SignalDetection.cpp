@@ -185,19 +185,25 @@ DetectionResult detectSpectral(
 
     // ── Accumulate two-sided power spectrum ───────────────────────────────────
     std::vector<double> psdAccum(M, 0.0);
-    size_t numFrames = 0;
-
-    for (size_t s = 0; s + M <= N; s += step) {
-        std::vector<std::complex<double>> frame(M);
-        for (size_t i = 0; i < M; ++i)
-            frame[i] = iq[s + i] * win[i];
-
-        FFTPlan::create(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
+    const size_t numFrames = (N >= M) ? (N - M) / step + 1 : 0;
+
+    // Windowed frames are transformed in batches of up to kBatchFrames.
+    constexpr size_t kBatchFrames = 64;
+    const auto plan = FFTPlan::cached(M, {FFTDirection::Forward, FFTNorm::None});
+    std::vector<std::complex<double>> block(std::min(numFrames, kBatchFrames) * M);
+    for (size_t f0 = 0; f0 < numFrames; f0 += kBatchFrames) {
+        const size_t count = std::min(kBatchFrames, numFrames - f0);
+        for (size_t f = 0; f < count; ++f) {
+            const size_t s = (f0 + f) * step;
+            for (size_t i = 0; i < M; ++i)
+                block[f * M + i] = iq[s + i] * win[i];
+        }
 
-        for (size_t k = 0; k < M; ++k)
-            psdAccum[k] += std::norm(frame[k]);
+        plan.executeBatch(block.data(), count);
 
-        ++numFrames;
+        for (size_t f = 0; f < count; ++f)
+            for (size_t k = 0; k < M; ++k)
+                psdAccum[k] += std::norm(block[f * M + k]);
     }
 
     if (numFrames == 0) return result;
@@ -332,13 +338,13 @@ DetectionResult detectMatchedFilter(
     for (size_t i = 0; i < Lb; ++i) B[i] = reference[i];
 
     {
-        auto fwd = FFTPlan::create(fftN, {FFTDirection::Forward, FFTNorm::None});
+        auto fwd = FFTPlan::cached(fftN, {FFTDirection::Forward, FFTNorm::None});
         fwd.execute(A);
         fwd.execute(B);
     }
 
     for (size_t i = 0; i < fftN; ++i) A[i] = std::conj(B[i]) * A[i];
-    FFTPlan::create(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A);
+    FFTPlan::cached(fftN, {FFTDirection::Inverse, FFTNorm::ByN}).execute(A);
 
     double refEnergy = 0.0;
     for (const auto& s : reference) refEnergy += std::norm(s);
@@ -105,7 +105,7 @@ double estimateSnrDb(
     for (size_t i = 0; i < winLen; ++i)
         frame[i] = iq[i] * win[i];
 
-    FFTPlan::create(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
+    FFTPlan::cached(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
 
     const double scale = 1.0 / std::max(winSumSq, 1e-300);
     std::vector<double> pwrDb(M);
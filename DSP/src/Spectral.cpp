@@ -4,7 +4,8 @@
  */
 
 #include "Spectral.h"
-#include "FFT.h"    // rfftFrequencies, FFTPlan, FFTDirection, FFTNorm
+#include "FFT.h"    // rfftFrequencies, FFTDirection, FFTNorm
+#include "RealFFTPlan.h"
 #include "Window.h" // makeWindow, WindowParams
 
 #include <cmath>
@@ -39,10 +40,11 @@ SpectralResult periodogram(
     for (double w : win) { winSumSq += w * w; winSum += w; }
 
     // Zero-pad windowed signal
-    std::vector<std::complex<double>> cx(Nfft, {0.0, 0.0});
-    for (size_t i = 0; i < N; ++i) cx[i] = signal[i] * win[i];
+    std::vector<double> frame(Nfft, 0.0);
+    for (size_t i = 0; i < N; ++i) frame[i] = signal[i] * win[i];
 
-    FFTPlan::create(Nfft, {FFTDirection::Forward, FFTNorm::None}).execute(cx);
+    std::vector<std::complex<double>> cx;
+    RealFFTPlan::cached(Nfft).execute(frame, cx);
 
     size_t m = Nfft / 2 + 1;
     double scale = (scaling == PSDScaling::Density)
@@ -92,11 +94,13 @@ SpectralResult welchPSD(
     std::vector<double> psdAccum(m, 0.0);
     size_t numFrames = 0;
 
+    const auto plan = RealFFTPlan::cached(Nfft);
+    std::vector<double> frame(Nfft, 0.0);          // tail stays zero-padded
+    std::vector<std::complex<double>> cx(m);
     for (size_t start = 0; start + frameSize <= signal.size(); start += hopSize) {
-        std::vector<std::complex<double>> cx(Nfft, {0.0, 0.0});
         for (size_t i = 0; i < frameSize; ++i)
-            cx[i] = signal[start + i] * win[i];
-        FFTPlan::create(Nfft, {FFTDirection::Forward, FFTNorm::None}).execute(cx);
+            frame[i] = signal[start + i] * win[i];
+        plan.execute(frame.data(), cx.data());
         for (size_t k = 0; k < m; ++k)
             psdAccum[k] += std::norm(cx[k]);
         ++numFrames;
@@ -172,16 +176,16 @@ CrossSpectralResult crossPowerSpectralDensity(
     std::vector<std::complex<double>> cpsdAccum(m, {0.0, 0.0});
     size_t numFrames = 0;
 
+    const auto plan = RealFFTPlan::cached(Nfft);
+    std::vector<double> fx(Nfft, 0.0), fy(Nfft, 0.0);   // tails stay zero-padded
+    std::vector<std::complex<double>> cx(m), cy(m);
     for (size_t start = 0; start + frameSize <= x.size(); start += hopSize) {
-        std::vector<std::complex<double>> cx(Nfft, {0.0, 0.0});
-        std::vector<std::complex<double>> cy(Nfft, {0.0, 0.0});
         for (size_t i = 0; i < frameSize; ++i) {
-            cx[i] = x[start + i] * win[i];
-            cy[i] = y[start + i] * win[i];
+            fx[i] = x[start + i] * win[i];
+            fy[i] = y[start + i] * win[i];
         }
-        auto plan = FFTPlan::create(Nfft, {FFTDirection::Forward, FFTNorm::None});
-        plan.execute(cx);
-        plan.execute(cy);
+        plan.execute(fx.data(), cx.data());
+        plan.execute(fy.data(), cy.data());
         for (size_t k = 0; k < m; ++k)
             cpsdAccum[k] += std::conj(cx[k]) * cy[k];
         ++numFrames;
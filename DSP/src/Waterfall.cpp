@@ -63,26 +63,37 @@ WaterfallResult computeWaterfall(
     result.powerDb.reserve(numFrames);
     result.timeAxisSec.reserve(numFrames);
 
-    for (size_t s = 0; s + M <= N; s += step) {
-        std::vector<std::complex<double>> frame(M);
-        for (size_t i = 0; i < M; ++i)
-            frame[i] = iq[s + i] * win[i];
-
-        FFTPlan::create(M, {FFTDirection::Forward, FFTNorm::None}).execute(frame);
-
-        std::vector<double> row(M);
-        if (params.centered) {
-            for (size_t k = 0; k < M; ++k)
-                row[(k + M / 2) % M] =
-                    10.0 * std::log10(std::max(std::norm(frame[k]) * scale, 1e-300));
-        } else {
-            for (size_t k = 0; k < M; ++k)
-                row[k] = 10.0 * std::log10(std::max(std::norm(frame[k]) * scale, 1e-300));
+    // Windowed frames are transformed in batches of up to kBatchFrames.
+    constexpr size_t kBatchFrames = 64;
+    const auto plan = FFTPlan::cached(M, {FFTDirection::Forward, FFTNorm::None});
+    std::vector<std::complex<double>> block(std::min(numFrames, kBatchFrames) * M);
+    for (size_t f0 = 0; f0 < numFrames; f0 += kBatchFrames) {
+        const size_t count = std::min(kBatchFrames, numFrames - f0);
+        for (size_t f = 0; f < count; ++f) {
+            const size_t s = (f0 + f) * step;
+            for (size_t i = 0; i < M; ++i)
+                block[f * M + i] = iq[s + i] * win[i];
         }
-        result.powerDb.push_back(std::move(row));
 
-        // Centre time of this frame
-        result.timeAxisSec.push_back(static_cast<double>(s + M / 2) / fs);
+        plan.executeBatch(block.data(), count);
+
+        for (size_t f = 0; f < count; ++f) {
+            const std::complex<double>* frame = block.data() + f * M;
+            std::vector<double> row(M);
+            if (params.centered) {
+                for (size_t k = 0; k < M; ++k)
+                    row[(k + M / 2) % M] =
+                        10.0 * std::log10(std::max(std::norm(frame[k]) * scale, 1e-300));
+            } else {
+                for (size_t k = 0; k < M; ++k)
+                    row[k] = 10.0 * std::log10(std::max(std::norm(frame[k]) * scale, 1e-300));
+            }
+            result.powerDb.push_back(std::move(row));
+
+            // Centre time of this frame
+            const size_t s = (f0 + f) * step;
+            result.timeAxisSec.push_back(static_cast<double>(s + M / 2) / fs);
+        }
     }
 
     return result;
@@ -9,7 +9,9 @@ namespace SharedMath::LinearAlgebra {
 /// can operate on any concrete implementation (DynamicMatrix, Matrix<R,C>, …).
 class AbstractMatrix {
 public:
-    virtual ~AbstractMatrix() = default;
+    // Empty body rather than `= default`: GCC 12 rejects a defaulted virtual
+    // destructor during constant evaluation, which constexpr Matrix<R,C> needs.
+    constexpr virtual ~AbstractMatrix() {}
 
     virtual size_t rows() const = 0;
     virtual size_t cols() const = 0;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "ComplexMatrix.h"
+#include "ComplexSparseMatrix.h"
+#include "ComplexVector.h"
+#include "SparseOrdering.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Dense complex LU with partial pivoting: P·A = L·U.
+///
+/// Usage (AC analysis, Y·V = I):
+///   ComplexLU lu(Y);
+///   ComplexVector V = lu.solve(I);
+///
+/// The factorization is blocked; the trailing updates run as four real
+/// GEMMs on split real / imaginary panels, so the cost is that of one
+/// complex n×n LU rather than of the 2n×2n real embedding.
+/// Throws std::invalid_argument for a non-square A and std::runtime_error
+/// when A is singular.
+class SHAREDMATH_LINEARALGEBRA_EXPORT ComplexLU {
+public:
+    explicit ComplexLU(const ComplexMatrix& A);
+
+    /// Solve A·x = b
+    ComplexVector solve(const ComplexVector& b) const;
+
+    /// Solve A·X = B (multiple right-hand sides)
+    ComplexMatrix solve(const ComplexMatrix& B) const;
+
+    ComplexMatrix inverse() const;
+    Complex       determinant() const;
+
+    size_t size() const noexcept { return LU_.rows(); }
+
+private:
+    ComplexMatrix LU_;          // unit L below the diagonal, U on and above
+    std::vector<size_t> piv_;   // row k was swapped with row piv_[k]
+    int piv_sign_ = 1;
+};
+
+/// Sparse complex LU for square ComplexSparseMatrix systems:
+///   P·A·Q = L·U,  Q a fill-reducing column order, P from pivoting.
+///
+/// Construction runs the symbolic analysis (AMD ordering on A + Aᵀ) and a
+/// left-looking Gilbert–Peierls factorization with threshold partial
+/// pivoting that prefers the diagonal, as in KLU.
+///
+/// refactor() reuses the ordering, the pivot sequence and the L / U
+/// patterns for a matrix with the same pattern and only recomputes values,
+/// so an AC sweep is one analysis plus one numeric pass per frequency:
+///
+///   SparseComplexLU lu(Y(ω0));
+///   for (double w : omegas) { lu.refactor(Y(w)); V = lu.solve(I); }
+///
+/// If a reused pivot fails the threshold test for the new values, that
+/// refactor() falls back to a pivoting factorization with the same
+/// ordering.
+class SHAREDMATH_LINEARALGEBRA_EXPORT SparseComplexLU {
+public:
+    /// pivot_tol ∈ (0, 1]: the diagonal is kept as pivot while
+    /// |a_kk| >= pivot_tol · max_i |a_ik|.
+    explicit SparseComplexLU(const ComplexSparseMatrix& A,
+                             SparseOrdering ordering = SparseOrdering::AMD,
+                             double pivot_tol = 1e-3);
+
+    /// Numeric refactorization for a matrix with the same pattern.
+    /// Throws std::invalid_argument if the pattern differs.
+    void refactor(const ComplexSparseMatrix& A);
+
+    ComplexVector solve(const ComplexVector& b) const;
+    ComplexMatrix solve(const ComplexMatrix& B) const;
+
+    size_t size()  const noexcept { return n_; }
+    size_t nnz_L() const noexcept { return Li_.size(); }
+    size_t nnz_U() const noexcept { return Ui_.size(); }
+
+    /// Number of refactor() calls that had to pivot again.
+    size_t repivots() const noexcept { return repivots_; }
+
+private:
+    size_t n_ = 0;
+    double pivot_tol_;
+    size_t repivots_ = 0;
+
+    // Symbolic analysis: pattern of A, column order, CSC view of A.
+    std::vector<size_t> row_ptr_, col_idx_;
+    std::vector<size_t> q_;          // column k of the factor is column q_[k] of A
+    std::vector<size_t> cscPtr_, cscRow_, cscSrc_;   // cscSrc_: CSR position of each CSC entry
+
+    // Factors in CSC, row indices in pivoted order.  Each L column starts
+    // with its unit diagonal; each U column holds the off-diagonal entries
+    // in a topological order and ends with the pivot.
+    std::vector<size_t> pinv_;       // pinv_[i] = pivot position of row i
+    std::vector<size_t> Lp_, Li_, Up_, Ui_;
+    std::vector<Complex> Lx_, Ux_;
+
+    void factorize(const std::vector<Complex>& Ax);
+    bool refactorize(const std::vector<Complex>& Ax);
+    std::vector<Complex> cscValues(const ComplexSparseMatrix& A) const;
+};
+
+/// ── Free functions ───────────────────────────────────────────────────────
+
+/// Solve A·x = b via ComplexLU (A square and non-singular)
+SHAREDMATH_LINEARALGEBRA_EXPORT
+ComplexVector solve(const ComplexMatrix& A, const ComplexVector& b);
+
+/// Solve A·x = b via SparseComplexLU
+SHAREDMATH_LINEARALGEBRA_EXPORT
+ComplexVector solve(const ComplexSparseMatrix& A, const ComplexVector& b);
+
+/// A⁻¹ via ComplexLU
+SHAREDMATH_LINEARALGEBRA_EXPORT
+ComplexMatrix inv(const ComplexMatrix& A);
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ComplexMatrix.h"
+#include "ComplexVector.h"
+#include "SparseMatrix.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Complex sparse matrix in Compressed Sparse Row (CSR) format.
+///
+/// Same layout and invariants as SparseMatrix: row_ptr_[i] is the first
+/// entry of row i, columns ascend within a row, duplicate triplets are
+/// summed.
+///
+/// The pattern and the values are kept apart on purpose: for an AC sweep
+/// Y(ω) = G + jωC only values() changes between frequencies, which is what
+/// SparseComplexLU::refactor() expects.
+///
+class SHAREDMATH_LINEARALGEBRA_EXPORT ComplexSparseMatrix {
+public:
+    /// ── Construction ──────────────────────────────────────────────────────
+
+    /// Empty matrix with given dimensions (zero non-zeros)
+    ComplexSparseMatrix(size_t rows, size_t cols);
+
+    /// Build from COO triplets.  Duplicate (i,j) entries are summed.
+    static ComplexSparseMatrix from_triplets(size_t rows, size_t cols,
+                                             const std::vector<size_t>& row_idx,
+                                             const std::vector<size_t>& col_idx,
+                                             const std::vector<Complex>& values);
+
+    /// Adopt ready-made CSR arrays.  Column indices must be strictly
+    /// ascending within each row; throws std::invalid_argument otherwise.
+    static ComplexSparseMatrix from_csr(size_t rows, size_t cols,
+                                        std::vector<size_t> row_ptr,
+                                        std::vector<size_t> col_idx,
+                                        std::vector<Complex> values);
+
+    /// Convert a dense matrix (drop entries with |v| <= tol).
+    static ComplexSparseMatrix from_dense(const ComplexMatrix& A, double tol = 0.0);
+
+    /// re + j·im on the union of both patterns (im may be empty of entries).
+    static ComplexSparseMatrix from_parts(const SparseMatrix& re, const SparseMatrix& im);
+
+    /// ── Shape / storage ───────────────────────────────────────────────────
+    size_t rows()     const noexcept { return rows_; }
+    size_t cols()     const noexcept { return cols_; }
+    size_t nnz()      const noexcept { return values_.size(); }
+    bool   isSquare() const noexcept { return rows_ == cols_; }
+
+    const std::vector<size_t>&  row_ptr()     const noexcept { return row_ptr_; }
+    const std::vector<size_t>&  col_indices() const noexcept { return col_idx_; }
+    const std::vector<Complex>& values()      const noexcept { return values_; }
+    /// Writable values on the fixed pattern.
+    std::vector<Complex>&       values()            noexcept { return values_; }
+
+    /// True when both matrices have identical shape and CSR pattern.
+    bool same_pattern(const ComplexSparseMatrix& o) const noexcept;
+
+    /// Entry (r, c); zero outside the pattern.
+    Complex get(size_t r, size_t c) const;
+
+    /// ── Arithmetic ────────────────────────────────────────────────────────
+
+    /// y = A * x
+    ComplexVector operator*(const ComplexVector& x) const;
+
+    /// y = A * x into a caller-owned y of size rows() (no allocation)
+    void multiply(const std::vector<Complex>& x, std::vector<Complex>& y) const;
+
+    ComplexSparseMatrix operator*(Complex s) const;
+    friend ComplexSparseMatrix operator*(Complex s, const ComplexSparseMatrix& m) { return m * s; }
+
+    /// ── Conversion ────────────────────────────────────────────────────────
+    ComplexMatrix to_dense() const;
+
+private:
+    size_t rows_ = 0;
+    size_t cols_ = 0;
+    std::vector<Complex> values_;
+    std::vector<size_t>  col_idx_;
+    std::vector<size_t>  row_ptr_;
+};
+
+} // namespace SharedMath::LinearAlgebra
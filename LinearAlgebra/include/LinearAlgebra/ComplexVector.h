@@ -16,6 +16,8 @@ namespace SharedMath::LinearAlgebra {
 
 using Complex = std::complex<double>;
 
+class ComplexMatrix;
+
 /// Heap-allocated dense complex vector.
 /// Complements ComplexMatrix: supports the same arithmetic patterns and
 /// provides first-class matrix–vector multiply as free functions.
@@ -176,4 +178,10 @@ private:
     }
 };
 
+/// ── Free functions ───────────────────────────────────────────────────────
+
+/// y = A * x
+SHAREDMATH_LINEARALGEBRA_EXPORT
+ComplexVector matvec(const ComplexMatrix& A, const ComplexVector& x);
+
 } // namespace SharedMath::LinearAlgebra
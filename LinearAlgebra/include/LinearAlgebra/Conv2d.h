@@ -0,0 +1,83 @@
+#pragma once
+
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstddef>
+
+namespace SharedMath::LinearAlgebra {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// 2-D convolution kernels on raw row-major NCHW buffers
+///
+///   x   [N, C, H, W]                input
+///   w   [OC, C / groups, KH, KW]    weight
+///   y   [N, OC, OH, OW]             output
+///
+///   OH = (H + 2·padding − dilation·(KH − 1) − 1) / stride + 1   (OW likewise)
+///
+/// As in the deep-learning frameworks the operation is a cross-correlation
+/// (the kernel is not flipped).  Input and output channels are split into
+/// `groups` equal groups; output group g only sees input group g.
+///
+/// These are the CPU kernels behind Tensor::conv2d and its backward passes:
+///
+///   Im2col     each image (and group) is unfolded into a (C/groups·KH·KW)
+///              × (OH·OW) column matrix and multiplied by the weight with
+///              gemm().  Handles every geometry; 1×1 stride-1 convolutions
+///              use the input in place.
+///   Winograd   F(2×2, 3×3) for 3×3, stride 1, dilation 1, groups 1: every
+///              2×2 output tile costs 16 multiplies per channel pair instead
+///              of 36, done as 16 GEMMs of (OC × C)·(C × tiles).
+///   Depthwise  groups == C == OC: a direct kernel over blocks of 8 channels
+///              interleaved in the innermost dimension (NCHWc), so the inner
+///              loop runs across channels.
+///   Direct     reference loops, for testing.
+/// ─────────────────────────────────────────────────────────────────────────────
+
+/// Geometry of one convolution.  stride, padding and dilation apply to
+/// both spatial axes.
+struct Conv2dShape {
+    size_t N = 1, C = 1, H = 1, W = 1;      // input
+    size_t OC = 1, KH = 1, KW = 1;          // weight
+    size_t stride = 1, padding = 0, dilation = 1, groups = 1;
+
+    size_t outH() const noexcept { return (H + 2 * padding - dilation * (KH - 1) - 1) / stride + 1; }
+    size_t outW() const noexcept { return (W + 2 * padding - dilation * (KW - 1) - 1) / stride + 1; }
+
+    /// Throws std::invalid_argument, prefixed with `who`, when a size is zero,
+    /// the channels do not split into `groups`, or the dilated kernel is
+    /// larger than the padded input.
+    void validate(const char* who) const;
+};
+
+enum class ConvAlgorithm {
+    Auto,
+    Direct,
+    Im2col,
+    Winograd,
+    Depthwise
+};
+
+/// The algorithm conv2d() runs for `s` under ConvAlgorithm::Auto.
+SHAREDMATH_LINEARALGEBRA_EXPORT ConvAlgorithm conv2dAlgorithm(const Conv2dShape& s) noexcept;
+
+/// y = conv(x, w) + bias; bias (OC entries) may be null and y is
+/// overwritten.  Throws std::invalid_argument if `algo` cannot handle `s`.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void conv2d(const Conv2dShape& s, const double* x, const double* w,
+            const double* bias, double* y, ConvAlgorithm algo = ConvAlgorithm::Auto);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void conv2d(const Conv2dShape& s, const float* x, const float* w,
+            const float* bias, float* y, ConvAlgorithm algo = ConvAlgorithm::Auto);
+
+/// dx = ∂L/∂x from dy = ∂L/∂y; dx is overwritten.  Stride-1 convolutions
+/// run as the forward convolution of dy with the flipped, transposed
+/// weight (so 3×3 kernels get Winograd too); the rest is gemm() + col2im.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void conv2dBackwardInput(const Conv2dShape& s, const double* dy, const double* w, double* dx);
+
+/// dw = ∂L/∂w from dy and the forward input x; dw is overwritten.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void conv2dBackwardWeight(const Conv2dShape& s, const double* dy, const double* x, double* dw);
+
+} // namespace SharedMath::LinearAlgebra
@@ -2,6 +2,7 @@
 
 #include "MatrixOperationsStrategy.h"
 #include "DynamicMatrix.h"
+#include "Gemm.h"
 
 namespace SharedMath::LinearAlgebra {
 
@@ -68,16 +69,22 @@ public:
         if (!isSupported(*A, *B))
             throw std::invalid_argument("MatrixMultiplyStrategy: inner dimensions mismatch");
 
-        // Fast path: both DynamicMatrix — uses cache-friendly i-k-j operator*
+        // Fast path: both DynamicMatrix — operator* runs the blocked GEMM
+        // kernel (or cuBLAS for GPU matrices) on the operands in place.
         auto* dA = dynamic_cast<DynamicMatrix*>(A.get());
         auto* dB = dynamic_cast<DynamicMatrix*>(B.get());
         if (dA && dB)
             return std::make_shared<DynamicMatrix>(*dA * *dB);
 
-        /// General path with cache-friendly i-k-j loop.
-        /// Copies A into a DynamicMatrix so inner-loop rows are contiguous.
+        /// General path: not every AbstractMatrix stores dense row-major data
+        /// behind toPtr() (e.g. SparseMatrix), so densify the operands first
+        /// and hand the contiguous buffers to gemm().
         DynamicMatrix cA(*A), cB(*B);
-        return std::make_shared<DynamicMatrix>(cA * cB);
+        auto result = std::make_shared<DynamicMatrix>(cA.rows(), cB.cols());
+        gemm(Transpose::No, Transpose::No, cA.rows(), cB.cols(), cA.cols(),
+             1.0, cA.toPtr(), cA.cols(), cB.toPtr(), cB.cols(),
+             0.0, result->toPtr(), result->cols());
+        return result;
     }
 
     bool isSupported(const AbstractMatrix& A, const AbstractMatrix& B) const override {
@@ -57,12 +57,13 @@ public:
     explicit DynamicMatrix(std::shared_ptr<AbstractMatrix> src)
         : DynamicMatrix(*src) {}
 
-    /// Construct from 2-D CPU Tensor (zero-copy move)
+    /// Construct from 2-D CPU Tensor (zero-copy move; Float32 data is widened)
     explicit DynamicMatrix(Tensor t) {
         if (t.ndim() != 2)
             throw std::invalid_argument(
                 "DynamicMatrix: Tensor must be 2-D, got ndim=" +
                 std::to_string(t.ndim()));
+        if (t.dtype() != TensorDType::Float64) t = t.astype(TensorDType::Float64);
         rows_ = t.dim(0);
         cols_ = t.dim(1);
         data_ = std::move(t.data());
@@ -172,16 +173,7 @@ public:
     DynamicMatrix  operator* (const DynamicMatrix& B) const;
 
     /// ── Transpose ─────────────────────────────────────────────────────────
-    DynamicMatrix transposed() const {
-        requireCPU("transposed");
-        DynamicMatrix T(cols_, rows_);
-        for (size_t i = 0; i < rows_; ++i) {
-            const double* Ai = row_ptr(i);
-            for (size_t j = 0; j < cols_; ++j)
-                T.at_unsafe(j, i) = Ai[j];
-        }
-        return T;
-    }
+    DynamicMatrix transposed() const;
 
     /// ── Utilities ─────────────────────────────────────────────────────────
     void clear()        noexcept { std::fill(data_.begin(), data_.end(), 0.0); }
@@ -209,6 +201,8 @@ public:
         if (t.ndim() != 2)
             throw std::invalid_argument(
                 "DynamicMatrix::fromTensor: Tensor must be 2-D");
+        if (t.dtype() != TensorDType::Float64)
+            return DynamicMatrix(t.dim(0), t.dim(1), t.astype(TensorDType::Float64).data());
         return DynamicMatrix(t.dim(0), t.dim(1), t.data());
     }
 
@@ -276,4 +270,29 @@ private:
     }
 };
 
+/// ── Out-parameter kernels ─────────────────────────────────────────────────────
+/// Each writes its result into `out` and returns it.  When `out` already has
+/// the result shape it is overwritten in place without allocating, so a loop
+/// that keeps its buffers runs allocation-free; otherwise `out` is replaced
+/// by a new matrix.  `out` may also be one of the operands.  Operands on the
+/// GPU go through the allocating operators.
+
+/// C = alpha * A * B + beta * C.  With beta != 0, C must already be
+/// rows(A) × cols(B).
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix& matmul_into(DynamicMatrix& C, const DynamicMatrix& A, const DynamicMatrix& B,
+                           double alpha = 1.0, double beta = 0.0);
+
+/// out = A + B, out = A - B, out = s * A
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix& add_into(DynamicMatrix& out, const DynamicMatrix& A, const DynamicMatrix& B);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix& sub_into(DynamicMatrix& out, const DynamicMatrix& A, const DynamicMatrix& B);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix& scale_into(DynamicMatrix& out, const DynamicMatrix& A, double s);
+
+/// out = Aᵀ (CPU only)
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix& transpose_into(DynamicMatrix& out, const DynamicMatrix& A);
+
 } // namespace SharedMath::LinearAlgebra
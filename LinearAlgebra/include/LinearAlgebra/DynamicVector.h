@@ -240,6 +240,16 @@ DynamicVector matvec(const DynamicMatrix& A, const DynamicVector& x);
 SHAREDMATH_LINEARALGEBRA_EXPORT
 DynamicVector rmatvec(const DynamicMatrix& A, const DynamicVector& x);
 
+/// y = alpha * A * x + beta * y and y = alpha * A^T * x + beta * y, written
+/// into y's own storage when it already has the result size (see
+/// matmul_into).  With beta != 0, y must already have that size.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicVector& matvec_into(DynamicVector& y, const DynamicMatrix& A, const DynamicVector& x,
+                           double alpha = 1.0, double beta = 0.0);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicVector& rmatvec_into(DynamicVector& y, const DynamicMatrix& A, const DynamicVector& x,
+                            double alpha = 1.0, double beta = 0.0);
+
 /// Outer product: u ⊗ v → DynamicMatrix (n×m)
 SHAREDMATH_LINEARALGEBRA_EXPORT
 DynamicMatrix outer(const DynamicVector& u, const DynamicVector& v);
@@ -0,0 +1,437 @@
+#pragma once
+
+#include "DynamicMatrix.h"
+#include "Tensor.h"
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// Lazy element-wise expressions
+///
+/// The arithmetic operators on Tensor and DynamicMatrix are eager: every
+/// operator allocates and fills a full temporary.  Wrapping the operands in
+/// lazy() instead builds an expression tree that is evaluated in a single
+/// pass into one output buffer:
+///
+///   Tensor step = ((lazy(mh) / (lazy(vh).sqrt() + eps)) * lr).eval();
+///
+///   DynamicMatrix D = (lazy(A) + lazy(B) * s - lazy(C)).eval();
+///
+///   assign(w, lazy(w) - lazy(g) * lr);        // in place, no allocation
+///
+/// Tensor operands broadcast with the usual NumPy rules; DynamicMatrix
+/// operands must all have the same shape.  Tensor and DynamicMatrix leaves
+/// cannot be mixed in one expression.  Only CPU operands (and only Float64
+/// tensors) are accepted.
+///
+/// When every operand already has the output shape the evaluator runs a flat
+/// loop over contiguous storage that the compiler vectorizes; otherwise it
+/// walks the output row by row with per-operand broadcast strides.  Large
+/// outputs are split over the shared thread pool.
+///
+/// Expressions hold pointers into their operands, so the operands must
+/// outlive the expression — evaluate it before they go out of scope, and do
+/// not wrap temporaries in lazy().
+/// ─────────────────────────────────────────────────────────────────────────────
+
+namespace expr {
+
+using Shape = std::vector<size_t>;
+
+template<typename Op, typename E>          class Unary;
+template<typename Op, typename L, typename R> class Binary;
+template<typename F, typename E>           class Map;
+
+// ── Element-wise functors ────────────────────────────────────────────────────
+
+namespace ops {
+struct Add  { static double apply(double a, double b) noexcept { return a + b; } };
+struct Sub  { static double apply(double a, double b) noexcept { return a - b; } };
+struct Mul  { static double apply(double a, double b) noexcept { return a * b; } };
+struct Div  { static double apply(double a, double b) noexcept { return a / b; } };
+struct Neg  { static double apply(double a) noexcept { return -a; } };
+struct Abs  { static double apply(double a) noexcept { return std::abs(a); } };
+struct Sqrt { static double apply(double a) noexcept { return std::sqrt(a); } };
+struct Exp  { static double apply(double a) noexcept { return std::exp(a); } };
+struct Log  { static double apply(double a) noexcept { return std::log(a); } };
+struct Tanh { static double apply(double a) noexcept { return std::tanh(a); } };
+struct Square { static double apply(double a) noexcept { return a * a; } };
+} // namespace ops
+
+// ── CRTP base ────────────────────────────────────────────────────────────────
+
+/// Base of every expression node.  Each node provides:
+///
+///   Shape shape() const              broadcast output shape
+///   bool  dense(const Shape&) const  true when every leaf has exactly that shape
+///   void  bind(const Shape&)         fix per-leaf broadcast strides
+///   void  seek(const size_t*)        move to the row at the given outer index
+///   double at(size_t i) const        flat element (dense evaluation only)
+///   double operator[](size_t j) const  element j of the current row
+template<typename E>
+class Expr {
+public:
+    const E& self() const noexcept { return static_cast<const E&>(*this); }
+
+    /// Evaluate into a freshly allocated Tensor / DynamicMatrix.
+    auto eval() const;
+
+    Unary<ops::Abs,    E> abs()    const { return Unary<ops::Abs,    E>(self()); }
+    Unary<ops::Sqrt,   E> sqrt()   const { return Unary<ops::Sqrt,   E>(self()); }
+    Unary<ops::Exp,    E> exp()    const { return Unary<ops::Exp,    E>(self()); }
+    Unary<ops::Log,    E> log()    const { return Unary<ops::Log,    E>(self()); }
+    Unary<ops::Tanh,   E> tanh()   const { return Unary<ops::Tanh,   E>(self()); }
+    Unary<ops::Square, E> square() const { return Unary<ops::Square, E>(self()); }
+
+    /// Apply an arbitrary double(double) callable element-wise.  Unlike
+    /// Tensor::apply the callable is inlined into the fused loop; it may be
+    /// invoked concurrently from several threads.
+    template<typename F>
+    Map<std::decay_t<F>, E> map(F&& f) const {
+        return Map<std::decay_t<F>, E>(self(), std::forward<F>(f));
+    }
+};
+
+namespace detail {
+
+inline Shape broadcastShapes(const Shape& a, const Shape& b) {
+    if (a.empty()) return b;
+    if (b.empty()) return a;
+    const size_t nd = std::max(a.size(), b.size());
+    Shape out(nd);
+    for (size_t i = 0; i < nd; ++i) {
+        size_t da = i < nd - a.size() ? 1 : a[i - (nd - a.size())];
+        size_t db = i < nd - b.size() ? 1 : b[i - (nd - b.size())];
+        if (da != db && da != 1 && db != 1)
+            throw std::invalid_argument(
+                "lazy expression: shapes are not broadcastable (" +
+                std::to_string(da) + " vs " + std::to_string(db) + ")");
+        out[i] = std::max(da, db);
+    }
+    return out;
+}
+
+inline size_t shapeSize(const Shape& s) noexcept {
+    size_t n = 1;
+    for (size_t d : s) n *= d;
+    return n;
+}
+
+// Result container of an expression: the leaf type, or void for a node
+// built only from scalars.
+template<typename A, typename B>
+struct CommonResult {
+    static_assert(std::is_void_v<A> || std::is_void_v<B> || std::is_same_v<A, B>,
+                  "lazy expression: Tensor and DynamicMatrix operands cannot be mixed");
+    using type = std::conditional_t<std::is_void_v<A>, B, A>;
+};
+
+} // namespace detail
+
+// ── Leaves ───────────────────────────────────────────────────────────────────
+
+/// Reference to the storage of a CPU Tensor or DynamicMatrix.
+template<typename C>
+class Leaf : public Expr<Leaf<C>> {
+public:
+    using result_type = C;
+
+    Leaf(const double* data, Shape shape)
+        : m_data(data), m_shape(std::move(shape)) {}
+
+    Shape shape() const { return m_shape; }
+    bool  dense(const Shape& out) const { return m_shape == out; }
+
+    void bind(const Shape& out) {
+        // Broadcast strides aligned to the output rank; size-1 axes get 0.
+        const size_t nd = out.size(), lead = nd - m_shape.size();
+        m_bstride.assign(nd, 0);
+        size_t s = 1;
+        for (size_t i = m_shape.size(); i-- > 0;) {
+            if (m_shape[i] != 1) m_bstride[lead + i] = s;
+            s *= m_shape[i];
+        }
+        m_inner = nd ? m_bstride.back() : 0;
+        m_row   = m_data;
+    }
+
+    void seek(const size_t* idx) {
+        size_t off = 0;
+        for (size_t d = 0; d + 1 < m_bstride.size(); ++d) off += idx[d] * m_bstride[d];
+        m_row = m_data + off;
+    }
+
+    double at(size_t i) const noexcept         { return m_data[i]; }
+    double operator[](size_t j) const noexcept { return m_row[j * m_inner]; }
+
+private:
+    const double* m_data;
+    Shape         m_shape;
+    Shape         m_bstride;
+    const double* m_row   = nullptr;
+    size_t        m_inner = 0;
+};
+
+/// Scalar operand; broadcasts against anything.
+class Scalar : public Expr<Scalar> {
+public:
+    using result_type = void;
+
+    explicit Scalar(double v) noexcept : m_value(v) {}
+
+    Shape shape() const { return {}; }
+    bool  dense(const Shape&) const noexcept { return true; }
+    void  bind(const Shape&) noexcept {}
+    void  seek(const size_t*) noexcept {}
+
+    double at(size_t) const noexcept         { return m_value; }
+    double operator[](size_t) const noexcept { return m_value; }
+
+private:
+    double m_value;
+};
+
+// ── Interior nodes ───────────────────────────────────────────────────────────
+
+template<typename Op, typename E>
+class Unary : public Expr<Unary<Op, E>> {
+public:
+    using result_type = typename E::result_type;
+
+    explicit Unary(const E& e) : m_e(e) {}
+
+    Shape shape() const                  { return m_e.shape(); }
+    bool  dense(const Shape& out) const  { return m_e.dense(out); }
+    void  bind(const Shape& out)         { m_e.bind(out); }
+    void  seek(const size_t* idx)        { m_e.seek(idx); }
+
+    double at(size_t i) const         { return Op::apply(m_e.at(i)); }
+    double operator[](size_t j) const { return Op::apply(m_e[j]); }
+
+private:
+    E m_e;
+};
+
+template<typename F, typename E>
+class Map : public Expr<Map<F, E>> {
+public:
+    using result_type = typename E::result_type;
+
+    Map(const E& e, F f) : m_e(e), m_f(std::move(f)) {}
+
+    Shape shape() const                  { return m_e.shape(); }
+    bool  dense(const Shape& out) const  { return m_e.dense(out); }
+    void  bind(const Shape& out)         { m_e.bind(out); }
+    void  seek(const size_t* idx)        { m_e.seek(idx); }
+
+    double at(size_t i) const         { return m_f(m_e.at(i)); }
+    double operator[](size_t j) const { return m_f(m_e[j]); }
+
+private:
+    E m_e;
+    F m_f;
+};
+
+template<typename Op, typename L, typename R>
+class Binary : public Expr<Binary<Op, L, R>> {
+public:
+    using result_type = typename detail::CommonResult<
+        typename L::result_type, typename R::result_type>::type;
+
+    Binary(const L& l, const R& r) : m_l(l), m_r(r) {}
+
+    Shape shape() const { return detail::broadcastShapes(m_l.shape(), m_r.shape()); }
+    bool  dense(const Shape& out) const { return m_l.dense(out) && m_r.dense(out); }
+    void  bind(const Shape& out)  { m_l.bind(out); m_r.bind(out); }
+    void  seek(const size_t* idx) { m_l.seek(idx); m_r.seek(idx); }
+
+    double at(size_t i) const         { return Op::apply(m_l.at(i), m_r.at(i)); }
+    double operator[](size_t j) const { return Op::apply(m_l[j], m_r[j]); }
+
+private:
+    L m_l;
+    R m_r;
+};
+
+// ── Operators ────────────────────────────────────────────────────────────────
+
+#define SHAREDMATH_EXPR_BINARY_OP(sym, Op)                                       \
+    template<typename L, typename R>                                            \
+    Binary<ops::Op, L, R> operator sym(const Expr<L>& l, const Expr<R>& r) {    \
+        return Binary<ops::Op, L, R>(l.self(), r.self());                       \
+    }                                                                           \
+    template<typename L>                                                        \
+    Binary<ops::Op, L, Scalar> operator sym(const Expr<L>& l, double s) {       \
+        return Binary<ops::Op, L, Scalar>(l.self(), Scalar(s));                 \
+    }                                                                           \
+    template<typename R>                                                        \
+    Binary<ops::Op, Scalar, R> operator sym(double s, const Expr<R>& r) {       \
+        return Binary<ops::Op, Scalar, R>(Scalar(s), r.self());                 \
+    }
+
+SHAREDMATH_EXPR_BINARY_OP(+, Add)
+SHAREDMATH_EXPR_BINARY_OP(-, Sub)
+SHAREDMATH_EXPR_BINARY_OP(*, Mul)
+SHAREDMATH_EXPR_BINARY_OP(/, Div)
+
+#undef SHAREDMATH_EXPR_BINARY_OP
+
+template<typename E>
+Unary<ops::Neg, E> operator-(const Expr<E>& e) { return Unary<ops::Neg, E>(e.self()); }
+
+// ── Evaluation ───────────────────────────────────────────────────────────────
+
+namespace detail {
+
+constexpr size_t kEvalGrain = 1 << 15;
+
+template<typename C> C makeResult(const Shape& shape);
+
+template<> inline Tensor makeResult<Tensor>(const Shape& shape) {
+    return Tensor(shape);
+}
+
+template<> inline DynamicMatrix makeResult<DynamicMatrix>(const Shape& shape) {
+    return DynamicMatrix(shape[0], shape[1]);
+}
+
+template<typename C>
+Shape containerShape(const C& c) {
+    if constexpr (std::is_same_v<C, Tensor>) return c.shape();
+    else return {c.rows(), c.cols()};
+}
+
+// Checks the expression against its container rules and returns the output
+// shape.
+template<typename E>
+Shape resolveShape(const E& e) {
+    using C = typename E::result_type;
+    static_assert(!std::is_void_v<C>,
+                  "lazy expression: needs at least one Tensor or DynamicMatrix operand");
+    Shape shape = e.shape();
+    if constexpr (std::is_same_v<C, DynamicMatrix>) {
+        if (!e.dense(shape))
+            throw std::invalid_argument(
+                "DynamicMatrix: shape mismatch in lazy expression");
+    }
+    return shape;
+}
+
+// Write every element of `e` (with output shape `shape`) to `out`.
+template<typename E>
+void evalInto(const E& e, const Shape& shape, double* out) {
+    const size_t n = shapeSize(shape);
+    if (n == 0) return;
+
+    if (e.dense(shape)) {
+        Core::parallel_for(0, n, kEvalGrain, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++i) out[i] = e.at(i);
+        });
+        return;
+    }
+
+    E node = e;
+    node.bind(shape);
+    const size_t inner = shape.back();
+    const size_t rows  = n / inner;
+    const size_t outer = shape.size() - 1;
+    const size_t grain = std::max<size_t>(1, kEvalGrain / inner);
+
+    Core::parallel_for(0, rows, grain, [&](size_t rowLo, size_t rowHi) {
+        E local = node;
+        Shape idx(outer, 0);
+        for (size_t r = rowLo, d = outer; d-- > 0;) {
+            idx[d] = r % shape[d];
+            r /= shape[d];
+        }
+        for (size_t row = rowLo; row < rowHi; ++row) {
+            local.seek(idx.data());
+            double* dst = out + row * inner;
+            for (size_t j = 0; j < inner; ++j) dst[j] = local[j];
+            for (size_t d = outer; d-- > 0;) {
+                if (++idx[d] < shape[d]) break;
+                idx[d] = 0;
+            }
+        }
+    });
+}
+
+template<typename C>
+void requireCpu(const C& c) {
+    if (c.device() != Device::CPU)
+        throw std::runtime_error("lazy: operand must live on the CPU");
+}
+
+inline void requireCpu(const Tensor& t) {
+    if (t.device() != Device::CPU)
+        throw std::runtime_error("lazy: operand must live on the CPU");
+    if (t.dtype() != TensorDType::Float64)
+        throw std::runtime_error("lazy: Tensor operand must be Float64");
+}
+
+// Whether `assign` may evaluate straight into the destination's storage.
+template<typename C>
+bool writableInPlace(const C& c) { return c.device() == Device::CPU; }
+
+inline bool writableInPlace(const Tensor& t) {
+    return t.device() == Device::CPU && t.dtype() == TensorDType::Float64;
+}
+
+} // namespace detail
+
+template<typename E>
+auto Expr<E>::eval() const {
+    using C = typename E::result_type;
+    const Shape shape = detail::resolveShape(self());
+    C out = detail::makeResult<C>(shape);
+    detail::evalInto(self(), shape, out.data().data());
+    return out;
+}
+
+} // namespace expr
+
+// ── Entry points ─────────────────────────────────────────────────────────────
+
+/// Wrap a CPU Tensor as a lazy operand.
+inline expr::Leaf<Tensor> lazy(const Tensor& t) {
+    expr::detail::requireCpu(t);
+    // A default-constructed Tensor has no dimensions and no elements; give it
+    // an explicit zero extent so it is not mistaken for a scalar.
+    return expr::Leaf<Tensor>(t.data().data(),
+                              t.ndim() ? t.shape() : expr::Shape{0});
+}
+
+/// Wrap a CPU DynamicMatrix as a lazy operand.
+inline expr::Leaf<DynamicMatrix> lazy(const DynamicMatrix& m) {
+    expr::detail::requireCpu(m);
+    return expr::Leaf<DynamicMatrix>(m.data().data(), {m.rows(), m.cols()});
+}
+
+/// Evaluate `e` into `dst`.  When `dst` already has the result shape it is
+/// overwritten in place without allocating; `dst` may itself appear in the
+/// expression, since every output element depends only on the operand
+/// elements at the same position.  Otherwise `dst` is replaced by a new
+/// result.
+template<typename C, typename E>
+C& assign(C& dst, const expr::Expr<E>& e) {
+    static_assert(std::is_same_v<C, typename E::result_type>,
+                  "assign: destination type does not match the expression");
+    const expr::Shape shape = expr::detail::resolveShape(e.self());
+    if (expr::detail::writableInPlace(dst) && expr::detail::containerShape(dst) == shape)
+        expr::detail::evalInto(e.self(), shape, dst.data().data());
+    else
+        dst = e.eval();
+    return dst;
+}
+
+} // namespace SharedMath::LinearAlgebra
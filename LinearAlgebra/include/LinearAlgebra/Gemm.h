@@ -0,0 +1,94 @@
+#pragma once
+
+#include <sharedmath_linearalgebra_export.h>
+
+#include "core/CpuFeatures.h"
+
+#include <cstddef>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Operand transpose flag for the level-3 kernels below.
+enum class SHAREDMATH_LINEARALGEBRA_EXPORT Transpose { No, Yes };
+
+/// Side of the triangular operand in trsm().
+enum class SHAREDMATH_LINEARALGEBRA_EXPORT Side { Left, Right };
+
+/// Which triangle of the stored triangular operand is referenced.
+enum class SHAREDMATH_LINEARALGEBRA_EXPORT Triangle { Lower, Upper };
+
+/// Whether the triangular operand has an implicit unit diagonal.
+enum class SHAREDMATH_LINEARALGEBRA_EXPORT Diagonal { NonUnit, Unit };
+
+/// Instruction set used by the GEMM micro-kernel (see core/CpuFeatures.h).
+using SimdLevel = Core::SimdLevel;
+
+/// General matrix multiply on row-major storage:
+///
+///   C = alpha * op(A) * op(B) + beta * C
+///
+/// op(A) is M×K, op(B) is K×N and C is M×N.  lda / ldb / ldc are the row
+/// strides (in elements) of the matrices as they are stored, i.e. before the
+/// transpose flag is applied.  When beta == 0, C is overwritten and its prior
+/// contents (including NaN / Inf) are ignored.
+///
+/// The implementation packs op(A) and op(B) into L1/L2-sized panels and runs
+/// a register-tiled micro-kernel.  The SIMD variant (AVX-512, AVX2+FMA or
+/// portable scalar) is selected once at runtime from the host CPU.
+///
+/// This is the shared kernel behind DynamicMatrix::operator*, Tensor::matmul
+/// and MatrixMultiplyStrategy.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void gemm(Transpose transA, Transpose transB,
+          size_t M, size_t N, size_t K,
+          double alpha,
+          const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta,
+          double* C, size_t ldc);
+
+/// Single-precision gemm() with the same contract.  The float micro-kernels
+/// use tiles twice as wide as the double ones, so each FMA covers twice as
+/// many elements.  This is the kernel behind Float32 Tensor::matmul.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void gemm(Transpose transA, Transpose transB,
+          size_t M, size_t N, size_t K,
+          float alpha,
+          const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta,
+          float* C, size_t ldc);
+
+/// Triangular solve with multiple right-hand sides, row-major storage:
+///
+///   op(A) * X = alpha * B   (Side::Left,  A is M×M)
+///   X * op(A) = alpha * B   (Side::Right, A is N×N)
+///
+/// B is M×N and is overwritten with X.  Only the `uplo` triangle of A is
+/// read; with Diagonal::Unit its diagonal is not read either.  A singular
+/// A yields Inf / NaN, as in BLAS — callers check their pivots.
+///
+/// The solve is blocked: each diagonal block is solved directly (split over
+/// the thread pool by columns or rows of B) and the rest of B is updated
+/// with gemm(), so almost all flops run in the GEMM micro-kernel.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void trsm(Side side, Triangle uplo, Transpose transA, Diagonal diag,
+          size_t M, size_t N,
+          double alpha,
+          const double* A, size_t lda,
+          double* B, size_t ldb);
+
+/// Micro-kernel currently used by gemm().
+SHAREDMATH_LINEARALGEBRA_EXPORT SimdLevel gemmSimdLevel() noexcept;
+
+/// Highest micro-kernel the host CPU supports.
+SHAREDMATH_LINEARALGEBRA_EXPORT SimdLevel gemmMaxSimdLevel() noexcept;
+
+/// Force a specific micro-kernel (clamped to gemmMaxSimdLevel()).
+/// Returns the level actually selected.  Mainly useful for testing and
+/// benchmarking; the default is Core::simdLevel(), or the level named by
+/// the SHAREDMATH_GEMM_SIMD environment variable ("scalar", "avx2",
+/// "avx512").  Neither affects the other SIMD kernels.
+SHAREDMATH_LINEARALGEBRA_EXPORT SimdLevel setGemmSimdLevel(SimdLevel level) noexcept;
+
+} // namespace SharedMath::LinearAlgebra
@@ -1,39 +1,85 @@
 #pragma once
 
 #include "AbstractMatrix.h"
+#include "LinearOperator.h"
+#include "Preconditioner.h"
 #include <sharedmath_linearalgebra_export.h>
 #include <vector>
 
 namespace SharedMath::LinearAlgebra {
 
+// Every solver comes in two flavours: one taking a LinearOperator (sparse,
+// dense or matrix-free — A is only touched through apply()/applyTranspose()),
+// and a convenience overload taking any AbstractMatrix, which wraps it with
+// makeOperator().  Neither densifies A.
+//
+// cg, gmres, bicgstab and minres also accept a Preconditioner M as the third
+// argument; those overloads return a KrylovResult instead of the bare x.
+
+/// Outcome of a preconditioned solve (mirrors NumericalMethods::IterResult).
+struct KrylovResult {
+    std::vector<double> x;
+    size_t iterations = 0;    // Krylov steps taken (products with A·M⁻¹)
+    double residual   = 0.0;  // true ||b − A·x||_2 of the returned x
+    bool   converged  = false;
+};
+
 /// ── Conjugate Gradient ────────────────────────────────────────────────────────
 /// Solves Ax = b where A must be symmetric positive definite.
 /// x0     — initial guess; empty → zero vector
 /// tol    — convergence threshold on ||r||_2
 /// max_iter — maximum number of iterations
+/// M      — symmetric positive definite preconditioner
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> cg(const AbstractMatrix& A,
                         const std::vector<double>& b,
                         std::vector<double> x0 = {},
                         double tol = 1e-10,
                         size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> cg(const LinearOperator& A,
+                        const std::vector<double>& b,
+                        std::vector<double> x0 = {},
+                        double tol = 1e-10,
+                        size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult cg(const AbstractMatrix& A,
+                const std::vector<double>& b,
+                const Preconditioner& M,
+                std::vector<double> x0 = {},
+                double tol = 1e-10,
+                size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult cg(const LinearOperator& A,
+                const std::vector<double>& b,
+                const Preconditioner& M,
+                std::vector<double> x0 = {},
+                double tol = 1e-10,
+                size_t max_iter = 1000);
 
 /// ── LSQR ─────────────────────────────────────────────────────────────────────
 /// Solves min ||Ax - b||_2 for any m×n matrix A (overdetermined, underdetermined,
 /// or rank-deficient). Based on Lanczos bidiagonalization.
 /// tol    — convergence threshold on the relative residual
 /// max_iter — maximum number of Lanczos steps
+/// Needs Aᵀ·x: throws std::invalid_argument if !A.hasTranspose().
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> lsqr(const AbstractMatrix& A,
                           const std::vector<double>& b,
                           double tol = 1e-10,
                           size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> lsqr(const LinearOperator& A,
+                          const std::vector<double>& b,
+                          double tol = 1e-10,
+                          size_t max_iter = 1000);
 
 /// ── GMRES(m) ──────────────────────────────────────────────────────────────────
 /// Generalised Minimal Residual — works for any square non-singular system,
 /// including non-symmetric and indefinite matrices.
 /// restart  — Krylov subspace dimension before restart (GMRES(restart))
 /// x0       — initial guess; empty → zero vector
+/// M        — any non-singular preconditioner, applied on the right
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> gmres(const AbstractMatrix& A,
                            const std::vector<double>& b,
@@ -41,27 +87,92 @@ std::vector<double> gmres(const AbstractMatrix& A,
                            double tol     = 1e-10,
                            size_t max_iter = 1000,
                            size_t restart  = 50);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> gmres(const LinearOperator& A,
+                           const std::vector<double>& b,
+                           std::vector<double> x0 = {},
+                           double tol     = 1e-10,
+                           size_t max_iter = 1000,
+                           size_t restart  = 50);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult gmres(const AbstractMatrix& A,
+                   const std::vector<double>& b,
+                   const Preconditioner& M,
+                   std::vector<double> x0 = {},
+                   double tol     = 1e-10,
+                   size_t max_iter = 1000,
+                   size_t restart  = 50);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult gmres(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   const Preconditioner& M,
+                   std::vector<double> x0 = {},
+                   double tol     = 1e-10,
+                   size_t max_iter = 1000,
+                   size_t restart  = 50);
 
 /// ── BiCGSTAB ─────────────────────────────────────────────────────────────────
 /// Biconjugate Gradient Stabilised — robust for non-symmetric systems,
 /// short recurrence (constant memory unlike GMRES).
 /// x0 — initial guess; empty → zero vector
+/// M  — any non-singular preconditioner, applied on the right
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> bicgstab(const AbstractMatrix& A,
                               const std::vector<double>& b,
                               std::vector<double> x0 = {},
                               double tol     = 1e-10,
                               size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> bicgstab(const LinearOperator& A,
+                              const std::vector<double>& b,
+                              std::vector<double> x0 = {},
+                              double tol     = 1e-10,
+                              size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult bicgstab(const AbstractMatrix& A,
+                      const std::vector<double>& b,
+                      const Preconditioner& M,
+                      std::vector<double> x0 = {},
+                      double tol     = 1e-10,
+                      size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult bicgstab(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      const Preconditioner& M,
+                      std::vector<double> x0 = {},
+                      double tol     = 1e-10,
+                      size_t max_iter = 1000);
 
 /// ── MINRES ────────────────────────────────────────────────────────────────────
 /// Minimum Residual method (Paige & Saunders) — for symmetric systems
 /// (positive definite, indefinite, or singular).
 /// x0 — initial guess; empty → zero vector
+/// M  — symmetric positive definite preconditioner (even when A is indefinite)
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> minres(const AbstractMatrix& A,
                             const std::vector<double>& b,
                             std::vector<double> x0 = {},
                             double tol     = 1e-10,
                             size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> minres(const LinearOperator& A,
+                            const std::vector<double>& b,
+                            std::vector<double> x0 = {},
+                            double tol     = 1e-10,
+                            size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult minres(const AbstractMatrix& A,
+                    const std::vector<double>& b,
+                    const Preconditioner& M,
+                    std::vector<double> x0 = {},
+                    double tol     = 1e-10,
+                    size_t max_iter = 1000);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+KrylovResult minres(const LinearOperator& A,
+                    const std::vector<double>& b,
+                    const Preconditioner& M,
+                    std::vector<double> x0 = {},
+                    double tol     = 1e-10,
+                    size_t max_iter = 1000);
 
 } // namespace SharedMath::LinearAlgebra
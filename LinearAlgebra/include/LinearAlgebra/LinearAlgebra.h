@@ -2,15 +2,27 @@
 
 #include "VectorN.h"
 #include "DynamicMatrix.h"
+#include "Gemm.h"
 #include "DynamicVector.h"
 #include "Matrix.h"
+#include "MatrixBatch.h"
 #include "MatrixView.h"
 #include "MatrixOperations.h"
 #include "Tensor.h"
+#include "Conv2d.h"
+#include "Expr.h"
 #include "MatrixFunctions.h"
+#include "LinearOperator.h"
+#include "Preconditioner.h"
 #include "IterativeSolvers.h"
 #include "SparseMatrix.h"
+#include "SparseFormats.h"
 #include "LinearSolver.h"
 #include "PCA.h"
 #include "ComplexMatrix.h"
 #include "ComplexVector.h"
+#include "ComplexSparseMatrix.h"
+#include "SparseOrdering.h"
+#include "ComplexSolver.h"
+#include "SparseDirectSolver.h"
+#include "Randomized.h"
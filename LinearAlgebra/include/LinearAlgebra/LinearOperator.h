@@ -0,0 +1,130 @@
+#pragma once
+
+#include "AbstractMatrix.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+class DynamicMatrix;
+class SparseMatrix;
+
+/// Abstract m×n linear operator: anything that can form y = A·x (and
+/// optionally y = Aᵀ·x) without exposing its entries.
+///
+/// The Krylov solvers in IterativeSolvers.h only ever touch A through this
+/// interface, so a sparse matrix costs O(nnz) per product and a matrix-free
+/// operator never has to be materialised.
+///
+/// apply()/applyTranspose() write into a caller-owned y that already has the
+/// right size; implementations must not resize it.
+class SHAREDMATH_LINEARALGEBRA_EXPORT LinearOperator {
+public:
+    virtual ~LinearOperator() = default;
+
+    virtual size_t rows() const noexcept = 0;
+    virtual size_t cols() const noexcept = 0;
+
+    /// y = A·x   (x.size() == cols(), y.size() == rows())
+    virtual void apply(const std::vector<double>& x, std::vector<double>& y) const = 0;
+
+    /// y = Aᵀ·x  (x.size() == rows(), y.size() == cols())
+    /// The default throws std::logic_error; check hasTranspose() first.
+    virtual void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const;
+
+    virtual bool hasTranspose() const noexcept { return false; }
+
+    /// Block products Y = A·X (X is cols()×k) and Y = Aᵀ·X (X is rows()×k),
+    /// used by the randomized routines in Randomized.h.  Y is resized to the
+    /// result shape.  The defaults call apply()/applyTranspose() once per
+    /// column; the dense and sparse operators override them with GEMM and
+    /// sparse-times-dense kernels.
+    virtual void applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const;
+    virtual void applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const;
+};
+
+/// ── CSR operator ──────────────────────────────────────────────────────────────
+/// Non-owning view of a SparseMatrix.  A·x is SparseMatrix::multiply (row-
+/// parallel, balanced by non-zeros); Aᵀ·x is a single scatter pass over the
+/// stored entries.  Both are O(nnz).  For repeated Aᵀ·x, see CSCMatrix.
+class SHAREDMATH_LINEARALGEBRA_EXPORT SparseOperator final : public LinearOperator {
+public:
+    explicit SparseOperator(const SparseMatrix& A) noexcept : A_(A) {}
+
+    size_t rows() const noexcept override;
+    size_t cols() const noexcept override;
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+    void applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const override;
+    void applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const override;
+
+private:
+    const SparseMatrix& A_;
+};
+
+/// ── Dense operator ────────────────────────────────────────────────────────────
+/// Non-owning view of a CPU-resident DynamicMatrix (GEMV over row_ptr()).
+class SHAREDMATH_LINEARALGEBRA_EXPORT DenseOperator final : public LinearOperator {
+public:
+    /// Throws std::runtime_error if A lives on a GPU.
+    explicit DenseOperator(const DynamicMatrix& A);
+
+    size_t rows() const noexcept override;
+    size_t cols() const noexcept override;
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+    void applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const override;
+    void applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const override;
+
+private:
+    const DynamicMatrix& A_;
+};
+
+/// ── Generic matrix operator ───────────────────────────────────────────────────
+/// Fallback for any other AbstractMatrix; goes through get(i, j).
+class SHAREDMATH_LINEARALGEBRA_EXPORT MatrixOperator final : public LinearOperator {
+public:
+    explicit MatrixOperator(const AbstractMatrix& A) noexcept : A_(A) {}
+
+    size_t rows() const noexcept override { return A_.rows(); }
+    size_t cols() const noexcept override { return A_.cols(); }
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+
+private:
+    const AbstractMatrix& A_;
+};
+
+/// ── Matrix-free operator ──────────────────────────────────────────────────────
+/// Wraps user callbacks.  `applyT` may be left empty when only A·x is known;
+/// solvers that need Aᵀ (lsqr) then reject the operator.
+class SHAREDMATH_LINEARALGEBRA_EXPORT FunctionOperator final : public LinearOperator {
+public:
+    using Fn = std::function<void(const std::vector<double>&, std::vector<double>&)>;
+
+    FunctionOperator(size_t rows, size_t cols, Fn apply, Fn applyT = {});
+
+    size_t rows() const noexcept override { return rows_; }
+    size_t cols() const noexcept override { return cols_; }
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return static_cast<bool>(applyT_); }
+
+private:
+    size_t rows_, cols_;
+    Fn     apply_, applyT_;
+};
+
+/// Pick the cheapest operator for a concrete matrix type: SparseOperator for
+/// SparseMatrix, DenseOperator for a CPU DynamicMatrix, MatrixOperator
+/// otherwise.  The result borrows A, which must outlive it.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::unique_ptr<LinearOperator> makeOperator(const AbstractMatrix& A);
+
+} // namespace SharedMath::LinearAlgebra
@@ -59,6 +59,15 @@ public:
     /// Numerical rank via QR with column pivoting (independent of factorization method)
     size_t rank(double tol = -1.0) const;
 
+    /// ── QR factors (Method::QR only) ──────────────────────────────────────
+
+    /// R as a min(rows, cols) × cols upper-trapezoidal matrix.
+    DynamicMatrix r_factor() const;
+
+    /// X ← Qᵀ·X (transpose = true) or Q·X, X is rows()×k; Q is applied one
+    /// reflector block at a time and never formed.
+    void apply_q(DynamicMatrix& X, bool transpose) const;
+
     /// ── Named constructors ────────────────────────────────────────────────
     static LinearSolver lu       (const AbstractMatrix& A);
     static LinearSolver qr       (const AbstractMatrix& A);
@@ -78,27 +87,21 @@ private:
     int piv_sign_ = 1;           // +1 or -1 depending on number of row swaps
 
     // ── QR factorization storage ──────────────────────────────────────────
-    DynamicMatrix Q_, R_;
+    DynamicMatrix QR_;           // R on/above the diagonal, Householder vectors below
+    std::vector<double> tau_;    // H_k = I − tau_k·v_k·v_kᵀ  (v_k(k) = 1 implied)
 
     // ── Cholesky factorization storage ────────────────────────────────────
     DynamicMatrix L_;            // lower-triangular factor, A = L*L^T
 
     /// ── Internal helpers ──────────────────────────────────────────────────
+    // All three factorizations are blocked (kBlock columns at a time) so the
+    // bulk of the work is GEMM / TRSM on the shared thread pool.
     void factorize_lu      (const AbstractMatrix& A);
     void factorize_qr      (const AbstractMatrix& A);
     void factorize_cholesky(const AbstractMatrix& A);
 
-    /// Back/forward substitution
-    std::vector<double> solve_lu (const std::vector<double>& b) const;
-    std::vector<double> solve_qr (const std::vector<double>& b) const;
-    std::vector<double> solve_cho(const std::vector<double>& b) const;
-
-    // Triangular solvers
-    static std::vector<double> forward_sub (const DynamicMatrix& L,
-                                             const std::vector<double>& b,
-                                             bool unit_diag = false);
-    static std::vector<double> backward_sub(const DynamicMatrix& U,
-                                             const std::vector<double>& b);
+    /// Solve in place: B (rows_×k) is overwritten by X (first cols_ rows).
+    DynamicMatrix solve_blocked(DynamicMatrix B) const;
 };
 
 } // namespace SharedMath::LinearAlgebra
@@ -6,6 +6,7 @@
 #include <array>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 namespace SharedMath::LinearAlgebra {
 
@@ -17,16 +18,27 @@ namespace SharedMath::LinearAlgebra {
 // toPtr() / rowPtr() return correct flat pointers.
 //
 // Prefer operator()(r, c) over operator[](r)[c] for direct access;
-// the latter is kept for backward compatibility.
+// the latter is kept for backward compatibility.  operator() and at() are
+// bounds-checked; at_unsafe() is the unchecked accessor for inner loops.
+//
+// Arithmetic, determinant(), inverse() and the transform helpers below the
+// class are constexpr.  Products whose dimensions are all ≤ 6 are unrolled
+// at compile time, and 2×2 / 3×3 / 4×4 determinant and inverse use closed
+// cofactor forms instead of elimination.  For transforming large point sets
+// see MatrixBatch.h.
 //
 template<size_t Rows, size_t Cols>
 class Matrix : public AbstractMatrix {
     static_assert(Rows > 0 && Cols > 0, "Matrix dimensions must be > 0");
+
+    /// Largest dimension for which products are fully unrolled.
+    static constexpr size_t kUnroll = 6;
+
 public:
     /// ── Construction ──────────────────────────────────────────────────────
-    Matrix() noexcept { for (auto& row : data_) row = Vector<Cols>(); }
+    constexpr Matrix() noexcept : data_{} {}
 
-    Matrix(std::initializer_list<std::initializer_list<double>> values) {
+    constexpr Matrix(std::initializer_list<std::initializer_list<double>> values) : data_{} {
         if (values.size() != Rows)
             throw std::invalid_argument("Matrix: wrong number of rows in initializer list");
         size_t i = 0;
@@ -39,29 +51,44 @@ public:
         }
     }
 
-    Matrix(const Matrix&)            = default;
-    Matrix(Matrix&&) noexcept        = default;
-    Matrix& operator=(const Matrix&) = default;
-    Matrix& operator=(Matrix&&) noexcept = default;
-    ~Matrix() override = default;
+    constexpr Matrix(const Matrix&)            = default;
+    constexpr Matrix(Matrix&&) noexcept        = default;
+    constexpr Matrix& operator=(const Matrix&) = default;
+    constexpr Matrix& operator=(Matrix&&) noexcept = default;
+    constexpr ~Matrix() override {}
+
+    static constexpr Matrix identity() noexcept {
+        static_assert(Rows == Cols, "Matrix::identity: matrix must be square");
+        Matrix m;
+        for (size_t i = 0; i < Rows; ++i) m.data_[i][i] = 1.0;
+        return m;
+    }
 
     /// ── Element access ────────────────────────────────────────────────────
 
     /// Preferred: direct (row, col) access
-    double& operator()(size_t r, size_t c) {
+    constexpr double& operator()(size_t r, size_t c) {
         if (r >= Rows || c >= Cols)
             throw std::out_of_range("Matrix: index out of range");
         return data_[r][c];
     }
-    double operator()(size_t r, size_t c) const {
+    constexpr double operator()(size_t r, size_t c) const {
         if (r >= Rows || c >= Cols)
             throw std::out_of_range("Matrix: index out of range");
         return data_[r][c];
     }
 
+    constexpr double& at(size_t r, size_t c)      { return (*this)(r, c); }
+    constexpr double  at(size_t r, size_t c) const { return (*this)(r, c); }
+
+    /// Unchecked access for hot loops; r < Rows and c < Cols are the
+    /// caller's responsibility.
+    constexpr double& at_unsafe(size_t r, size_t c)       noexcept { return data_[r][c]; }
+    constexpr double  at_unsafe(size_t r, size_t c) const noexcept { return data_[r][c]; }
+
     // Row access (backward-compatible: matrix[r][c])
-    Vector<Cols>& operator[](size_t r) noexcept { return data_[r]; }
-    const Vector<Cols>& operator[](size_t r) const noexcept { return data_[r]; }
+    constexpr Vector<Cols>& operator[](size_t r) noexcept { return data_[r]; }
+    constexpr const Vector<Cols>& operator[](size_t r) const noexcept { return data_[r]; }
 
     /// AbstractMatrix interface
     double  get(size_t r, size_t c) const override { return (*this)(r, c); }
@@ -85,87 +112,227 @@ public:
     }
 
     /// ── Metadata ──────────────────────────────────────────────────────────
-    size_t rows() const noexcept override { return Rows; }
-    size_t cols() const noexcept override { return Cols; }
+    constexpr size_t rows() const noexcept override { return Rows; }
+    constexpr size_t cols() const noexcept override { return Cols; }
     static constexpr size_t totalElements() noexcept { return Rows * Cols; }
     static constexpr size_t dataSizeBytes() noexcept { return Rows * Cols * sizeof(double); }
     static constexpr bool   isContiguous()  noexcept { return true; }
 
     // ── Arithmetic ────────────────────────────────────────────────────────
-    Matrix operator+(const Matrix& o) const noexcept {
+    constexpr Matrix operator+(const Matrix& o) const noexcept {
         Matrix r;
         for (size_t i = 0; i < Rows; ++i) r.data_[i] = data_[i] + o.data_[i];
         return r;
     }
-    Matrix operator-(const Matrix& o) const noexcept {
+    constexpr Matrix operator-(const Matrix& o) const noexcept {
         Matrix r;
         for (size_t i = 0; i < Rows; ++i) r.data_[i] = data_[i] - o.data_[i];
         return r;
     }
-    Matrix operator*(double s) const noexcept {
+    constexpr Matrix operator*(double s) const noexcept {
         Matrix r;
         for (size_t i = 0; i < Rows; ++i) r.data_[i] = data_[i] * s;
         return r;
     }
-    friend Matrix operator*(double s, const Matrix& m) noexcept { return m * s; }
+    friend constexpr Matrix operator*(double s, const Matrix& m) noexcept { return m * s; }
 
-    Matrix& operator+=(const Matrix& o) noexcept {
+    constexpr Matrix& operator+=(const Matrix& o) noexcept {
         for (size_t i = 0; i < Rows; ++i) data_[i] += o.data_[i];
         return *this;
     }
-    Matrix& operator-=(const Matrix& o) noexcept {
+    constexpr Matrix& operator-=(const Matrix& o) noexcept {
         for (size_t i = 0; i < Rows; ++i) data_[i] -= o.data_[i];
         return *this;
     }
-    Matrix& operator*=(double s) noexcept {
+    constexpr Matrix& operator*=(double s) noexcept {
         for (auto& row : data_) row *= s;
         return *this;
     }
 
     // Matrix * vector (M × N) * (N) = (M)
-    Vector<Rows> operator*(const Vector<Cols>& v) const noexcept {
+    constexpr Vector<Rows> operator*(const Vector<Cols>& v) const noexcept {
         Vector<Rows> result;
-        for (size_t i = 0; i < Rows; ++i)
-            result[i] = data_[i].dot(v);
+        if constexpr (Cols <= kUnroll) {
+            for (size_t i = 0; i < Rows; ++i)
+                result[i] = rowDot(data_[i], v, std::make_index_sequence<Cols>{});
+        } else {
+            for (size_t i = 0; i < Rows; ++i)
+                result[i] = data_[i].dot(v);
+        }
         return result;
     }
 
     // Matrix * matrix: (Rows × Cols) * (Cols × Other) = (Rows × Other)
-    // Cache-friendly i-k-j loop.
+    // Small shapes: each row of C is an unrolled sum of scaled rows of B,
+    // which vectorises across the row.
+    // Otherwise the cache-friendly i-k-j loop.
     template<size_t Other>
-    Matrix<Rows, Other> mul(const Matrix<Cols, Other>& B) const noexcept {
+    constexpr Matrix<Rows, Other> mul(const Matrix<Cols, Other>& B) const noexcept {
         Matrix<Rows, Other> C;
-        for (size_t i = 0; i < Rows; ++i) {
-            for (size_t k = 0; k < Cols; ++k) {
-                double a = data_[i][k];
-                for (size_t j = 0; j < Other; ++j)
-                    C[i][j] = C[i][j] + a * B[k][j];
+        if constexpr (Rows <= kUnroll && Cols <= kUnroll && Other <= kUnroll) {
+            for (size_t i = 0; i < Rows; ++i)
+                C[i] = rowCombination(data_[i], B, std::make_index_sequence<Cols>{});
+        } else {
+            for (size_t i = 0; i < Rows; ++i) {
+                for (size_t k = 0; k < Cols; ++k) {
+                    double a = data_[i][k];
+                    for (size_t j = 0; j < Other; ++j)
+                        C[i][j] = C[i][j] + a * B[k][j];
+                }
             }
         }
         return C;
     }
 
+    constexpr Matrix<Cols, Rows> transposed() const noexcept {
+        Matrix<Cols, Rows> T;
+        for (size_t i = 0; i < Rows; ++i)
+            for (size_t j = 0; j < Cols; ++j)
+                T.at_unsafe(j, i) = data_[i][j];
+        return T;
+    }
+
+    constexpr double trace() const noexcept {
+        static_assert(Rows == Cols, "Matrix::trace: matrix must be square");
+        double t = 0.0;
+        for (size_t i = 0; i < Rows; ++i) t += data_[i][i];
+        return t;
+    }
+
+    /// ── Determinant / inverse ─────────────────────────────────────────────
+    /// 2×2, 3×3 and 4×4 use closed cofactor expansions; larger sizes use
+    /// Gaussian elimination with partial pivoting on a copy.
+    constexpr double determinant() const noexcept {
+        static_assert(Rows == Cols, "Matrix::determinant: matrix must be square");
+        const auto& a = data_;
+        if constexpr (Rows == 1) {
+            return a[0][0];
+        } else if constexpr (Rows == 2) {
+            return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        } else if constexpr (Rows == 3) {
+            return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+                 - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+                 + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+        } else if constexpr (Rows == 4) {
+            const Minors4 m = minors4();
+            return m.s[0] * m.c[5] - m.s[1] * m.c[4] + m.s[2] * m.c[3]
+                 + m.s[3] * m.c[2] - m.s[4] * m.c[1] + m.s[5] * m.c[0];
+        } else {
+            Matrix lu = *this;
+            double det = 1.0;
+            for (size_t k = 0; k < Rows; ++k) {
+                size_t p = k;
+                for (size_t i = k + 1; i < Rows; ++i)
+                    if (magnitude(lu.data_[i][k]) > magnitude(lu.data_[p][k])) p = i;
+                if (lu.data_[p][k] == 0.0) return 0.0;
+                if (p != k) { std::swap(lu.data_[p], lu.data_[k]); det = -det; }
+                det *= lu.data_[k][k];
+                for (size_t i = k + 1; i < Rows; ++i) {
+                    const double f = lu.data_[i][k] / lu.data_[k][k];
+                    for (size_t j = k + 1; j < Cols; ++j)
+                        lu.data_[i][j] -= f * lu.data_[k][j];
+                }
+            }
+            return det;
+        }
+    }
+
+    /// Throws std::runtime_error if the matrix is singular.
+    constexpr Matrix inverse() const {
+        static_assert(Rows == Cols, "Matrix::inverse: matrix must be square");
+        const auto& a = data_;
+        Matrix r;
+        if constexpr (Rows <= 4) {
+            const double det = determinant();
+            if (magnitude(det) < kSingular)
+                throw std::runtime_error("Matrix::inverse: matrix is singular");
+            const double d = 1.0 / det;
+            if constexpr (Rows == 1) {
+                r.data_[0][0] = d;
+            } else if constexpr (Rows == 2) {
+                r.data_[0][0] =  a[1][1] * d;  r.data_[0][1] = -a[0][1] * d;
+                r.data_[1][0] = -a[1][0] * d;  r.data_[1][1] =  a[0][0] * d;
+            } else if constexpr (Rows == 3) {
+                r.data_[0][0] = (a[1][1] * a[2][2] - a[1][2] * a[2][1]) * d;
+                r.data_[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * d;
+                r.data_[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * d;
+                r.data_[1][0] = (a[1][2] * a[2][0] - a[1][0] * a[2][2]) * d;
+                r.data_[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * d;
+                r.data_[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * d;
+                r.data_[2][0] = (a[1][0] * a[2][1] - a[1][1] * a[2][0]) * d;
+                r.data_[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * d;
+                r.data_[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * d;
+            } else {
+                const Minors4 m = minors4();
+                const auto& s = m.s;
+                const auto& c = m.c;
+                r.data_[0][0] = ( a[1][1] * c[5] - a[1][2] * c[4] + a[1][3] * c[3]) * d;
+                r.data_[0][1] = (-a[0][1] * c[5] + a[0][2] * c[4] - a[0][3] * c[3]) * d;
+                r.data_[0][2] = ( a[3][1] * s[5] - a[3][2] * s[4] + a[3][3] * s[3]) * d;
+                r.data_[0][3] = (-a[2][1] * s[5] + a[2][2] * s[4] - a[2][3] * s[3]) * d;
+                r.data_[1][0] = (-a[1][0] * c[5] + a[1][2] * c[2] - a[1][3] * c[1]) * d;
+                r.data_[1][1] = ( a[0][0] * c[5] - a[0][2] * c[2] + a[0][3] * c[1]) * d;
+                r.data_[1][2] = (-a[3][0] * s[5] + a[3][2] * s[2] - a[3][3] * s[1]) * d;
+                r.data_[1][3] = ( a[2][0] * s[5] - a[2][2] * s[2] + a[2][3] * s[1]) * d;
+                r.data_[2][0] = ( a[1][0] * c[4] - a[1][1] * c[2] + a[1][3] * c[0]) * d;
+                r.data_[2][1] = (-a[0][0] * c[4] + a[0][1] * c[2] - a[0][3] * c[0]) * d;
+                r.data_[2][2] = ( a[3][0] * s[4] - a[3][1] * s[2] + a[3][3] * s[0]) * d;
+                r.data_[2][3] = (-a[2][0] * s[4] + a[2][1] * s[2] - a[2][3] * s[0]) * d;
+                r.data_[3][0] = (-a[1][0] * c[3] + a[1][1] * c[1] - a[1][2] * c[0]) * d;
+                r.data_[3][1] = ( a[0][0] * c[3] - a[0][1] * c[1] + a[0][2] * c[0]) * d;
+                r.data_[3][2] = (-a[3][0] * s[3] + a[3][1] * s[1] - a[3][2] * s[0]) * d;
+                r.data_[3][3] = ( a[2][0] * s[3] - a[2][1] * s[1] + a[2][2] * s[0]) * d;
+            }
+        } else {
+            // Gauss–Jordan with partial pivoting on [A | I].
+            Matrix w = *this;
+            r = identity();
+            for (size_t k = 0; k < Rows; ++k) {
+                size_t p = k;
+                for (size_t i = k + 1; i < Rows; ++i)
+                    if (magnitude(w.data_[i][k]) > magnitude(w.data_[p][k])) p = i;
+                if (magnitude(w.data_[p][k]) < kSingular)
+                    throw std::runtime_error("Matrix::inverse: matrix is singular");
+                if (p != k) {
+                    std::swap(w.data_[p], w.data_[k]);
+                    std::swap(r.data_[p], r.data_[k]);
+                }
+                const double d = 1.0 / w.data_[k][k];
+                w.data_[k] *= d;
+                r.data_[k] *= d;
+                for (size_t i = 0; i < Rows; ++i) {
+                    if (i == k) continue;
+                    const double f = w.data_[i][k];
+                    if (f == 0.0) continue;
+                    w.data_[i] -= w.data_[k] * f;
+                    r.data_[i] -= r.data_[k] * f;
+                }
+            }
+        }
+        return r;
+    }
+
     // ── Flat array conversions ────────────────────────────────────────────
-    std::array<double, Rows * Cols> toRowMajorArray() const {
-        std::array<double, Rows * Cols> out;
+    constexpr std::array<double, Rows * Cols> toRowMajorArray() const {
+        std::array<double, Rows * Cols> out{};
         for (size_t i = 0; i < Rows; ++i)
             for (size_t j = 0; j < Cols; ++j)
                 out[i * Cols + j] = data_[i][j];
         return out;
     }
-    std::array<double, Rows * Cols> toColumnMajorArray() const {
-        std::array<double, Rows * Cols> out;
+    constexpr std::array<double, Rows * Cols> toColumnMajorArray() const {
+        std::array<double, Rows * Cols> out{};
         for (size_t j = 0; j < Cols; ++j)
             for (size_t i = 0; i < Rows; ++i)
                 out[j * Rows + i] = data_[i][j];
         return out;
     }
-    void fromRowMajorArray(const double* ptr) {
+    constexpr void fromRowMajorArray(const double* ptr) {
         for (size_t i = 0; i < Rows; ++i)
             for (size_t j = 0; j < Cols; ++j)
                 data_[i][j] = ptr[i * Cols + j];
     }
-    void fromColumnMajorArray(const double* ptr) {
+    constexpr void fromColumnMajorArray(const double* ptr) {
         for (size_t j = 0; j < Cols; ++j)
             for (size_t i = 0; i < Rows; ++i)
                 data_[i][j] = ptr[j * Rows + i];
@@ -206,7 +373,88 @@ public:
     }
 
 private:
+    /// Pivots / determinants below this are treated as exact zeros
+    /// (same threshold as LinearSolver).
+    static constexpr double kSingular = 1e-300;
+
+    static constexpr double magnitude(double v) noexcept { return v < 0.0 ? -v : v; }
+
+    template<size_t... K>
+    static constexpr double rowDot(const Vector<Cols>& a, const Vector<Cols>& v,
+                                   std::index_sequence<K...>) noexcept {
+        return ((a[K] * v[K]) + ...);
+    }
+
+    template<size_t Other, size_t... K>
+    static constexpr Vector<Other> rowCombination(const Vector<Cols>& a, const Matrix<Cols, Other>& B,
+                                                  std::index_sequence<K...>) noexcept {
+        return ((B[K] * a[K]) + ...);
+    }
+
+    /// The 2×2 minors of rows {0,1} (s) and rows {2,3} (c) shared by the
+    /// 4×4 determinant and inverse.
+    struct Minors4 { double s[6]; double c[6]; };
+
+    constexpr Minors4 minors4() const noexcept {
+        const auto& a = data_;
+        return {{a[0][0] * a[1][1] - a[1][0] * a[0][1],
+                 a[0][0] * a[1][2] - a[1][0] * a[0][2],
+                 a[0][0] * a[1][3] - a[1][0] * a[0][3],
+                 a[0][1] * a[1][2] - a[1][1] * a[0][2],
+                 a[0][1] * a[1][3] - a[1][1] * a[0][3],
+                 a[0][2] * a[1][3] - a[1][2] * a[0][3]},
+                {a[2][0] * a[3][1] - a[3][0] * a[2][1],
+                 a[2][0] * a[3][2] - a[3][0] * a[2][2],
+                 a[2][0] * a[3][3] - a[3][0] * a[2][3],
+                 a[2][1] * a[3][2] - a[3][1] * a[2][2],
+                 a[2][1] * a[3][3] - a[3][1] * a[2][3],
+                 a[2][2] * a[3][3] - a[3][2] * a[2][3]}};
+    }
+
     std::array<Vector<Cols>, Rows> data_;
 };
 
+// ── Homogeneous transforms ────────────────────────────────────────────────────
+// T is a (D × D) homogeneous transform acting on (D−1)-dimensional points,
+// e.g. Matrix<3,3> for 2-D and Matrix<4,4> for 3-D geometry.
+
+/// Affine point transform: the linear block plus the translation column.
+/// The bottom row of T is ignored.
+template<size_t D>
+constexpr Vector<D - 1> transformPoint(const Matrix<D, D>& T, const Vector<D - 1>& p) noexcept {
+    static_assert(D >= 2, "transformPoint: transform must be at least 2x2");
+    Vector<D - 1> r;
+    for (size_t i = 0; i + 1 < D; ++i) {
+        double s = T.at_unsafe(i, D - 1);
+        for (size_t j = 0; j + 1 < D; ++j) s += T.at_unsafe(i, j) * p[j];
+        r[i] = s;
+    }
+    return r;
+}
+
+/// Direction transform: the linear block only (no translation).
+template<size_t D>
+constexpr Vector<D - 1> transformVector(const Matrix<D, D>& T, const Vector<D - 1>& v) noexcept {
+    static_assert(D >= 2, "transformVector: transform must be at least 2x2");
+    Vector<D - 1> r;
+    for (size_t i = 0; i + 1 < D; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j + 1 < D; ++j) s += T.at_unsafe(i, j) * v[j];
+        r[i] = s;
+    }
+    return r;
+}
+
+/// Projective point transform: full homogeneous product followed by the
+/// divide by w.  Throws std::runtime_error if w is zero (point at infinity).
+template<size_t D>
+constexpr Vector<D - 1> projectPoint(const Matrix<D, D>& T, const Vector<D - 1>& p) {
+    static_assert(D >= 2, "projectPoint: transform must be at least 2x2");
+    double w = T.at_unsafe(D - 1, D - 1);
+    for (size_t j = 0; j + 1 < D; ++j) w += T.at_unsafe(D - 1, j) * p[j];
+    if (w == 0.0)
+        throw std::runtime_error("projectPoint: point maps to infinity (w = 0)");
+    return transformPoint(T, p) * (1.0 / w);
+}
+
 } // namespace SharedMath::LinearAlgebra
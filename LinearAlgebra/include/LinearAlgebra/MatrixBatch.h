@@ -0,0 +1,49 @@
+#pragma once
+
+#include <sharedmath_linearalgebra_export.h>
+
+#include "Matrix.h"
+
+#include <array>
+#include <cstddef>
+
+namespace SharedMath::LinearAlgebra {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// Batched small-matrix kernels on "structure of arrays" point sets
+///
+/// A set of n points in D dimensions is passed as D separate coordinate
+/// arrays (x[0..n), y[0..n), …) instead of n interleaved Vector<D>s, so the
+/// kernels can load four consecutive x's (y's, …) into one SIMD register and
+/// apply the matrix to four points per step.  The AVX2+FMA path is selected
+/// at runtime from Core::simdLevel(); otherwise a portable scalar loop runs.
+///
+/// Output arrays may be the input arrays themselves (in-place transform) but
+/// must not otherwise overlap them.
+/// ─────────────────────────────────────────────────────────────────────────────
+
+template<size_t D>
+using PointsIn = std::array<const double*, D>;
+
+template<size_t D>
+using PointsOut = std::array<double*, D>;
+
+/// out_i = A · in_i for every point i (e.g. a state-transition step).
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void applyBatch(const Matrix<2, 2>& A, const PointsIn<2>& in, const PointsOut<2>& out, size_t n);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void applyBatch(const Matrix<3, 3>& A, const PointsIn<3>& in, const PointsOut<3>& out, size_t n);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void applyBatch(const Matrix<4, 4>& A, const PointsIn<4>& in, const PointsOut<4>& out, size_t n);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void applyBatch(const Matrix<6, 6>& A, const PointsIn<6>& in, const PointsOut<6>& out, size_t n);
+
+/// Affine point transform, as transformPoint(T, p) for every point: 2-D
+/// points through a 3×3 and 3-D points through a 4×4 homogeneous transform.
+/// The bottom row of T is ignored.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void transformPointsBatch(const Matrix<3, 3>& T, const PointsIn<2>& in, const PointsOut<2>& out, size_t n);
+SHAREDMATH_LINEARALGEBRA_EXPORT
+void transformPointsBatch(const Matrix<4, 4>& T, const PointsIn<3>& in, const PointsOut<3>& out, size_t n);
+
+} // namespace SharedMath::LinearAlgebra
@@ -167,24 +167,61 @@ DynamicMatrix cholesky(const AbstractMatrix& A);
 
 /// ── Eigenvalues ───────────────────────────────────────────────────────────────
 
-/// Eigenvalues of a real symmetric matrix via QR iteration (sorted descending)
+/// The symmetric eigensolvers reduce A to tridiagonal form with Householder
+/// reflections, solve the tridiagonal problem, and map the eigenvectors
+/// back.  Only symmetric A is supported (the upper triangle is assumed to
+/// mirror the lower).  max_iter caps the implicit QL sweeps per eigenvalue;
+/// std::runtime_error is thrown if it is exceeded.
+
+/// Eigenvalues only (sorted descending) — O(n³) reduction plus O(n²) QL
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::vector<double> eigvals(const AbstractMatrix& A, size_t max_iter = 1000);
 
-/// Full eigendecomposition of a real symmetric matrix via QR iteration
+/// Full eigendecomposition of a real symmetric matrix (implicit-shift QL)
 /// Returns {eigenvalues (descending), V} where columns of V are eigenvectors
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::pair<std::vector<double>, DynamicMatrix>
 eig(const AbstractMatrix& A, size_t max_iter = 1000);
 
+/// The k largest eigenpairs of a real symmetric matrix: eigenvalues by QL,
+/// eigenvectors by inverse iteration on the tridiagonal form
+/// Returns {k eigenvalues (descending), V (n×k)}
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::pair<std::vector<double>, DynamicMatrix>
+eigs(const AbstractMatrix& A, size_t k, size_t max_iter = 1000);
+
 // ── SVD ───────────────────────────────────────────────────────────────────────
 
+/// The SVD reduces A to bidiagonal form with Householder reflections
+/// (Golub–Kahan), runs implicit-shift QR on the bidiagonal, and maps the
+/// singular vectors back; tall A is first reduced to its R factor.  AᵀA is
+/// never formed.  max_iter caps the QR sweeps per singular value;
+/// std::runtime_error is thrown if it is exceeded.
+
+/// Which singular vectors svd() computes (k = min(m, n)).
+enum class SVDMode {
+    Thin,        // U m×k, Vt k×n
+    Full,        // U m×m, Vt n×n
+    RightOnly,   // Vt k×n; U is returned empty
+    ValuesOnly   // U and Vt are returned empty
+};
+
 /// Thin SVD: A ≈ U * diag(S) * Vt, where k = min(rows, cols)
 /// Returns {U (m×k), S (k singular values, descending), Vt (k×n)}
 SHAREDMATH_LINEARALGEBRA_EXPORT
 std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
 svd(const AbstractMatrix& A, size_t max_iter = 1000);
 
+/// SVD with the singular vectors selected by `mode`
+/// Returns {U, S (k singular values, descending), Vt}
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
+svd(const AbstractMatrix& A, SVDMode mode, size_t max_iter = 1000);
+
+/// Singular values only (descending) — same as svd(A, SVDMode::ValuesOnly)
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<double> svdvals(const AbstractMatrix& A, size_t max_iter = 1000);
+
 /// Randomized SVD (Halko–Martinsson–Tropp 2011)
 /// Computes a rank-k approximation: A ≈ U * diag(S) * Vt
 ///   k          — number of singular values/vectors to compute
@@ -200,22 +237,33 @@ rsvd(const AbstractMatrix& A,
 // ── Tensor operations ─────────────────────────────────────────────────────────
 
 /// Generalised tensor contraction over paired axes
-/// axes_a[i] of a is contracted with axes_b[i] of b; dimensions must match
+/// axes_a[i] of a is contracted with axes_b[i] of b; dimensions must match.
+/// Lowered to a single GEMM over the permuted operands.
 SHAREDMATH_LINEARALGEBRA_EXPORT
 Tensor tensordot(const Tensor& a, const Tensor& b,
                  const std::vector<size_t>& axes_a,
                  const std::vector<size_t>& axes_b);
 
-/// Einstein summation — single-operand form
-/// Supported patterns: "ij->ji", "ii->", "ij->i", "ij->j", "ij->", "ii->i"
+/// Einstein summation, "lhs->rhs" with explicit output, e.g. "ij,jk->ik",
+/// "bij,bjk->bik", "ii->", "ij,jk,kl->il".
+/// The subscripts are parsed once into a plan (cached by subscripts and
+/// operand shapes): repeated labels take the diagonal, operands are
+/// contracted pairwise in a greedy order as batched GEMMs, and the result
+/// is permuted into the output order.  A scalar result has shape {1}.
+/// Float32 inputs are computed in double precision.
+
+/// Single-operand form
 SHAREDMATH_LINEARALGEBRA_EXPORT
 Tensor einsum(const std::string& subscripts, const Tensor& a);
 
-/// Einstein summation — two-operand form
-/// Supported patterns: "ij,jk->ik", "i,i->", "i,j->ij", "ij,ij->", etc.
+/// Two-operand form
 SHAREDMATH_LINEARALGEBRA_EXPORT
 Tensor einsum(const std::string& subscripts, const Tensor& a, const Tensor& b);
 
+/// N-operand form; operands.size() must match the subscripts
+SHAREDMATH_LINEARALGEBRA_EXPORT
+Tensor einsum(const std::string& subscripts, const std::vector<Tensor>& operands);
+
 // ── Structured matrix generators ─────────────────────────────────────────────
 
 /// Symmetric Toeplitz matrix from first row c (and first column = c)
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "AbstractMatrix.h"
+#include "LinearSolver.h"
+#include "SparseMatrix.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <memory>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Approximate inverse M⁻¹ ≈ A⁻¹ used to accelerate the Krylov solvers.
+///
+/// apply() computes z = M⁻¹·r into a caller-owned z of size size().  All
+/// preconditioners below are built once from A and are read-only afterwards,
+/// so one instance may be shared by concurrent solves.
+///
+/// cg and minres need a symmetric positive definite M (Jacobi, IC(0), SSOR
+/// and AMG are, for SPD A); gmres and bicgstab accept any M.
+class SHAREDMATH_LINEARALGEBRA_EXPORT Preconditioner {
+public:
+    virtual ~Preconditioner() = default;
+
+    virtual size_t size() const noexcept = 0;
+
+    /// z = M⁻¹·r   (r.size() == z.size() == size())
+    virtual void apply(const std::vector<double>& r, std::vector<double>& z) const = 0;
+};
+
+/// ── Identity ──────────────────────────────────────────────────────────────────
+/// M = I.  Lets callers ask for a solver report without preconditioning.
+class SHAREDMATH_LINEARALGEBRA_EXPORT IdentityPreconditioner final : public Preconditioner {
+public:
+    explicit IdentityPreconditioner(size_t n) noexcept : n_(n) {}
+
+    size_t size() const noexcept override { return n_; }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+private:
+    size_t n_;
+};
+
+/// ── Jacobi ────────────────────────────────────────────────────────────────────
+/// M = diag(A).  Reads the diagonal straight from CSR storage for a
+/// SparseMatrix.  Throws std::invalid_argument on a zero diagonal entry.
+class SHAREDMATH_LINEARALGEBRA_EXPORT JacobiPreconditioner final : public Preconditioner {
+public:
+    explicit JacobiPreconditioner(const AbstractMatrix& A);
+
+    size_t size() const noexcept override { return inv_diag_.size(); }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+private:
+    std::vector<double> inv_diag_;
+};
+
+/// ── ILU(0) ────────────────────────────────────────────────────────────────────
+/// Incomplete LU with zero fill: L·U ≈ A restricted to the sparsity pattern
+/// of A.  L is unit lower triangular; both factors share one CSR array.
+/// Throws std::invalid_argument if a diagonal entry is missing or a pivot
+/// vanishes.
+class SHAREDMATH_LINEARALGEBRA_EXPORT ILU0Preconditioner final : public Preconditioner {
+public:
+    explicit ILU0Preconditioner(const SparseMatrix& A);
+
+    size_t size() const noexcept override { return row_ptr_.size() - 1; }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+private:
+    std::vector<double> values_;   // L (strictly lower, unit diag implied) + U
+    std::vector<size_t> col_idx_;
+    std::vector<size_t> row_ptr_;
+    std::vector<size_t> diag_;     // position of (i, i) inside row i
+};
+
+/// ── IC(0) ─────────────────────────────────────────────────────────────────────
+/// Incomplete Cholesky with zero fill: L·Lᵀ ≈ A on the lower-triangular
+/// pattern of A (A must be symmetric).  `shift` factors A + shift·diag(A)
+/// instead, the usual remedy when a pivot turns non-positive.
+/// Throws std::runtime_error on breakdown.
+class SHAREDMATH_LINEARALGEBRA_EXPORT IC0Preconditioner final : public Preconditioner {
+public:
+    explicit IC0Preconditioner(const SparseMatrix& A, double shift = 0.0);
+
+    size_t size() const noexcept override { return row_ptr_.size() - 1; }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+private:
+    std::vector<double> values_;   // rows of L, diagonal stored last in each row
+    std::vector<size_t> col_idx_;
+    std::vector<size_t> row_ptr_;
+};
+
+/// ── SSOR ──────────────────────────────────────────────────────────────────────
+/// Symmetric successive over-relaxation, one forward and one backward sweep:
+///   M = (D + ωL) · D⁻¹ · (D + ωU) / (ω(2−ω)),   0 < ω < 2.
+/// Symmetric positive definite whenever A is.
+class SHAREDMATH_LINEARALGEBRA_EXPORT SSORPreconditioner final : public Preconditioner {
+public:
+    explicit SSORPreconditioner(const SparseMatrix& A, double omega = 1.0);
+
+    size_t size() const noexcept override { return A_.rows(); }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+private:
+    SparseMatrix        A_;
+    std::vector<double> diag_;
+    std::vector<size_t> diag_pos_;
+    double              omega_;
+};
+
+/// ── Smoothed-aggregation AMG ──────────────────────────────────────────────────
+/// One V-cycle of algebraic multigrid per apply().
+///
+/// Setup, per level: strength-of-connection filter |a_ij| ≥ θ·√|a_ii·a_jj|,
+/// greedy aggregation, a piecewise-constant tentative prolongator smoothed
+/// by one damped-Jacobi step P = (I − ω/ρ·D⁻¹A)·P₀, and the Galerkin coarse
+/// operator Pᵀ·A·P.  The coarsest level is factorised densely (LU).
+/// Damped Jacobi smoothing keeps the cycle symmetric, so it can precondition
+/// cg for SPD A.
+class SHAREDMATH_LINEARALGEBRA_EXPORT AMGPreconditioner final : public Preconditioner {
+public:
+    struct Options {
+        double strength_threshold = 0.08;      // θ
+        size_t max_levels         = 10;
+        size_t coarse_size        = 64;        // stop coarsening at this many rows
+        size_t pre_smooth         = 1;         // damped-Jacobi sweeps before / after
+        size_t post_smooth        = 1;         //   the coarse-grid correction
+        double jacobi_weight      = 2.0 / 3.0; // smoother damping
+    };
+
+    explicit AMGPreconditioner(const SparseMatrix& A);
+    AMGPreconditioner(const SparseMatrix& A, const Options& opts);
+
+    size_t size() const noexcept override { return levels_.front().A.rows(); }
+    void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+    /// Number of levels in the hierarchy, including the finest.
+    size_t levels() const noexcept { return levels_.size(); }
+
+    /// Rows of the operator on level `l` (0 = finest).
+    size_t levelSize(size_t l) const { return levels_.at(l).A.rows(); }
+
+private:
+    struct Level {
+        SparseMatrix        A;
+        SparseMatrix        P;          // prolongation to this level from the next
+        SparseMatrix        R;          // Pᵀ
+        std::vector<double> inv_diag;
+    };
+
+    void cycle(size_t l, const std::vector<double>& b, std::vector<double>& x) const;
+    void smooth(const Level& L, const std::vector<double>& b,
+                std::vector<double>& x, size_t sweeps) const;
+
+    Options                       opts_;
+    std::vector<Level>            levels_;
+    std::unique_ptr<LinearSolver> coarse_;
+};
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "AbstractMatrix.h"
+#include "DynamicMatrix.h"
+#include "LinearOperator.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// Randomized low-rank approximation
+///
+/// Every routine reaches A only through block products A·X and Aᵀ·X
+/// (LinearOperator::applyBlock / applyTransposeBlock), so A may be a dense
+/// DynamicMatrix (GEMM), a SparseMatrix (sparse × dense) or a matrix-free
+/// FunctionOperator.  The cost is a handful of passes over A plus O(m·l²)
+/// dense work, where l = k + oversampling is the sketch width.
+///
+///   randomizedRangeFinder   orthonormal Q with A ≈ Q·Qᵀ·A
+///   randomizedSVD           A ≈ U·diag(S)·Vt
+///   randomizedEigh          A ≈ V·diag(λ)·Vᵀ for symmetric A
+///   nystrom                 A ≈ U·diag(λ)·Uᵀ for positive semidefinite A
+///   StreamingSketch         single pass over the rows of A
+///
+/// References: Halko, Martinsson & Tropp (2011), "Finding structure with
+/// randomness"; Tropp, Yurtsever, Udell & Cevher (2017), "Fixed-rank
+/// approximation of a positive-semidefinite matrix from streaming data" and
+/// "Practical sketching algorithms for low-rank matrix approximation".
+///
+/// Test matrices are drawn from a seeded generator, so results are
+/// reproducible for a given seed.
+/// ─────────────────────────────────────────────────────────────────────────────
+
+struct RandomizedOptions {
+    size_t        oversampling = 10;    // sketch width l = k + oversampling
+    size_t        power_iters  = 2;     // subspace iterations (one A and one Aᵀ pass each)
+    std::uint64_t seed         = 20240101;
+};
+
+/// A ≈ U·diag(S)·Vt with U m×k, S descending, Vt k×n.
+struct LowRankSVD {
+    DynamicMatrix       U;
+    std::vector<double> S;
+    DynamicMatrix       Vt;
+};
+
+/// A ≈ V·diag(values)·Vᵀ with V n×k orthonormal.
+struct LowRankEigen {
+    std::vector<double> values;
+    DynamicMatrix       vectors;
+};
+
+/// m×l matrix with orthonormal columns spanning an approximation of the
+/// range of A: Y = A·Ω for a Gaussian Ω, followed by power_iters rounds of
+/// Z = orth(Aᵀ·Q), Q = orth(A·Z).  Every product is re-orthonormalized with
+/// Householder QR, so the basis stays accurate for slowly decaying spectra
+/// and rank-deficient A.  Power iterations need A's transpose.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+DynamicMatrix randomizedRangeFinder(const LinearOperator& A, size_t l,
+                                    size_t power_iters = 2,
+                                    std::uint64_t seed = 20240101);
+
+/// Rank-k truncated SVD.  k must be in [1, min(m, n)]; A needs a transpose.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankSVD randomizedSVD(const LinearOperator& A, size_t k,
+                         const RandomizedOptions& opt = {});
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankSVD randomizedSVD(const AbstractMatrix& A, size_t k,
+                         const RandomizedOptions& opt = {});
+
+/// The k eigenpairs of largest magnitude of a symmetric A (eigenvalues
+/// sorted descending).  Only A·X is used, since Aᵀ = A.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankEigen randomizedEigh(const LinearOperator& A, size_t k,
+                            const RandomizedOptions& opt = {});
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankEigen randomizedEigh(const AbstractMatrix& A, size_t k,
+                            const RandomizedOptions& opt = {});
+
+/// Nyström approximation of a positive semidefinite A (kernel and Gram
+/// matrices) from one block product A·Ω, using the shifted, numerically
+/// stable form of Tropp et al.  Returns the k largest eigenpairs of the
+/// approximation; eigenvalues are clipped at zero.  power_iters is ignored.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankEigen nystrom(const LinearOperator& A, size_t k,
+                     const RandomizedOptions& opt = {});
+SHAREDMATH_LINEARALGEBRA_EXPORT
+LowRankEigen nystrom(const AbstractMatrix& A, size_t k,
+                     const RandomizedOptions& opt = {});
+
+/// ── Single-pass sketch ────────────────────────────────────────────────────────
+
+/// Low-rank SVD of a matrix whose rows arrive in blocks and are seen only
+/// once (data that does not fit in memory).  For each block of rows R the
+/// sketch keeps R·Ω (the range sketch, l columns per row seen) and adds
+/// Ψ(:, rows)·R into the l' × n co-range sketch W, where l' = 2l + 1; the
+/// columns of Ψ are regenerated from the seed rather than stored.
+/// finalize() solves (Ψ·Q)·X = W for X in the least-squares sense and returns
+/// the rank-k SVD of Q·X.  Memory is O((rows + n)·l).
+///
+///   StreamingSketch sk(n_cols, 20);
+///   while (reader.next(block)) sk.append(block);
+///   LowRankSVD f = sk.finalize();
+class SHAREDMATH_LINEARALGEBRA_EXPORT StreamingSketch {
+public:
+    StreamingSketch(size_t cols, size_t k, const RandomizedOptions& opt = {});
+
+    /// Add the next rows (a block with cols() columns).
+    void append(const DynamicMatrix& rows);
+
+    /// Rank-k SVD of everything appended so far; the sketch may keep growing.
+    LowRankSVD finalize() const;
+
+    size_t rows() const noexcept { return rows_; }
+    size_t cols() const noexcept { return cols_; }
+    size_t rank() const noexcept { return k_; }
+
+private:
+    size_t              cols_, k_, l_, s_;
+    size_t              rows_ = 0;
+    std::uint64_t       seed_;
+    DynamicMatrix       Omega_;     // cols × l
+    std::vector<double> Y_;         // rows × l, row-major, grows with append()
+    DynamicMatrix       W_;         // s × cols
+
+    /// Column `row` of Ψ (s entries), identical on every call.
+    void psiColumn(size_t row, double* out) const;
+};
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "DynamicMatrix.h"
+#include "DynamicVector.h"
+#include "SparseMatrix.h"
+#include "SparseOrdering.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Supernodal sparse direct solver for square SparseMatrix systems:
+///   A(p, p)   = L·Lᵀ     (Method::Cholesky, A symmetric positive definite)
+///   P·A(p, p) = L·U      (Method::LU)
+///
+/// Usage:
+///   SparseDirectSolver sol(A);                 // analyse + factorize
+///   DynamicVector x = sol.solve(b);
+///   sol.refactor(A2);                          // same pattern, new values
+///   DynamicVector y = sol.solve(b2);
+///
+/// The symbolic analysis runs once per pattern: a fill-reducing ordering of
+/// A + Aᵀ, the elimination tree and its postorder, the column structure of
+/// the factor, and relaxed supernodes (consecutive columns with nested
+/// structure, padded with a few explicit zeros).  The numeric phase is
+/// multifrontal: each supernode assembles a dense frontal matrix from A and
+/// its children's update matrices, eliminates its own columns with blocked
+/// dense kernels (trsm / gemm) and passes the Schur complement up the tree.
+/// Independent subtrees are factorized concurrently on the thread pool;
+/// the large fronts near the root use the parallel gemm instead.
+///
+/// LU pivots by rows inside each supernode: the diagonal is kept while
+/// |a_jj| >= pivot_tol · max_i |a_ij|, otherwise the largest candidate
+/// among the supernode's own rows is taken.  Pivots are never delayed to
+/// the parent, so the structure is fixed by the analysis.  A candidate
+/// below √ε·max|A| is replaced by that value (static pivoting);
+/// perturbed_pivots() counts these and solve() then applies iterative
+/// refinement against A.
+///
+/// Throws std::invalid_argument for a non-square matrix (or an unsymmetric
+/// one with Method::Cholesky), std::runtime_error when Cholesky meets a
+/// non-positive pivot or a column of A(p, p) is numerically zero.
+class SHAREDMATH_LINEARALGEBRA_EXPORT SparseDirectSolver {
+public:
+    enum class Method {
+        Auto,       // symmetric with a positive diagonal → Cholesky, falling back to LU
+        Cholesky,   // LLᵀ (A must be symmetric positive-definite)
+        LU,         // LU with threshold partial pivoting inside supernodes
+    };
+
+    /// pivot_tol ∈ (0, 1] is only used by LU.
+    explicit SparseDirectSolver(const SparseMatrix& A,
+                                Method method = Method::Auto,
+                                SparseOrdering ordering = SparseOrdering::AMD,
+                                double pivot_tol = 0.1);
+
+    /// Numeric refactorization for a matrix with the same pattern; the
+    /// ordering, elimination tree and supernodes are reused.  With
+    /// Method::Auto the Cholesky / LU choice is made again.
+    /// Throws std::invalid_argument if the pattern differs.
+    void refactor(const SparseMatrix& A);
+
+    /// ── Solve ─────────────────────────────────────────────────────────────
+
+    DynamicVector       solve(const DynamicVector& b) const;
+    std::vector<double> solve(const std::vector<double>& b) const;
+
+    /// Solve AX = B (multiple right-hand sides, solved together)
+    DynamicMatrix solve(const DynamicMatrix& B) const;
+
+    /// ── Queries ───────────────────────────────────────────────────────────
+
+    /// Cholesky or LU (never Auto once constructed)
+    Method method() const noexcept { return method_; }
+    size_t size()   const noexcept { return n_; }
+
+    /// Stored entries of L (Cholesky) or of L and U, explicit zeros included
+    size_t nnz_factor() const noexcept;
+    size_t supernodes() const noexcept { return sn_.size(); }
+
+    /// LU pivots replaced by √ε·max|A| in the last factorization
+    size_t perturbed_pivots() const noexcept { return perturbed_; }
+
+private:
+    struct Supernode {
+        size_t first = 0, cols = 0;      // pivot columns first .. first + cols - 1
+        std::vector<size_t> rows;        // rows below the block, ascending
+        std::vector<size_t> relind;      // rows[i] → row of the parent's front
+        std::vector<size_t> children;
+        size_t parent;                   // sn_.size() for a root
+    };
+    struct Factor {
+        std::vector<double> top;         // pivot rows: cols × (LU: front size, Cholesky: cols)
+        std::vector<double> bottom;      // rows.size() × cols, the L block below
+        std::vector<size_t> piv;         // LU: row j was swapped with row piv[j]
+    };
+
+    size_t n_ = 0;
+    Method requested_, method_;
+    double pivot_tol_;
+    size_t perturbed_ = 0;
+    SparseMatrix A_;                     // kept for refinement and pattern checks
+
+    // Symbolic analysis
+    std::vector<size_t> perm_;           // perm_[k] = original index of pivot k
+    std::vector<Supernode> sn_;          // in postorder
+    std::vector<size_t> asmPtr_, asmSrc_, asmDst_;   // A value → front position
+    std::vector<size_t> firstDesc_;      // subtree of s = supernodes firstDesc_[s] .. s
+    std::vector<size_t> tasks_, top_;    // parallel subtrees, then the nodes above them
+
+    // Numeric factorization
+    std::vector<Factor> factors_;
+
+    void analyse(SparseOrdering ordering);
+    void factorize();
+    void factorizeAs(Method method);
+    void factorFront(size_t s, std::vector<std::vector<double>>& updates, double tiny,
+                     size_t& perturbed);
+    void solvePermuted(double* X, size_t k) const;
+    std::vector<double> solveRefined(const std::vector<double>& B, size_t k) const;
+};
+
+} // namespace SharedMath::LinearAlgebra
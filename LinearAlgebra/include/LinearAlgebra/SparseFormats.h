@@ -0,0 +1,120 @@
+#pragma once
+
+#include "LinearOperator.h"
+#include "SparseMatrix.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+// Alternative storage layouts for a sparse matrix, each tuned for one kind
+// of product.  SparseMatrix (CSR) is the hub: every format is built from a
+// SparseMatrix and converts back with to_csr(), so any format reaches any
+// other in two steps, e.g.  BSRMatrix(CSCMatrix(A).to_csr(), 3).
+//
+// All of them are LinearOperators and own their arrays, so they can be
+// handed straight to the Krylov solvers in IterativeSolvers.h.  Products
+// run over the shared thread pool, split by stored entries rather than by
+// rows.
+
+/// ── CSC ───────────────────────────────────────────────────────────────────────
+/// Compressed sparse column: the CSR arrays of Aᵀ.  applyTranspose() is a
+/// gather per column and runs in parallel; apply() is a serial scatter.
+/// Prefer it over SparseOperator when Aᵀ·x dominates (lsqr, normal equations).
+class SHAREDMATH_LINEARALGEBRA_EXPORT CSCMatrix final : public LinearOperator {
+public:
+    explicit CSCMatrix(const SparseMatrix& A);
+
+    size_t rows() const noexcept override { return rows_; }
+    size_t cols() const noexcept override { return cols_; }
+    size_t nnz()  const noexcept { return values_.size(); }
+
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+
+    const std::vector<double>& values()      const noexcept { return values_;  }
+    const std::vector<size_t>& row_indices() const noexcept { return row_idx_; }
+    const std::vector<size_t>& col_ptr()     const noexcept { return col_ptr_; }
+
+    SparseMatrix to_csr() const;
+
+private:
+    size_t              rows_, cols_;
+    std::vector<double> values_;
+    std::vector<size_t> row_idx_;   // row of each entry, ascending per column
+    std::vector<size_t> col_ptr_;   // size cols+1
+};
+
+/// ── SELL-C-σ ──────────────────────────────────────────────────────────────────
+/// Sliced ELLPACK (Kreutzer et al.).  Rows are sorted by length inside
+/// windows of σ rows, then cut into slices of C rows; each slice is padded
+/// to its longest row and stored column-major, so entry j of the C rows of a
+/// slice is contiguous.  The SpMV inner loop then runs over C independent
+/// rows with unit stride, which the compiler vectorises.
+///
+/// σ trades padding for locality: σ = 1 keeps the original row order, a
+/// larger σ groups rows of similar length and shrinks the padding on
+/// irregular matrices.  C must be in [1, 64]; 4–8 matches AVX2/AVX-512 width.
+class SHAREDMATH_LINEARALGEBRA_EXPORT SELLMatrix final : public LinearOperator {
+public:
+    explicit SELLMatrix(const SparseMatrix& A, size_t C = 8, size_t sigma = 256);
+
+    size_t rows() const noexcept override { return rows_; }
+    size_t cols() const noexcept override { return cols_; }
+    size_t nnz()  const noexcept { return nnz_; }
+
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+
+    size_t chunkSize()  const noexcept { return C_; }
+    size_t sortWindow() const noexcept { return sigma_; }
+
+    /// Stored slots (including padding) per true non-zero; 1 means no padding.
+    double fillRatio() const noexcept;
+
+    SparseMatrix to_csr() const;
+
+private:
+    size_t              rows_, cols_, nnz_;
+    size_t              C_, sigma_;
+    std::vector<size_t> perm_;        // slot r of the sorted order holds row perm_[r]
+    std::vector<size_t> slice_ptr_;   // first slot of each slice, size slices+1
+    std::vector<size_t> slice_len_;   // padded row length of each slice
+    std::vector<size_t> row_len_;     // true length of each sorted row
+    std::vector<size_t> col_idx_;     // slot s·C·len + j·C + r
+    std::vector<double> values_;      //   (padding: value 0, a valid column)
+};
+
+/// ── BSR ───────────────────────────────────────────────────────────────────────
+/// Block sparse row: CSR over dense b×b blocks (row-major inside a block).
+/// One column index per block instead of per entry, and b-wide dense inner
+/// loops — a good fit for FEM matrices with b unknowns per node.
+/// Throws std::invalid_argument unless b divides both dimensions.
+class SHAREDMATH_LINEARALGEBRA_EXPORT BSRMatrix final : public LinearOperator {
+public:
+    BSRMatrix(const SparseMatrix& A, size_t block_size);
+
+    size_t rows() const noexcept override { return rows_; }
+    size_t cols() const noexcept override { return cols_; }
+
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override;
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override;
+    bool hasTranspose() const noexcept override { return true; }
+
+    size_t blockSize() const noexcept { return b_; }
+    size_t numBlocks() const noexcept { return block_col_.size(); }
+
+    /// Drops the explicit zeros that padding the blocks introduced.
+    SparseMatrix to_csr() const;
+
+private:
+    size_t              rows_, cols_, b_;
+    std::vector<size_t> block_row_ptr_;   // size rows/b + 1
+    std::vector<size_t> block_col_;       // block column of each block
+    std::vector<double> values_;          // numBlocks()·b·b
+};
+
+} // namespace SharedMath::LinearAlgebra
@@ -23,6 +23,10 @@ namespace SharedMath::LinearAlgebra {
 /// All entries within a row are stored in ascending column order.
 /// Duplicate (i,j) entries in from_triplets() are summed automatically.
 ///
+/// CSR is the hub format: CSCMatrix, SELLMatrix and BSRMatrix
+/// (SparseFormats.h) are built from a SparseMatrix and convert back with
+/// to_csr().
+///
 class SHAREDMATH_LINEARALGEBRA_EXPORT SparseMatrix : public AbstractMatrix {
 public:
     /// ── Construction ──────────────────────────────────────────────────────
@@ -37,6 +41,13 @@ public:
                                       const std::vector<size_t>& col_idx,
                                       const std::vector<double>& values);
 
+    /// Adopt ready-made CSR arrays.  Column indices must be ascending within
+    /// each row; throws std::invalid_argument otherwise.
+    static SparseMatrix from_csr(size_t rows, size_t cols,
+                                 std::vector<size_t> row_ptr,
+                                 std::vector<size_t> col_idx,
+                                 std::vector<double> values);
+
     /// Convert dense matrix to sparse (drop entries with |v| <= tol).
     static SparseMatrix from_dense(const AbstractMatrix& A, double tol = 0.0);
 
@@ -77,10 +88,15 @@ public:
     bool isSquare() const noexcept { return rows_ == cols_; }
 
     // ── Arithmetic ────────────────────────────────────────────────────────
+    // SpMV and SpMM split rows across the thread pool so that each task owns
+    // about the same number of non-zeros, not the same number of rows.
 
     // Sparse matrix–vector multiply: y = A * x
     DynamicVector operator*(const DynamicVector& x) const;
 
+    // y = A * x into a caller-owned y of size rows() (no allocation)
+    void multiply(const std::vector<double>& x, std::vector<double>& y) const;
+
     // Sparse matrix–dense matrix multiply: C = A * B (result is dense)
     DynamicMatrix operator*(const DynamicMatrix& B) const;
 
@@ -92,10 +108,13 @@ public:
 
     friend SparseMatrix operator*(double s, const SparseMatrix& m) { return m * s; }
 
-    /// Sparse–sparse matrix multiply
+    /// Sparse–sparse matrix multiply (parallel Gustavson, two passes: a
+    /// symbolic pass sizes every output row, a numeric pass fills them in
+    /// place).  Entries that cancel to zero stay in the pattern.
     SparseMatrix matmul(const SparseMatrix& B) const;
 
     /// ── Transpose ─────────────────────────────────────────────────────────
+    /// O(nnz + rows + cols) counting sort; no comparison sort.
     SparseMatrix transposed() const;
 
     /// ── Conversion ────────────────────────────────────────────────────────
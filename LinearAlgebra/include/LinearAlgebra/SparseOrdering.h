@@ -0,0 +1,54 @@
+#pragma once
+
+#include "SparseMatrix.h"
+#include <sharedmath_linearalgebra_export.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+/// Fill-reducing orderings for sparse direct factorization.
+///
+/// Every ordering works on the symmetric pattern of A + Aᵀ (the diagonal is
+/// ignored) and returns perm with perm[k] = the original row / column that
+/// is eliminated k-th, i.e. the factorization is applied to A(perm, perm).
+enum class SparseOrdering {
+    Natural,    // perm[k] = k
+    AMD,        // approximate minimum degree
+    NestedDissection,   // recursive vertex separators, AMD on the leaves
+};
+
+/// Approximate minimum degree (Amestoy, Davis & Duff) on a square CSR or
+/// CSC pattern.  Works on the quotient graph with element absorption and
+/// approximate external degrees; rows denser than 10·√n are ordered last.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<size_t> amdOrdering(size_t n,
+                                const std::vector<size_t>& ptr,
+                                const std::vector<size_t>& idx);
+
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<size_t> amdOrdering(const SparseMatrix& A);
+
+/// Nested dissection on a square CSR or CSC pattern.  Each connected piece
+/// is split by a level-structure separator (the middle BFS level from a
+/// pseudo-peripheral node, trimmed to the vertices that actually touch the
+/// far side); both halves are ordered recursively and the separator last.
+/// Pieces of at most 128 vertices are ordered with AMD.  Separators are
+/// what make the elimination tree wide, so this is the ordering to use
+/// with the tree-parallel SparseDirectSolver on large 2-D / 3-D meshes.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<size_t> nestedDissectionOrdering(size_t n,
+                                             const std::vector<size_t>& ptr,
+                                             const std::vector<size_t>& idx);
+
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<size_t> nestedDissectionOrdering(const SparseMatrix& A);
+
+/// Dispatch on `ordering`.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+std::vector<size_t> fillReducingOrdering(SparseOrdering ordering, size_t n,
+                                         const std::vector<size_t>& ptr,
+                                         const std::vector<size_t>& idx);
+
+} // namespace SharedMath::LinearAlgebra
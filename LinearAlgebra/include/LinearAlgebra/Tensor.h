@@ -3,6 +3,7 @@
 #include "constans.h"
 #include <sharedmath_linearalgebra_export.h>
 
+#include <array>
 #include <vector>
 #include <functional>
 #include <string>
@@ -21,17 +22,27 @@ namespace SharedMath::LinearAlgebra {
 /// -DSHAREDMATH_ENABLE_CUDA=ON. On CPU-only builds, .cuda() is a no-op.
 enum class SHAREDMATH_LINEARALGEBRA_EXPORT Device { CPU, CUDA };
 
+/// Element type of a CPU tensor.  Float32 tensors store floats (half the
+/// memory of Float64) and run element-wise ops, reductions, matmul and conv2d
+/// in single precision; the remaining ops widen to Float64 internally and
+/// narrow the result back.  Binary ops between mixed dtypes promote to
+/// Float64.  GPU tensors are always Float64.
 enum class SHAREDMATH_LINEARALGEBRA_EXPORT TensorDType {
     Float64,
     Float32
 };
 
-namespace detail { struct TensorCUDAImpl; }   // forward-declared CUDA accessor
+namespace detail {
+struct TensorCUDAImpl;   // forward-declared CUDA accessor
+struct TensorInto;       // out-parameter kernels (Tensor.cpp)
+}
 
 class Tensor;
 
 /// Lightweight non-owning view into a CPU Tensor. It keeps the original storage
 /// and uses shape/stride metadata, so writing through the view updates the base.
+/// Unlike the views returned by Tensor::slice, writes here are not copy-on-
+/// write: the base tensor is the one being written.
 class SHAREDMATH_LINEARALGEBRA_EXPORT TensorView {
 public:
     using Shape = std::vector<size_t>;
@@ -62,8 +73,14 @@ private:
     friend class Tensor;
 };
 
-/// N-dimensional dense tensor with row-major (C-contiguous) storage.
+/// N-dimensional dense tensor.  Elements live in a reference-counted host
+/// buffer addressed through shape, strides and an offset, so copies and the
+/// shape ops (reshape, transpose, permute, slice, split, squeeze, broadcast_to)
+/// share storage and cost O(1).  Writable element access gives the tensor a
+/// private row-major buffer first (copy-on-write).
 /// Supports NumPy-style broadcasting, axis reductions, and element-wise math.
+/// Elements are stored as double (Float64, the default) or float (Float32);
+/// see TensorDType.
 /// When built with CUDA support, tensors can be moved to GPU with .cuda() and
 /// back with .cpu(). Operations between two GPU tensors are dispatched to cuBLAS
 /// / custom CUDA kernels automatically.
@@ -82,6 +99,7 @@ public:
 
     /// Static factories
     static Tensor zeros(Shape shape);
+    static Tensor zeros(Shape shape, TensorDType dtype);
     static Tensor ones(Shape shape);
     static Tensor eye(size_t n);
     static Tensor arange(double start, double stop, double step = 1.0);
@@ -93,6 +111,8 @@ public:
     static Tensor randn(Shape shape, std::uint64_t seed = 0);
     static Tensor bernoulli(Shape shape, double p = 0.5, std::uint64_t seed = 0);
     static Tensor from_vector(const std::vector<double>& v);
+    /// Float32 tensor taking ownership of `data`.
+    static Tensor from_f32(Shape shape, std::vector<float> data);
     static Tensor from_matrix(size_t rows, size_t cols,
                               const std::vector<double>& flat_row_major);
     static Tensor concat(const std::vector<Tensor>& tensors, size_t axis = 0);
@@ -134,26 +154,98 @@ public:
     // Element access
     // ------------------------------------------------------------------ //
 
-    // t(i, j, k) — variadic, bounds-checked
+    /// Writable element of either dtype: reads widen to double, writes
+    /// narrow to the tensor's storage type.  Returned by the non-const
+    /// element accessors; it converts to double wherever a value is needed.
+    class ElementRef {
+    public:
+        operator double() const noexcept {
+            return m_f64 ? *m_f64 : static_cast<double>(*m_f32);
+        }
+        ElementRef& operator=(double v) noexcept {
+            if (m_f64) *m_f64 = v; else *m_f32 = static_cast<float>(v);
+            return *this;
+        }
+        ElementRef& operator=(const ElementRef& o) noexcept {
+            return *this = static_cast<double>(o);
+        }
+        ElementRef& operator+=(double v) noexcept { return *this = double(*this) + v; }
+        ElementRef& operator-=(double v) noexcept { return *this = double(*this) - v; }
+        ElementRef& operator*=(double v) noexcept { return *this = double(*this) * v; }
+        ElementRef& operator/=(double v) noexcept { return *this = double(*this) / v; }
+
+    private:
+        friend class Tensor;
+        ElementRef(double* f64, float* f32) noexcept : m_f64(f64), m_f32(f32) {}
+        ElementRef(const ElementRef&) = default;
+        double* m_f64;
+        float*  m_f32;
+    };
+
+    // t(i, j, k) — variadic, bounds-checked.  The rank is known at compile
+    // time, so the index lives in a stack array (no allocation per access).
     template<typename... Idx>
-    double& operator()(Idx... indices) {
-        return m_data[flatIndex({ static_cast<size_t>(indices)... })];
+    ElementRef operator()(Idx... indices) {
+        prepareWrite();
+        return elementRef(checkedOffset(indices...));
     }
     template<typename... Idx>
     double operator()(Idx... indices) const {
-        return m_data[flatIndex({ static_cast<size_t>(indices)... })];
+        const size_t off = checkedOffset(indices...);
+        return m_dtype == TensorDType::Float64 ? (*m_data)[off]
+                                               : static_cast<double>((*m_data_f32)[off]);
     }
 
-    double& at(const std::vector<size_t>& idx);
-    double  at(const std::vector<size_t>& idx) const;
+    /// t.at_unsafe(i, j, k) — no rank, bounds, device or dtype checks.  For
+    /// inner loops whose indices are already known to be valid on a Float64
+    /// CPU tensor.  The writable overload still detaches shared storage.
+    template<typename... Idx>
+    double& at_unsafe(Idx... indices) {
+        prepareWrite();
+        return (*m_data)[uncheckedOffset(indices...)];
+    }
+    template<typename... Idx>
+    double at_unsafe(Idx... indices) const noexcept {
+        return (*m_data)[uncheckedOffset(indices...)];
+    }
+
+    ElementRef at(const std::vector<size_t>& idx);
+    double     at(const std::vector<size_t>& idx) const;
 
     /// Raw flat access — only valid for CPU tensors; throws for GPU tensors.
-    double& flat(size_t i);
-    double  flat(size_t i) const;
+    ElementRef flat(size_t i);
+    double     flat(size_t i) const;
+
+    /// Host data vector in row-major order (empty for GPU and Float32
+    /// tensors — use .cpu().data() or data_f32() respectively).  A strided
+    /// view is compacted into its own buffer first, so the const overload is
+    /// not safe to call concurrently on the same view.  The writable overload
+    /// also detaches shared storage; the reference is invalidated by copying
+    /// the tensor.
+    const std::vector<double>& data() const;
+    std::vector<double>&       data();
+
+    /// Host data of a Float32 tensor (empty for any other tensor).
+    const std::vector<float>& data_f32() const;
+    std::vector<float>&       data_f32();
+
+    /// ── Storage layout ────────────────────────────────────────────────── //
+
+    /// Element strides into the shared buffer (0 along broadcast axes).
+    const std::vector<size_t>& strides() const noexcept { return m_strides; }
+
+    /// True when the tensor's elements are exactly its buffer, in row-major
+    /// order, i.e. data() needs no copy.  GPU tensors are always contiguous.
+    bool is_contiguous() const noexcept {
+        return m_device != Device::CPU ||
+               (m_rowMajor && m_offset == 0 && storageSize() == size());
+    }
+
+    /// *this when contiguous, otherwise a row-major copy.
+    Tensor contiguous() const;
 
-    /// Host data vector (empty for GPU tensors — use .cpu().data() to fetch).
-    const std::vector<double>& data()  const noexcept { return m_data; }
-    std::vector<double>&       data()        noexcept { return m_data; }
+    /// True when both tensors view the same host buffer.
+    bool shares_storage(const Tensor& other) const noexcept;
 
     /// ------------------------------------------------------------------ //
     /// Shape operations
@@ -174,6 +266,7 @@ public:
     Tensor broadcast_to(Shape target_shape)    const;
     std::vector<Tensor> split(size_t axis, const std::vector<size_t>& sections) const;
     std::vector<Tensor> split(size_t axis, size_t chunk_size) const;
+    /// Convert to another dtype (shares storage when the dtype is unchanged).
     Tensor astype(TensorDType dtype)           const;
 
     // ------------------------------------------------------------------ //
@@ -191,8 +284,16 @@ public:
     Tensor operator/(double s) const;
     Tensor operator-()         const;
 
+    /// In-place ops keep this tensor's dtype.  On the CPU they write into
+    /// this tensor's own buffer (copying it first if it is shared or
+    /// strided); when broadcasting `o` would change the shape, the tensor is
+    /// replaced by the broadcast result instead.
     Tensor& operator+=(const Tensor& o);
     Tensor& operator-=(const Tensor& o);
+    Tensor& operator*=(const Tensor& o);
+    Tensor& operator/=(const Tensor& o);
+    Tensor& operator+=(double s);
+    Tensor& operator-=(double s);
     Tensor& operator*=(double s);
     Tensor& operator/=(double s);
 
@@ -227,6 +328,8 @@ public:
     /// Element-wise math
     /// ------------------------------------------------------------------ //
 
+    /// f must be safe to call concurrently: large tensors are processed on
+    /// the shared thread pool.
     Tensor apply(std::function<double(double)> f) const;
     Tensor abs()                      const;
     Tensor sqrt()                     const;
@@ -258,17 +361,27 @@ public:
     // ML-oriented dense NCHW kernels. These are intentionally exposed at the
     // Tensor level so higher ML modules can dispatch through the same CPU/CUDA
     // backend instead of hand-writing loops in layers.
+    //
+    // weight is [OC, C / groups, KH, KW]; kernels may be non-square.  The CPU
+    // path picks im2col + GEMM, Winograd F(2x2, 3x3) or a channel-blocked
+    // depthwise kernel per call (see Conv2d.h).  On CUDA, dilated, grouped
+    // and non-square convolutions run on the host.
     Tensor conv2d(const Tensor& weight, const Tensor* bias = nullptr,
-                  size_t stride = 1, size_t padding = 0) const;
+                  size_t stride = 1, size_t padding = 0,
+                  size_t dilation = 1, size_t groups = 1) const;
     static Tensor conv2d_backward_input(const Tensor& grad_out,
                                         const Tensor& weight,
                                         Shape input_shape,
                                         size_t stride = 1,
-                                        size_t padding = 0);
+                                        size_t padding = 0,
+                                        size_t dilation = 1,
+                                        size_t groups = 1);
     Tensor conv2d_backward_weight(const Tensor& input,
                                   Shape weight_shape,
                                   size_t stride = 1,
-                                  size_t padding = 0) const;
+                                  size_t padding = 0,
+                                  size_t dilation = 1,
+                                  size_t groups = 1) const;
     Tensor conv2d_backward_bias() const;
 
     Tensor max_pool2d(size_t kernel_size, size_t stride = 0,
@@ -304,10 +417,19 @@ public:
 
 private:
     // ── CPU storage ───────────────────────────────────────────────────── //
-    Shape               m_shape;
-    std::vector<double> m_data;      // empty when tensor is on GPU
-    std::vector<size_t> m_strides;
-    TensorDType         m_dtype = TensorDType::Float64;
+    // Element idx sits at m_offset + sum(idx[i] * m_strides[i]) in the buffer
+    // matching m_dtype.  The layout members are mutable because const data()
+    // compacts a strided view in place.
+    using Buffer64 = std::shared_ptr<std::vector<double>>;
+    using Buffer32 = std::shared_ptr<std::vector<float>>;
+
+    Shape                       m_shape;
+    mutable Buffer64            m_data;      // null when tensor is on GPU or Float32
+    mutable Buffer32            m_data_f32;  // used instead of m_data for Float32
+    mutable std::vector<size_t> m_strides;
+    mutable size_t              m_offset   = 0;
+    mutable bool                m_rowMajor = true;   // strides are C-contiguous
+    TensorDType                 m_dtype = TensorDType::Float64;
 
     // ── GPU storage ──────────────────────────────────────────────────────//
     std::shared_ptr<CUDABuffer> m_cuda_buf;     // null → CPU tensor
@@ -317,20 +439,108 @@ private:
     /// ── Helpers ───────────────────────────────────────────────────────── //
     void   computeStrides();
     size_t flatIndex(const std::vector<size_t>& idx) const;
+    /// Buffer position of the element with row-major index i.
+    size_t physicalOffset(size_t i) const noexcept;
+
+    /// A tensor sharing this one's buffer under another layout.
+    Tensor strided(Shape shape, std::vector<size_t> strides, size_t offset) const;
+    /// A private row-major copy of the elements.
+    Tensor materialize() const;
+    /// Take over the buffer and layout of a dense tensor.
+    void   rebind(Tensor&& dense) const noexcept;
+
+    bool sharedBuffer() const noexcept {
+        return m_dtype == TensorDType::Float32 ? m_data_f32.use_count() > 1
+                                               : m_data.use_count() > 1;
+    }
+    /// Copy-on-write: called before handing out writable element access.
+    void prepareWrite() {
+        if (m_device == Device::CPU && (!is_contiguous() || sharedBuffer()))
+            rebind(materialize());
+    }
+
+    [[noreturn]] void throwIndexRank(size_t rank) const;
+    [[noreturn]] void throwIndexRange(size_t axis, size_t index) const;
+
+    ElementRef elementRef(size_t off) noexcept {
+        return m_dtype == TensorDType::Float64 ? ElementRef(&(*m_data)[off], nullptr)
+                                               : ElementRef(nullptr, &(*m_data_f32)[off]);
+    }
+
+    template<typename... Idx>
+    size_t checkedOffset(Idx... indices) const {
+        const std::array<size_t, sizeof...(Idx)> idx{ static_cast<size_t>(indices)... };
+        if (idx.size() != m_shape.size()) throwIndexRank(idx.size());
+        size_t off = m_offset;
+        for (size_t i = 0; i < idx.size(); ++i) {
+            if (idx[i] >= m_shape[i]) throwIndexRange(i, idx[i]);
+            off += idx[i] * m_strides[i];
+        }
+        return off;
+    }
+
+    template<typename... Idx>
+    size_t uncheckedOffset(Idx... indices) const noexcept {
+        const std::array<size_t, sizeof...(Idx)> idx{ static_cast<size_t>(indices)... };
+        size_t off = m_offset;
+        for (size_t i = 0; i < idx.size(); ++i) off += idx[i] * m_strides[i];
+        return off;
+    }
 
     static Shape broadcastShape(const Shape& a, const Shape& b);
-    Tensor broadcastOp(const Tensor& other,
-                       std::function<double(double, double)> op) const;
-    Tensor axisReduce(size_t axis,
-                      std::function<double(double, double)> reducer,
-                      double init) const;
+    // storage<T>() points at this tensor's first element in the host buffer
+    // for element type T (double or float); the writable overload is only
+    // used on freshly created tensors.  visit(fn) calls fn with the pointer
+    // matching the dtype.  forEach(p, lo, hi, fn) calls fn(x) for the
+    // elements with row-major index in [lo, hi), in order, p being that
+    // pointer.
+    template<typename T> T*       storage() noexcept;
+    template<typename T> const T* storage() const noexcept;
+    template<typename Fn>
+    decltype(auto) visit(Fn&& fn) const;
+    template<typename T, typename Fn>
+    void forEach(const T* p, size_t lo, size_t hi, Fn&& fn) const;
+    /// Row-major copy of the elements into dst, converted to D.
+    template<typename D>
+    void copyTo(D* dst) const;
+    /// Elements in the host buffer (more than size() for a view).
+    size_t storageSize() const noexcept {
+        if (m_dtype == TensorDType::Float32) return m_data_f32 ? m_data_f32->size() : 0;
+        return m_data ? m_data->size() : 0;
+    }
+    // Defined (and only instantiated) in Tensor.cpp so the op inlines.
+    // The *Into variants write into `result`, a dense row-major CPU tensor
+    // of the output shape (and dtype; Float64 for axisReduceInto), which may
+    // be this tensor itself.
+    template<typename Op>
+    Tensor broadcastOp(const Tensor& other, Op op) const;
+    template<typename Op>
+    void   broadcastInto(Tensor& result, const Tensor& other, Op op) const;
+    template<typename F>
+    Tensor map(F f) const;
+    template<typename F>
+    void   mapInto(Tensor& result, F f) const;
+    template<typename Reducer>
+    Tensor axisReduce(size_t axis, Reducer reducer, double init) const;
+    template<typename Reducer>
+    void   axisReduceInto(Tensor& result, size_t axis, Reducer reducer, double init) const;
+    /// Element-wise update of this tensor's own buffer with `o` broadcast to
+    /// this shape; false (nothing done) when that is not possible.
+    template<typename Op>
+    bool   updateInPlace(const Tensor& o, Op op);
+
+    /// Same storage and dtype under a new shape (size must match); strided
+    /// views are made contiguous first.
+    Tensor withShape(Shape shape) const;
 
     // Private factory used by TensorCUDA.cu to wrap a GPU buffer
     static Tensor from_cuda(Shape shape, std::shared_ptr<CUDABuffer> buf,
                             int device_id = 0);
 
     friend struct detail::TensorCUDAImpl;   // CUDA implementation accessor
+    friend struct detail::TensorInto;
     friend class TensorView;
+    friend SHAREDMATH_LINEARALGEBRA_EXPORT Tensor operator/(double s, const Tensor& t);
 };
 
 // Scalar-on-left arithmetic
@@ -340,4 +550,58 @@ SHAREDMATH_LINEARALGEBRA_EXPORT Tensor operator*(double s, const Tensor& t);
 SHAREDMATH_LINEARALGEBRA_EXPORT Tensor operator/(double s, const Tensor& t);
 SHAREDMATH_LINEARALGEBRA_EXPORT std::ostream& operator<<(std::ostream& os, const Tensor& t);
 
+/// ── Out-parameter kernels ─────────────────────────────────────────────────────
+/// Each writes its result into `out` and returns it.  When `out` is a CPU
+/// tensor that already has the result shape and dtype and owns its buffer
+/// (contiguous and not shared with another tensor), the result goes straight
+/// into that buffer and nothing is allocated, so a loop that keeps its
+/// output tensors runs allocation-free.  Otherwise `out` is replaced by a new
+/// tensor.  `out` may also be one of the operands.  The result dtype follows
+/// the matching operator (mixed dtypes promote to Float64); GPU operands go
+/// through the allocating ops.
+///
+///   Tensor h, z;
+///   for (...) {
+///       matmul_into(h, x, W);            // h = x·W
+///       add_into(h, h, b);               // h += b (broadcast)
+///       tanh_into(z, h);
+///   }
+
+/// C = alpha * A·B + beta * C for 2-D A, B.  With beta != 0, C must already
+/// have shape [rows(A), cols(B)].
+SHAREDMATH_LINEARALGEBRA_EXPORT
+Tensor& matmul_into(Tensor& C, const Tensor& A, const Tensor& B,
+                    double alpha = 1.0, double beta = 0.0);
+
+/// Element-wise with broadcasting: out = a ∘ b.
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& add_into(Tensor& out, const Tensor& a, const Tensor& b);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sub_into(Tensor& out, const Tensor& a, const Tensor& b);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& mul_into(Tensor& out, const Tensor& a, const Tensor& b);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& div_into(Tensor& out, const Tensor& a, const Tensor& b);
+
+/// Axis reductions (output rank = ndim - 1).  Float32 inputs accumulate in
+/// a Float64 temporary, as Tensor::sum(axis) does.
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sum_into (Tensor& out, const Tensor& t, size_t axis);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& mean_into(Tensor& out, const Tensor& t, size_t axis);
+
+/// Element-wise math: out = f(t), same rules as the Tensor members.
+SHAREDMATH_LINEARALGEBRA_EXPORT
+Tensor& apply_into(Tensor& out, const Tensor& t, const std::function<double(double)>& f);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& abs_into    (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sqrt_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& exp_into    (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& log_into    (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& log2_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& log10_into  (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sin_into    (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& cos_into    (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& tanh_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& relu_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sigmoid_into(Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& gelu_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& sign_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& floor_into  (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& ceil_into   (Tensor& out, const Tensor& t);
+SHAREDMATH_LINEARALGEBRA_EXPORT Tensor& round_into  (Tensor& out, const Tensor& t);
+
 } // namespace SharedMath::LinearAlgebra
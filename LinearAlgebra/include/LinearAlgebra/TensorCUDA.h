@@ -89,7 +89,7 @@ struct TensorCUDAImpl {
 
     /// Host data vector (empty for GPU tensors).
     static const std::vector<double>& host_data(const Tensor& t) {
-        return t.m_data;
+        return t.data();
     }
 
     /// Shape accessor (same as t.shape(), just here for symmetry).
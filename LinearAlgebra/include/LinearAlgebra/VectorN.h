@@ -13,6 +13,9 @@ namespace SharedMath::LinearAlgebra {
 
 // Fixed-size N-dimensional vector with stack-allocated contiguous storage.
 // Fully STL-compatible (iterators, data(), size()).
+//
+// Everything except norm(), normalized() and the stream operator is
+// constexpr, so small geometry constants can be built at compile time.
 template<size_t N>
 class Vector {
     static_assert(N > 0, "Vector size must be greater than zero");
@@ -23,11 +26,11 @@ public:
     using const_iterator  = const double*;
 
     /// ── Construction ──────────────────────────────────────────────────────
-    Vector() noexcept { data_.fill(0.0); }
+    constexpr Vector() noexcept : data_{} {}
 
-    explicit Vector(double fill) noexcept { data_.fill(fill); }
+    constexpr explicit Vector(double fill) noexcept : data_{} { data_.fill(fill); }
 
-    Vector(std::initializer_list<double> values) {
+    constexpr Vector(std::initializer_list<double> values) : data_{} {
         if (values.size() != N)
             throw std::invalid_argument("Vector: initializer list size mismatch");
         std::copy(values.begin(), values.end(), data_.begin());
@@ -40,61 +43,61 @@ public:
     ~Vector() = default;
 
     // ── Element access ────────────────────────────────────────────────────
-    double& operator[](size_t i) noexcept { return data_[i]; }
-    const double& operator[](size_t i) const noexcept { return data_[i]; }
+    constexpr double& operator[](size_t i) noexcept { return data_[i]; }
+    constexpr const double& operator[](size_t i) const noexcept { return data_[i]; }
 
-    double& at(size_t i) {
+    constexpr double& at(size_t i) {
         if (i >= N) throw std::out_of_range("Vector::at: index out of range");
         return data_[i];
     }
-    const double& at(size_t i) const {
+    constexpr const double& at(size_t i) const {
         if (i >= N) throw std::out_of_range("Vector::at: index out of range");
         return data_[i];
     }
 
-    double*       data() noexcept       { return data_.data(); }
-    const double* data() const noexcept { return data_.data(); }
+    constexpr double*       data() noexcept       { return data_.data(); }
+    constexpr const double* data() const noexcept { return data_.data(); }
 
     /// ── STL iterators ─────────────────────────────────────────────────────
-    iterator       begin()  noexcept       { return data_.data(); }
-    iterator       end()    noexcept       { return data_.data() + N; }
-    const_iterator begin()  const noexcept { return data_.data(); }
-    const_iterator end()    const noexcept { return data_.data() + N; }
-    const_iterator cbegin() const noexcept { return data_.data(); }
-    const_iterator cend()   const noexcept { return data_.data() + N; }
+    constexpr iterator       begin()  noexcept       { return data_.data(); }
+    constexpr iterator       end()    noexcept       { return data_.data() + N; }
+    constexpr const_iterator begin()  const noexcept { return data_.data(); }
+    constexpr const_iterator end()    const noexcept { return data_.data() + N; }
+    constexpr const_iterator cbegin() const noexcept { return data_.data(); }
+    constexpr const_iterator cend()   const noexcept { return data_.data() + N; }
 
     /// ── Metadata ──────────────────────────────────────────────────────────
     static constexpr size_t size()     noexcept { return N; }
     static constexpr bool   empty()    noexcept { return N == 0; }
 
     // ── Comparison ────────────────────────────────────────────────────────
-    bool operator==(const Vector& o) const noexcept { return data_ == o.data_; }
-    bool operator!=(const Vector& o) const noexcept { return data_ != o.data_; }
+    constexpr bool operator==(const Vector& o) const noexcept { return data_ == o.data_; }
+    constexpr bool operator!=(const Vector& o) const noexcept { return data_ != o.data_; }
 
     // ── Arithmetic ────────────────────────────────────────────────────────
-    Vector operator-() const noexcept {
+    constexpr Vector operator-() const noexcept {
         Vector r;
         for (size_t i = 0; i < N; ++i) r.data_[i] = -data_[i];
         return r;
     }
 
-    Vector operator+(const Vector& o) const noexcept {
+    constexpr Vector operator+(const Vector& o) const noexcept {
         Vector r;
         for (size_t i = 0; i < N; ++i) r.data_[i] = data_[i] + o.data_[i];
         return r;
     }
-    Vector operator-(const Vector& o) const noexcept {
+    constexpr Vector operator-(const Vector& o) const noexcept {
         Vector r;
         for (size_t i = 0; i < N; ++i) r.data_[i] = data_[i] - o.data_[i];
         return r;
     }
-    Vector operator*(double s) const noexcept {
+    constexpr Vector operator*(double s) const noexcept {
         Vector r;
         for (size_t i = 0; i < N; ++i) r.data_[i] = data_[i] * s;
         return r;
     }
-    Vector operator/(double s) const {
-        if (std::abs(s) < Epsilon)
+    constexpr Vector operator/(double s) const {
+        if (s > -Epsilon && s < Epsilon)
             throw std::runtime_error("Vector: division by zero");
         double inv = 1.0 / s;
         Vector r;
@@ -102,31 +105,31 @@ public:
         return r;
     }
 
-    Vector& operator+=(const Vector& o) noexcept {
+    constexpr Vector& operator+=(const Vector& o) noexcept {
         for (size_t i = 0; i < N; ++i) data_[i] += o.data_[i];
         return *this;
     }
-    Vector& operator-=(const Vector& o) noexcept {
+    constexpr Vector& operator-=(const Vector& o) noexcept {
         for (size_t i = 0; i < N; ++i) data_[i] -= o.data_[i];
         return *this;
     }
-    Vector& operator*=(double s) noexcept {
+    constexpr Vector& operator*=(double s) noexcept {
         for (double& v : data_) v *= s;
         return *this;
     }
-    Vector& operator/=(double s) {
+    constexpr Vector& operator/=(double s) {
         *this = *this / s;
         return *this;
     }
 
     /// ── Linear algebra ────────────────────────────────────────────────────
-    double dot(const Vector& o) const noexcept {
+    constexpr double dot(const Vector& o) const noexcept {
         double r = 0.0;
         for (size_t i = 0; i < N; ++i) r += data_[i] * o.data_[i];
         return r;
     }
 
-    double norm_sq() const noexcept { return dot(*this); }
+    constexpr double norm_sq() const noexcept { return dot(*this); }
     double norm()    const noexcept { return std::sqrt(norm_sq()); }
 
     Vector normalized() const {
@@ -138,21 +141,21 @@ public:
 
     // Cross product — available only for 3-D vectors (compile-time check)
     template<size_t M = N, typename = std::enable_if_t<M == 3>>
-    Vector cross(const Vector& o) const noexcept {
+    constexpr Vector cross(const Vector& o) const noexcept {
         return { data_[1]*o.data_[2] - data_[2]*o.data_[1],
                  data_[2]*o.data_[0] - data_[0]*o.data_[2],
                  data_[0]*o.data_[1] - data_[1]*o.data_[0] };
     }
 
     /// ── Reductions ────────────────────────────────────────────────────────
-    double sum()  const noexcept {
+    constexpr double sum()  const noexcept {
         return std::accumulate(data_.begin(), data_.end(), 0.0);
     }
-    double mean() const noexcept { return sum() / static_cast<double>(N); }
-    double min()  const noexcept {
+    constexpr double mean() const noexcept { return sum() / static_cast<double>(N); }
+    constexpr double min()  const noexcept {
         return *std::min_element(data_.begin(), data_.end());
     }
-    double max()  const noexcept {
+    constexpr double max()  const noexcept {
         return *std::max_element(data_.begin(), data_.end());
     }
 
@@ -172,6 +175,6 @@ private:
 
 // ── Free functions ────────────────────────────────────────────────────────────
 template<size_t N>
-Vector<N> operator*(double s, const Vector<N>& v) noexcept { return v * s; }
+constexpr Vector<N> operator*(double s, const Vector<N>& v) noexcept { return v * s; }
 
 } // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,420 @@
+// ComplexSolver.cpp — dense and sparse complex LU.
+//
+// Dense: right-looking blocked LU.  The matrix is held as separate real and
+// imaginary planes while factorizing so the trailing update
+//   A22 −= L21·U12
+// is four real gemm() calls; panels and the U12 triangular solve are
+// plain complex loops.
+//
+// Sparse: left-looking Gilbert–Peierls.  Column k of L·U is found by a
+// sparse triangular solve x = L \ A(:, q[k]) whose nonzero pattern is the
+// set of nodes reachable from A(:, q[k]) in the graph of L (a DFS that
+// also yields a topological order), so the work is proportional to the
+// flops.  refactor() replays the stored patterns and pivot rows.
+
+#include "ComplexSolver.h"
+#include "Gemm.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr size_t kBlock = 64;           // panel width of the dense LU
+constexpr size_t kNone  = std::numeric_limits<size_t>::max();
+
+// y −= a·x over len entries, written out so it vectorizes (std::complex
+// multiplication keeps a NaN-recovery branch per element).
+void caxpyNeg(Complex a, const Complex* x, Complex* y, size_t len) {
+    const double ar = a.real(), ai = a.imag();
+    for (size_t k = 0; k < len; ++k) {
+        const double xr = x[k].real(), xi = x[k].imag();
+        y[k] = Complex(y[k].real() - (ar * xr - ai * xi),
+                       y[k].imag() - (ar * xi + ai * xr));
+    }
+}
+
+// y −= a·b, the scattered form of caxpyNeg.
+inline void cmulSub(Complex& y, Complex a, Complex b) {
+    y = Complex(y.real() - (a.real() * b.real() - a.imag() * b.imag()),
+                y.imag() - (a.real() * b.imag() + a.imag() * b.real()));
+}
+
+} // namespace
+
+// ══════════════════════════════════════════════════════════════════════════════
+// ComplexLU
+// ══════════════════════════════════════════════════════════════════════════════
+
+ComplexLU::ComplexLU(const ComplexMatrix& A) {
+    if (!A.isSquare())
+        throw std::invalid_argument("ComplexLU: matrix must be square");
+    const size_t n = A.rows();
+    piv_.resize(n);
+
+    std::vector<double> re(n * n), im(n * n);
+    for (size_t k = 0; k < n * n; ++k) {
+        re[k] = A.data()[k].real();
+        im[k] = A.data()[k].imag();
+    }
+    auto at = [&](size_t i, size_t j) { return Complex(re[i * n + j], im[i * n + j]); };
+    auto put = [&](size_t i, size_t j, Complex v) {
+        re[i * n + j] = v.real();
+        im[i * n + j] = v.imag();
+    };
+
+    for (size_t k0 = 0; k0 < n; k0 += kBlock) {
+        const size_t kend = std::min(n, k0 + kBlock);
+
+        // ── Panel: unblocked LU of columns [k0, kend) ───────────────────────
+        for (size_t j = k0; j < kend; ++j) {
+            size_t p = j;
+            double best = 0.0;
+            for (size_t i = j; i < n; ++i) {
+                const double a = std::norm(at(i, j));
+                if (a > best) { best = a; p = i; }
+            }
+            if (best == 0.0)
+                throw std::runtime_error("ComplexLU: matrix is singular");
+            piv_[j] = p;
+            if (p != j) {
+                std::swap_ranges(re.begin() + p * n, re.begin() + (p + 1) * n, re.begin() + j * n);
+                std::swap_ranges(im.begin() + p * n, im.begin() + (p + 1) * n, im.begin() + j * n);
+                piv_sign_ = -piv_sign_;
+            }
+            const Complex inv = 1.0 / at(j, j);
+            for (size_t i = j + 1; i < n; ++i) {
+                const Complex l = at(i, j) * inv;
+                put(i, j, l);
+                for (size_t c = j + 1; c < kend; ++c)
+                    put(i, c, at(i, c) - l * at(j, c));
+            }
+        }
+        if (kend == n) break;
+
+        // ── U12 = L11⁻¹·A12 ─────────────────────────────────────────────────
+        const size_t rest = n - kend;
+        for (size_t j = k0; j < kend; ++j)
+            for (size_t i = j + 1; i < kend; ++i) {
+                const double lr = re[i * n + j], li = im[i * n + j];
+                double *ri = &re[i * n + kend], *ii = &im[i * n + kend];
+                const double *rj = &re[j * n + kend], *ij = &im[j * n + kend];
+                for (size_t c = 0; c < rest; ++c) {
+                    ri[c] -= lr * rj[c] - li * ij[c];
+                    ii[c] -= lr * ij[c] + li * rj[c];
+                }
+            }
+
+        // ── A22 −= L21·U12 as four real GEMMs ───────────────────────────────
+        const size_t kb = kend - k0;
+        const double *Lr = &re[kend * n + k0], *Li = &im[kend * n + k0];
+        const double *Ur = &re[k0 * n + kend], *Ui = &im[k0 * n + kend];
+        double *Cr = &re[kend * n + kend], *Ci = &im[kend * n + kend];
+        gemm(Transpose::No, Transpose::No, rest, rest, kb, -1.0, Lr, n, Ur, n, 1.0, Cr, n);
+        gemm(Transpose::No, Transpose::No, rest, rest, kb,  1.0, Li, n, Ui, n, 1.0, Cr, n);
+        gemm(Transpose::No, Transpose::No, rest, rest, kb, -1.0, Lr, n, Ui, n, 1.0, Ci, n);
+        gemm(Transpose::No, Transpose::No, rest, rest, kb, -1.0, Li, n, Ur, n, 1.0, Ci, n);
+    }
+
+    LU_ = ComplexMatrix(n, n);
+    for (size_t k = 0; k < n * n; ++k) LU_.data()[k] = Complex(re[k], im[k]);
+}
+
+ComplexMatrix ComplexLU::solve(const ComplexMatrix& B) const {
+    const size_t n = size();
+    if (B.rows() != n)
+        throw std::invalid_argument("ComplexLU::solve: dimension mismatch");
+    ComplexMatrix X = B;
+    const size_t k = X.cols();
+    for (size_t j = 0; j < n; ++j)
+        if (piv_[j] != j)
+            std::swap_ranges(X.row_ptr(j), X.row_ptr(j) + k, X.row_ptr(piv_[j]));
+
+    // Row-oriented substitution; right-hand sides are split across the pool.
+    Core::parallel_for(0, k, std::max<size_t>(1, 4096 / std::max<size_t>(n, 1)),
+        [&](size_t lo, size_t hi) {
+            const size_t w = hi - lo;
+            for (size_t i = 1; i < n; ++i) {
+                const Complex* Li = LU_.row_ptr(i);
+                for (size_t j = 0; j < i; ++j)
+                    caxpyNeg(Li[j], X.row_ptr(j) + lo, X.row_ptr(i) + lo, w);
+            }
+            for (size_t i = n; i-- > 0;) {
+                const Complex* Ui = LU_.row_ptr(i);
+                for (size_t j = i + 1; j < n; ++j)
+                    caxpyNeg(Ui[j], X.row_ptr(j) + lo, X.row_ptr(i) + lo, w);
+                const Complex inv = 1.0 / Ui[i];
+                Complex* xi = X.row_ptr(i) + lo;
+                for (size_t c = 0; c < w; ++c) xi[c] *= inv;
+            }
+        });
+    return X;
+}
+
+ComplexVector ComplexLU::solve(const ComplexVector& b) const {
+    if (b.size() != size())
+        throw std::invalid_argument("ComplexLU::solve: dimension mismatch");
+    ComplexMatrix X = solve(ComplexMatrix(b.size(), 1, b.vec()));
+    return ComplexVector(std::move(X.vec()));
+}
+
+ComplexMatrix ComplexLU::inverse() const {
+    return solve(ComplexMatrix::eye(size()));
+}
+
+Complex ComplexLU::determinant() const {
+    Complex d(static_cast<double>(piv_sign_), 0.0);
+    for (size_t i = 0; i < size(); ++i) d *= LU_(i, i);
+    return d;
+}
+
+// ══════════════════════════════════════════════════════════════════════════════
+// SparseComplexLU
+// ══════════════════════════════════════════════════════════════════════════════
+
+SparseComplexLU::SparseComplexLU(const ComplexSparseMatrix& A,
+                                 SparseOrdering ordering, double pivot_tol)
+    : n_(A.rows()), pivot_tol_(pivot_tol)
+{
+    if (!A.isSquare())
+        throw std::invalid_argument("SparseComplexLU: matrix must be square");
+    if (!(pivot_tol > 0.0 && pivot_tol <= 1.0))
+        throw std::invalid_argument("SparseComplexLU: pivot_tol must be in (0, 1]");
+
+    // ── Symbolic analysis ──────────────────────────────────────────────────
+    row_ptr_ = A.row_ptr();
+    col_idx_ = A.col_indices();
+    q_ = fillReducingOrdering(ordering, n_, row_ptr_, col_idx_);
+
+    // CSC view: column j holds its rows in ascending order.
+    cscPtr_.assign(n_ + 1, 0);
+    for (size_t c : col_idx_) ++cscPtr_[c + 1];
+    for (size_t j = 0; j < n_; ++j) cscPtr_[j + 1] += cscPtr_[j];
+    cscRow_.resize(col_idx_.size());
+    cscSrc_.resize(col_idx_.size());
+    std::vector<size_t> next(cscPtr_.begin(), cscPtr_.end() - 1);
+    for (size_t i = 0; i < n_; ++i)
+        for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k) {
+            const size_t dst = next[col_idx_[k]]++;
+            cscRow_[dst] = i;
+            cscSrc_[dst] = k;
+        }
+
+    factorize(cscValues(A));
+}
+
+std::vector<Complex> SparseComplexLU::cscValues(const ComplexSparseMatrix& A) const {
+    std::vector<Complex> Ax(cscSrc_.size());
+    const auto& v = A.values();
+    for (size_t k = 0; k < Ax.size(); ++k) Ax[k] = v[cscSrc_[k]];
+    return Ax;
+}
+
+void SparseComplexLU::factorize(const std::vector<Complex>& Ax) {
+    const size_t n = n_;
+    pinv_.assign(n, kNone);
+    Lp_.assign(n + 1, 0);
+    Up_.assign(n + 1, 0);
+    Li_.clear(); Lx_.clear(); Ui_.clear(); Ux_.clear();
+    Li_.reserve(2 * Ax.size() + n);
+    Lx_.reserve(2 * Ax.size() + n);
+    Ui_.reserve(2 * Ax.size() + n);
+    Ux_.reserve(2 * Ax.size() + n);
+
+    std::vector<Complex> x(n, Complex(0.0, 0.0));
+    std::vector<size_t> xi(2 * n), mark(n, 0);
+    size_t* pstack = xi.data() + n;
+
+    for (size_t k = 0; k < n; ++k) {
+        const size_t col = q_[k], stamp = k + 1;
+        Lp_[k] = Li_.size();
+        Up_[k] = Ui_.size();
+
+        // ── Reach of A(:, col) in the graph of L, in topological order ─────
+        // Non-recursive DFS: xi[0..head] is the recursion stack, the
+        // finished nodes fill xi[top..n) from the back.
+        size_t top = n;
+        for (size_t p = cscPtr_[col]; p < cscPtr_[col + 1]; ++p) {
+            if (mark[cscRow_[p]] == stamp) continue;
+            size_t head = 0;
+            xi[0] = cscRow_[p];
+            for (;;) {
+                const size_t j = xi[head], J = pinv_[j];
+                if (mark[j] != stamp) {
+                    mark[j] = stamp;
+                    pstack[head] = J == kNone ? 0 : Lp_[J] + 1;
+                }
+                const size_t pend = J == kNone ? 0 : Lp_[J + 1];
+                bool done = true;
+                for (size_t t = pstack[head]; t < pend; ++t) {
+                    const size_t i = Li_[t];
+                    if (mark[i] == stamp) continue;
+                    pstack[head] = t + 1;
+                    xi[++head] = i;
+                    done = false;
+                    break;
+                }
+                if (done) {
+                    xi[--top] = j;
+                    if (head == 0) break;
+                    --head;
+                }
+            }
+        }
+
+        // ── x = L \ A(:, col) ──────────────────────────────────────────────
+        for (size_t p = cscPtr_[col]; p < cscPtr_[col + 1]; ++p) x[cscRow_[p]] = Ax[p];
+        for (size_t p = top; p < n; ++p) {
+            const size_t j = xi[p], J = pinv_[j];
+            if (J == kNone) continue;
+            const Complex xj = x[j];
+            for (size_t t = Lp_[J] + 1; t < Lp_[J + 1]; ++t) cmulSub(x[Li_[t]], Lx_[t], xj);
+        }
+
+        // ── Threshold partial pivoting, diagonal preferred ─────────────────
+        size_t ipiv = kNone;
+        double amax = 0.0;
+        for (size_t p = top; p < n; ++p) {
+            const size_t i = xi[p];
+            if (pinv_[i] == kNone) {
+                const double a = std::abs(x[i]);
+                if (ipiv == kNone || a > amax) { amax = a; ipiv = i; }
+            } else {
+                Ui_.push_back(pinv_[i]);
+                Ux_.push_back(x[i]);
+            }
+        }
+        if (ipiv == kNone || amax == 0.0)
+            throw std::runtime_error("SparseComplexLU: matrix is singular");
+        if (pinv_[col] == kNone && std::abs(x[col]) >= pivot_tol_ * amax) ipiv = col;
+
+        const Complex pivot = x[ipiv];
+        Ui_.push_back(k);
+        Ux_.push_back(pivot);
+        pinv_[ipiv] = k;
+
+        const Complex inv = 1.0 / pivot;
+        Li_.push_back(ipiv);
+        Lx_.emplace_back(1.0, 0.0);
+        for (size_t p = top; p < n; ++p) {
+            const size_t i = xi[p];
+            if (pinv_[i] == kNone) {
+                Li_.push_back(i);
+                Lx_.push_back(x[i] * inv);
+            }
+            x[i] = Complex(0.0, 0.0);
+        }
+    }
+    Lp_[n] = Li_.size();
+    Up_[n] = Ui_.size();
+    for (size_t& i : Li_) i = pinv_[i];
+}
+
+bool SparseComplexLU::refactorize(const std::vector<Complex>& Ax) {
+    std::vector<Complex> x(n_, Complex(0.0, 0.0));
+    for (size_t k = 0; k < n_; ++k) {
+        const size_t col = q_[k];
+        for (size_t p = cscPtr_[col]; p < cscPtr_[col + 1]; ++p) x[pinv_[cscRow_[p]]] = Ax[p];
+
+        // U(:, k) in its stored topological order, pivot last.
+        const size_t uend = Up_[k + 1] - 1;
+        for (size_t t = Up_[k]; t < uend; ++t) {
+            const size_t j = Ui_[t];
+            const Complex xj = x[j];
+            Ux_[t] = xj;
+            x[j] = Complex(0.0, 0.0);
+            for (size_t s = Lp_[j] + 1; s < Lp_[j + 1]; ++s) cmulSub(x[Li_[s]], Lx_[s], xj);
+        }
+        const Complex pivot = x[k];
+        x[k] = Complex(0.0, 0.0);
+
+        double amax = 0.0;
+        for (size_t s = Lp_[k] + 1; s < Lp_[k + 1]; ++s) amax = std::max(amax, std::abs(x[Li_[s]]));
+        if (pivot == Complex(0.0, 0.0) || std::abs(pivot) < pivot_tol_ * amax)
+            return false;
+
+        Ux_[uend] = pivot;
+        const Complex inv = 1.0 / pivot;
+        for (size_t s = Lp_[k] + 1; s < Lp_[k + 1]; ++s) {
+            Lx_[s] = x[Li_[s]] * inv;
+            x[Li_[s]] = Complex(0.0, 0.0);
+        }
+    }
+    return true;
+}
+
+void SparseComplexLU::refactor(const ComplexSparseMatrix& A) {
+    if (A.rows() != n_ || A.cols() != n_ ||
+        A.row_ptr() != row_ptr_ || A.col_indices() != col_idx_)
+        throw std::invalid_argument(
+            "SparseComplexLU::refactor: sparsity pattern differs from the analysed matrix");
+    const auto Ax = cscValues(A);
+    if (!refactorize(Ax)) {
+        ++repivots_;
+        factorize(Ax);
+    }
+}
+
+ComplexVector SparseComplexLU::solve(const ComplexVector& b) const {
+    if (b.size() != n_)
+        throw std::invalid_argument("SparseComplexLU::solve: dimension mismatch");
+    std::vector<Complex> y(n_);
+    for (size_t i = 0; i < n_; ++i) y[pinv_[i]] = b[i];
+
+    for (size_t j = 0; j < n_; ++j) {
+        const Complex yj = y[j];
+        if (yj == Complex(0.0, 0.0)) continue;
+        for (size_t s = Lp_[j] + 1; s < Lp_[j + 1]; ++s) cmulSub(y[Li_[s]], Lx_[s], yj);
+    }
+    for (size_t j = n_; j-- > 0;) {
+        const size_t uend = Up_[j + 1] - 1;
+        y[j] /= Ux_[uend];
+        const Complex yj = y[j];
+        if (yj == Complex(0.0, 0.0)) continue;
+        for (size_t t = Up_[j]; t < uend; ++t) cmulSub(y[Ui_[t]], Ux_[t], yj);
+    }
+
+    ComplexVector x(n_);
+    for (size_t k = 0; k < n_; ++k) x[q_[k]] = y[k];
+    return x;
+}
+
+ComplexMatrix SparseComplexLU::solve(const ComplexMatrix& B) const {
+    if (B.rows() != n_)
+        throw std::invalid_argument("SparseComplexLU::solve: dimension mismatch");
+    ComplexMatrix X(n_, B.cols());
+    Core::parallel_for(0, B.cols(), 1, [&](size_t lo, size_t hi) {
+        ComplexVector b(n_);
+        for (size_t c = lo; c < hi; ++c) {
+            for (size_t i = 0; i < n_; ++i) b[i] = B(i, c);
+            ComplexVector x = solve(b);
+            for (size_t i = 0; i < n_; ++i) X(i, c) = x[i];
+        }
+    });
+    return X;
+}
+
+// ══════════════════════════════════════════════════════════════════════════════
+// Free functions
+// ══════════════════════════════════════════════════════════════════════════════
+
+ComplexVector solve(const ComplexMatrix& A, const ComplexVector& b) {
+    return ComplexLU(A).solve(b);
+}
+
+ComplexVector solve(const ComplexSparseMatrix& A, const ComplexVector& b) {
+    return SparseComplexLU(A).solve(b);
+}
+
+ComplexMatrix inv(const ComplexMatrix& A) {
+    return ComplexLU(A).inverse();
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,188 @@
+#include "LinearAlgebra/ComplexSparseMatrix.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace SharedMath::LinearAlgebra {
+
+// ── Construction ──────────────────────────────────────────────────────────────
+
+ComplexSparseMatrix::ComplexSparseMatrix(size_t rows, size_t cols)
+    : rows_(rows), cols_(cols), row_ptr_(rows + 1, 0) {}
+
+ComplexSparseMatrix ComplexSparseMatrix::from_triplets(
+    size_t rows, size_t cols,
+    const std::vector<size_t>& ri,
+    const std::vector<size_t>& ci,
+    const std::vector<Complex>& vals)
+{
+    if (ri.size() != ci.size() || ri.size() != vals.size())
+        throw std::invalid_argument("ComplexSparseMatrix::from_triplets: inconsistent input sizes");
+
+    std::vector<size_t> order(ri.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return ri[a] != ri[b] ? ri[a] < ri[b] : ci[a] < ci[b];
+    });
+
+    ComplexSparseMatrix M(rows, cols);
+    M.values_.reserve(order.size());
+    M.col_idx_.reserve(order.size());
+    size_t lastRow = rows;
+    for (size_t k : order) {
+        const size_t r = ri[k], c = ci[k];
+        if (r >= rows || c >= cols)
+            throw std::out_of_range("ComplexSparseMatrix::from_triplets: index out of range");
+        if (r == lastRow && M.col_idx_.back() == c) {
+            M.values_.back() += vals[k];       // sum duplicates
+            continue;
+        }
+        M.values_.push_back(vals[k]);
+        M.col_idx_.push_back(c);
+        ++M.row_ptr_[r + 1];
+        lastRow = r;
+    }
+    for (size_t r = 0; r < rows; ++r)
+        M.row_ptr_[r + 1] += M.row_ptr_[r];
+    return M;
+}
+
+ComplexSparseMatrix ComplexSparseMatrix::from_csr(size_t rows, size_t cols,
+                                                  std::vector<size_t> row_ptr,
+                                                  std::vector<size_t> col_idx,
+                                                  std::vector<Complex> values)
+{
+    if (row_ptr.size() != rows + 1 || row_ptr.front() != 0 ||
+        row_ptr.back() != col_idx.size() || col_idx.size() != values.size())
+        throw std::invalid_argument("ComplexSparseMatrix::from_csr: inconsistent array sizes");
+    for (size_t i = 0; i < rows; ++i) {
+        if (row_ptr[i] > row_ptr[i + 1])
+            throw std::invalid_argument("ComplexSparseMatrix::from_csr: row_ptr must be non-decreasing");
+        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+            if (col_idx[k] >= cols)
+                throw std::invalid_argument("ComplexSparseMatrix::from_csr: column index out of range");
+            if (k > row_ptr[i] && col_idx[k] <= col_idx[k - 1])
+                throw std::invalid_argument(
+                    "ComplexSparseMatrix::from_csr: columns must be strictly ascending within a row");
+        }
+    }
+    ComplexSparseMatrix M(rows, cols);
+    M.row_ptr_ = std::move(row_ptr);
+    M.col_idx_ = std::move(col_idx);
+    M.values_  = std::move(values);
+    return M;
+}
+
+ComplexSparseMatrix ComplexSparseMatrix::from_dense(const ComplexMatrix& A, double tol) {
+    std::vector<size_t> ri, ci;
+    std::vector<Complex> vals;
+    for (size_t i = 0; i < A.rows(); ++i)
+        for (size_t j = 0; j < A.cols(); ++j) {
+            const Complex v = A(i, j);
+            if (std::abs(v) > tol) {
+                ri.push_back(i); ci.push_back(j); vals.push_back(v);
+            }
+        }
+    return from_triplets(A.rows(), A.cols(), ri, ci, vals);
+}
+
+ComplexSparseMatrix ComplexSparseMatrix::from_parts(const SparseMatrix& re, const SparseMatrix& im) {
+    if (re.rows() != im.rows() || re.cols() != im.cols())
+        throw std::invalid_argument("ComplexSparseMatrix::from_parts: shape mismatch");
+
+    // Row-by-row merge of the two sorted patterns.
+    ComplexSparseMatrix M(re.rows(), re.cols());
+    M.values_.reserve(re.nnz() + im.nnz());
+    M.col_idx_.reserve(re.nnz() + im.nnz());
+    const auto &rp = re.row_ptr(), &rc = re.col_indices(), &ip = im.row_ptr(), &ic = im.col_indices();
+    const auto &rv = re.values(), &iv = im.values();
+    for (size_t r = 0; r < re.rows(); ++r) {
+        size_t a = rp[r], b = ip[r];
+        while (a < rp[r + 1] || b < ip[r + 1]) {
+            const size_t ca = a < rp[r + 1] ? rc[a] : re.cols();
+            const size_t cb = b < ip[r + 1] ? ic[b] : re.cols();
+            const size_t c  = std::min(ca, cb);
+            M.values_.emplace_back(ca == c ? rv[a++] : 0.0, cb == c ? iv[b++] : 0.0);
+            M.col_idx_.push_back(c);
+        }
+        M.row_ptr_[r + 1] = M.values_.size();
+    }
+    return M;
+}
+
+// ── Queries ───────────────────────────────────────────────────────────────────
+
+bool ComplexSparseMatrix::same_pattern(const ComplexSparseMatrix& o) const noexcept {
+    return rows_ == o.rows_ && cols_ == o.cols_ &&
+           row_ptr_ == o.row_ptr_ && col_idx_ == o.col_idx_;
+}
+
+Complex ComplexSparseMatrix::get(size_t r, size_t c) const {
+    if (r >= rows_ || c >= cols_)
+        throw std::out_of_range("ComplexSparseMatrix::get: index out of range");
+    auto first = col_idx_.begin() + static_cast<std::ptrdiff_t>(row_ptr_[r]);
+    auto last  = col_idx_.begin() + static_cast<std::ptrdiff_t>(row_ptr_[r + 1]);
+    auto it = std::lower_bound(first, last, c);
+    return (it != last && *it == c) ? values_[static_cast<size_t>(it - col_idx_.begin())]
+                                    : Complex(0.0, 0.0);
+}
+
+// ── SpMV ──────────────────────────────────────────────────────────────────────
+
+namespace {
+
+constexpr size_t kSpmvGrain = 8192;   // non-zeros per task, at least
+
+void csrMultiply(const std::vector<size_t>& rp, const std::vector<size_t>& ci,
+                 const std::vector<Complex>& val, const Complex* x, Complex* y) {
+    Core::parallel_for_balanced(rp, kSpmvGrain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            double sr = 0.0, si = 0.0;
+            for (size_t k = rp[i]; k < rp[i + 1]; ++k) {
+                const Complex a = val[k], b = x[ci[k]];
+                sr += a.real() * b.real() - a.imag() * b.imag();
+                si += a.real() * b.imag() + a.imag() * b.real();
+            }
+            y[i] = Complex(sr, si);
+        }
+    });
+}
+
+} // namespace
+
+ComplexVector ComplexSparseMatrix::operator*(const ComplexVector& x) const {
+    if (x.size() != cols_)
+        throw std::invalid_argument(
+            "ComplexSparseMatrix * ComplexVector: dimension mismatch (" +
+            std::to_string(cols_) + " vs " + std::to_string(x.size()) + ")");
+    ComplexVector y(rows_);
+    csrMultiply(row_ptr_, col_idx_, values_, x.data(), y.data());
+    return y;
+}
+
+void ComplexSparseMatrix::multiply(const std::vector<Complex>& x, std::vector<Complex>& y) const {
+    if (x.size() != cols_ || y.size() != rows_)
+        throw std::invalid_argument("ComplexSparseMatrix::multiply: dimension mismatch");
+    csrMultiply(row_ptr_, col_idx_, values_, x.data(), y.data());
+}
+
+ComplexSparseMatrix ComplexSparseMatrix::operator*(Complex s) const {
+    ComplexSparseMatrix M(*this);
+    for (Complex& v : M.values_) v *= s;
+    return M;
+}
+
+// ── Conversion ────────────────────────────────────────────────────────────────
+
+ComplexMatrix ComplexSparseMatrix::to_dense() const {
+    ComplexMatrix D(rows_, cols_);
+    for (size_t i = 0; i < rows_; ++i)
+        for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k)
+            D(i, col_idx_[k]) = values_[k];
+    return D;
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -1,4 +1,5 @@
 #include "LinearAlgebra/ComplexVector.h"
+#include "LinearAlgebra/ComplexMatrix.h"
 #include <iostream>
 
 namespace SharedMath::LinearAlgebra {
@@ -13,4 +14,17 @@ std::ostream& operator<<(std::ostream& os, const ComplexVector& v) {
     return os;
 }
 
+ComplexVector matvec(const ComplexMatrix& A, const ComplexVector& x) {
+    if (A.cols() != x.size())
+        throw std::invalid_argument("matvec: dimension mismatch");
+    ComplexVector y(A.rows());
+    for (size_t i = 0; i < A.rows(); ++i) {
+        const Complex* a = A.row_ptr(i);
+        Complex s(0.0, 0.0);
+        for (size_t j = 0; j < x.size(); ++j) s += a[j] * x[j];
+        y[i] = s;
+    }
+    return y;
+}
+
 } // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,483 @@
+// Conv2d.cpp — NCHW convolution: im2col + GEMM, Winograd F(2×2, 3×3) and a
+// channel-blocked depthwise kernel.
+//
+// Forward (per image n):
+//
+//   Im2col     col[(c, kh, kw), (oh, ow)] = x[c, oh·s + kh·d − p, ow·s + kw·d − p]
+//              y_g = w_g · col_g            one gemm() per group
+//   Winograd   U[ξ] = G·w·Gᵀ (once per call), V[ξ] = Bᵀ·d·B per 4×4 input
+//              tile, M[ξ] = U[ξ]·V[ξ] (16 gemm() calls), y tile = Aᵀ·M·A
+//   Depthwise  8 channels are interleaved into [Hp, Wp, 8] (zero-padded),
+//              so every multiply-add in the inner loop covers 8 channels
+//
+// Backward input is the forward convolution of dy with the flipped,
+// transposed weight when the stride is 1; otherwise col = w_gᵀ · dy_g
+// followed by a col2im scatter.  Backward weight accumulates dy_g · col_gᵀ.
+// Every parallel loop splits work so that no two threads write the same
+// output element.
+
+#include "LinearAlgebra/Conv2d.h"
+#include "LinearAlgebra/Gemm.h"
+
+#include "core/Memory.h"
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr size_t kLanes = 8;         // channels per NCHWc block
+
+// Outputs o in [lo, hi) read inside the input: 0 <= o·stride + off < extent.
+std::pair<size_t, size_t> validRange(size_t outExtent, size_t extent,
+                                     size_t stride, long off) {
+    const long s = static_cast<long>(stride);
+    const long lo = off >= 0 ? 0 : (-off + s - 1) / s;
+    const long hi = off >= static_cast<long>(extent)
+                  ? 0 : (static_cast<long>(extent) - off + s - 1) / s;
+    const size_t h = std::min(outExtent, static_cast<size_t>(hi));
+    return {std::min(static_cast<size_t>(lo), h), h};
+}
+
+// ─── Direct ───────────────────────────────────────────────────────────────────
+
+template<typename T>
+void convDirect(const Conv2dShape& s, const T* x, const T* w, const T* bias, T* y) {
+    const size_t OH = s.outH(), OW = s.outW();
+    const size_t Cg = s.C / s.groups, OCg = s.OC / s.groups;
+    Core::parallel_for(0, s.N * s.OC, 1, [&](size_t lo, size_t hi) {
+        for (size_t job = lo; job < hi; ++job) {
+            const size_t n = job / s.OC, oc = job % s.OC, g = oc / OCg;
+            T* yp = y + job * OH * OW;
+            for (size_t oh = 0; oh < OH; ++oh)
+                for (size_t ow = 0; ow < OW; ++ow) {
+                    T sum = bias ? bias[oc] : T(0);
+                    for (size_t c = 0; c < Cg; ++c) {
+                        const T* xp = x + (n * s.C + g * Cg + c) * s.H * s.W;
+                        const T* wp = w + (oc * Cg + c) * s.KH * s.KW;
+                        for (size_t kh = 0; kh < s.KH; ++kh) {
+                            const long ih = static_cast<long>(oh * s.stride + kh * s.dilation) -
+                                            static_cast<long>(s.padding);
+                            if (ih < 0 || ih >= static_cast<long>(s.H)) continue;
+                            for (size_t kw = 0; kw < s.KW; ++kw) {
+                                const long iw = static_cast<long>(ow * s.stride + kw * s.dilation) -
+                                                static_cast<long>(s.padding);
+                                if (iw < 0 || iw >= static_cast<long>(s.W)) continue;
+                                sum += xp[static_cast<size_t>(ih) * s.W + static_cast<size_t>(iw)] *
+                                       wp[kh * s.KW + kw];
+                            }
+                        }
+                    }
+                    yp[oh * OW + ow] = sum;
+                }
+        }
+    });
+}
+
+// ─── im2col / col2im ──────────────────────────────────────────────────────────
+
+// Unfold Cg channel planes starting at x into col ((Cg·KH·KW) × (OH·OW)).
+template<typename T>
+void im2col(const Conv2dShape& s, size_t Cg, const T* x, T* col) {
+    const size_t OH = s.outH(), OW = s.outW(), KK = s.KH * s.KW;
+    Core::parallel_for(0, Cg * KK, 4, [&](size_t lo, size_t hi) {
+        for (size_t r = lo; r < hi; ++r) {
+            const size_t c = r / KK, kh = (r % KK) / s.KW, kw = r % s.KW;
+            const T* xp = x + c * s.H * s.W;
+            T* cp = col + r * OH * OW;
+            const long offH = static_cast<long>(kh * s.dilation) - static_cast<long>(s.padding);
+            const long offW = static_cast<long>(kw * s.dilation) - static_cast<long>(s.padding);
+            const auto [wlo, whi] = validRange(OW, s.W, s.stride, offW);
+            for (size_t oh = 0; oh < OH; ++oh, cp += OW) {
+                const long ih = static_cast<long>(oh * s.stride) + offH;
+                if (ih < 0 || ih >= static_cast<long>(s.H) || wlo == whi) {
+                    std::fill(cp, cp + OW, T(0));
+                    continue;
+                }
+                const T* xr = xp + static_cast<size_t>(ih) * s.W;
+                std::fill(cp, cp + wlo, T(0));
+                if (s.stride == 1) {
+                    std::copy(xr + (static_cast<long>(wlo) + offW), xr + (static_cast<long>(whi) + offW), cp + wlo);
+                } else {
+                    for (size_t ow = wlo; ow < whi; ++ow)
+                        cp[ow] = xr[static_cast<long>(ow * s.stride) + offW];
+                }
+                std::fill(cp + whi, cp + OW, T(0));
+            }
+        }
+    });
+}
+
+// Scatter-add col back into Cg channel planes at dx (the adjoint of im2col).
+// Each channel owns its KH·KW rows of col and its plane, so channels run in
+// parallel.
+template<typename T>
+void col2im(const Conv2dShape& s, size_t Cg, const T* col, T* dx) {
+    const size_t OH = s.outH(), OW = s.outW(), KK = s.KH * s.KW;
+    Core::parallel_for(0, Cg, 1, [&](size_t lo, size_t hi) {
+        for (size_t c = lo; c < hi; ++c) {
+            T* dp = dx + c * s.H * s.W;
+            for (size_t k = 0; k < KK; ++k) {
+                const size_t kh = k / s.KW, kw = k % s.KW;
+                const T* cp = col + (c * KK + k) * OH * OW;
+                const long offH = static_cast<long>(kh * s.dilation) - static_cast<long>(s.padding);
+                const long offW = static_cast<long>(kw * s.dilation) - static_cast<long>(s.padding);
+                const auto [wlo, whi] = validRange(OW, s.W, s.stride, offW);
+                const auto [hlo, hhi] = validRange(OH, s.H, s.stride, offH);
+                for (size_t oh = hlo; oh < hhi; ++oh) {
+                    T* dr = dp + static_cast<size_t>(static_cast<long>(oh * s.stride) + offH) * s.W;
+                    const T* cr = cp + oh * OW;
+                    for (size_t ow = wlo; ow < whi; ++ow)
+                        dr[static_cast<long>(ow * s.stride) + offW] += cr[ow];
+                }
+            }
+        }
+    });
+}
+
+bool pointwise(const Conv2dShape& s) {
+    return s.KH == 1 && s.KW == 1 && s.stride == 1 && s.padding == 0;
+}
+
+template<typename T>
+void addBias(const Conv2dShape& s, const T* bias, T* y) {
+    if (!bias) return;
+    const size_t plane = s.outH() * s.outW();
+    Core::parallel_for(0, s.N * s.OC, 4, [&](size_t lo, size_t hi) {
+        for (size_t job = lo; job < hi; ++job) {
+            T* yp = y + job * plane;
+            const T b = bias[job % s.OC];
+            for (size_t i = 0; i < plane; ++i) yp[i] += b;
+        }
+    });
+}
+
+template<typename T>
+void convIm2col(const Conv2dShape& s, const T* x, const T* w, const T* bias, T* y) {
+    const size_t P = s.outH() * s.outW();
+    const size_t Cg = s.C / s.groups, OCg = s.OC / s.groups;
+    const size_t R = Cg * s.KH * s.KW;
+    std::vector<T> col(pointwise(s) ? 0 : R * P);
+    for (size_t n = 0; n < s.N; ++n)
+        for (size_t g = 0; g < s.groups; ++g) {
+            const T* xg = x + (n * s.C + g * Cg) * s.H * s.W;
+            const T* B = xg;
+            if (!pointwise(s)) {
+                im2col(s, Cg, xg, col.data());
+                B = col.data();
+            }
+            gemm(Transpose::No, Transpose::No, OCg, P, R, T(1), w + g * OCg * R, R,
+                 B, P, T(0), y + (n * s.OC + g * OCg) * P, P);
+        }
+    addBias(s, bias, y);
+}
+
+// ─── Winograd F(2×2, 3×3) ─────────────────────────────────────────────────────
+//   Bᵀ = [1 0 −1 0; 0 1 1 0; 0 −1 1 0; 0 1 0 −1]
+//   G  = [1 0 0; ½ ½ ½; ½ −½ ½; 0 0 1]
+//   Aᵀ = [1 1 1 0; 0 1 −1 −1]
+
+bool winogradFits(const Conv2dShape& s) {
+    return s.KH == 3 && s.KW == 3 && s.stride == 1 && s.dilation == 1 && s.groups == 1;
+}
+
+template<typename T>
+void convWinograd(const Conv2dShape& s, const T* x, const T* w, const T* bias, T* y) {
+    const size_t C = s.C, OC = s.OC, H = s.H, W = s.W;
+    const size_t OH = s.outH(), OW = s.outW();
+    const size_t TH = (OH + 1) / 2, TW = (OW + 1) / 2, P = TH * TW;
+    const long pad = static_cast<long>(s.padding);
+
+    // U[ξ][oc][c] = (G·w·Gᵀ)[ξ]
+    std::vector<T> U(16 * OC * C);
+    Core::parallel_for(0, OC * C, 16, [&](size_t lo, size_t hi) {
+        for (size_t j = lo; j < hi; ++j) {
+            const T* g = w + j * 9;
+            T t[4][3];
+            for (size_t c = 0; c < 3; ++c) {
+                t[0][c] = g[c];
+                t[1][c] = T(0.5) * (g[c] + g[3 + c] + g[6 + c]);
+                t[2][c] = T(0.5) * (g[c] - g[3 + c] + g[6 + c]);
+                t[3][c] = g[6 + c];
+            }
+            for (size_t r = 0; r < 4; ++r) {
+                const T u[4] = { t[r][0],
+                                 T(0.5) * (t[r][0] + t[r][1] + t[r][2]),
+                                 T(0.5) * (t[r][0] - t[r][1] + t[r][2]),
+                                 t[r][2] };
+                for (size_t c = 0; c < 4; ++c) U[(r * 4 + c) * OC * C + j] = u[c];
+            }
+        }
+    });
+
+    std::vector<T> V(16 * C * P), M(16 * OC * P);
+    for (size_t n = 0; n < s.N; ++n) {
+        // V[ξ][c][tile] = (Bᵀ·d·B)[ξ]
+        Core::parallel_for(0, C, 1, [&](size_t lo, size_t hi) {
+            for (size_t c = lo; c < hi; ++c) {
+                const T* xp = x + (n * C + c) * H * W;
+                for (size_t th = 0; th < TH; ++th)
+                    for (size_t tw = 0; tw < TW; ++tw) {
+                        T d[4][4];
+                        for (size_t r = 0; r < 4; ++r) {
+                            const long ih = static_cast<long>(2 * th + r) - pad;
+                            for (size_t q = 0; q < 4; ++q) {
+                                const long iw = static_cast<long>(2 * tw + q) - pad;
+                                d[r][q] = (ih >= 0 && ih < static_cast<long>(H) &&
+                                           iw >= 0 && iw < static_cast<long>(W))
+                                        ? xp[static_cast<size_t>(ih) * W + static_cast<size_t>(iw)] : T(0);
+                            }
+                        }
+                        T t[4][4];
+                        for (size_t q = 0; q < 4; ++q) {
+                            t[0][q] = d[0][q] - d[2][q];
+                            t[1][q] = d[1][q] + d[2][q];
+                            t[2][q] = d[2][q] - d[1][q];
+                            t[3][q] = d[1][q] - d[3][q];
+                        }
+                        const size_t p = th * TW + tw;
+                        for (size_t r = 0; r < 4; ++r) {
+                            const T v[4] = { t[r][0] - t[r][2], t[r][1] + t[r][2],
+                                             t[r][2] - t[r][1], t[r][1] - t[r][3] };
+                            for (size_t q = 0; q < 4; ++q)
+                                V[((r * 4 + q) * C + c) * P + p] = v[q];
+                        }
+                    }
+            }
+        });
+
+        for (size_t xi = 0; xi < 16; ++xi)
+            gemm(Transpose::No, Transpose::No, OC, P, C, T(1), U.data() + xi * OC * C, C,
+                 V.data() + xi * C * P, P, T(0), M.data() + xi * OC * P, P);
+
+        // y tile = Aᵀ·M·A (+ bias); odd output sizes drop the last row / column.
+        Core::parallel_for(0, OC, 1, [&](size_t lo, size_t hi) {
+            for (size_t oc = lo; oc < hi; ++oc) {
+                T* yp = y + (n * OC + oc) * OH * OW;
+                const T b = bias ? bias[oc] : T(0);
+                for (size_t th = 0; th < TH; ++th)
+                    for (size_t tw = 0; tw < TW; ++tw) {
+                        const size_t p = th * TW + tw;
+                        T m[4][4];
+                        for (size_t xi = 0; xi < 16; ++xi)
+                            m[xi / 4][xi % 4] = M[(xi * OC + oc) * P + p];
+                        T t[2][4];
+                        for (size_t q = 0; q < 4; ++q) {
+                            t[0][q] = m[0][q] + m[1][q] + m[2][q];
+                            t[1][q] = m[1][q] - m[2][q] - m[3][q];
+                        }
+                        for (size_t r = 0; r < 2; ++r) {
+                            const size_t oh = 2 * th + r;
+                            if (oh >= OH) break;
+                            const T o[2] = { t[r][0] + t[r][1] + t[r][2],
+                                             t[r][1] - t[r][2] - t[r][3] };
+                            for (size_t q = 0; q < 2 && 2 * tw + q < OW; ++q)
+                                yp[oh * OW + 2 * tw + q] = o[q] + b;
+                        }
+                    }
+            }
+        });
+    }
+}
+
+// ─── Depthwise (NCHWc) ────────────────────────────────────────────────────────
+
+bool depthwiseFits(const Conv2dShape& s) {
+    return s.groups == s.C && s.OC == s.C;
+}
+
+template<typename T>
+void convDepthwise(const Conv2dShape& s, const T* x, const T* w, const T* bias, T* y) {
+    const size_t OH = s.outH(), OW = s.outW();
+    const size_t Hp = s.H + 2 * s.padding, Wp = s.W + 2 * s.padding;
+    const size_t KK = s.KH * s.KW;
+    const size_t blocks = (s.C + kLanes - 1) / kLanes;
+
+    Core::parallel_for(0, s.N * blocks, 1, [&](size_t lo, size_t hi) {
+        Core::ArenaScope scratch;
+        Core::ScratchVector<T> in(Hp * Wp * kLanes), wk(KK * kLanes), acc(OW * kLanes);
+        for (size_t job = lo; job < hi; ++job) {
+            const size_t n = job / blocks, c0 = (job % blocks) * kLanes;
+            const size_t lanes = std::min(kLanes, s.C - c0);
+
+            std::fill(in.begin(), in.end(), T(0));
+            std::fill(wk.begin(), wk.end(), T(0));
+            for (size_t l = 0; l < lanes; ++l) {
+                const T* xp = x + (n * s.C + c0 + l) * s.H * s.W;
+                for (size_t ih = 0; ih < s.H; ++ih) {
+                    T* row = in.data() + ((ih + s.padding) * Wp + s.padding) * kLanes + l;
+                    for (size_t iw = 0; iw < s.W; ++iw) row[iw * kLanes] = xp[ih * s.W + iw];
+                }
+                for (size_t k = 0; k < KK; ++k) wk[k * kLanes + l] = w[(c0 + l) * KK + k];
+            }
+
+            for (size_t oh = 0; oh < OH; ++oh) {
+                for (size_t ow = 0; ow < OW; ++ow)
+                    for (size_t l = 0; l < kLanes; ++l)
+                        acc[ow * kLanes + l] = (bias && l < lanes) ? bias[c0 + l] : T(0);
+                for (size_t kh = 0; kh < s.KH; ++kh)
+                    for (size_t kw = 0; kw < s.KW; ++kw) {
+                        const T* wl = wk.data() + (kh * s.KW + kw) * kLanes;
+                        const T* ip = in.data() +
+                            ((oh * s.stride + kh * s.dilation) * Wp + kw * s.dilation) * kLanes;
+                        for (size_t ow = 0; ow < OW; ++ow) {
+                            const T* iv = ip + ow * s.stride * kLanes;
+                            T* av = acc.data() + ow * kLanes;
+                            for (size_t l = 0; l < kLanes; ++l) av[l] += iv[l] * wl[l];
+                        }
+                    }
+                for (size_t l = 0; l < lanes; ++l) {
+                    T* yr = y + ((n * s.C + c0 + l) * OH + oh) * OW;
+                    for (size_t ow = 0; ow < OW; ++ow) yr[ow] = acc[ow * kLanes + l];
+                }
+            }
+        }
+    });
+}
+
+// ─── Dispatch ─────────────────────────────────────────────────────────────────
+
+template<typename T>
+void convForward(const Conv2dShape& s, const T* x, const T* w, const T* bias, T* y,
+                 ConvAlgorithm algo) {
+    s.validate("conv2d");
+    if (algo == ConvAlgorithm::Auto) algo = conv2dAlgorithm(s);
+    switch (algo) {
+    case ConvAlgorithm::Direct:
+        return convDirect(s, x, w, bias, y);
+    case ConvAlgorithm::Winograd:
+        if (!winogradFits(s))
+            throw std::invalid_argument(
+                "conv2d: Winograd needs a 3x3 kernel, stride 1, dilation 1 and groups 1");
+        return convWinograd(s, x, w, bias, y);
+    case ConvAlgorithm::Depthwise:
+        if (!depthwiseFits(s))
+            throw std::invalid_argument("conv2d: Depthwise needs groups == C == OC");
+        return convDepthwise(s, x, w, bias, y);
+    default:
+        return convIm2col(s, x, w, bias, y);
+    }
+}
+
+} // namespace
+
+void Conv2dShape::validate(const char* who) const {
+    if (N == 0 || C == 0 || H == 0 || W == 0 || OC == 0 || KH == 0 || KW == 0)
+        throw std::invalid_argument(std::string(who) + ": sizes must be > 0");
+    if (stride == 0 || dilation == 0 || groups == 0)
+        throw std::invalid_argument(std::string(who) + ": stride, dilation and groups must be > 0");
+    if (C % groups != 0 || OC % groups != 0)
+        throw std::invalid_argument(std::string(who) + ": channels must be divisible by groups");
+    if (dilation * (KH - 1) + 1 > H + 2 * padding || dilation * (KW - 1) + 1 > W + 2 * padding)
+        throw std::invalid_argument(std::string(who) + ": kernel larger than padded input");
+}
+
+ConvAlgorithm conv2dAlgorithm(const Conv2dShape& s) noexcept {
+    if (s.groups > 1 && depthwiseFits(s)) return ConvAlgorithm::Depthwise;
+    // Below a few tiles per image the transforms cost more than they save.
+    if (winogradFits(s) && s.C >= 4 && s.outH() >= 4 && s.outW() >= 4)
+        return ConvAlgorithm::Winograd;
+    return ConvAlgorithm::Im2col;
+}
+
+void conv2d(const Conv2dShape& s, const double* x, const double* w,
+            const double* bias, double* y, ConvAlgorithm algo) {
+    convForward(s, x, w, bias, y, algo);
+}
+
+void conv2d(const Conv2dShape& s, const float* x, const float* w,
+            const float* bias, float* y, ConvAlgorithm algo) {
+    convForward(s, x, w, bias, y, algo);
+}
+
+void conv2dBackwardInput(const Conv2dShape& s, const double* dy, const double* w, double* dx) {
+    s.validate("conv2dBackwardInput");
+    const size_t OH = s.outH(), OW = s.outW(), P = OH * OW;
+    const size_t Cg = s.C / s.groups, OCg = s.OC / s.groups;
+    const size_t KK = s.KH * s.KW, R = Cg * KK;
+
+    // Stride 1: dx = conv(dy, w'), w'[g·Cg + c][o] = w[g·OCg + o][c] flipped,
+    // padded by dilation·(K − 1) − padding on each side.
+    const size_t reach = s.dilation * (s.KH - 1);
+    if (s.stride == 1 && s.KH == s.KW && s.padding <= reach) {
+        std::vector<double> wf(s.C * OCg * KK);
+        for (size_t g = 0; g < s.groups; ++g)
+            for (size_t o = 0; o < OCg; ++o)
+                for (size_t c = 0; c < Cg; ++c) {
+                    const double* src = w + ((g * OCg + o) * Cg + c) * KK;
+                    double* dst = wf.data() + ((g * Cg + c) * OCg + o) * KK;
+                    for (size_t k = 0; k < KK; ++k) dst[k] = src[KK - 1 - k];
+                }
+        Conv2dShape t = s;
+        t.C = s.OC;  t.H = OH;  t.W = OW;
+        t.OC = s.C;
+        t.padding = reach - s.padding;
+        convForward(t, dy, wf.data(), static_cast<const double*>(nullptr), dx, ConvAlgorithm::Auto);
+        return;
+    }
+
+    std::fill(dx, dx + s.N * s.C * s.H * s.W, 0.0);
+    std::vector<double> col(R * P);
+    for (size_t n = 0; n < s.N; ++n)
+        for (size_t g = 0; g < s.groups; ++g) {
+            gemm(Transpose::Yes, Transpose::No, R, P, OCg, 1.0, w + g * OCg * R, R,
+                 dy + (n * s.OC + g * OCg) * P, P, 0.0, col.data(), P);
+            col2im(s, Cg, col.data(), dx + (n * s.C + g * Cg) * s.H * s.W);
+        }
+}
+
+void conv2dBackwardWeight(const Conv2dShape& s, const double* dy, const double* x, double* dw) {
+    s.validate("conv2dBackwardWeight");
+    const size_t OH = s.outH(), OW = s.outW(), P = OH * OW;
+    const size_t Cg = s.C / s.groups, OCg = s.OC / s.groups;
+    const size_t KK = s.KH * s.KW, R = Cg * KK;
+
+    if (depthwiseFits(s) && s.groups > 1) {
+        // One output channel per input channel: a GEMM would have one row,
+        // so each channel reduces its own KH·KW taps directly.
+        Core::parallel_for(0, s.C, 1, [&](size_t lo, size_t hi) {
+            for (size_t c = lo; c < hi; ++c)
+                for (size_t k = 0; k < KK; ++k) {
+                    const long offH = static_cast<long>((k / s.KW) * s.dilation) - static_cast<long>(s.padding);
+                    const long offW = static_cast<long>((k % s.KW) * s.dilation) - static_cast<long>(s.padding);
+                    const auto [hlo, hhi] = validRange(OH, s.H, s.stride, offH);
+                    const auto [wlo, whi] = validRange(OW, s.W, s.stride, offW);
+                    double sum = 0.0;
+                    for (size_t n = 0; n < s.N; ++n) {
+                        const double* gp = dy + (n * s.C + c) * P;
+                        const double* xp = x + (n * s.C + c) * s.H * s.W;
+                        for (size_t oh = hlo; oh < hhi; ++oh) {
+                            const double* xr = xp + static_cast<size_t>(static_cast<long>(oh * s.stride) + offH) * s.W;
+                            const double* gr = gp + oh * OW;
+                            for (size_t ow = wlo; ow < whi; ++ow)
+                                sum += gr[ow] * xr[static_cast<long>(ow * s.stride) + offW];
+                        }
+                    }
+                    dw[c * KK + k] = sum;
+                }
+        });
+        return;
+    }
+
+    std::vector<double> col(pointwise(s) ? 0 : R * P);
+    for (size_t n = 0; n < s.N; ++n)
+        for (size_t g = 0; g < s.groups; ++g) {
+            const double* xg = x + (n * s.C + g * Cg) * s.H * s.W;
+            const double* B = xg;
+            if (!pointwise(s)) {
+                im2col(s, Cg, xg, col.data());
+                B = col.data();
+            }
+            gemm(Transpose::No, Transpose::Yes, OCg, R, P, 1.0, dy + (n * s.OC + g * OCg) * P, P,
+                 B, P, n == 0 ? 0.0 : 1.0, dw + g * OCg * R, R);
+        }
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -5,11 +5,13 @@
 // a circular dependency between the public header and the internal CUDA header.
 
 #include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/Gemm.h"
 
 #ifdef SHAREDMATH_CUDA
 #  include "DynamicMatrixCUDA.h"   // dispatch declarations (internal, not installed)
 #endif
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
@@ -128,7 +130,7 @@ DynamicMatrix& DynamicMatrix::operator-=(const DynamicMatrix& o) {
     return *this;
 }
 
-// Cache-friendly matrix multiply (i-k-j loop order).
+// Matrix multiply through the shared blocked GEMM kernel.
 // Dispatches to cuBLAS when both matrices are on GPU.
 DynamicMatrix DynamicMatrix::operator*(const DynamicMatrix& B) const {
     if (cols_ != B.rows_)
@@ -139,18 +141,126 @@ DynamicMatrix DynamicMatrix::operator*(const DynamicMatrix& B) const {
 #ifdef SHAREDMATH_CUDA
     if (m_device == Device::CUDA) { DM_CUDA_MATMUL(*this, B); }
 #endif
-    DynamicMatrix C(rows_, B.cols_, 0.0);
-    for (size_t i = 0; i < rows_; ++i) {
-        const double* Ai = row_ptr(i);
-        double*       Ci = C.row_ptr(i);
-        for (size_t k = 0; k < cols_; ++k) {
-            const double  a  = Ai[k];
-            const double* Bk = B.row_ptr(k);
-            for (size_t j = 0; j < B.cols_; ++j)
-                Ci[j] += a * Bk[j];
-        }
+    DynamicMatrix C;
+    return matmul_into(C, *this, B);
+}
+
+// ─── Transpose ────────────────────────────────────────────────────────────────
+
+DynamicMatrix DynamicMatrix::transposed() const {
+    requireCPU("transposed");
+    DynamicMatrix T;
+    return transpose_into(T, *this);
+}
+
+// ─── Out-parameter kernels ────────────────────────────────────────────────────
+
+namespace {
+
+// Whether `out` can take a rows×cols result in its current buffer.
+bool reusable(const DynamicMatrix& out, size_t rows, size_t cols) {
+    return out.device() == Device::CPU && out.rows() == rows && out.cols() == cols;
+}
+
+bool onCPU(const DynamicMatrix& a, const DynamicMatrix& b) {
+    return a.device() == Device::CPU && b.device() == Device::CPU;
+}
+
+void checkSameShape(const DynamicMatrix& a, const DynamicMatrix& b, const char* fn) {
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+        throw std::invalid_argument(
+            std::string(fn) + ": shape mismatch (" +
+            std::to_string(a.rows()) + "x" + std::to_string(a.cols()) + " vs " +
+            std::to_string(b.rows()) + "x" + std::to_string(b.cols()) + ")");
+}
+
+} // namespace
+
+DynamicMatrix& matmul_into(DynamicMatrix& C, const DynamicMatrix& A, const DynamicMatrix& B,
+                           double alpha, double beta) {
+    if (A.cols() != B.rows())
+        throw std::invalid_argument(
+            "matmul_into: inner dimensions mismatch (" +
+            std::to_string(A.cols()) + " vs " + std::to_string(B.rows()) + ")");
+    const size_t m = A.rows(), n = B.cols(), k = A.cols();
+    if (beta != 0.0 && (C.rows() != m || C.cols() != n))
+        throw std::invalid_argument(
+            "matmul_into: C must be " + std::to_string(m) + "x" + std::to_string(n) +
+            " when beta != 0");
+
+    if (!onCPU(A, B) || C.device() != Device::CPU) {
+        DynamicMatrix P = A * B;
+        if (alpha != 1.0) P *= alpha;
+        if (beta != 0.0) P += C * beta;
+        return C = std::move(P);
+    }
+
+    // gemm must not write to an operand it is still reading.
+    if (!reusable(C, m, n) || &C == &A || &C == &B) {
+        DynamicMatrix R = beta != 0.0 ? C : DynamicMatrix(m, n);
+        gemm(Transpose::No, Transpose::No, m, n, k, alpha, A.data().data(), k,
+             B.data().data(), n, beta, R.data().data(), n);
+        return C = std::move(R);
     }
+    gemm(Transpose::No, Transpose::No, m, n, k, alpha, A.data().data(), k,
+         B.data().data(), n, beta, C.data().data(), n);
     return C;
 }
 
+DynamicMatrix& add_into(DynamicMatrix& out, const DynamicMatrix& A, const DynamicMatrix& B) {
+    checkSameShape(A, B, "add_into");
+    if (!onCPU(A, B)) return out = A + B;
+    if (!reusable(out, A.rows(), A.cols())) out = DynamicMatrix(A.rows(), A.cols());
+    const double* a = A.data().data();
+    const double* b = B.data().data();
+    double*       r = out.data().data();
+    for (size_t i = 0, n = A.size(); i < n; ++i) r[i] = a[i] + b[i];
+    return out;
+}
+
+DynamicMatrix& sub_into(DynamicMatrix& out, const DynamicMatrix& A, const DynamicMatrix& B) {
+    checkSameShape(A, B, "sub_into");
+    if (!onCPU(A, B)) return out = A - B;
+    if (!reusable(out, A.rows(), A.cols())) out = DynamicMatrix(A.rows(), A.cols());
+    const double* a = A.data().data();
+    const double* b = B.data().data();
+    double*       r = out.data().data();
+    for (size_t i = 0, n = A.size(); i < n; ++i) r[i] = a[i] - b[i];
+    return out;
+}
+
+DynamicMatrix& scale_into(DynamicMatrix& out, const DynamicMatrix& A, double s) {
+    if (A.device() != Device::CPU) return out = A * s;
+    if (!reusable(out, A.rows(), A.cols())) out = DynamicMatrix(A.rows(), A.cols());
+    const double* a = A.data().data();
+    double*       r = out.data().data();
+    for (size_t i = 0, n = A.size(); i < n; ++i) r[i] = s * a[i];
+    return out;
+}
+
+// Tiled so that both the rows read and the rows written stay in cache.
+DynamicMatrix& transpose_into(DynamicMatrix& out, const DynamicMatrix& A) {
+    if (A.device() != Device::CPU)
+        throw std::runtime_error(
+            "transpose_into: matrix is on GPU — call .cpu() first to access elements");
+    const size_t m = A.rows(), n = A.cols();
+    if (&out == &A || !reusable(out, n, m)) {
+        DynamicMatrix T(n, m);
+        transpose_into(T, A);
+        return out = std::move(T);
+    }
+    constexpr size_t kTile = 32;
+    for (size_t i0 = 0; i0 < m; i0 += kTile) {
+        const size_t i1 = std::min(m, i0 + kTile);
+        for (size_t j0 = 0; j0 < n; j0 += kTile) {
+            const size_t j1 = std::min(n, j0 + kTile);
+            for (size_t i = i0; i < i1; ++i) {
+                const double* Ai = A.row_ptr(i);
+                for (size_t j = j0; j < j1; ++j) out(j, i) = Ai[j];
+            }
+        }
+    }
+    return out;
+}
+
 } // namespace SharedMath::LinearAlgebra
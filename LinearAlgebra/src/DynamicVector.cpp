@@ -1,6 +1,7 @@
 #include "LinearAlgebra/DynamicVector.h"
 #include "LinearAlgebra/DynamicMatrix.h"
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
@@ -58,30 +59,58 @@ std::ostream& operator<<(std::ostream& os, const DynamicVector& v) {
 
 // y = A * x  (m = rows(A), n = cols(A))
 DynamicVector matvec(const DynamicMatrix& A, const DynamicVector& x) {
+    DynamicVector y;
+    return matvec_into(y, A, x);
+}
+
+// y = A^T * x  (n = cols(A))
+DynamicVector rmatvec(const DynamicMatrix& A, const DynamicVector& x) {
+    DynamicVector y;
+    return rmatvec_into(y, A, x);
+}
+
+DynamicVector& matvec_into(DynamicVector& y, const DynamicMatrix& A, const DynamicVector& x,
+                           double alpha, double beta) {
     if (A.cols() != x.size())
         throw std::invalid_argument(
             "matvec: dimension mismatch — A.cols()=" + std::to_string(A.cols()) +
             " vs x.size()=" + std::to_string(x.size()));
-    DynamicVector y(A.rows(), 0.0);
+    if (beta != 0.0 && y.size() != A.rows())
+        throw std::invalid_argument("matvec_into: y must have A.rows() elements when beta != 0");
+    if (&y == &x) {
+        DynamicVector r = beta != 0.0 ? y : DynamicVector(A.rows());
+        matvec_into(r, A, x, alpha, beta);
+        return y = std::move(r);
+    }
+    if (y.size() != A.rows()) y = DynamicVector(A.rows());
     for (size_t i = 0; i < A.rows(); ++i) {
         const double* Ai = A.row_ptr(i);
         double s = 0.0;
         for (size_t j = 0; j < A.cols(); ++j) s += Ai[j] * x[j];
-        y[i] = s;
+        y[i] = beta == 0.0 ? alpha * s : alpha * s + beta * y[i];
     }
     return y;
 }
 
-// y = A^T * x  (n = cols(A))
-DynamicVector rmatvec(const DynamicMatrix& A, const DynamicVector& x) {
+DynamicVector& rmatvec_into(DynamicVector& y, const DynamicMatrix& A, const DynamicVector& x,
+                            double alpha, double beta) {
     if (A.rows() != x.size())
         throw std::invalid_argument(
             "rmatvec: dimension mismatch — A.rows()=" + std::to_string(A.rows()) +
             " vs x.size()=" + std::to_string(x.size()));
-    DynamicVector y(A.cols(), 0.0);
+    if (beta != 0.0 && y.size() != A.cols())
+        throw std::invalid_argument("rmatvec_into: y must have A.cols() elements when beta != 0");
+    if (&y == &x) {
+        DynamicVector r = beta != 0.0 ? y : DynamicVector(A.cols());
+        rmatvec_into(r, A, x, alpha, beta);
+        return y = std::move(r);
+    }
+    if (y.size() != A.cols()) y = DynamicVector(A.cols());
+    if (beta == 0.0) std::fill(y.begin(), y.end(), 0.0);
+    else if (beta != 1.0) y *= beta;
     for (size_t i = 0; i < A.rows(); ++i) {
         const double* Ai = A.row_ptr(i);
-        double xi = x[i];
+        const double xi = alpha * x[i];
         for (size_t j = 0; j < A.cols(); ++j) y[j] += Ai[j] * xi;
     }
     return y;
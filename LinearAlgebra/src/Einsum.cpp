@@ -0,0 +1,496 @@
+// Einsum.cpp — tensordot / einsum lowered to batched GEMM.
+//
+// A subscript string is parsed once into a plan that is cached by
+// subscripts + operand shapes.  Execution then works on flat row-major
+// buffers tagged with one label per axis:
+//
+//   1. repeated labels inside one operand take the diagonal ("ii->i")
+//   2. labels needed by nothing else are summed out early
+//   3. operands are contracted pairwise in the greedy order of the plan;
+//      each pair is laid out as [batch, free_a, contracted] and
+//      [batch, contracted, free_b] so one gemm() per batch entry does the
+//      work.  A layout that is already right (either transpose) is used
+//      in place
+//   4. the last operand is permuted into the output order
+//
+// Every permutation is one strided gather, so the only non-GEMM work is
+// O(size) per operand and per intermediate.
+
+#include "MatrixFunctions.h"
+#include "Gemm.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+// Below this many multiply-adds per batch entry a plain loop beats the
+// packing overhead of gemm().
+constexpr size_t kSmallGemm   = 32 * 32 * 32;
+constexpr size_t kGatherGrain = 4096;     // elements per parallel chunk
+constexpr size_t kPlanCacheCapacity = 256;
+
+// One operand during execution: a row-major buffer with one label per axis.
+// p points either into a caller's tensor or into own.
+struct Operand {
+    std::vector<double> own;
+    const double*       p = nullptr;
+    std::vector<size_t> shape;
+    std::string         labels;
+
+    size_t size() const {
+        size_t s = 1;
+        for (size_t d : shape) s *= d;
+        return s;
+    }
+};
+
+std::vector<size_t> rowStrides(const std::vector<size_t>& shape) {
+    std::vector<size_t> st(shape.size(), 1);
+    for (size_t i = shape.size(); i-- > 1;) st[i - 1] = st[i] * shape[i];
+    return st;
+}
+
+// dst (contiguous, `shape`) ← src read with arbitrary element strides.
+// Covers permutations (permuted strides) and diagonals (summed strides).
+void gather(const double* src, const std::vector<size_t>& shape,
+            const std::vector<size_t>& srcStrides, double* dst)
+{
+    const size_t nd = shape.size();
+    if (nd == 0) { dst[0] = src[0]; return; }
+    size_t total = 1;
+    for (size_t d : shape) total *= d;
+    if (total == 0) return;
+
+    const size_t inner = shape[nd - 1], is = srcStrides[nd - 1];
+    const size_t outer = total / inner;
+    const size_t grain = std::max<size_t>(1, kGatherGrain / inner);
+
+    Core::parallel_for(0, outer, grain, [&](size_t lo, size_t hi) {
+        // Unravel lo over the outer nd-1 axes.
+        std::vector<size_t> idx(nd - 1, 0);
+        size_t off = 0;
+        for (size_t r = lo, a = nd - 1; a-- > 0;) {
+            idx[a] = r % shape[a];
+            r /= shape[a];
+            off += idx[a] * srcStrides[a];
+        }
+        for (size_t o = lo; o < hi; ++o) {
+            double* d = dst + o * inner;
+            const double* s = src + off;
+            if (is == 1) std::copy(s, s + inner, d);
+            else for (size_t k = 0; k < inner; ++k) d[k] = s[k * is];
+
+            for (size_t a = nd - 1; a-- > 0;) {
+                off += srcStrides[a];
+                if (++idx[a] < shape[a]) break;
+                off -= idx[a] * srcStrides[a];
+                idx[a] = 0;
+            }
+        }
+    });
+}
+
+// Permute x so that its labels read `order` (a permutation of x.labels).
+Operand arrange(Operand x, const std::string& order) {
+    if (x.labels == order) return x;
+    const auto st = rowStrides(x.shape);
+    Operand y;
+    std::vector<size_t> srcStrides;
+    for (char c : order) {
+        size_t a = x.labels.find(c);
+        y.shape.push_back(x.shape[a]);
+        srcStrides.push_back(st[a]);
+    }
+    y.labels = order;
+    y.own.resize(y.size());
+    gather(x.p, y.shape, srcStrides, y.own.data());
+    y.p = y.own.data();
+    return y;
+}
+
+// Collapse repeated labels onto their diagonal: "iji" → "ij".
+Operand takeDiagonal(Operand x) {
+    std::string uniq;
+    for (char c : x.labels)
+        if (uniq.find(c) == std::string::npos) uniq += c;
+    if (uniq.size() == x.labels.size()) return x;
+
+    const auto st = rowStrides(x.shape);
+    Operand y;
+    y.labels = uniq;
+    std::vector<size_t> srcStrides(uniq.size(), 0);
+    for (size_t u = 0; u < uniq.size(); ++u) {
+        for (size_t a = 0; a < x.labels.size(); ++a)
+            if (x.labels[a] == uniq[u]) srcStrides[u] += st[a];
+        y.shape.push_back(x.shape[x.labels.find(uniq[u])]);
+    }
+    y.own.resize(y.size());
+    gather(x.p, y.shape, srcStrides, y.own.data());
+    y.p = y.own.data();
+    return y;
+}
+
+// Sum over every label of x that does not occur in `keep`.
+Operand sumOut(Operand x, const std::string& keep) {
+    std::string kept, summed;
+    for (char c : x.labels)
+        (keep.find(c) == std::string::npos ? summed : kept) += c;
+    if (summed.empty()) return x;
+
+    x = arrange(std::move(x), kept + summed);
+    size_t R = 1, S = 1;
+    Operand y;
+    y.labels = kept;
+    for (size_t a = 0; a < kept.size(); ++a) {
+        y.shape.push_back(x.shape[a]);
+        R *= x.shape[a];
+    }
+    for (size_t a = kept.size(); a < x.shape.size(); ++a) S *= x.shape[a];
+
+    y.own.assign(R, 0.0);
+    const double* src = x.p;
+    double* dst = y.own.data();
+    Core::parallel_for(0, R, std::max<size_t>(1, kGatherGrain / std::max<size_t>(S, 1)),
+        [&](size_t lo, size_t hi) {
+            for (size_t r = lo; r < hi; ++r) {
+                const double* row = src + r * S;
+                double s = 0.0;
+                for (size_t k = 0; k < S; ++k) s += row[k];
+                dst[r] = s;
+            }
+        });
+    y.p = y.own.data();
+    return y;
+}
+
+// C[t] = op(A[t]) · op(B[t]) for t < batch, with op(A) M×K and op(B) K×N.
+void batchedGemm(size_t batch, size_t M, size_t N, size_t K,
+                 Transpose ta, const double* A, Transpose tb, const double* B,
+                 double* C)
+{
+    const size_t lda = ta == Transpose::No ? K : M;
+    const size_t ldb = tb == Transpose::No ? N : K;
+    if (M * N * K >= kSmallGemm) {
+        Core::parallel_for(0, batch, 1, [&](size_t lo, size_t hi) {
+            for (size_t t = lo; t < hi; ++t)
+                gemm(ta, tb, M, N, K, 1.0, A + t * M * K, lda,
+                     B + t * K * N, ldb, 0.0, C + t * M * N, N);
+        });
+        return;
+    }
+
+    // Small products (elementwise, dot, outer, tiny matmuls): plain loops.
+    const size_t grain = std::max<size_t>(1, kSmallGemm / std::max<size_t>(M * N * K, 1));
+    Core::parallel_for(0, batch, grain, [&](size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; ++t) {
+            const double* a = A + t * M * K;
+            const double* b = B + t * K * N;
+            double* c = C + t * M * N;
+            std::fill(c, c + M * N, 0.0);
+            for (size_t i = 0; i < M; ++i)
+                for (size_t k = 0; k < K; ++k) {
+                    const double aik = ta == Transpose::No ? a[i * lda + k] : a[k * lda + i];
+                    double* ci = c + i * N;
+                    if (tb == Transpose::No) {
+                        const double* bk = b + k * ldb;
+                        for (size_t j = 0; j < N; ++j) ci[j] += aik * bk[j];
+                    } else {
+                        for (size_t j = 0; j < N; ++j) ci[j] += aik * b[j * ldb + k];
+                    }
+                }
+        }
+    });
+}
+
+// Contract a with b.  Shared labels in `keep` become batch axes, the other
+// shared labels are summed; the result is labelled batch + free_a + free_b.
+Operand contractPair(Operand a, Operand b, const std::string& keep) {
+    a = sumOut(std::move(a), b.labels + keep);
+    b = sumOut(std::move(b), a.labels + keep);
+
+    std::string batch, contr, freeA, freeB;
+    size_t Bt = 1, M = 1, N = 1, K = 1;
+    std::vector<size_t> shape;
+    for (size_t i = 0; i < a.labels.size(); ++i) {
+        char c = a.labels[i];
+        if (b.labels.find(c) == std::string::npos) { freeA += c; M *= a.shape[i]; }
+        else if (keep.find(c) != std::string::npos) { batch += c; Bt *= a.shape[i]; }
+        else { contr += c; K *= a.shape[i]; }
+    }
+    for (size_t i = 0; i < b.labels.size(); ++i)
+        if (a.labels.find(b.labels[i]) == std::string::npos) {
+            freeB += b.labels[i];
+            N *= b.shape[i];
+        }
+
+    Transpose ta = Transpose::No, tb = Transpose::No;
+    if (a.labels == batch + contr + freeA && !freeA.empty() && !contr.empty())
+        ta = Transpose::Yes;
+    else
+        a = arrange(std::move(a), batch + freeA + contr);
+    if (b.labels == batch + freeB + contr && !freeB.empty() && !contr.empty())
+        tb = Transpose::Yes;
+    else
+        b = arrange(std::move(b), batch + contr + freeB);
+
+    Operand c;
+    c.labels = batch + freeA + freeB;
+    for (char l : c.labels) {
+        size_t pos = a.labels.find(l);
+        c.shape.push_back(pos != std::string::npos ? a.shape[pos]
+                                                    : b.shape[b.labels.find(l)]);
+    }
+    c.own.resize(Bt * M * N);
+    if (!c.own.empty())
+        batchedGemm(Bt, M, N, K, ta, a.p, tb, b.p, c.own.data());
+    c.p = c.own.data();
+    return c;
+}
+
+// ─── Plans ───────────────────────────────────────────────────────────────────
+
+struct EinsumPlan {
+    std::vector<std::string> inputs;
+    std::string output;
+    // Pairs of positions in the working list; both are removed and the
+    // result is appended (the numpy / opt_einsum path convention).
+    std::vector<std::pair<size_t, size_t>> path;
+};
+
+// Greedy order: repeatedly contract the pair whose result is smallest
+// relative to its inputs, preferring pairs that share a label so outer
+// products are left until last.
+std::vector<std::pair<size_t, size_t>>
+greedyPath(std::vector<std::string> labels, const std::string& output,
+           const std::array<size_t, 256>& dims)
+{
+    auto sizeOf = [&](const std::string& l) {
+        double s = 1.0;
+        for (char c : l) s *= static_cast<double>(dims[static_cast<unsigned char>(c)]);
+        return s;
+    };
+
+    std::vector<std::pair<size_t, size_t>> path;
+    while (labels.size() > 1) {
+        size_t bi = 0, bj = 1;
+        bool bestShares = false;
+        double bestCost = 0.0;
+        std::string bestResult;
+        for (size_t i = 0; i < labels.size(); ++i)
+            for (size_t j = i + 1; j < labels.size(); ++j) {
+                std::string keep = output;
+                for (size_t o = 0; o < labels.size(); ++o)
+                    if (o != i && o != j) keep += labels[o];
+                std::string result;
+                bool shares = false;
+                for (char c : labels[i] + labels[j]) {
+                    if (labels[j].find(c) != std::string::npos &&
+                        labels[i].find(c) != std::string::npos) shares = true;
+                    if (keep.find(c) != std::string::npos &&
+                        result.find(c) == std::string::npos) result += c;
+                }
+                const double cost = sizeOf(result) - sizeOf(labels[i]) - sizeOf(labels[j]);
+                const bool first = i == 0 && j == 1;
+                if (first || (shares && !bestShares) ||
+                    (shares == bestShares && cost < bestCost)) {
+                    bi = i; bj = j;
+                    bestShares = shares;
+                    bestCost = cost;
+                    bestResult = result;
+                }
+            }
+        path.emplace_back(bi, bj);
+        labels.erase(labels.begin() + bj);
+        labels.erase(labels.begin() + bi);
+        labels.push_back(bestResult);
+    }
+    return path;
+}
+
+std::shared_ptr<const EinsumPlan>
+buildPlan(const std::string& subscripts, const std::vector<const Tensor*>& ops)
+{
+    auto arrow = subscripts.find("->");
+    if (arrow == std::string::npos)
+        throw std::invalid_argument("einsum: subscripts must contain '->'");
+    const std::string lhs = subscripts.substr(0, arrow);
+
+    auto plan = std::make_shared<EinsumPlan>();
+    plan->output = subscripts.substr(arrow + 2);
+    for (size_t start = 0;;) {
+        size_t comma = lhs.find(',', start);
+        plan->inputs.push_back(lhs.substr(start, comma - start));
+        if (comma == std::string::npos) break;
+        start = comma + 1;
+    }
+    if (plan->inputs.size() != ops.size())
+        throw std::invalid_argument("einsum: wrong number of operands in subscripts");
+
+    std::array<size_t, 256> dims{};
+    std::array<bool, 256> seen{};
+    for (size_t k = 0; k < ops.size(); ++k) {
+        const std::string& l = plan->inputs[k];
+        if (l.size() != ops[k]->ndim())
+            throw std::invalid_argument("einsum: subscript rank mismatch");
+        for (size_t i = 0; i < l.size(); ++i) {
+            const auto c = static_cast<unsigned char>(l[i]);
+            if (seen[c] && dims[c] != ops[k]->dim(i))
+                throw std::invalid_argument("einsum: index size mismatch");
+            seen[c] = true;
+            dims[c] = ops[k]->dim(i);
+        }
+    }
+    for (size_t i = 0; i < plan->output.size(); ++i) {
+        const char c = plan->output[i];
+        if (!seen[static_cast<unsigned char>(c)])
+            throw std::invalid_argument("einsum: output subscript not found in inputs");
+        if (plan->output.find(c) != i)
+            throw std::invalid_argument("einsum: output subscripts must be unique");
+    }
+
+    // Labels each operand still carries after its diagonal / sum-out pass.
+    std::vector<std::string> reduced;
+    for (size_t k = 0; k < ops.size(); ++k) {
+        std::string keep = plan->output;
+        for (size_t o = 0; o < ops.size(); ++o)
+            if (o != k) keep += plan->inputs[o];
+        std::string r;
+        for (char c : plan->inputs[k])
+            if (keep.find(c) != std::string::npos && r.find(c) == std::string::npos) r += c;
+        reduced.push_back(r);
+    }
+    plan->path = greedyPath(std::move(reduced), plan->output, dims);
+    return plan;
+}
+
+std::shared_ptr<const EinsumPlan>
+cachedPlan(const std::string& subscripts, const std::vector<const Tensor*>& ops)
+{
+    static std::mutex mtx;
+    static std::unordered_map<std::string, std::shared_ptr<const EinsumPlan>> cache;
+
+    std::string key = subscripts;
+    for (const Tensor* t : ops) {
+        key += '|';
+        for (size_t d : t->shape()) { key += std::to_string(d); key += ','; }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = cache.find(key);
+        if (it != cache.end()) return it->second;
+    }
+    auto plan = buildPlan(subscripts, ops);
+    std::lock_guard<std::mutex> lock(mtx);
+    if (cache.size() >= kPlanCacheCapacity) cache.clear();
+    cache.emplace(std::move(key), plan);
+    return plan;
+}
+
+// Host Float64 view of t; `holder` keeps any converted copy alive.
+Operand load(const Tensor& t, Tensor& holder, const std::string& labels) {
+    holder = t.device() == Device::CPU ? t : t.cpu();
+    if (holder.dtype() != TensorDType::Float64)
+        holder = holder.astype(TensorDType::Float64);
+    Operand x;
+    x.p = std::as_const(holder).data().data();   // no detach of shared storage
+    x.shape = holder.shape();
+    x.labels = labels;
+    return x;
+}
+
+Tensor toTensor(Operand x) {
+    Tensor::Shape shape = x.shape;
+    if (shape.empty()) shape.push_back(1);
+    if (x.own.empty() || x.own.data() != x.p)
+        x.own.assign(x.p, x.p + x.size());
+    return Tensor(std::move(shape), std::move(x.own));
+}
+
+Tensor runEinsum(const std::string& subscripts, const std::vector<const Tensor*>& ops) {
+    auto plan = cachedPlan(subscripts, ops);
+
+    std::vector<Tensor> holders(ops.size());
+    std::vector<Operand> work;
+    work.reserve(ops.size());
+    for (size_t k = 0; k < ops.size(); ++k) {
+        std::string keep = plan->output;
+        for (size_t o = 0; o < ops.size(); ++o)
+            if (o != k) keep += plan->inputs[o];
+        work.push_back(sumOut(takeDiagonal(load(*ops[k], holders[k], plan->inputs[k])), keep));
+    }
+
+    for (auto [i, j] : plan->path) {
+        Operand a = std::move(work[i]), b = std::move(work[j]);
+        work.erase(work.begin() + j);
+        work.erase(work.begin() + i);
+        std::string keep = plan->output;
+        for (const Operand& o : work) keep += o.labels;
+        work.push_back(contractPair(std::move(a), std::move(b), keep));
+    }
+    return toTensor(arrange(sumOut(std::move(work[0]), plan->output), plan->output));
+}
+
+} // namespace
+
+// ─── tensordot ────────────────────────────────────────────────────────────────
+
+Tensor tensordot(const Tensor& a, const Tensor& b,
+                 const std::vector<size_t>& axes_a,
+                 const std::vector<size_t>& axes_b)
+{
+    if (axes_a.size() != axes_b.size())
+        throw std::invalid_argument("tensordot: axes vectors must have the same length");
+
+    for (size_t i = 0; i < axes_a.size(); ++i)
+        if (a.dim(axes_a[i]) != b.dim(axes_b[i]))
+            throw std::invalid_argument("tensordot: contracted dimensions must match");
+
+    // Label the axes directly: contracted pairs share a label, everything
+    // else gets its own, and nothing is kept beyond the free axes.
+    if (a.ndim() + b.ndim() > 256)
+        throw std::invalid_argument("tensordot: too many axes");
+    std::string la(a.ndim(), '\0'), lb(b.ndim(), '\0');
+    unsigned char next = 0;
+    for (size_t i = 0; i < axes_a.size(); ++i) {
+        if (la[axes_a[i]] != '\0' || lb[axes_b[i]] != '\0')
+            throw std::invalid_argument("tensordot: repeated axis");
+        la[axes_a[i]] = lb[axes_b[i]] = static_cast<char>(++next);
+    }
+    std::string out;
+    for (char& c : la) if (c == '\0') { c = static_cast<char>(++next); out += c; }
+    for (char& c : lb) if (c == '\0') { c = static_cast<char>(++next); out += c; }
+
+    Tensor ha, hb;
+    Operand r = contractPair(load(a, ha, la), load(b, hb, lb), out);
+    return toTensor(std::move(r));
+}
+
+// ─── einsum ──────────────────────────────────────────────────────────────────
+
+Tensor einsum(const std::string& subscripts, const Tensor& a) {
+    return runEinsum(subscripts, {&a});
+}
+
+Tensor einsum(const std::string& subscripts, const Tensor& a, const Tensor& b) {
+    return runEinsum(subscripts, {&a, &b});
+}
+
+Tensor einsum(const std::string& subscripts, const std::vector<Tensor>& operands) {
+    std::vector<const Tensor*> ops;
+    for (const Tensor& t : operands) ops.push_back(&t);
+    return runEinsum(subscripts, ops);
+}
+
+} // namespace SharedMath::LinearAlgebra
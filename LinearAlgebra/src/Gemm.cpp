@@ -0,0 +1,649 @@
+// Gemm.cpp — cache-blocked, register-tiled GEMM (double and float), plus the
+// blocked TRSM built on top of it (end of file).
+//
+// Classic Goto/BLIS structure on row-major storage:
+//
+//   for jc in N step NC            ── B panel fits in L3
+//     for pc in K step KC          ── pack op(B)[pc:pc+KC, jc:jc+NC] → Bp
+//       for ic in M step MC        ── pack alpha*op(A)[ic:ic+MC, pc:pc+KC] → Ap (L2)
+//         for jr in NC step NR     ── Bp micro-panel stays in L1
+//           for ir in MC step MR   ── MR×NR register tile
+//             micro-kernel(KC)
+//
+// Packing absorbs both transpose flags and alpha, so the micro-kernels only
+// ever see unit-stride MR- and NR-wide panels.  Partial edge tiles are
+// zero-padded in the packed buffers and computed into a scratch tile.
+//
+// The row blocks of C (ic loop) run on the shared Core::ThreadPool; each
+// thread packs its own A block into a thread-local buffer.
+//
+// The micro-kernel is selected at runtime: AVX-512 (8×24 double, 8×48 float),
+// AVX2+FMA (6×8 double, 6×16 float) or a portable scalar 4×4 tile.  The SIMD
+// kernels are compiled with function target attributes so the library itself
+// needs no global -mavx flags.  Everything above the micro-kernel is a
+// template over the element type.
+
+#include "LinearAlgebra/Gemm.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SM_GEMM_X86 1
+#  define SM_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#  define SM_TARGET_AVX512 __attribute__((target("avx512f")))
+#  include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define SM_GEMM_X86 1
+#  define SM_TARGET_AVX2
+#  define SM_TARGET_AVX512
+#  include <immintrin.h>
+#endif
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+template<typename T>
+using MicroKernel = void (*)(size_t kc, const T* a, const T* b,
+                             T* c, size_t ldc);
+
+/// Register tile and cache-block sizes for one micro-kernel.
+template<typename T>
+struct KernelConfig {
+    size_t         MR, NR;      // register tile
+    size_t         MC, KC, NC;  // cache blocks (MC % MR == 0, NC % NR == 0)
+    MicroKernel<T> kernel;
+};
+
+constexpr size_t kMaxTile = 8 * 48;   // largest MR×NR across kernels
+
+// ─── Micro-kernels ───────────────────────────────────────────────────────────
+// Contract: a is an MR×kc packed panel (MR values per k), b is a kc×NR packed
+// panel (NR values per k).  The kernel accumulates the product into c:
+//   c[i*ldc + j] += Σ_p a[p*MR + i] * b[p*NR + j]
+
+template<typename T>
+void kernelScalar4x4(size_t kc, const T* a, const T* b, T* c, size_t ldc) {
+    T acc[4][4] = {};
+    for (size_t p = 0; p < kc; ++p) {
+        for (size_t i = 0; i < 4; ++i) {
+            const T ai = a[i];
+            for (size_t j = 0; j < 4; ++j)
+                acc[i][j] += ai * b[j];
+        }
+        a += 4;
+        b += 4;
+    }
+    for (size_t i = 0; i < 4; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            c[i * ldc + j] += acc[i][j];
+}
+
+#ifdef SM_GEMM_X86
+
+SM_TARGET_AVX2
+void kernelAvx2_6x8(size_t kc, const double* a, const double* b,
+                    double* c, size_t ldc) {
+#define SM_AVX2_DECL(i) \
+    __m256d c##i##0 = _mm256_setzero_pd(), c##i##1 = _mm256_setzero_pd();
+#define SM_AVX2_FMA(i) {                                  \
+        const __m256d ai = _mm256_broadcast_sd(a + i);    \
+        c##i##0 = _mm256_fmadd_pd(ai, b0, c##i##0);       \
+        c##i##1 = _mm256_fmadd_pd(ai, b1, c##i##1);       \
+    }
+#define SM_AVX2_STORE(i) {                                                  \
+        double* ci = c + i * ldc;                                           \
+        _mm256_storeu_pd(ci,     _mm256_add_pd(_mm256_loadu_pd(ci),     c##i##0)); \
+        _mm256_storeu_pd(ci + 4, _mm256_add_pd(_mm256_loadu_pd(ci + 4), c##i##1)); \
+    }
+    SM_AVX2_DECL(0) SM_AVX2_DECL(1) SM_AVX2_DECL(2)
+    SM_AVX2_DECL(3) SM_AVX2_DECL(4) SM_AVX2_DECL(5)
+    for (size_t p = 0; p < kc; ++p) {
+        const __m256d b0 = _mm256_loadu_pd(b);
+        const __m256d b1 = _mm256_loadu_pd(b + 4);
+        SM_AVX2_FMA(0) SM_AVX2_FMA(1) SM_AVX2_FMA(2)
+        SM_AVX2_FMA(3) SM_AVX2_FMA(4) SM_AVX2_FMA(5)
+        a += 6;
+        b += 8;
+    }
+    SM_AVX2_STORE(0) SM_AVX2_STORE(1) SM_AVX2_STORE(2)
+    SM_AVX2_STORE(3) SM_AVX2_STORE(4) SM_AVX2_STORE(5)
+#undef SM_AVX2_DECL
+#undef SM_AVX2_FMA
+#undef SM_AVX2_STORE
+}
+
+SM_TARGET_AVX512
+void kernelAvx512_8x24(size_t kc, const double* a, const double* b,
+                       double* c, size_t ldc) {
+#define SM_AVX512_DECL(i)                                                   \
+    __m512d c##i##0 = _mm512_setzero_pd(), c##i##1 = _mm512_setzero_pd(),   \
+            c##i##2 = _mm512_setzero_pd();
+#define SM_AVX512_FMA(i) {                                \
+        const __m512d ai = _mm512_set1_pd(a[i]);          \
+        c##i##0 = _mm512_fmadd_pd(ai, b0, c##i##0);       \
+        c##i##1 = _mm512_fmadd_pd(ai, b1, c##i##1);       \
+        c##i##2 = _mm512_fmadd_pd(ai, b2, c##i##2);       \
+    }
+#define SM_AVX512_STORE(i) {                                                     \
+        double* ci = c + i * ldc;                                                \
+        _mm512_storeu_pd(ci,      _mm512_add_pd(_mm512_loadu_pd(ci),      c##i##0)); \
+        _mm512_storeu_pd(ci + 8,  _mm512_add_pd(_mm512_loadu_pd(ci + 8),  c##i##1)); \
+        _mm512_storeu_pd(ci + 16, _mm512_add_pd(_mm512_loadu_pd(ci + 16), c##i##2)); \
+    }
+    SM_AVX512_DECL(0) SM_AVX512_DECL(1) SM_AVX512_DECL(2) SM_AVX512_DECL(3)
+    SM_AVX512_DECL(4) SM_AVX512_DECL(5) SM_AVX512_DECL(6) SM_AVX512_DECL(7)
+    for (size_t p = 0; p < kc; ++p) {
+        const __m512d b0 = _mm512_loadu_pd(b);
+        const __m512d b1 = _mm512_loadu_pd(b + 8);
+        const __m512d b2 = _mm512_loadu_pd(b + 16);
+        SM_AVX512_FMA(0) SM_AVX512_FMA(1) SM_AVX512_FMA(2) SM_AVX512_FMA(3)
+        SM_AVX512_FMA(4) SM_AVX512_FMA(5) SM_AVX512_FMA(6) SM_AVX512_FMA(7)
+        a += 8;
+        b += 24;
+    }
+    SM_AVX512_STORE(0) SM_AVX512_STORE(1) SM_AVX512_STORE(2) SM_AVX512_STORE(3)
+    SM_AVX512_STORE(4) SM_AVX512_STORE(5) SM_AVX512_STORE(6) SM_AVX512_STORE(7)
+#undef SM_AVX512_DECL
+#undef SM_AVX512_FMA
+#undef SM_AVX512_STORE
+}
+
+SM_TARGET_AVX2
+void kernelAvx2_6x16f(size_t kc, const float* a, const float* b,
+                      float* c, size_t ldc) {
+#define SM_AVX2_DECL(i) \
+    __m256 c##i##0 = _mm256_setzero_ps(), c##i##1 = _mm256_setzero_ps();
+#define SM_AVX2_FMA(i) {                                  \
+        const __m256 ai = _mm256_broadcast_ss(a + i);     \
+        c##i##0 = _mm256_fmadd_ps(ai, b0, c##i##0);       \
+        c##i##1 = _mm256_fmadd_ps(ai, b1, c##i##1);       \
+    }
+#define SM_AVX2_STORE(i) {                                                  \
+        float* ci = c + i * ldc;                                            \
+        _mm256_storeu_ps(ci,     _mm256_add_ps(_mm256_loadu_ps(ci),     c##i##0)); \
+        _mm256_storeu_ps(ci + 8, _mm256_add_ps(_mm256_loadu_ps(ci + 8), c##i##1)); \
+    }
+    SM_AVX2_DECL(0) SM_AVX2_DECL(1) SM_AVX2_DECL(2)
+    SM_AVX2_DECL(3) SM_AVX2_DECL(4) SM_AVX2_DECL(5)
+    for (size_t p = 0; p < kc; ++p) {
+        const __m256 b0 = _mm256_loadu_ps(b);
+        const __m256 b1 = _mm256_loadu_ps(b + 8);
+        SM_AVX2_FMA(0) SM_AVX2_FMA(1) SM_AVX2_FMA(2)
+        SM_AVX2_FMA(3) SM_AVX2_FMA(4) SM_AVX2_FMA(5)
+        a += 6;
+        b += 16;
+    }
+    SM_AVX2_STORE(0) SM_AVX2_STORE(1) SM_AVX2_STORE(2)
+    SM_AVX2_STORE(3) SM_AVX2_STORE(4) SM_AVX2_STORE(5)
+#undef SM_AVX2_DECL
+#undef SM_AVX2_FMA
+#undef SM_AVX2_STORE
+}
+
+SM_TARGET_AVX512
+void kernelAvx512_8x48f(size_t kc, const float* a, const float* b,
+                        float* c, size_t ldc) {
+#define SM_AVX512_DECL(i)                                                   \
+    __m512 c##i##0 = _mm512_setzero_ps(), c##i##1 = _mm512_setzero_ps(),    \
+           c##i##2 = _mm512_setzero_ps();
+#define SM_AVX512_FMA(i) {                                \
+        const __m512 ai = _mm512_set1_ps(a[i]);           \
+        c##i##0 = _mm512_fmadd_ps(ai, b0, c##i##0);       \
+        c##i##1 = _mm512_fmadd_ps(ai, b1, c##i##1);       \
+        c##i##2 = _mm512_fmadd_ps(ai, b2, c##i##2);       \
+    }
+#define SM_AVX512_STORE(i) {                                                     \
+        float* ci = c + i * ldc;                                                 \
+        _mm512_storeu_ps(ci,      _mm512_add_ps(_mm512_loadu_ps(ci),      c##i##0)); \
+        _mm512_storeu_ps(ci + 16, _mm512_add_ps(_mm512_loadu_ps(ci + 16), c##i##1)); \
+        _mm512_storeu_ps(ci + 32, _mm512_add_ps(_mm512_loadu_ps(ci + 32), c##i##2)); \
+    }
+    SM_AVX512_DECL(0) SM_AVX512_DECL(1) SM_AVX512_DECL(2) SM_AVX512_DECL(3)
+    SM_AVX512_DECL(4) SM_AVX512_DECL(5) SM_AVX512_DECL(6) SM_AVX512_DECL(7)
+    for (size_t p = 0; p < kc; ++p) {
+        const __m512 b0 = _mm512_loadu_ps(b);
+        const __m512 b1 = _mm512_loadu_ps(b + 16);
+        const __m512 b2 = _mm512_loadu_ps(b + 32);
+        SM_AVX512_FMA(0) SM_AVX512_FMA(1) SM_AVX512_FMA(2) SM_AVX512_FMA(3)
+        SM_AVX512_FMA(4) SM_AVX512_FMA(5) SM_AVX512_FMA(6) SM_AVX512_FMA(7)
+        a += 8;
+        b += 48;
+    }
+    SM_AVX512_STORE(0) SM_AVX512_STORE(1) SM_AVX512_STORE(2) SM_AVX512_STORE(3)
+    SM_AVX512_STORE(4) SM_AVX512_STORE(5) SM_AVX512_STORE(6) SM_AVX512_STORE(7)
+#undef SM_AVX512_DECL
+#undef SM_AVX512_FMA
+#undef SM_AVX512_STORE
+}
+
+#endif // SM_GEMM_X86
+
+template<typename T>
+const KernelConfig<T>& configFor(SimdLevel level);
+
+template<>
+const KernelConfig<double>& configFor<double>(SimdLevel level) {
+    static const KernelConfig<double> scalar{4, 4, 128, 256, 2048, &kernelScalar4x4<double>};
+#ifdef SM_GEMM_X86
+    static const KernelConfig<double> avx2  {6, 8,  96, 256, 4096, &kernelAvx2_6x8};
+    static const KernelConfig<double> avx512{8, 24, 128, 384, 3072, &kernelAvx512_8x24};
+    switch (level) {
+        case SimdLevel::AVX512: return avx512;
+        case SimdLevel::AVX2:   return avx2;
+        default:                break;
+    }
+#else
+    (void)level;
+#endif
+    return scalar;
+}
+
+template<>
+const KernelConfig<float>& configFor<float>(SimdLevel level) {
+    static const KernelConfig<float> scalar{4, 4, 128, 256, 2048, &kernelScalar4x4<float>};
+#ifdef SM_GEMM_X86
+    static const KernelConfig<float> avx2  {6, 16,  96, 256, 4096, &kernelAvx2_6x16f};
+    static const KernelConfig<float> avx512{8, 48, 128, 384, 3072, &kernelAvx512_8x48f};
+    switch (level) {
+        case SimdLevel::AVX512: return avx512;
+        case SimdLevel::AVX2:   return avx2;
+        default:                break;
+    }
+#else
+    (void)level;
+#endif
+    return scalar;
+}
+
+// ─── Kernel selection ────────────────────────────────────────────────────────
+// The host's capabilities come from Core; SHAREDMATH_GEMM_SIMD and
+// setGemmSimdLevel() choose among them for GEMM alone.
+
+SimdLevel maxSimdLevel() noexcept { return Core::hostSimdLevel(); }
+
+SimdLevel clampSimdLevel(SimdLevel level) noexcept {
+    return static_cast<int>(level) > static_cast<int>(maxSimdLevel())
+        ? maxSimdLevel() : level;
+}
+
+SimdLevel initialSimdLevel() noexcept {
+    SimdLevel level = Core::simdLevel();
+    if (const char* env = std::getenv("SHAREDMATH_GEMM_SIMD")) {
+        const std::string name(env);
+        if      (name == "scalar") level = SimdLevel::Scalar;
+        else if (name == "avx2")   level = SimdLevel::AVX2;
+        else if (name == "avx512") level = SimdLevel::AVX512;
+    }
+    return clampSimdLevel(level);
+}
+
+std::atomic<SimdLevel>& activeSimdLevel() noexcept {
+    static std::atomic<SimdLevel> level{initialSimdLevel()};
+    return level;
+}
+
+// ─── Packing buffers ─────────────────────────────────────────────────────────
+// Thread-local, 64-byte aligned, grown on demand and reused across calls.
+
+template<typename T>
+class PackBuffer {
+public:
+    T* reserve(size_t n) {
+        if (n > capacity_) {
+            data_.reset(static_cast<T*>(
+                ::operator new(n * sizeof(T), std::align_val_t{64})));
+            capacity_ = n;
+        }
+        return data_.get();
+    }
+
+private:
+    struct Deleter {
+        void operator()(T* p) const noexcept {
+            ::operator delete(p, std::align_val_t{64});
+        }
+    };
+    std::unique_ptr<T, Deleter> data_;
+    size_t capacity_ = 0;
+};
+
+/// Pack alpha * op(A)[i0:i0+mc, p0:p0+kc] into MR-row micro-panels.
+template<typename T>
+void packA(const T* A, size_t lda, bool trans,
+           size_t i0, size_t p0, size_t mc, size_t kc,
+           size_t MR, T alpha, T* out) {
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        const size_t mr = std::min(MR, mc - ir);
+        T* panel = out + ir * kc;
+        if (!trans) {
+            for (size_t i = 0; i < mr; ++i) {
+                const T* src = A + (i0 + ir + i) * lda + p0;
+                for (size_t p = 0; p < kc; ++p)
+                    panel[p * MR + i] = alpha * src[p];
+            }
+        } else {
+            for (size_t p = 0; p < kc; ++p) {
+                const T* src = A + (p0 + p) * lda + i0 + ir;
+                for (size_t i = 0; i < mr; ++i)
+                    panel[p * MR + i] = alpha * src[i];
+            }
+        }
+        for (size_t i = mr; i < MR; ++i)
+            for (size_t p = 0; p < kc; ++p)
+                panel[p * MR + i] = T(0);
+    }
+}
+
+/// Pack op(B)[p0:p0+kc, j0:j0+nc] into NR-column micro-panels.
+template<typename T>
+void packB(const T* B, size_t ldb, bool trans,
+           size_t p0, size_t j0, size_t kc, size_t nc,
+           size_t NR, T* out) {
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        const size_t nr = std::min(NR, nc - jr);
+        T* panel = out + jr * kc;
+        if (!trans) {
+            for (size_t p = 0; p < kc; ++p) {
+                const T* src = B + (p0 + p) * ldb + j0 + jr;
+                T* dst = panel + p * NR;
+                for (size_t j = 0; j < nr; ++j) dst[j] = src[j];
+                for (size_t j = nr; j < NR; ++j) dst[j] = T(0);
+            }
+        } else {
+            for (size_t j = 0; j < nr; ++j) {
+                const T* src = B + (j0 + jr + j) * ldb + p0;
+                for (size_t p = 0; p < kc; ++p)
+                    panel[p * NR + j] = src[p];
+            }
+            for (size_t j = nr; j < NR; ++j)
+                for (size_t p = 0; p < kc; ++p)
+                    panel[p * NR + j] = T(0);
+        }
+    }
+}
+
+/// Multiply a packed mc×kc A block by a packed kc×nc B block into C.
+template<typename T>
+void macroKernel(const KernelConfig<T>& cfg, size_t mc, size_t nc, size_t kc,
+                 const T* Ap, const T* Bp, T* C, size_t ldc) {
+    const size_t MR = cfg.MR, NR = cfg.NR;
+    alignas(64) T tile[kMaxTile];
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        const size_t nr = std::min(NR, nc - jr);
+        const T* b = Bp + jr * kc;
+        for (size_t ir = 0; ir < mc; ir += MR) {
+            const size_t mr = std::min(MR, mc - ir);
+            const T* a = Ap + ir * kc;
+            T* c = C + ir * ldc + jr;
+            if (mr == MR && nr == NR) {
+                cfg.kernel(kc, a, b, c, ldc);
+            } else {
+                std::fill(tile, tile + MR * NR, T(0));
+                cfg.kernel(kc, a, b, tile, NR);
+                for (size_t i = 0; i < mr; ++i)
+                    for (size_t j = 0; j < nr; ++j)
+                        c[i * ldc + j] += tile[i * NR + j];
+            }
+        }
+    }
+}
+
+/// Straight loops for products too small to amortise packing.
+template<typename T>
+void gemmSmall(bool transA, bool transB, size_t M, size_t N, size_t K,
+               T alpha, const T* A, size_t lda,
+               const T* B, size_t ldb, T* C, size_t ldc) {
+    for (size_t i = 0; i < M; ++i) {
+        T* Ci = C + i * ldc;
+        for (size_t p = 0; p < K; ++p) {
+            const T a = alpha * (transA ? A[p * lda + i] : A[i * lda + p]);
+            if (!transB) {
+                const T* Bp = B + p * ldb;
+                for (size_t j = 0; j < N; ++j) Ci[j] += a * Bp[j];
+            } else {
+                for (size_t j = 0; j < N; ++j) Ci[j] += a * B[j * ldb + p];
+            }
+        }
+    }
+}
+
+/// Shared driver behind both public gemm() overloads.
+template<typename T>
+void gemmImpl(Transpose transA, Transpose transB,
+              size_t M, size_t N, size_t K,
+              T alpha, const T* A, size_t lda,
+              const T* B, size_t ldb,
+              T beta, T* C, size_t ldc)
+{
+    if (M == 0 || N == 0) return;
+
+    // C ← beta * C up front; every later stage only accumulates.
+    if (beta == T(0)) {
+        for (size_t i = 0; i < M; ++i)
+            std::fill(C + i * ldc, C + i * ldc + N, T(0));
+    } else if (beta != T(1)) {
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                C[i * ldc + j] *= beta;
+    }
+    if (K == 0 || alpha == T(0)) return;
+
+    const bool tA = transA == Transpose::Yes;
+    const bool tB = transB == Transpose::Yes;
+
+    if (M * N * K <= 32 * 32 * 32) {
+        gemmSmall(tA, tB, M, N, K, alpha, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    const KernelConfig<T>& cfg = configFor<T>(gemmSimdLevel());
+
+    // Row blocks of C are independent and share the packed B panel, so they
+    // are spread over the thread pool.  When there are fewer MC blocks than
+    // threads, MC is shrunk (to a multiple of MR) so every thread gets work.
+    const size_t threads = Core::ThreadPool::numThreads();
+    size_t mcBlock = cfg.MC;
+    if ((M + cfg.MC - 1) / cfg.MC < threads) {
+        const size_t rows = (M + threads - 1) / threads;
+        mcBlock = std::min(cfg.MC, (rows + cfg.MR - 1) / cfg.MR * cfg.MR);
+    }
+    const size_t mBlocks = (M + mcBlock - 1) / mcBlock;
+
+    thread_local PackBuffer<T> bufB;
+    T* Bp = bufB.reserve(cfg.KC * cfg.NC);
+
+    for (size_t jc = 0; jc < N; jc += cfg.NC) {
+        const size_t nc = std::min(cfg.NC, N - jc);
+        const size_t panels = (nc + cfg.NR - 1) / cfg.NR;
+        for (size_t pc = 0; pc < K; pc += cfg.KC) {
+            const size_t kc = std::min(cfg.KC, K - pc);
+            Core::parallel_for(0, panels, 8, [&](size_t lo, size_t hi) {
+                const size_t j0 = lo * cfg.NR;
+                const size_t j1 = std::min(nc, hi * cfg.NR);
+                packB(B, ldb, tB, pc, jc + j0, kc, j1 - j0, cfg.NR, Bp + j0 * kc);
+            });
+            Core::parallel_for(0, mBlocks, 1, [&](size_t lo, size_t hi) {
+                thread_local PackBuffer<T> bufA;
+                T* Ap = bufA.reserve(cfg.MC * cfg.KC);
+                for (size_t blk = lo; blk < hi; ++blk) {
+                    const size_t ic = blk * mcBlock;
+                    const size_t mc = std::min(mcBlock, M - ic);
+                    packA(A, lda, tA, ic, pc, mc, kc, cfg.MR, alpha, Ap);
+                    macroKernel(cfg, mc, nc, kc, Ap, Bp, C + ic * ldc + jc, ldc);
+                }
+            });
+        }
+    }
+}
+
+} // namespace
+
+// ─── Public API ──────────────────────────────────────────────────────────────
+
+SimdLevel gemmSimdLevel() noexcept    { return activeSimdLevel().load(std::memory_order_relaxed); }
+SimdLevel gemmMaxSimdLevel() noexcept { return maxSimdLevel(); }
+
+SimdLevel setGemmSimdLevel(SimdLevel level) noexcept {
+    level = clampSimdLevel(level);
+    activeSimdLevel().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+void gemm(Transpose transA, Transpose transB,
+          size_t M, size_t N, size_t K,
+          double alpha,
+          const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta,
+          double* C, size_t ldc)
+{
+    gemmImpl(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void gemm(Transpose transA, Transpose transB,
+          size_t M, size_t N, size_t K,
+          float alpha,
+          const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta,
+          float* C, size_t ldc)
+{
+    gemmImpl(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// ─── TRSM ─────────────────────────────────────────────────────────────────────
+// Blocked over kTrsmBlock-wide diagonal blocks.  A transposed triangle is
+// handled by flipping its effective orientation: op(A) is lower exactly when
+// (uplo == Lower) != transA.  Off-diagonal blocks of op(A) are handed to
+// gemm() with the same transpose flag.
+
+namespace {
+
+constexpr size_t kTrsmBlock = 96;
+
+struct TriangularOperand {
+    const double* A;
+    size_t        lda;
+    bool          trans;
+
+    double at(size_t i, size_t j) const { return trans ? A[j * lda + i] : A[i * lda + j]; }
+
+    // op(A)[r0.., c0..] as a (pointer, flag) pair for gemm()
+    const double* block(size_t r0, size_t c0) const {
+        return trans ? A + c0 * lda + r0 : A + r0 * lda + c0;
+    }
+    Transpose flag() const { return trans ? Transpose::Yes : Transpose::No; }
+};
+
+// Left side, op(A) lower: rows r0..r1 of X, forward order.  Every column of
+// B is independent, so column ranges run in parallel.
+void trsmLeftDiag(const TriangularOperand& a, bool lower, bool unit,
+                  size_t r0, size_t r1, size_t N, double* B, size_t ldb)
+{
+    Core::parallel_for(0, N, 256, [&](size_t lo, size_t hi) {
+        const size_t nb = r1 - r0;
+        for (size_t t = 0; t < nb; ++t) {
+            const size_t i = lower ? r0 + t : r1 - 1 - t;
+            double* Bi = B + i * ldb;
+            if (lower) {
+                for (size_t j = r0; j < i; ++j) {
+                    const double l = a.at(i, j);
+                    if (l == 0.0) continue;
+                    const double* Bj = B + j * ldb;
+                    for (size_t c = lo; c < hi; ++c) Bi[c] -= l * Bj[c];
+                }
+            } else {
+                for (size_t j = i + 1; j < r1; ++j) {
+                    const double u = a.at(i, j);
+                    if (u == 0.0) continue;
+                    const double* Bj = B + j * ldb;
+                    for (size_t c = lo; c < hi; ++c) Bi[c] -= u * Bj[c];
+                }
+            }
+            if (!unit) {
+                const double inv = 1.0 / a.at(i, i);
+                for (size_t c = lo; c < hi; ++c) Bi[c] *= inv;
+            }
+        }
+    });
+}
+
+// Right side: columns c0..c1 of X.  Rows of B are independent.
+void trsmRightDiag(const TriangularOperand& a, bool lower, bool unit,
+                   size_t c0, size_t c1, size_t M, double* B, size_t ldb)
+{
+    Core::parallel_for(0, M, 64, [&](size_t lo, size_t hi) {
+        const size_t nb = c1 - c0;
+        for (size_t r = lo; r < hi; ++r) {
+            double* Br = B + r * ldb;
+            for (size_t t = 0; t < nb; ++t) {
+                // X·U = B runs left to right, X·L = B right to left.
+                const size_t j = lower ? c1 - 1 - t : c0 + t;
+                double s = Br[j];
+                if (lower) for (size_t i = j + 1; i < c1; ++i) s -= Br[i] * a.at(i, j);
+                else       for (size_t i = c0;    i < j;  ++i) s -= Br[i] * a.at(i, j);
+                Br[j] = unit ? s : s / a.at(j, j);
+            }
+        }
+    });
+}
+
+} // namespace
+
+void trsm(Side side, Triangle uplo, Transpose transA, Diagonal diag,
+          size_t M, size_t N,
+          double alpha,
+          const double* A, size_t lda,
+          double* B, size_t ldb)
+{
+    if (M == 0 || N == 0) return;
+    if (alpha != 1.0)
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j) B[i * ldb + j] *= alpha;
+
+    const TriangularOperand a{A, lda, transA == Transpose::Yes};
+    const bool lower = (uplo == Triangle::Lower) != a.trans;
+    const bool unit  = diag == Diagonal::Unit;
+    const size_t nb  = kTrsmBlock;
+
+    if (side == Side::Left) {
+        const size_t blocks = (M + nb - 1) / nb;
+        for (size_t t = 0; t < blocks; ++t) {
+            // forward for lower, backward for upper
+            const size_t k  = lower ? t : blocks - 1 - t;
+            const size_t k0 = k * nb, k1 = std::min(M, k0 + nb);
+            trsmLeftDiag(a, lower, unit, k0, k1, N, B, ldb);
+            if (lower && k1 < M)
+                gemm(a.flag(), Transpose::No, M - k1, N, k1 - k0, -1.0,
+                     a.block(k1, k0), lda, B + k0 * ldb, ldb, 1.0, B + k1 * ldb, ldb);
+            else if (!lower && k0 > 0)
+                gemm(a.flag(), Transpose::No, k0, N, k1 - k0, -1.0,
+                     a.block(0, k0), lda, B + k0 * ldb, ldb, 1.0, B, ldb);
+        }
+    } else {
+        const size_t blocks = (N + nb - 1) / nb;
+        for (size_t t = 0; t < blocks; ++t) {
+            // X·U: forward over column blocks; X·L: backward
+            const size_t k  = lower ? blocks - 1 - t : t;
+            const size_t k0 = k * nb, k1 = std::min(N, k0 + nb);
+            trsmRightDiag(a, lower, unit, k0, k1, M, B, ldb);
+            if (!lower && k1 < N)
+                gemm(Transpose::No, a.flag(), M, N - k1, k1 - k0, -1.0,
+                     B + k0, ldb, a.block(k0, k1), lda, 1.0, B + k1, ldb);
+            else if (lower && k0 > 0)
+                gemm(Transpose::No, a.flag(), M, k0, k1 - k0, -1.0,
+                     B + k0, ldb, a.block(k0, 0), lda, 1.0, B, ldb);
+        }
+    }
+}
+
+} // namespace SharedMath::LinearAlgebra
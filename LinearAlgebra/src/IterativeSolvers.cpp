@@ -1,29 +1,15 @@
 #include "IterativeSolvers.h"
-#include "DynamicMatrix.h"
-#include "MatrixFunctions.h"   // for toDynamic / transposeMatrix (via friend / free functions)
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace SharedMath::LinearAlgebra {
 
 // ─── helpers local to this TU ─────────────────────────────────────────────────
 
-static DynamicMatrix toDyn(const AbstractMatrix& A) {
-    if (const auto* d = dynamic_cast<const DynamicMatrix*>(&A)) return *d;
-    return DynamicMatrix(A);
-}
-
-// y = A * x  (dense)
-static std::vector<double> matvec(const DynamicMatrix& A, const std::vector<double>& x) {
-    size_t m = A.rows(), n = A.cols();
-    std::vector<double> y(m, 0.0);
-    for (size_t i = 0; i < m; ++i)
-        for (size_t j = 0; j < n; ++j)
-            y[i] += A.get(i, j) * x[j];
-    return y;
-}
-
 static double dot(const std::vector<double>& a, const std::vector<double>& b) {
     double s = 0.0;
     for (size_t i = 0; i < a.size(); ++i) s += a[i] * b[i];
@@ -32,52 +18,174 @@ static double dot(const std::vector<double>& a, const std::vector<double>& b) {
 
 static double nrm2(const std::vector<double>& v) { return std::sqrt(dot(v, v)); }
 
-// ─── Conjugate Gradient ───────────────────────────────────────────────────────
+// Package a solve; the reported residual is the true ||b − A·x||₂, which
+// costs one extra product.
+static KrylovResult report(const LinearOperator& A, const std::vector<double>& b,
+                           std::vector<double> x, size_t iterations, bool converged) {
+    std::vector<double> Ax(A.rows());
+    A.apply(x, Ax);
+    double s = 0.0;
+    for (size_t i = 0; i < b.size(); ++i) s += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+    return {std::move(x), iterations, std::sqrt(s), converged};
+}
+
+static void checkSquare(const LinearOperator& A, const std::vector<double>& b,
+                        const Preconditioner& M, const char* who) {
+    if (A.rows() != A.cols())
+        throw std::invalid_argument(std::string(who) + ": A must be square");
+    if (A.rows() != b.size())
+        throw std::invalid_argument(std::string(who) + ": A dimensions incompatible with b");
+    if (M.size() != b.size())
+        throw std::invalid_argument(std::string(who) + ": preconditioner size does not match A");
+}
+
+// ─── Unpreconditioned overloads ───────────────────────────────────────────────
+// M = I; the AbstractMatrix forms wrap A in the cheapest LinearOperator for
+// its concrete type, never copying it.
 
-std::vector<double> cg(const AbstractMatrix& A,
-                        const std::vector<double>& b,
-                        std::vector<double> x0,
-                        double tol,
-                        size_t max_iter)
+std::vector<double> cg(const LinearOperator& A, const std::vector<double>& b,
+                        std::vector<double> x0, double tol, size_t max_iter)
+{
+    return cg(A, b, IdentityPreconditioner(b.size()), std::move(x0), tol, max_iter).x;
+}
+
+std::vector<double> cg(const AbstractMatrix& A, const std::vector<double>& b,
+                        std::vector<double> x0, double tol, size_t max_iter)
+{
+    return cg(*makeOperator(A), b, std::move(x0), tol, max_iter);
+}
+
+KrylovResult cg(const AbstractMatrix& A, const std::vector<double>& b,
+                const Preconditioner& M, std::vector<double> x0,
+                double tol, size_t max_iter)
+{
+    return cg(*makeOperator(A), b, M, std::move(x0), tol, max_iter);
+}
+
+std::vector<double> lsqr(const AbstractMatrix& A, const std::vector<double>& b,
+                          double tol, size_t max_iter)
+{
+    return lsqr(*makeOperator(A), b, tol, max_iter);
+}
+
+std::vector<double> gmres(const LinearOperator& A, const std::vector<double>& b,
+                           std::vector<double> x0, double tol, size_t max_iter,
+                           size_t restart)
+{
+    return gmres(A, b, IdentityPreconditioner(b.size()), std::move(x0), tol,
+                 max_iter, restart).x;
+}
+
+std::vector<double> gmres(const AbstractMatrix& A, const std::vector<double>& b,
+                           std::vector<double> x0, double tol, size_t max_iter,
+                           size_t restart)
+{
+    return gmres(*makeOperator(A), b, std::move(x0), tol, max_iter, restart);
+}
+
+KrylovResult gmres(const AbstractMatrix& A, const std::vector<double>& b,
+                   const Preconditioner& M, std::vector<double> x0,
+                   double tol, size_t max_iter, size_t restart)
+{
+    return gmres(*makeOperator(A), b, M, std::move(x0), tol, max_iter, restart);
+}
+
+std::vector<double> bicgstab(const LinearOperator& A, const std::vector<double>& b,
+                              std::vector<double> x0, double tol, size_t max_iter)
+{
+    return bicgstab(A, b, IdentityPreconditioner(b.size()), std::move(x0), tol, max_iter).x;
+}
+
+std::vector<double> bicgstab(const AbstractMatrix& A, const std::vector<double>& b,
+                              std::vector<double> x0, double tol, size_t max_iter)
+{
+    return bicgstab(*makeOperator(A), b, std::move(x0), tol, max_iter);
+}
+
+KrylovResult bicgstab(const AbstractMatrix& A, const std::vector<double>& b,
+                      const Preconditioner& M, std::vector<double> x0,
+                      double tol, size_t max_iter)
+{
+    return bicgstab(*makeOperator(A), b, M, std::move(x0), tol, max_iter);
+}
+
+std::vector<double> minres(const LinearOperator& A, const std::vector<double>& b,
+                            std::vector<double> x0, double tol, size_t max_iter)
+{
+    return minres(A, b, IdentityPreconditioner(b.size()), std::move(x0), tol, max_iter).x;
+}
+
+std::vector<double> minres(const AbstractMatrix& A, const std::vector<double>& b,
+                            std::vector<double> x0, double tol, size_t max_iter)
+{
+    return minres(*makeOperator(A), b, std::move(x0), tol, max_iter);
+}
+
+KrylovResult minres(const AbstractMatrix& A, const std::vector<double>& b,
+                    const Preconditioner& M, std::vector<double> x0,
+                    double tol, size_t max_iter)
+{
+    return minres(*makeOperator(A), b, M, std::move(x0), tol, max_iter);
+}
+
+// ─── Conjugate Gradient ───────────────────────────────────────────────────────
+// Preconditioned CG (Saad 2003, Algorithm 9.1).  Stops on the unpreconditioned
+// residual ||r||₂ ≤ tol, so results do not depend on how M is scaled.
+
+KrylovResult cg(const LinearOperator& A,
+                const std::vector<double>& b,
+                const Preconditioner& M,
+                std::vector<double> x0,
+                double tol,
+                size_t max_iter)
 {
     size_t n = b.size();
     if (A.rows() != n || A.cols() != n)
         throw std::invalid_argument("cg: A must be square n×n matching b");
+    if (M.size() != n)
+        throw std::invalid_argument("cg: preconditioner size does not match A");
 
-    DynamicMatrix Ad = toDyn(A);
     std::vector<double> x = x0.empty() ? std::vector<double>(n, 0.0) : std::move(x0);
 
-    // r = b - A*x
-    std::vector<double> Ax = matvec(Ad, x);
-    std::vector<double> r(n);
-    for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax[i];
+    // r = b - A*x,  z = M⁻¹ r,  p = z
+    std::vector<double> Ap(n), r(n), z(n);
+    A.apply(x, Ap);
+    for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ap[i];
+    M.apply(r, z);
 
-    std::vector<double> p = r;
-    double rs = dot(r, r);
+    std::vector<double> p = z;
+    double rz = dot(r, z);
+    double rr = dot(r, r);
 
-    for (size_t iter = 0; iter < max_iter && std::sqrt(rs) > tol; ++iter) {
-        std::vector<double> Ap = matvec(Ad, p);
+    size_t iter = 0;
+    while (iter < max_iter && std::sqrt(rr) > tol) {
+        A.apply(p, Ap);
         double pAp = dot(p, Ap);
-        if (std::abs(pAp) < 1e-14) break;
+        if (!(pAp > 0.0)) break;   // p = 0, or A is not positive definite
 
-        double alpha = rs / pAp;
-        double rs_new = 0.0;
+        double alpha = rz / pAp;
         for (size_t i = 0; i < n; ++i) {
             x[i] += alpha * p[i];
             r[i] -= alpha * Ap[i];
-            rs_new += r[i] * r[i];
         }
-        double beta = rs_new / rs;
-        for (size_t i = 0; i < n; ++i) p[i] = r[i] + beta * p[i];
-        rs = rs_new;
+        rr = dot(r, r);
+        ++iter;
+        if (std::sqrt(rr) <= tol) break;
+
+        M.apply(r, z);
+        double rz_new = dot(r, z);
+        double beta = rz_new / rz;
+        for (size_t i = 0; i < n; ++i) p[i] = z[i] + beta * p[i];
+        rz = rz_new;
     }
-    return x;
+    bool converged = std::sqrt(rr) <= tol;
+    return report(A, b, std::move(x), iter, converged);
 }
 
 // ─── LSQR ─────────────────────────────────────────────────────────────────────
 // Paige & Saunders (1982).  Solves min_x ||Ax - b||_2 for any A.
 
-std::vector<double> lsqr(const AbstractMatrix& A,
+std::vector<double> lsqr(const LinearOperator& A,
                           const std::vector<double>& b,
                           double tol,
                           size_t max_iter)
@@ -86,13 +194,8 @@ std::vector<double> lsqr(const AbstractMatrix& A,
     if (m != b.size())
         throw std::invalid_argument("lsqr: row count of A must equal size of b");
 
-    DynamicMatrix Ad = toDyn(A);
-
-    // Transpose once — used as A^T
-    DynamicMatrix At(n, m);
-    for (size_t i = 0; i < m; ++i)
-        for (size_t j = 0; j < n; ++j)
-            At.set(j, i, Ad.get(i, j));
+    if (!A.hasTranspose())
+        throw std::invalid_argument("lsqr: operator must provide applyTranspose()");
 
     std::vector<double> x(n, 0.0);
 
@@ -102,33 +205,36 @@ std::vector<double> lsqr(const AbstractMatrix& A,
     if (beta < 1e-14) return x;
     for (double& v : u) v /= beta;
 
-    std::vector<double> v = matvec(At, u);
+    std::vector<double> v(n);
+    A.applyTranspose(u, v);
     double alpha = nrm2(v);
     if (alpha < 1e-14) return x;
     for (double& vi : v) vi /= alpha;
 
     std::vector<double> w = v;
+    std::vector<double> u_new(m), v_new(n);
     double phi_bar = beta;
     double rho_bar = alpha;
 
     for (size_t iter = 0; iter < max_iter; ++iter) {
         // ① Bidiagonalize: β_{k+1} u_{k+1} = A v_k − α_k u_k
-        std::vector<double> u_new = matvec(Ad, v);
+        A.apply(v, u_new);
         for (size_t i = 0; i < m; ++i) u_new[i] -= alpha * u[i];
         double beta_new = nrm2(u_new);
 
         // ② α_{k+1} v_{k+1} = Aᵀ u_{k+1} − β_{k+1} v_k
         //    (skipped when β_{k+1} = 0 — exact solution found)
-        std::vector<double> v_new(n, 0.0);
         double alpha_new = 0.0;
         if (beta_new > 1e-14) {
             for (double& vi : u_new) vi /= beta_new;
-            u = u_new;
-            v_new = matvec(At, u);
+            u.swap(u_new);
+            A.applyTranspose(u, v_new);
             for (size_t i = 0; i < n; ++i) v_new[i] -= beta_new * v[i];
             alpha_new = nrm2(v_new);
             if (alpha_new > 1e-14)
                 for (double& vi : v_new) vi /= alpha_new;
+        } else {
+            std::fill(v_new.begin(), v_new.end(), 0.0);
         }
 
         // ③ Givens rotation to eliminate β_{k+1} from the bidiagonal matrix
@@ -151,65 +257,65 @@ std::vector<double> lsqr(const AbstractMatrix& A,
         if (beta_new < 1e-14 || alpha_new < 1e-14 ||
             std::abs(phi_bar) < tol) break;
 
-        v     = v_new;
+        v.swap(v_new);
         alpha = alpha_new;
     }
     return x;
 }
 
+
 // ─── GMRES(m) ─────────────────────────────────────────────────────────────────
 // Restarted Arnoldi GMRES with Givens rotations on the upper Hessenberg matrix.
 // Reference: Saad & Schultz (1986), Saad (2003) "Iterative Methods for Sparse
 // Linear Systems", Algorithm 6.9 (GMRES with restart).
-
-std::vector<double> gmres(const AbstractMatrix& A,
-                           const std::vector<double>& b,
-                           std::vector<double> x0,
-                           double tol,
-                           size_t max_iter,
-                           size_t restart)
+// Right-preconditioned (Algorithm 9.5): the Krylov space is built for A·M⁻¹,
+// so the residual the rotations track is the true residual of A·x = b.
+
+KrylovResult gmres(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   const Preconditioner& M,
+                   std::vector<double> x0,
+                   double tol,
+                   size_t max_iter,
+                   size_t restart)
 {
-    if (A.rows() != A.cols())
-        throw std::invalid_argument("gmres: A must be square");
+    checkSquare(A, b, M, "gmres");
     size_t n = b.size();
-    if (A.rows() != n)
-        throw std::invalid_argument("gmres: A dimensions incompatible with b");
 
-    DynamicMatrix Ad = toDyn(A);
     std::vector<double> x = x0.empty() ? std::vector<double>(n, 0.0) : std::move(x0);
-
-    auto apply = [&](const std::vector<double>& v) { return matvec(Ad, v); };
+    std::vector<double> Ax(n), w(n), z(n), r(n);
 
     size_t m = std::min(restart, n);
-    // Q stores the Krylov basis vectors as columns: Q[j] is a vector of size n
-    std::vector<std::vector<double>> Q;   // Q[j] = j-th basis vector
-    // H is the (m+1) × m upper Hessenberg matrix stored column-major
-    std::vector<std::vector<double>> H;
+    // Q stores the Krylov basis vectors as columns: Q[j] is a vector of size n.
+    // Allocated once and overwritten by every restart cycle.
+    std::vector<std::vector<double>> Q(m + 1, std::vector<double>(n));
+    // H is the (m+1) × m upper Hessenberg matrix stored column-major; H[j]
+    // uses its first j+2 rows
+    std::vector<std::vector<double>> H(m, std::vector<double>(m + 1));
+    // Givens rotation coefficients for QR of H, and the rotated residual
+    std::vector<double> cs(m), sn(m), g(m + 1), y(m);
 
     size_t total_iter = 0;
+    bool converged = false;
     while (total_iter < max_iter) {
         // Compute initial residual for this cycle
-        std::vector<double> r = b;
-        auto Ax = apply(x);
-        for (size_t i = 0; i < n; ++i) r[i] -= Ax[i];
+        A.apply(x, Ax);
+        for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax[i];
         double beta = nrm2(r);
-        if (beta < tol) break;
+        if (beta < tol) { converged = true; break; }
 
-        Q.clear(); H.clear();
-        Q.push_back(std::vector<double>(n));
         for (size_t i = 0; i < n; ++i) Q[0][i] = r[i] / beta;
-
-        // Givens rotation coefficients for QR of H
-        std::vector<double> cs, sn, g(m + 1, 0.0);
+        std::fill(g.begin(), g.end(), 0.0);
         g[0] = beta;
 
         size_t j = 0;
         for (; j < m && total_iter < max_iter; ++j, ++total_iter) {
-            // Arnoldi: w = A * Q[j]
-            std::vector<double> w = apply(Q[j]);
+            // Arnoldi: w = A * M⁻¹ * Q[j]
+            M.apply(Q[j], z);
+            A.apply(z, w);
 
             // Modified Gram-Schmidt orthogonalisation
-            H.push_back(std::vector<double>(j + 2, 0.0));  // H[j] has j+2 rows
+            std::fill(H[j].begin(), H[j].begin() + std::ptrdiff_t(j + 2), 0.0);
             for (size_t i = 0; i <= j; ++i) {
                 H[j][i] = dot(w, Q[i]);
                 for (size_t k = 0; k < n; ++k) w[k] -= H[j][i] * Q[i][k];
@@ -218,10 +324,8 @@ std::vector<double> gmres(const AbstractMatrix& A,
 
             // New basis vector
             if (H[j][j + 1] > 1e-300) {
-                std::vector<double> qnew(n);
                 double inv = 1.0 / H[j][j + 1];
-                for (size_t k = 0; k < n; ++k) qnew[k] = w[k] * inv;
-                Q.push_back(std::move(qnew));
+                for (size_t k = 0; k < n; ++k) Q[j + 1][k] = w[k] * inv;
             }
 
             // Apply previous Givens rotations to new column of H
@@ -235,7 +339,7 @@ std::vector<double> gmres(const AbstractMatrix& A,
             double denom = std::sqrt(H[j][j] * H[j][j] + H[j][j + 1] * H[j][j + 1]);
             double cj = H[j][j]     / denom;
             double sj = H[j][j + 1] / denom;
-            cs.push_back(cj); sn.push_back(sj);
+            cs[j] = cj; sn[j] = sj;
             H[j][j]     = cj * H[j][j] + sj * H[j][j + 1];
             H[j][j + 1] = 0.0;
 
@@ -243,65 +347,67 @@ std::vector<double> gmres(const AbstractMatrix& A,
             g[j + 1] = -sj * g[j];
             g[j]     =  cj * g[j];
 
-            if (std::abs(g[j + 1]) < tol) { ++j; break; }
+            if (std::abs(g[j + 1]) < tol) { ++j; ++total_iter; break; }
         }
 
         // Solve the (j × j) upper-triangular system H_j * y = g_j
         size_t sz = j;
-        std::vector<double> y(sz, 0.0);
         for (size_t i = sz; i-- > 0; ) {
             y[i] = g[i];
             for (size_t k = i + 1; k < sz; ++k) y[i] -= H[k][i] * y[k];
             y[i] /= H[i][i];
         }
 
-        // Update solution: x = x + Q_j * y
+        // Update solution: x = x + M⁻¹ * Q_j * y
+        std::fill(w.begin(), w.end(), 0.0);
         for (size_t i = 0; i < sz; ++i)
             for (size_t k = 0; k < n; ++k)
-                x[k] += Q[i][k] * y[i];
+                w[k] += Q[i][k] * y[i];
+        M.apply(w, z);
+        for (size_t k = 0; k < n; ++k) x[k] += z[k];
 
         // Check true residual
-        auto Ax2 = apply(x);
+        A.apply(x, Ax);
         double res = 0.0;
-        for (size_t k = 0; k < n; ++k) { double d = b[k] - Ax2[k]; res += d*d; }
-        if (std::sqrt(res) < tol) break;
+        for (size_t k = 0; k < n; ++k) { double d = b[k] - Ax[k]; res += d*d; }
+        if (std::sqrt(res) < tol) { converged = true; break; }
     }
-    return x;
+    return report(A, b, std::move(x), total_iter, converged);
 }
 
 // ─── BiCGSTAB ─────────────────────────────────────────────────────────────────
 // Van der Vorst (1992).  Short recurrences, constant memory.
-
-std::vector<double> bicgstab(const AbstractMatrix& A,
-                              const std::vector<double>& b,
-                              std::vector<double> x0,
-                              double tol,
-                              size_t max_iter)
+// Right-preconditioned: p̂ = M⁻¹p and ŝ = M⁻¹s replace p and s in the
+// products with A and in the update of x.
+
+KrylovResult bicgstab(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      const Preconditioner& M,
+                      std::vector<double> x0,
+                      double tol,
+                      size_t max_iter)
 {
-    if (A.rows() != A.cols())
-        throw std::invalid_argument("bicgstab: A must be square");
+    checkSquare(A, b, M, "bicgstab");
     size_t n = b.size();
-    if (A.rows() != n)
-        throw std::invalid_argument("bicgstab: A dimensions incompatible with b");
 
-    DynamicMatrix Ad = toDyn(A);
     std::vector<double> x = x0.empty() ? std::vector<double>(n, 0.0) : std::move(x0);
 
     // r = b - A*x
     std::vector<double> r(n), r_hat(n);
-    {
-        auto Ax = matvec(Ad, x);
-        for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax[i];
-    }
+    A.apply(x, r);
+    for (size_t i = 0; i < n; ++i) r[i] = b[i] - r[i];
     r_hat = r;   // arbitrary shadow residual
 
     double rho = 1.0, alpha = 1.0, omega = 1.0;
-    std::vector<double> v(n, 0.0), p(n, 0.0), s(n), t(n);
+    std::vector<double> v(n, 0.0), p(n, 0.0), s(n), t(n), p_hat(n), s_hat(n);
 
     double b_norm = nrm2(b);
     if (b_norm < 1e-300) b_norm = 1.0;
 
-    for (size_t it = 0; it < max_iter; ++it) {
+    size_t it = 0;
+    bool converged = nrm2(r) < tol * b_norm;
+    while (!converged && it < max_iter) {
+        ++it;
         double rho_new = dot(r_hat, r);
         if (std::abs(rho_new) < 1e-300) break;  // breakdown
 
@@ -312,7 +418,8 @@ std::vector<double> bicgstab(const AbstractMatrix& A,
         for (size_t i = 0; i < n; ++i)
             p[i] = r[i] + beta * (p[i] - omega * v[i]);
 
-        v = matvec(Ad, p);
+        M.apply(p, p_hat);
+        A.apply(p_hat, v);
         double denom = dot(r_hat, v);
         if (std::abs(denom) < 1e-300) break;
         alpha = rho / denom;
@@ -321,110 +428,114 @@ std::vector<double> bicgstab(const AbstractMatrix& A,
         for (size_t i = 0; i < n; ++i) s[i] = r[i] - alpha * v[i];
 
         if (nrm2(s) < tol * b_norm) {
-            for (size_t i = 0; i < n; ++i) x[i] += alpha * p[i];
+            for (size_t i = 0; i < n; ++i) x[i] += alpha * p_hat[i];
+            converged = true;
             break;
         }
 
-        t = matvec(Ad, s);
+        M.apply(s, s_hat);
+        A.apply(s_hat, t);
         double tt = dot(t, t);
         omega = (tt > 0.0) ? dot(t, s) / tt : 0.0;
 
         for (size_t i = 0; i < n; ++i) {
-            x[i] += alpha * p[i] + omega * s[i];
+            x[i] += alpha * p_hat[i] + omega * s_hat[i];
             r[i]  = s[i] - omega * t[i];
         }
 
-        if (nrm2(r) < tol * b_norm) break;
+        if (nrm2(r) < tol * b_norm) { converged = true; break; }
         if (std::abs(omega) < 1e-300) break;  // stagnation
     }
-    return x;
+    return report(A, b, std::move(x), it, converged);
 }
 
 // ─── MINRES ───────────────────────────────────────────────────────────────────
 // Paige & Saunders (1975).  For symmetric systems (any definiteness).
-
-std::vector<double> minres(const AbstractMatrix& A,
-                            const std::vector<double>& b,
-                            std::vector<double> x0,
-                            double tol,
-                            size_t max_iter)
+// Preconditioned Lanczos on M⁻¹A in the M-inner product (M must be SPD); the
+// recurrences follow Choi, Paige & Saunders (2011).  φ̄ tracks ||r||_{M⁻¹}.
+
+KrylovResult minres(const LinearOperator& A,
+                    const std::vector<double>& b,
+                    const Preconditioner& M,
+                    std::vector<double> x0,
+                    double tol,
+                    size_t max_iter)
 {
     if (A.rows() != A.cols())
         throw std::invalid_argument("minres: A must be square (symmetric)");
+    checkSquare(A, b, M, "minres");
     size_t n = b.size();
-    if (A.rows() != n)
-        throw std::invalid_argument("minres: A dimensions incompatible with b");
 
-    DynamicMatrix Ad = toDyn(A);
     std::vector<double> x = x0.empty() ? std::vector<double>(n, 0.0) : std::move(x0);
 
-    // Lanczos initialisation
-    auto Ax0 = matvec(Ad, x);
-    std::vector<double> r(n);
-    for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax0[i];
-
-    double beta1 = nrm2(r);
-    if (beta1 < tol) return x;
-
-    std::vector<double> v_old(n, 0.0), v(n), v_new(n);
-    for (size_t i = 0; i < n; ++i) v[i] = r[i] / beta1;
-
-    // MINRES direction vectors
-    std::vector<double> w(n, 0.0), w_bar(n), w_hat(n);
-    for (size_t i = 0; i < n; ++i) w_bar[i] = v[i];
-
+    // Lanczos initialisation: r1 = b − A·x,  y = M⁻¹·r1,  β₁ = √(r1·y)
+    std::vector<double> r1(n), r2(n), y(n), v(n);
+    A.apply(x, r1);
+    for (size_t i = 0; i < n; ++i) r1[i] = b[i] - r1[i];
+    if (nrm2(r1) < tol) return report(A, b, std::move(x), 0, true);
+
+    M.apply(r1, y);
+    double beta1 = dot(r1, y);
+    if (beta1 <= 0.0)
+        throw std::invalid_argument("minres: preconditioner is not positive definite");
+    beta1 = std::sqrt(beta1);
+    r2 = r1;
+
+    // Search directions w_{k-2}, w_{k-1}, w_k
+    std::vector<double> w(n, 0.0), w1(n, 0.0), w2(n, 0.0);
+
+    double beta = beta1, oldb = 0.0;
+    double dbar = 0.0, epsln = 0.0;
+    double cs = -1.0, sn = 0.0;
     double phi_bar = beta1;
-    double c = 1.0,     s = 0.0;
-    double beta = beta1, beta_old = 0.0, alpha = 0.0;
-
-    for (size_t it = 0; it < max_iter; ++it) {
-        // Lanczos: z = A*v
-        auto z = matvec(Ad, v);
-        alpha = dot(v, z);
-
-        // v_new = z - alpha*v - beta*v_old
-        for (size_t i = 0; i < n; ++i)
-            v_new[i] = z[i] - alpha * v[i] - beta * v_old[i];
 
-        beta_old = beta;
-        beta      = nrm2(v_new);
-
-        // QR factorisation of the tridiagonal (Givens)
-        double delta  =  c * alpha - s * beta_old;
-        double eps_1  =  s * alpha + c * beta_old;
-        double phi    =  std::sqrt(delta * delta + beta * beta);
-
-        if (phi < 1e-300) break;
-
-        double c_new = delta / phi;
-        double s_new = beta  / phi;
-
-        // Update w direction
+    size_t it = 0;
+    bool converged = false;
+    while (it < max_iter) {
+        ++it;
+        // Lanczos: v = y/β,  y = A·v − (β/β_old)·r1 − (α/β)·r2,  y ← M⁻¹ r
+        const double sc = 1.0 / beta;
+        for (size_t i = 0; i < n; ++i) v[i] = sc * y[i];
+        A.apply(v, y);
+        if (it >= 2)
+            for (size_t i = 0; i < n; ++i) y[i] -= (beta / oldb) * r1[i];
+        double alpha = dot(v, y);
+        for (size_t i = 0; i < n; ++i) y[i] -= (alpha / beta) * r2[i];
+        r1.swap(r2);
+        r2.swap(y);
+        M.apply(r2, y);
+        oldb = beta;
+        beta = dot(r2, y);
+        if (beta < 0.0)
+            throw std::invalid_argument("minres: preconditioner is not positive definite");
+        beta = std::sqrt(beta);
+
+        // Apply the previous rotation, then form the one that zeroes β_{k+1}
+        double oldeps = epsln;
+        double delta  = cs * dbar + sn * alpha;
+        double gbar   = sn * dbar - cs * alpha;
+        epsln         = sn * beta;
+        dbar          = -cs * beta;
+
+        double gamma = std::sqrt(gbar * gbar + beta * beta);
+        if (gamma < 1e-300) break;
+        cs = gbar / gamma;
+        sn = beta / gamma;
+        double phi = cs * phi_bar;
+        phi_bar    = sn * phi_bar;
+
+        // w_k = (v_k − ε_k w_{k-2} − δ_k w_{k-1}) / γ_k,  x += φ_k w_k
+        w1.swap(w2);
+        w2.swap(w);
         for (size_t i = 0; i < n; ++i) {
-            w_hat[i] = w_bar[i];
-            w_bar[i] = (beta > 1e-300) ? v_new[i] / beta : 0.0;
+            w[i]  = (v[i] - oldeps * w1[i] - delta * w2[i]) / gamma;
+            x[i] += phi * w[i];
         }
-        for (size_t i = 0; i < n; ++i)
-            w[i] = (w_hat[i] - eps_1 * w[i]) / phi;
-
-        // Update solution
-        double phi_tilde = phi_bar * c_new;
-        phi_bar = phi_bar * s_new;
 
-        for (size_t i = 0; i < n; ++i)
-            x[i] += phi_tilde * w[i];
-
-        if (std::abs(phi_bar) < tol * beta1) break;
-
-        // Advance Lanczos vectors
-        v_old = v;
-        v     = v_new;
-        if (beta > 1e-300) {
-            for (size_t i = 0; i < n; ++i) v[i] /= beta;
-        }
-        c = c_new; s = s_new;
+        if (std::abs(phi_bar) < tol * beta1) { converged = true; break; }
+        if (beta < 1e-300) { converged = true; break; }   // invariant subspace: x is exact
     }
-    return x;
+    return report(A, b, std::move(x), it, converged);
 }
 
 } // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,208 @@
+#include "LinearAlgebra/LinearOperator.h"
+#include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/Gemm.h"
+#include "LinearAlgebra/SparseMatrix.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace SharedMath::LinearAlgebra {
+
+// ── LinearOperator ────────────────────────────────────────────────────────────
+
+void LinearOperator::applyTranspose(const std::vector<double>&,
+                                    std::vector<double>&) const {
+    throw std::logic_error("LinearOperator::applyTranspose: operator has no transpose");
+}
+
+namespace {
+
+// Y = op(X) one column at a time through the vector products.
+template<typename Apply>
+void applyByColumns(const DynamicMatrix& X, DynamicMatrix& Y, size_t outRows, Apply apply) {
+    const size_t inRows = X.rows(), k = X.cols();
+    if (Y.rows() != outRows || Y.cols() != k) Y = DynamicMatrix(outRows, k);
+    std::vector<double> x(inRows), y(outRows);
+    for (size_t c = 0; c < k; ++c) {
+        for (size_t i = 0; i < inRows; ++i) x[i] = X(i, c);
+        apply(x, y);
+        for (size_t i = 0; i < outRows; ++i) Y(i, c) = y[i];
+    }
+}
+
+void checkBlock(const DynamicMatrix& X, size_t rows, const char* who) {
+    if (X.rows() != rows)
+        throw std::invalid_argument(std::string(who) + ": block has " +
+                                    std::to_string(X.rows()) + " rows, expected " +
+                                    std::to_string(rows));
+}
+
+} // namespace
+
+void LinearOperator::applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, cols(), "LinearOperator::applyBlock");
+    applyByColumns(X, Y, rows(), [this](const auto& x, auto& y) { apply(x, y); });
+}
+
+void LinearOperator::applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, rows(), "LinearOperator::applyTransposeBlock");
+    applyByColumns(X, Y, cols(), [this](const auto& x, auto& y) { applyTranspose(x, y); });
+}
+
+// ── SparseOperator ────────────────────────────────────────────────────────────
+
+size_t SparseOperator::rows() const noexcept { return A_.rows(); }
+size_t SparseOperator::cols() const noexcept { return A_.cols(); }
+
+void SparseOperator::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    A_.multiply(x, y);
+}
+
+void SparseOperator::applyTranspose(const std::vector<double>& x,
+                                    std::vector<double>& y) const {
+    // Scatter: row i of A contributes x[i]·A(i, :) to y.  Rows write to
+    // overlapping columns, so this pass stays serial.
+    const auto& rp  = A_.row_ptr();
+    const auto& ci  = A_.col_indices();
+    const auto& val = A_.values();
+    std::fill(y.begin(), y.end(), 0.0);
+    for (size_t i = 0; i < A_.rows(); ++i) {
+        const double xi = x[i];
+        if (xi == 0.0) continue;
+        for (size_t k = rp[i]; k < rp[i + 1]; ++k)
+            y[ci[k]] += val[k] * xi;
+    }
+}
+
+void SparseOperator::applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, A_.cols(), "SparseOperator::applyBlock");
+    Y = A_ * X;
+}
+
+// Scatter as in applyTranspose, but each task owns a band of the k columns
+// of Y, so the pass parallelises without write conflicts when k is large.
+void SparseOperator::applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, A_.rows(), "SparseOperator::applyTransposeBlock");
+    const size_t k = X.cols();
+    if (Y.rows() != A_.cols() || Y.cols() != k) Y = DynamicMatrix(A_.cols(), k);
+    Y.clear();
+    const auto& rp  = A_.row_ptr();
+    const auto& ci  = A_.col_indices();
+    const auto& val = A_.values();
+    Core::parallel_for(0, k, 8, [&](size_t c0, size_t c1) {
+        for (size_t i = 0; i < A_.rows(); ++i) {
+            const double* xi = X.row_ptr(i);
+            for (size_t q = rp[i]; q < rp[i + 1]; ++q) {
+                const double a  = val[q];
+                double*      yj = Y.row_ptr(ci[q]);
+                for (size_t c = c0; c < c1; ++c) yj[c] += a * xi[c];
+            }
+        }
+    });
+}
+
+// ── DenseOperator ─────────────────────────────────────────────────────────────
+
+DenseOperator::DenseOperator(const DynamicMatrix& A) : A_(A) {
+    if (A.device() != Device::CPU)
+        throw std::runtime_error(
+            "DenseOperator: matrix is on GPU — call .cpu() first");
+}
+
+size_t DenseOperator::rows() const noexcept { return A_.rows(); }
+size_t DenseOperator::cols() const noexcept { return A_.cols(); }
+
+void DenseOperator::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    const size_t n = A_.cols();
+    Core::parallel_for(0, A_.rows(), 64, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            const double* Ai = A_.row_ptr(i);
+            double s = 0.0;
+            for (size_t j = 0; j < n; ++j) s += Ai[j] * x[j];
+            y[i] = s;
+        }
+    });
+}
+
+void DenseOperator::applyTranspose(const std::vector<double>& x,
+                                   std::vector<double>& y) const {
+    // Each task owns a contiguous block of output columns and streams the rows
+    // of A over it, so the inner loop stays unit-stride.
+    const size_t m = A_.rows();
+    Core::parallel_for(0, A_.cols(), 256, [&](size_t lo, size_t hi) {
+        std::fill(y.begin() + lo, y.begin() + hi, 0.0);
+        for (size_t i = 0; i < m; ++i) {
+            const double* Ai = A_.row_ptr(i);
+            const double  xi = x[i];
+            for (size_t j = lo; j < hi; ++j) y[j] += Ai[j] * xi;
+        }
+    });
+}
+
+void DenseOperator::applyBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, A_.cols(), "DenseOperator::applyBlock");
+    matmul_into(Y, A_, X);
+}
+
+void DenseOperator::applyTransposeBlock(const DynamicMatrix& X, DynamicMatrix& Y) const {
+    checkBlock(X, A_.rows(), "DenseOperator::applyTransposeBlock");
+    const size_t m = A_.rows(), n = A_.cols(), k = X.cols();
+    if (&Y == &X || Y.rows() != n || Y.cols() != k) Y = DynamicMatrix(n, k);
+    gemm(Transpose::Yes, Transpose::No, n, k, m, 1.0, A_.data().data(), n,
+         X.data().data(), k, 0.0, Y.data().data(), k);
+}
+
+// ── MatrixOperator ────────────────────────────────────────────────────────────
+
+void MatrixOperator::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    const size_t m = A_.rows(), n = A_.cols();
+    for (size_t i = 0; i < m; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j < n; ++j) s += A_.get(i, j) * x[j];
+        y[i] = s;
+    }
+}
+
+void MatrixOperator::applyTranspose(const std::vector<double>& x,
+                                    std::vector<double>& y) const {
+    const size_t m = A_.rows(), n = A_.cols();
+    std::fill(y.begin(), y.end(), 0.0);
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j)
+            y[j] += A_.get(i, j) * x[i];
+}
+
+// ── FunctionOperator ──────────────────────────────────────────────────────────
+
+FunctionOperator::FunctionOperator(size_t rows, size_t cols, Fn apply, Fn applyT)
+    : rows_(rows), cols_(cols), apply_(std::move(apply)), applyT_(std::move(applyT))
+{
+    if (!apply_)
+        throw std::invalid_argument("FunctionOperator: apply callback must not be empty");
+}
+
+void FunctionOperator::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    apply_(x, y);
+}
+
+void FunctionOperator::applyTranspose(const std::vector<double>& x,
+                                      std::vector<double>& y) const {
+    if (!applyT_) LinearOperator::applyTranspose(x, y);
+    applyT_(x, y);
+}
+
+// ── Factory ───────────────────────────────────────────────────────────────────
+
+std::unique_ptr<LinearOperator> makeOperator(const AbstractMatrix& A) {
+    if (const auto* s = dynamic_cast<const SparseMatrix*>(&A))
+        return std::make_unique<SparseOperator>(*s);
+    if (const auto* d = dynamic_cast<const DynamicMatrix*>(&A))
+        return std::make_unique<DenseOperator>(*d);
+    return std::make_unique<MatrixOperator>(A);
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -1,6 +1,10 @@
 #include "LinearAlgebra/LinearSolver.h"
+#include "LinearAlgebra/Gemm.h"
 #include "LinearAlgebra/MatrixFunctions.h"
 
+#include "core/Memory.h"
+#include "core/ThreadPool.h"
+
 #include <cmath>
 #include <stdexcept>
 #include <algorithm>
@@ -26,13 +30,16 @@ LinearSolver::LinearSolver(const AbstractMatrix& A, Method method)
     : rows_(A.rows()), cols_(A.cols())
 {
     if (method == Method::Auto) {
-        // Choose: SPD → Cholesky, square → LU, rectangular → QR
-        if (A.rows() == A.cols() && isSymmetric(A) && isPositiveDefinite(A))
-            method = Method::Cholesky;
-        else if (A.rows() == A.cols())
-            method = Method::LU;
-        else
-            method = Method::QR;
+        // Choose: SPD → Cholesky, square → LU, rectangular → QR.  Positive
+        // definiteness is detected by attempting the factorization itself.
+        if (A.rows() == A.cols() && isSymmetric(A)) {
+            method_ = Method::Cholesky;
+            try {
+                factorize_cholesky(A);
+                return;
+            } catch (const std::runtime_error&) {}
+        }
+        method = A.rows() == A.cols() ? Method::LU : Method::QR;
     }
     method_ = method;
 
@@ -44,7 +51,17 @@ LinearSolver::LinearSolver(const AbstractMatrix& A, Method method)
     }
 }
 
-// ── LU factorization (in-place, partial pivoting) ─────────────────────────────
+namespace {
+
+constexpr size_t kBlock = 96;   // panel width of the blocked factorizations
+
+} // namespace
+
+// ── LU factorization (right-looking, blocked, partial pivoting) ───────────────
+// For each panel of kBlock columns: factorize the tall panel with an
+// unblocked loop (pivot rows are swapped across the whole matrix), then
+//   U12 ← L11⁻¹·A12        (TRSM)
+//   A22 ← A22 − L21·U12    (GEMM, where nearly all the flops go)
 
 void LinearSolver::factorize_lu(const AbstractMatrix& src) {
     if (src.rows() != src.cols())
@@ -54,135 +71,263 @@ void LinearSolver::factorize_lu(const AbstractMatrix& src) {
     piv_.resize(n);
     std::iota(piv_.begin(), piv_.end(), 0);
     piv_sign_ = 1;
-
-    for (size_t k = 0; k < n; ++k) {
-        // Partial pivot: find max in column k below row k
-        size_t maxRow = k;
-        double maxVal = std::abs(LU_(k, k));
-        for (size_t i = k + 1; i < n; ++i) {
-            double v = std::abs(LU_(i, k));
-            if (v > maxVal) { maxVal = v; maxRow = i; }
+    double* a = LU_.toPtr();
+
+    for (size_t k0 = 0; k0 < n; k0 += kBlock) {
+        const size_t k1 = std::min(n, k0 + kBlock);
+
+        for (size_t k = k0; k < k1; ++k) {
+            // Partial pivot: find max in column k below row k
+            size_t maxRow = k;
+            double maxVal = std::abs(a[k * n + k]);
+            for (size_t i = k + 1; i < n; ++i) {
+                double v = std::abs(a[i * n + k]);
+                if (v > maxVal) { maxVal = v; maxRow = i; }
+            }
+            if (maxRow != k) {
+                std::swap_ranges(a + k * n, a + (k + 1) * n, a + maxRow * n);
+                std::swap(piv_[k], piv_[maxRow]);
+                piv_sign_ = -piv_sign_;
+            }
+            if (maxVal < 1e-300)
+                throw std::runtime_error("LinearSolver (LU): singular matrix");
+
+            // Rank-1 update restricted to the panel; rows are independent.
+            const double inv_kk = 1.0 / a[k * n + k];
+            const double* Uk = a + k * n;
+            Core::parallel_for(k + 1, n, 512, [&](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i) {
+                    double* Ai = a + i * n;
+                    const double l = (Ai[k] *= inv_kk);
+                    for (size_t j = k + 1; j < k1; ++j) Ai[j] -= l * Uk[j];
+                }
+            });
         }
-        if (maxRow != k) {
-            // Swap rows k and maxRow
-            for (size_t j = 0; j < n; ++j)
-                std::swap(LU_(k, j), LU_(maxRow, j));
-            std::swap(piv_[k], piv_[maxRow]);
-            piv_sign_ = -piv_sign_;
-        }
-        if (std::abs(LU_(k, k)) < 1e-300)
-            throw std::runtime_error("LinearSolver (LU): singular matrix");
-        double inv_kk = 1.0 / LU_(k, k);
-        for (size_t i = k + 1; i < n; ++i) {
-            LU_(i, k) *= inv_kk;
-            for (size_t j = k + 1; j < n; ++j)
-                LU_(i, j) -= LU_(i, k) * LU_(k, j);
+
+        if (k1 < n) {
+            const size_t nb = k1 - k0;
+            trsm(Side::Left, Triangle::Lower, Transpose::No, Diagonal::Unit,
+                 nb, n - k1, 1.0, a + k0 * n + k0, n, a + k0 * n + k1, n);
+            gemm(Transpose::No, Transpose::No, n - k1, n - k1, nb, -1.0,
+                 a + k1 * n + k0, n, a + k0 * n + k1, n, 1.0, a + k1 * n + k1, n);
         }
     }
 }
 
-// ── QR factorization (Householder) ────────────────────────────────────────────
+// ── QR factorization (blocked Householder, compact WY) ────────────────────────
+// A panel of nb reflectors H_k = I − τ_k·v_k·v_kᵀ is aggregated as
+//   H_k0 ⋯ H_k1−1 = I − V·T·Vᵀ     (T upper triangular, nb×nb)
+// so applying it to the trailing matrix (or to a block of right-hand sides)
+// is three GEMMs instead of nb rank-1 updates.  Q is never formed.
 
-void LinearSolver::factorize_qr(const AbstractMatrix& src) {
-    auto [Q, R] = ::SharedMath::LinearAlgebra::qr(src);
-    Q_ = std::move(Q);
-    R_ = std::move(R);
-}
+namespace {
 
-// ── Cholesky factorization ────────────────────────────────────────────────────
+// Workspace of the blocked QR; drawn from the thread's arena while a
+// factorization or apply_q() runs.
+using Scratch = Core::ScratchVector<double>;
 
-void LinearSolver::factorize_cholesky(const AbstractMatrix& src) {
-    if (src.rows() != src.cols())
-        throw std::invalid_argument("LinearSolver (Cholesky): matrix must be square");
-    L_ = ::SharedMath::LinearAlgebra::cholesky(src);
+// V (m−k0 × nb, unit lower trapezoidal) and T for reflectors k0..k0+nb−1.
+void buildBlockReflector(const DynamicMatrix& QR, const std::vector<double>& tau,
+                         size_t k0, size_t nb, Scratch& V, Scratch& T)
+{
+    const size_t m = QR.rows(), mr = m - k0;
+    V.assign(mr * nb, 0.0);
+    for (size_t r = 0; r < mr; ++r) {
+        const double* row = QR.row_ptr(k0 + r) + k0;
+        for (size_t c = 0; c < nb && c <= r; ++c)
+            V[r * nb + c] = (c == r) ? 1.0 : row[c];
+    }
+    T.assign(nb * nb, 0.0);
+    // T(0:i, i) = −τ_i · T(0:i, 0:i) · V(:, 0:i)ᵀ·v_i, with VᵀV from one GEMM.
+    // G is released on return; V and T belong to the caller's scope.
+    Core::ArenaScope scratch;
+    Scratch G(nb * nb);
+    gemm(Transpose::Yes, Transpose::No, nb, nb, mr, 1.0, V.data(), nb, V.data(), nb,
+         0.0, G.data(), nb);
+    for (size_t i = 0; i < nb; ++i) {
+        T[i * nb + i] = tau[k0 + i];
+        if (i == 0 || tau[k0 + i] == 0.0) continue;
+        for (size_t p = 0; p < i; ++p) {
+            double s = 0.0;
+            for (size_t q = p; q < i; ++q) s += T[p * nb + q] * G[q * nb + i];
+            T[p * nb + i] = -tau[k0 + i] * s;
+        }
+    }
 }
 
-// ── Triangular solvers ────────────────────────────────────────────────────────
-
-// Solve L*x = b  (lower triangular)
-std::vector<double> LinearSolver::forward_sub(
-    const DynamicMatrix& L, const std::vector<double>& b, bool unit_diag)
+// C ← (I − V·op(T)·Vᵀ)·C  for an mr×nc block C with row stride ldc.
+void applyBlockReflector(const Scratch& V, const Scratch& T,
+                         size_t mr, size_t nb, bool transT,
+                         double* C, size_t nc, size_t ldc)
 {
-    size_t n = L.rows();
-    std::vector<double> x(n);
-    for (size_t i = 0; i < n; ++i) {
-        double s = b[i];
-        for (size_t j = 0; j < i; ++j) s -= L(i, j) * x[j];
-        x[i] = unit_diag ? s : s / L(i, i);
+    if (nc == 0) return;
+    Core::ArenaScope scratch;
+    Scratch W(nb * nc), W2(nb * nc);
+    gemm(Transpose::Yes, Transpose::No, nb, nc, mr, 1.0, V.data(), nb, C, ldc, 0.0, W.data(), nc);
+    gemm(transT ? Transpose::Yes : Transpose::No, Transpose::No, nb, nc, nb, 1.0,
+         T.data(), nb, W.data(), nc, 0.0, W2.data(), nc);
+    gemm(Transpose::No, Transpose::No, mr, nc, nb, -1.0, V.data(), nb, W2.data(), nc, 1.0, C, ldc);
+}
+
+// Householder QR of the panel columns c0..c1−1 (rows c0..m−1), applying each
+// reflector only within the panel.  Wide panels are split in half (Elmroth–
+// Gustavson): the left half's block reflector updates the right half with
+// GEMMs, so a tall panel is streamed O(log nb) times instead of nb times.
+// The left half's V/T are released before the right half recurses, so at
+// most one level's reflector block is live at a time.
+void factorizePanel(DynamicMatrix& QR, std::vector<double>& tau, size_t c0, size_t c1) {
+    constexpr size_t kLeaf = 8;
+    const size_t m = QR.rows(), n = QR.cols();
+    double* a = QR.toPtr();
+    if (c1 - c0 > kLeaf) {
+        const size_t h = (c1 - c0) / 2;
+        factorizePanel(QR, tau, c0, c0 + h);
+        {
+            Core::ArenaScope scratch;
+            Scratch V, T;
+            buildBlockReflector(QR, tau, c0, h, V, T);
+            applyBlockReflector(V, T, m - c0, h, /*transT=*/true,
+                                a + c0 * n + c0 + h, c1 - c0 - h, n);
+        }
+        factorizePanel(QR, tau, c0 + h, c1);
+        return;
+    }
+    Core::ArenaScope scratch;
+    Scratch w;
+    for (size_t k = c0; k < c1; ++k) {
+        double xnorm = 0.0;
+        for (size_t i = k + 1; i < m; ++i) xnorm += a[i * n + k] * a[i * n + k];
+        xnorm = std::sqrt(xnorm);
+        const double alpha = a[k * n + k];
+        if (xnorm < 1e-14) continue;                 // already reduced: H_k = I
+
+        // H_k·x = β·e₁ with β = −sign(α)·‖x‖, v = (x − β·e₁)/(α − β)
+        const double beta = -(alpha >= 0.0 ? 1.0 : -1.0) * std::hypot(alpha, xnorm);
+        tau[k] = (beta - alpha) / beta;
+        const double scale = 1.0 / (alpha - beta);
+        for (size_t i = k + 1; i < m; ++i) a[i * n + k] *= scale;
+        a[k * n + k] = beta;
+
+        // Apply H_k to the rest of the panel.
+        const size_t w0 = k + 1, wn = c1 - w0;
+        if (wn == 0) continue;
+        w.assign(a + k * n + w0, a + k * n + c1);   // v(k) = 1
+        for (size_t i = k + 1; i < m; ++i) {
+            const double vi = a[i * n + k];
+            for (size_t c = 0; c < wn; ++c) w[c] += vi * a[i * n + w0 + c];
+        }
+        for (size_t c = 0; c < wn; ++c) a[k * n + w0 + c] -= tau[k] * w[c];
+        for (size_t i = k + 1; i < m; ++i) {
+            const double tv = tau[k] * a[i * n + k];
+            for (size_t c = 0; c < wn; ++c) a[i * n + w0 + c] -= tv * w[c];
+        }
     }
-    return x;
 }
 
-// Solve U*x = b  (upper triangular)
-std::vector<double> LinearSolver::backward_sub(
-    const DynamicMatrix& U, const std::vector<double>& b)
-{
-    size_t n = U.rows();
-    std::vector<double> x(n);
-    for (size_t i = n; i-- > 0; ) {
-        double s = b[i];
-        for (size_t j = i + 1; j < n; ++j) s -= U(i, j) * x[j];
-        x[i] = s / U(i, i);
+} // namespace
+
+void LinearSolver::factorize_qr(const AbstractMatrix& src) {
+    const size_t m = src.rows(), n = src.cols(), kmax = std::min(m, n);
+    QR_ = DynamicMatrix(src);
+    tau_.assign(kmax, 0.0);
+    double* a = QR_.toPtr();
+
+    // One scope per panel: the panel's own recursion and the trailing
+    // update's V/T never hold the arena at the same time.
+    for (size_t k0 = 0; k0 < kmax; k0 += kBlock) {
+        const size_t k1 = std::min(kmax, k0 + kBlock);
+        Core::ArenaScope scratch;
+        factorizePanel(QR_, tau_, k0, k1);
+
+        // Trailing update A[k0:m, k1:n] ← (I − V·T·Vᵀ)ᵀ·A[k0:m, k1:n]
+        if (k1 < n) {
+            Scratch V, T;
+            buildBlockReflector(QR_, tau_, k0, k1 - k0, V, T);
+            applyBlockReflector(V, T, m - k0, k1 - k0, /*transT=*/true,
+                                a + k0 * n + k1, n - k1, n);
+        }
     }
-    return x;
 }
 
-// ── solve_lu ──────────────────────────────────────────────────────────────────
+DynamicMatrix LinearSolver::r_factor() const {
+    if (method_ != Method::QR)
+        throw std::logic_error("LinearSolver::r_factor: requires a QR factorization");
+    const size_t r = std::min(rows_, cols_);
+    DynamicMatrix R(r, cols_, 0.0);
+    for (size_t i = 0; i < r; ++i)
+        std::copy(QR_.row_ptr(i) + i, QR_.row_ptr(i) + cols_, R.row_ptr(i) + i);
+    return R;
+}
 
-std::vector<double> LinearSolver::solve_lu(const std::vector<double>& b) const {
-    size_t n = LU_.rows();
-    // Apply row permutation
-    std::vector<double> pb(n);
-    for (size_t i = 0; i < n; ++i) pb[i] = b[piv_[i]];
-    // Forward substitution: L*y = pb  (unit lower triangular stored in LU_)
-    auto y = forward_sub(LU_, pb, /*unit_diag=*/true);
-    // Backward substitution: U*x = y
-    return backward_sub(LU_, y);
+void LinearSolver::apply_q(DynamicMatrix& X, bool transpose) const {
+    if (method_ != Method::QR)
+        throw std::logic_error("LinearSolver::apply_q: requires a QR factorization");
+    if (X.rows() != rows_)
+        throw std::invalid_argument("LinearSolver::apply_q: dimension mismatch");
+    const size_t m = QR_.rows(), kmax = tau_.size(), nc = X.cols();
+    const size_t blocks = (kmax + kBlock - 1) / kBlock;
+    Core::ArenaScope scratch;
+    Scratch V, T;
+    // Qᵀ = H_p ⋯ H_1 applies block 0 first; Q applies the last block first.
+    for (size_t t = 0; t < blocks; ++t) {
+        const size_t b  = transpose ? t : blocks - 1 - t;
+        const size_t k0 = b * kBlock, nb = std::min(kBlock, kmax - k0);
+        buildBlockReflector(QR_, tau_, k0, nb, V, T);
+        applyBlockReflector(V, T, m - k0, nb, transpose, X.row_ptr(k0), nc, nc);
+    }
 }
 
-// ── solve_qr ──────────────────────────────────────────────────────────────────
+// ── Cholesky factorization ────────────────────────────────────────────────────
 
-std::vector<double> LinearSolver::solve_qr(const std::vector<double>& b) const {
-    // x = R^{-1} * Q^T * b  (least-squares for overdetermined)
-    size_t m = Q_.rows(), n = R_.cols(), k = std::min(m, n);
-    // y = Q^T * b  (only first k rows needed)
-    std::vector<double> y(k, 0.0);
-    for (size_t i = 0; i < k; ++i)
-        for (size_t j = 0; j < m; ++j)
-            y[i] += Q_(j, i) * b[j];
-    // Back-substitute into R (k×n upper triangular, thin)
-    DynamicMatrix Rk(k, k);
-    for (size_t i = 0; i < k; ++i)
-        for (size_t j = 0; j < k; ++j)
-            Rk(i, j) = R_(i, j);
-    return backward_sub(Rk, y);
+void LinearSolver::factorize_cholesky(const AbstractMatrix& src) {
+    if (src.rows() != src.cols())
+        throw std::invalid_argument("LinearSolver (Cholesky): matrix must be square");
+    L_ = ::SharedMath::LinearAlgebra::cholesky(src);   // blocked, left-looking
 }
 
-// ── solve_cho ─────────────────────────────────────────────────────────────────
+// ── Blocked solve ─────────────────────────────────────────────────────────────
+// Every right-hand side goes through level-3 TRSM, one block of columns of
+// B at a time rather than one vector at a time.
+
+DynamicMatrix LinearSolver::solve_blocked(DynamicMatrix B) const {
+    if (B.rows() != rows_)
+        throw std::invalid_argument("LinearSolver::solve: dimension mismatch");
+    const size_t k = B.cols();
 
-std::vector<double> LinearSolver::solve_cho(const std::vector<double>& b) const {
-    // A = L * L^T  →  solve L*y = b, then L^T*x = y
-    auto y = forward_sub(L_, b, /*unit_diag=*/false);
-    // Solve L^T * x = y  using backward substitution on L^T
-    size_t n = L_.rows();
-    std::vector<double> x(n);
-    for (size_t i = n; i-- > 0; ) {
-        double s = y[i];
-        for (size_t j = i + 1; j < n; ++j) s -= L_(j, i) * x[j];
-        x[i] = s / L_(i, i);
+    switch (method_) {
+    case Method::QR: {
+        apply_q(B, /*transpose=*/true);
+        const size_t r = std::min(rows_, cols_);
+        DynamicMatrix X(cols_, k, 0.0);
+        std::copy(B.toPtr(), B.toPtr() + r * k, X.toPtr());
+        // Least-squares / basic solution: R₁₁·x = (Qᵀb)[0:r], remaining x = 0
+        trsm(Side::Left, Triangle::Upper, Transpose::No, Diagonal::NonUnit,
+             r, k, 1.0, QR_.toPtr(), cols_, X.toPtr(), k);
+        return X;
+    }
+    case Method::Cholesky:
+        trsm(Side::Left, Triangle::Lower, Transpose::No,  Diagonal::NonUnit,
+             rows_, k, 1.0, L_.toPtr(), rows_, B.toPtr(), k);
+        trsm(Side::Left, Triangle::Lower, Transpose::Yes, Diagonal::NonUnit,
+             rows_, k, 1.0, L_.toPtr(), rows_, B.toPtr(), k);
+        return B;
+    default: {
+        DynamicMatrix X(rows_, k);
+        for (size_t i = 0; i < rows_; ++i)
+            std::copy(B.row_ptr(piv_[i]), B.row_ptr(piv_[i]) + k, X.row_ptr(i));
+        trsm(Side::Left, Triangle::Lower, Transpose::No, Diagonal::Unit,
+             rows_, k, 1.0, LU_.toPtr(), rows_, X.toPtr(), k);
+        trsm(Side::Left, Triangle::Upper, Transpose::No, Diagonal::NonUnit,
+             rows_, k, 1.0, LU_.toPtr(), rows_, X.toPtr(), k);
+        return X;
+    }
     }
-    return x;
 }
 
 // ── Public solve ──────────────────────────────────────────────────────────────
 
 std::vector<double> LinearSolver::solve(const std::vector<double>& b) const {
-    switch (method_) {
-    case Method::LU:       return solve_lu(b);
-    case Method::QR:       return solve_qr(b);
-    case Method::Cholesky: return solve_cho(b);
-    default:               return solve_lu(b);
-    }
+    return solve_blocked(DynamicMatrix(b.size(), 1, b)).data();
 }
 
 DynamicVector LinearSolver::solve(const DynamicVector& b) const {
@@ -190,15 +335,7 @@ DynamicVector LinearSolver::solve(const DynamicVector& b) const {
 }
 
 DynamicMatrix LinearSolver::solve(const DynamicMatrix& B) const {
-    size_t nrhs = B.cols();
-    DynamicMatrix X(cols_, nrhs);
-    std::vector<double> col(B.rows());
-    for (size_t j = 0; j < nrhs; ++j) {
-        for (size_t i = 0; i < B.rows(); ++i) col[i] = B(i, j);
-        auto x = solve(col);
-        for (size_t i = 0; i < x.size(); ++i) X(i, j) = x[i];
-    }
-    return X;
+    return solve_blocked(B);
 }
 
 // ── inverse ───────────────────────────────────────────────────────────────────
@@ -225,19 +362,31 @@ double LinearSolver::determinant() const {
         for (size_t i = 0; i < L_.rows(); ++i) d *= L_(i, i);
         return d * d;
     }
-    // QR: not ideal for det — fall back to LU
-    return LinearSolver(
-        (method_ == Method::QR ? Q_ * R_ : DynamicMatrix(rows_, cols_)),
-        Method::LU).determinant();
+    // QR: det(A) = det(Q)·det(R); every non-trivial reflector has det −1
+    if (rows_ != cols_)
+        throw std::invalid_argument("LinearSolver::determinant: matrix must be square");
+    double d = 1.0;
+    for (size_t i = 0; i < rows_; ++i) {
+        d *= QR_(i, i);
+        if (tau_[i] != 0.0) d = -d;
+    }
+    return d;
 }
 
 // ── rank ──────────────────────────────────────────────────────────────────────
 
 size_t LinearSolver::rank(double tol) const {
     // Use QR with column pivoting (already computed if method==QR, else redo)
+    DynamicMatrix A;
+    if (method_ == Method::QR) {
+        A = DynamicMatrix(rows_, cols_, 0.0);           // A = Q·R
+        for (size_t i = 0; i < std::min(rows_, cols_); ++i)
+            std::copy(QR_.row_ptr(i) + i, QR_.row_ptr(i) + cols_, A.row_ptr(i) + i);
+        apply_q(A, /*transpose=*/false);
+    }
     auto [Q2, R2, piv2] = ::SharedMath::LinearAlgebra::qrp(
         (method_ == Method::LU       ? LU_          :
-         method_ == Method::QR       ? Q_ * R_      :
+         method_ == Method::QR       ? A            :
          /* Cholesky */                L_ * L_.transposed()));
     if (tol < 0)
         tol = std::max(rows_, cols_) * std::abs(R2(0, 0)) * 2.2e-16;
@@ -0,0 +1,118 @@
+// MatrixBatch.cpp — small matrices applied to structure-of-arrays point sets.
+//
+// Every entry point reduces to one kernel template over the dimension D and
+// an Affine flag: the coefficients are copied into a flat row-major
+// D × (D + Affine) block (the translation column last), then
+//
+//   out_i[p] = Σ_j m[i][j] · in_j[p]  (+ m[i][D] when affine)
+//
+// The AVX2 kernel broadcasts each coefficient once and handles four points
+// per iteration with FMAs; the remainder (and non-AVX2 hosts) go through
+// the scalar loop.  Both load all D coordinates of a point before storing,
+// which is what makes in-place transforms safe.
+
+#include "LinearAlgebra/MatrixBatch.h"
+
+#include "core/CpuFeatures.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SM_BATCH_X86 1
+#  define SM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#  include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define SM_BATCH_X86 1
+#  define SM_TARGET_AVX2
+#  include <immintrin.h>
+#endif
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+template<size_t D, bool Affine>
+constexpr size_t kWidth = D + (Affine ? 1 : 0);
+
+template<size_t D, bool Affine, size_t R, size_t C>
+std::array<double, D * kWidth<D, Affine>> coefficients(const Matrix<R, C>& M) {
+    std::array<double, D * kWidth<D, Affine>> m{};
+    for (size_t i = 0; i < D; ++i)
+        for (size_t j = 0; j < kWidth<D, Affine>; ++j)
+            m[i * kWidth<D, Affine> + j] = M.at_unsafe(i, j);
+    return m;
+}
+
+template<size_t D, bool Affine>
+void batchScalar(const double* m, const double* const* in, double* const* out,
+                 size_t begin, size_t n) {
+    constexpr size_t W = kWidth<D, Affine>;
+    for (size_t p = begin; p < n; ++p) {
+        double x[D];
+        for (size_t j = 0; j < D; ++j) x[j] = in[j][p];
+        for (size_t i = 0; i < D; ++i) {
+            double s = Affine ? m[i * W + D] : 0.0;
+            for (size_t j = 0; j < D; ++j) s += m[i * W + j] * x[j];
+            out[i][p] = s;
+        }
+    }
+}
+
+#ifdef SM_BATCH_X86
+template<size_t D, bool Affine>
+SM_TARGET_AVX2 void batchAvx2(const double* m, const double* const* in,
+                              double* const* out, size_t n) {
+    constexpr size_t W = kWidth<D, Affine>;
+    __m256d coef[D * W];
+    for (size_t k = 0; k < D * W; ++k) coef[k] = _mm256_broadcast_sd(m + k);
+
+    size_t p = 0;
+    for (; p + 4 <= n; p += 4) {
+        __m256d x[D];
+        for (size_t j = 0; j < D; ++j) x[j] = _mm256_loadu_pd(in[j] + p);
+        for (size_t i = 0; i < D; ++i) {
+            const __m256d* row = coef + i * W;
+            __m256d acc = Affine ? _mm256_fmadd_pd(row[0], x[0], row[D])
+                                 : _mm256_mul_pd(row[0], x[0]);
+            for (size_t j = 1; j < D; ++j) acc = _mm256_fmadd_pd(row[j], x[j], acc);
+            _mm256_storeu_pd(out[i] + p, acc);
+        }
+    }
+    batchScalar<D, Affine>(m, in, out, p, n);
+}
+#endif
+
+template<size_t D, bool Affine, size_t R, size_t C>
+void runBatch(const Matrix<R, C>& M, const PointsIn<D>& in, const PointsOut<D>& out, size_t n) {
+    if (n == 0) return;
+    const auto m = coefficients<D, Affine>(M);
+#ifdef SM_BATCH_X86
+    if (Core::simdLevel() != Core::SimdLevel::Scalar) {
+        batchAvx2<D, Affine>(m.data(), in.data(), out.data(), n);
+        return;
+    }
+#endif
+    batchScalar<D, Affine>(m.data(), in.data(), out.data(), 0, n);
+}
+
+} // namespace
+
+void applyBatch(const Matrix<2, 2>& A, const PointsIn<2>& in, const PointsOut<2>& out, size_t n) {
+    runBatch<2, false>(A, in, out, n);
+}
+void applyBatch(const Matrix<3, 3>& A, const PointsIn<3>& in, const PointsOut<3>& out, size_t n) {
+    runBatch<3, false>(A, in, out, n);
+}
+void applyBatch(const Matrix<4, 4>& A, const PointsIn<4>& in, const PointsOut<4>& out, size_t n) {
+    runBatch<4, false>(A, in, out, n);
+}
+void applyBatch(const Matrix<6, 6>& A, const PointsIn<6>& in, const PointsOut<6>& out, size_t n) {
+    runBatch<6, false>(A, in, out, n);
+}
+
+void transformPointsBatch(const Matrix<3, 3>& T, const PointsIn<2>& in, const PointsOut<2>& out, size_t n) {
+    runBatch<2, true>(T, in, out, n);
+}
+void transformPointsBatch(const Matrix<4, 4>& T, const PointsIn<3>& in, const PointsOut<3>& out, size_t n) {
+    runBatch<3, true>(T, in, out, n);
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -1,14 +1,16 @@
 #include "MatrixFunctions.h"
+#include "Gemm.h"
+#include "Randomized.h"
 
 #include <cmath>
 #include <stdexcept>
 #include <numeric>
 #include <algorithm>
 #include <limits>
-#include <map>
 #include <string>
 #include <sstream>
 #include <random>
+#include <utility>
 
 namespace SharedMath::LinearAlgebra {
 
@@ -125,9 +127,8 @@ double norm(const AbstractMatrix& A, NormType type) {
     }
     case NormType::Nuclear: {
         // Nuclear norm = sum of singular values
-        auto [U, S, Vt] = svd(A);
         double s = 0.0;
-        for (double sv : S) s += sv;
+        for (double sv : svdvals(A)) s += sv;
         return s;
     }
     case NormType::Two: {
@@ -285,152 +286,65 @@ std::pair<DynamicMatrix, DynamicMatrix> qr(const AbstractMatrix& A) {
 }
 
 // ─── Cholesky decomposition ───────────────────────────────────────────────────
-
-DynamicMatrix cholesky(const AbstractMatrix& A) {
-    size_t n = A.rows();
-    if (A.cols() != n)
-        throw std::invalid_argument("cholesky: requires square matrix");
-
-    DynamicMatrix L(n, n);
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j <= i; ++j) {
-            double s = A.get(i, j);
-            for (size_t k = 0; k < j; ++k)
-                s -= L.get(i, k) * L.get(j, k);
-            if (i == j) {
-                if (s < 1e-14)
-                    throw std::runtime_error(
-                        "cholesky: matrix is not positive definite");
-                L.set(i, j, std::sqrt(s));
-            } else {
-                L.set(i, j, s / L.get(j, j));
-            }
+// Left-looking and blocked: before block column K is factorised it receives
+// the updates of all columns to its left in two GEMMs, then its diagonal
+// block is factorised directly and the panel below is solved with TRSM.
+// Only the lower triangle of A is read.
+
+namespace {
+
+constexpr size_t kCholeskyBlock = 96;
+
+// Unblocked Cholesky of the nb×nb block at L(k0, k0), in place.
+void choleskyDiagBlock(double* L, size_t ld, size_t nb) {
+    for (size_t j = 0; j < nb; ++j) {
+        double* Lj = L + j * ld;
+        double d = Lj[j];
+        for (size_t k = 0; k < j; ++k) d -= Lj[k] * Lj[k];
+        if (d < 1e-14)
+            throw std::runtime_error("cholesky: matrix is not positive definite");
+        d = std::sqrt(d);
+        Lj[j] = d;
+        for (size_t i = j + 1; i < nb; ++i) {
+            double* Li = L + i * ld;
+            double s = Li[j];
+            for (size_t k = 0; k < j; ++k) s -= Li[k] * Lj[k];
+            Li[j] = s / d;
         }
     }
-    return L;
 }
 
-// ─── Eigenvalues / eigenvectors (real symmetric, QR iteration) ────────────────
+} // namespace
 
-std::pair<std::vector<double>, DynamicMatrix>
-eig(const AbstractMatrix& A, size_t max_iter)
-{
-    if (A.rows() != A.cols())
-        throw std::invalid_argument("eig: requires square matrix");
+DynamicMatrix cholesky(const AbstractMatrix& A) {
     size_t n = A.rows();
+    if (A.cols() != n)
+        throw std::invalid_argument("cholesky: requires square matrix");
 
-    DynamicMatrix Ak = toDynamic(A);
-
-    // V accumulates the product of all Q factors: eigenvector matrix
-    DynamicMatrix V = eye(n);
-
-    for (size_t iter = 0; iter < max_iter; ++iter) {
-        // ① Check convergence BEFORE touching the matrix.
-        //   This avoids computing the Wilkinson shift when Ak is already
-        //   diagonal (e.g. identity), which would produce 0/0 = NaN.
-        {
-            double off = 0.0;
-            for (size_t i = 0; i < n; ++i)
-                for (size_t j = 0; j < n; ++j)
-                    if (i != j) off += Ak(i, j) * Ak(i, j);
-            if (std::sqrt(off) < 1e-10 * static_cast<double>(n)) break;
-        }
-
-        // ② Wilkinson shift from the bottom-right 2×2 submatrix.
-        //    Guard: when the sub-diagonal entry b ≈ 0 the last eigenvalue has
-        //    already separated; use Ak(n-1,n-1) as shift to avoid 0/0 = NaN.
-        double shift = 0.0;
-        if (n >= 2) {
-            double b = Ak(n-1, n-2);
-            if (std::abs(b) < 1e-14) {
-                shift = Ak(n-1, n-1);
-            } else {
-                double d  = (Ak(n-2, n-2) - Ak(n-1, n-1)) / 2.0;
-                double sq = std::sqrt(d * d + b * b);
-                shift = Ak(n-1, n-1) - (b * b) / (d + (d >= 0.0 ? sq : -sq));
-            }
+    DynamicMatrix L = toDynamic(A);
+    double* a = L.toPtr();
+    for (size_t k0 = 0; k0 < n; k0 += kCholeskyBlock) {
+        const size_t nb = std::min(kCholeskyBlock, n - k0);
+        const size_t k1 = k0 + nb;
+        if (k0 > 0) {
+            // A[K:n, K] -= L[K:n, 0:K] · L[K, 0:K]ᵀ   (diagonal block + panel)
+            gemm(Transpose::No, Transpose::Yes, n - k0, nb, k0, -1.0,
+                 a + k0 * n, n, a + k0 * n, n, 1.0, a + k0 * n + k0, n);
         }
-
-        // ③ A_shifted = Ak − shift·I
-        for (size_t i = 0; i < n; ++i)
-            Ak(i, i) -= shift;
-
-        auto [Q, R] = qr(Ak);
-
-        // ④ Ak = R·Q + shift·I
-        Ak = R * Q;
-        for (size_t i = 0; i < n; ++i)
-            Ak(i, i) += shift;
-
-        // ⑤ Accumulate eigenvectors: V = V·Q
-        V = V * Q;
+        choleskyDiagBlock(a + k0 * n + k0, n, nb);
+        if (k1 < n)
+            trsm(Side::Right, Triangle::Lower, Transpose::Yes, Diagonal::NonUnit,
+                 n - k1, nb, 1.0, a + k0 * n + k0, n, a + k1 * n + k0, n);
     }
-
-    // Extract and sort eigenvalues descending
-    std::vector<size_t> order(n);
-    std::iota(order.begin(), order.end(), 0);
-    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
-        return Ak.get(a, a) > Ak.get(b, b);
-    });
-
-    std::vector<double> evals(n);
-    DynamicMatrix evecs(n, n);
-    for (size_t i = 0; i < n; ++i) {
-        evals[i] = Ak.get(order[i], order[i]);
-        for (size_t row = 0; row < n; ++row)
-            evecs.set(row, i, V.get(row, order[i]));
-    }
-    return {evals, evecs};
-}
-
-std::vector<double> eigvals(const AbstractMatrix& A, size_t max_iter) {
-    return eig(A, max_iter).first;
+    for (size_t i = 0; i < n; ++i)
+        std::fill(a + i * n + i + 1, a + (i + 1) * n, 0.0);
+    return L;
 }
 
-// ─── Thin SVD ─────────────────────────────────────────────────────────────────
-// Uses eigendecomposition of A^T * A to obtain right singular vectors V
-// and computes U = A * V * diag(1/sigma) for nonzero singular values.
-
-std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
-svd(const AbstractMatrix& A, size_t max_iter)
-{
-    size_t m = A.rows(), n = A.cols();
-    size_t k = std::min(m, n);
-
-    // B = A^T * A  (n×n symmetric PSD)
-    DynamicMatrix At = transposeMatrix(A);
-    DynamicMatrix B  = At * toDynamic(A);
-
-    // Eigendecompose B: B = V * D * V^T
-    auto [evals, V] = eig(B, max_iter);
-
-    // Singular values σ_i = sqrt(max(λ_i, 0)), keep first k
-    std::vector<double> S(k);
-    for (size_t i = 0; i < k; ++i)
-        S[i] = (i < evals.size() && evals[i] > 0.0)
-               ? std::sqrt(evals[i]) : 0.0;
-
-    // V^T: first k rows of V^T  (k×n)
-    DynamicMatrix Vt(k, n);
-    for (size_t i = 0; i < k; ++i)
-        for (size_t j = 0; j < n; ++j)
-            Vt.set(i, j, V.get(j, i));
-
-    // U: left singular vectors (m×k), u_i = A * v_i / σ_i
-    DynamicMatrix Ad  = toDynamic(A);
-    DynamicMatrix U(m, k);
-    for (size_t i = 0; i < k; ++i) {
-        if (S[i] < 1e-12) continue;   // zero singular value: leave col as 0
-        for (size_t row = 0; row < m; ++row) {
-            double val = 0.0;
-            for (size_t j = 0; j < n; ++j)
-                val += Ad.get(row, j) * V.get(j, i);
-            U.set(row, i, val / S[i]);
-        }
-    }
+// ─── Eigenvalues / eigenvectors ───────────────────────────────────────────────
+// eig, eigvals and eigs live in SymmetricEigen.cpp.
 
-    return {U, S, Vt};
-}
+// svd and svdvals live in SVD.cpp.
 
 // ─── pseudoinverse ────────────────────────────────────────────────────────────
 
@@ -445,16 +359,18 @@ DynamicMatrix pinv(const AbstractMatrix& A, double tol) {
               static_cast<double>(std::max(m, n)) * max_s;
     }
 
-    // Pinv = V * diag(1/S) * U^T   (n×m)
+    // Pinv = V * diag(1/S) * U^T   (n×m): scale the kept rows of Vt, one GEMM
+    size_t r = 0;
+    while (r < k && S[r] >= tol) ++r;
     DynamicMatrix result(n, m);
-    for (size_t i = 0; i < k; ++i) {
-        if (S[i] < tol) continue;
-        double inv_s = 1.0 / S[i];
-        // result += (v_i / σ_i) * u_i^T
-        for (size_t r = 0; r < n; ++r)
-            for (size_t c = 0; c < m; ++c)
-                result.set(r, c, result.get(r, c) + Vt.get(i, r) * U.get(c, i) * inv_s);
+    if (r == 0) return result;
+    for (size_t i = 0; i < r; ++i) {
+        const double inv_s = 1.0 / S[i];
+        double* row = Vt.row_ptr(i);
+        for (size_t j = 0; j < n; ++j) row[j] *= inv_s;
     }
+    gemm(Transpose::Yes, Transpose::Yes, n, m, r, 1.0, Vt.toPtr(), n,
+         U.toPtr(), k, 0.0, result.toPtr(), m);
     return result;
 }
 
@@ -531,201 +447,7 @@ std::vector<double> cross(const std::vector<double>& u,
     };
 }
 
-// ─── tensordot ────────────────────────────────────────────────────────────────
-
-Tensor tensordot(const Tensor& a, const Tensor& b,
-                 const std::vector<size_t>& axes_a,
-                 const std::vector<size_t>& axes_b)
-{
-    if (axes_a.size() != axes_b.size())
-        throw std::invalid_argument("tensordot: axes vectors must have the same length");
-
-    for (size_t i = 0; i < axes_a.size(); ++i)
-        if (a.dim(axes_a[i]) != b.dim(axes_b[i]))
-            throw std::invalid_argument("tensordot: contracted dimensions must match");
-
-    // Collect free axes
-    std::vector<size_t> free_a, free_b;
-    for (size_t i = 0; i < a.ndim(); ++i) {
-        if (std::find(axes_a.begin(), axes_a.end(), i) == axes_a.end())
-            free_a.push_back(i);
-    }
-    for (size_t i = 0; i < b.ndim(); ++i) {
-        if (std::find(axes_b.begin(), axes_b.end(), i) == axes_b.end())
-            free_b.push_back(i);
-    }
-
-    // Result shape: free dims of a followed by free dims of b
-    Tensor::Shape rshape;
-    for (size_t i : free_a) rshape.push_back(a.dim(i));
-    for (size_t i : free_b) rshape.push_back(b.dim(i));
-    if (rshape.empty()) rshape.push_back(1);
-
-    Tensor result(rshape, 0.0);
-
-    // Contracted-index shape and strides
-    Tensor::Shape c_shape;
-    for (size_t ax : axes_a) c_shape.push_back(a.dim(ax));
-    size_t c_size = 1;
-    for (size_t d : c_shape) c_size *= d;
-
-    std::vector<size_t> c_strides(c_shape.size(), 1);
-    if (!c_shape.empty())
-        for (int s = static_cast<int>(c_shape.size()) - 2; s >= 0; --s)
-            c_strides[s] = c_strides[s + 1] * c_shape[s + 1];
-
-    // Iterate over result elements
-    for (size_t flat_r = 0; flat_r < result.size(); ++flat_r) {
-        auto ridx = result.unravel(flat_r);
-
-        // Map ridx → free indices for a and b
-        std::vector<size_t> fa(a.ndim(), 0), fb(b.ndim(), 0);
-        for (size_t i = 0; i < free_a.size(); ++i) fa[free_a[i]] = ridx[i];
-        for (size_t i = 0; i < free_b.size(); ++i) fb[free_b[i]] = ridx[free_a.size() + i];
-
-        // Sum over contracted indices
-        double acc = 0.0;
-        for (size_t flat_c = 0; flat_c < c_size; ++flat_c) {
-            size_t tmp = flat_c;
-            for (size_t k = 0; k < c_shape.size(); ++k) {
-                size_t ci = tmp / c_strides[k];
-                tmp       %= c_strides[k];
-                fa[axes_a[k]] = ci;
-                fb[axes_b[k]] = ci;
-            }
-            acc += a.at(fa) * b.at(fb);
-        }
-        result.flat(flat_r) = acc;
-    }
-    return result;
-}
-
-// ─── einsum ──────────────────────────────────────────────────────────────────
-
-// Parse "lhs->rhs" subscript string.
-static std::pair<std::string, std::string>
-parseEinsum(const std::string& s, size_t expected_commas)
-{
-    auto arrow = s.find("->");
-    if (arrow == std::string::npos)
-        throw std::invalid_argument("einsum: subscripts must contain '->'");
-    std::string lhs = s.substr(0, arrow);
-    std::string rhs = s.substr(arrow + 2);
-    size_t commas = std::count(lhs.begin(), lhs.end(), ',');
-    if (commas != expected_commas)
-        throw std::invalid_argument("einsum: wrong number of operands in subscripts");
-    return {lhs, rhs};
-}
-
-Tensor einsum(const std::string& subscripts, const Tensor& a) {
-    auto [lhs, out] = parseEinsum(subscripts, 0);
-    if (lhs.size() != a.ndim())
-        throw std::invalid_argument("einsum: subscript rank mismatch");
-
-    std::map<char, size_t> sizes;
-    for (size_t i = 0; i < lhs.size(); ++i) sizes[lhs[i]] = a.dim(i);
-
-    Tensor::Shape out_shape;
-    for (char c : out) out_shape.push_back(sizes.at(c));
-    if (out_shape.empty()) out_shape.push_back(1);
-
-    // Contracted indices: in lhs but not in out
-    std::string contracted;
-    for (char c : lhs)
-        if (out.find(c) == std::string::npos && contracted.find(c) == std::string::npos)
-            contracted += c;
-
-    Tensor::Shape c_shape;
-    for (char c : contracted) c_shape.push_back(sizes.at(c));
-    size_t c_size = 1;
-    for (size_t d : c_shape) c_size *= d;
-    std::vector<size_t> c_strides(c_shape.size(), 1);
-    if (!c_shape.empty())
-        for (int i = static_cast<int>(c_shape.size()) - 2; i >= 0; --i)
-            c_strides[i] = c_strides[i + 1] * c_shape[i + 1];
-
-    Tensor result(out_shape, 0.0);
-    for (size_t flat_r = 0; flat_r < result.size(); ++flat_r) {
-        // Decode output multi-index
-        auto ridx = result.unravel(flat_r);
-        std::map<char, size_t> idx_map;
-        for (size_t k = 0; k < out.size(); ++k) idx_map[out[k]] = ridx[k];
-
-        double acc = 0.0;
-        for (size_t flat_c = 0; flat_c < (c_size == 0 ? 1 : c_size); ++flat_c) {
-            size_t tmp = flat_c;
-            for (size_t k = 0; k < contracted.size(); ++k) {
-                idx_map[contracted[k]] = tmp / c_strides[k];
-                tmp %= c_strides[k];
-            }
-            std::vector<size_t> a_idx(lhs.size());
-            for (size_t k = 0; k < lhs.size(); ++k) a_idx[k] = idx_map.at(lhs[k]);
-            acc += a.at(a_idx);
-        }
-        result.flat(flat_r) = acc;
-    }
-    return result;
-}
-
-Tensor einsum(const std::string& subscripts, const Tensor& a, const Tensor& b) {
-    auto [lhs_all, out] = parseEinsum(subscripts, 1);
-    auto comma = lhs_all.find(',');
-    std::string lhs_a = lhs_all.substr(0, comma);
-    std::string lhs_b = lhs_all.substr(comma + 1);
-
-    if (lhs_a.size() != a.ndim() || lhs_b.size() != b.ndim())
-        throw std::invalid_argument("einsum: subscript rank mismatch");
-
-    std::map<char, size_t> sizes;
-    for (size_t i = 0; i < lhs_a.size(); ++i) sizes[lhs_a[i]] = a.dim(i);
-    for (size_t i = 0; i < lhs_b.size(); ++i) {
-        char c = lhs_b[i];
-        if (sizes.count(c) && sizes[c] != b.dim(i))
-            throw std::invalid_argument("einsum: index size mismatch");
-        sizes[c] = b.dim(i);
-    }
-
-    Tensor::Shape out_shape;
-    for (char c : out) out_shape.push_back(sizes.at(c));
-    if (out_shape.empty()) out_shape.push_back(1);
-
-    // Contracted indices: in lhs_a or lhs_b but not in out
-    std::string contracted;
-    for (char c : lhs_a + lhs_b)
-        if (out.find(c) == std::string::npos && contracted.find(c) == std::string::npos)
-            contracted += c;
-
-    Tensor::Shape c_shape;
-    for (char c : contracted) c_shape.push_back(sizes.at(c));
-    size_t c_size = 1;
-    for (size_t d : c_shape) c_size *= d;
-    std::vector<size_t> c_strides(c_shape.size(), 1);
-    if (!c_shape.empty())
-        for (int i = static_cast<int>(c_shape.size()) - 2; i >= 0; --i)
-            c_strides[i] = c_strides[i + 1] * c_shape[i + 1];
-
-    Tensor result(out_shape, 0.0);
-    for (size_t flat_r = 0; flat_r < result.size(); ++flat_r) {
-        auto ridx = result.unravel(flat_r);
-        std::map<char, size_t> idx_map;
-        for (size_t k = 0; k < out.size(); ++k) idx_map[out[k]] = ridx[k];
-
-        double acc = 0.0;
-        for (size_t flat_c = 0; flat_c < (c_size == 0 ? 1 : c_size); ++flat_c) {
-            size_t tmp = flat_c;
-            for (size_t k = 0; k < contracted.size(); ++k) {
-                idx_map[contracted[k]] = tmp / c_strides[k];
-                tmp %= c_strides[k];
-            }
-            std::vector<size_t> ai(lhs_a.size()), bi(lhs_b.size());
-            for (size_t k = 0; k < lhs_a.size(); ++k) ai[k] = idx_map.at(lhs_a[k]);
-            for (size_t k = 0; k < lhs_b.size(); ++k) bi[k] = idx_map.at(lhs_b[k]);
-            acc += a.at(ai) * b.at(bi);
-        }
-        result.flat(flat_r) = acc;
-    }
-    return result;
-}
+// tensordot and einsum live in Einsum.cpp.
 
 // ─── det ─────────────────────────────────────────────────────────────────────
 
@@ -750,7 +472,7 @@ double trace(const AbstractMatrix& A) {
 // ─── cond ─────────────────────────────────────────────────────────────────────
 
 double cond(const AbstractMatrix& A, double tol) {
-    auto [U, S, Vt] = svd(A);
+    const std::vector<double> S = svdvals(A);
     if (S.empty() || S[0] < 1e-14)
         return std::numeric_limits<double>::infinity();
     double s_min = S.back();
@@ -826,27 +548,26 @@ DynamicMatrix expm(const AbstractMatrix& A) {
         for (size_t j = 0; j < n; ++j)
             As.set(i, j, Ad.get(i, j) * scale);
 
-    // Taylor series: term_k = term_{k-1} * As / k, result += term_k
+    // Taylor series: term_k = term_{k-1} * As / k, result += term_k.
+    // The products ping-pong between two buffers, so the loop allocates
+    // nothing after the first step.
     DynamicMatrix result = eye(n);
     DynamicMatrix term   = eye(n);
+    DynamicMatrix next;
     for (size_t k = 1; k <= 30; ++k) {
-        term = term * As;
-        double inv_k = 1.0 / static_cast<double>(k);
-        for (size_t i = 0; i < n; ++i)
-            for (size_t j = 0; j < n; ++j)
-                term.set(i, j, term.get(i, j) * inv_k);
-
-        for (size_t i = 0; i < n; ++i)
-            for (size_t j = 0; j < n; ++j)
-                result.set(i, j, result.get(i, j) + term.get(i, j));
+        matmul_into(next, term, As, 1.0 / static_cast<double>(k));
+        std::swap(term, next);
+        result += term;
 
         double res_nrm = norm(result, NormType::One);
         if (norm(term, NormType::One) < 1e-15 * res_nrm) break;
     }
 
     // Square back 2^s times
-    for (int i = 0; i < s; ++i)
-        result = result * result;
+    for (int i = 0; i < s; ++i) {
+        matmul_into(next, result, result);
+        std::swap(result, next);
+    }
 
     return result;
 }
@@ -1025,13 +746,10 @@ schur(const AbstractMatrix& A, size_t max_iter)
 }
 
 // ─── rsvd ─────────────────────────────────────────────────────────────────────
-// Randomized SVD (Halko–Martinsson–Tropp 2011, Algorithm 4.3 + 4.4)
-// Step 1: form a random sketch  Y = A * Omega  (m × l, l = k + oversampling)
-// Step 2: power iteration       Y = (A * A^T)^q * Y
-// Step 3: orthonormalise        Q = orth(Y)
-// Step 4: project               B = Q^T * A          (l × n)
-// Step 5: thin SVD of B         B = Ub * S * Vt
-// Step 6: recover left vectors  U = Q * Ub           (m × l)
+// Randomized SVD (Halko–Martinsson–Tropp 2011).  Thin wrapper over
+// randomizedSVD (Randomized.h): A is applied through its LinearOperator, so
+// dense input goes through GEMM without a copy and the sketch is
+// re-orthonormalized between power iterations.
 
 std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
 rsvd(const AbstractMatrix& A_abs,
@@ -1043,59 +761,8 @@ rsvd(const AbstractMatrix& A_abs,
     if (k == 0 || k > std::min(m, n))
         throw std::invalid_argument("rsvd: k must be in [1, min(m,n)]");
 
-    DynamicMatrix A = toDynamic(A_abs);
-    size_t l = std::min(k + n_oversampling, std::min(m, n));
-
-    // --- Step 1: random Gaussian test matrix Omega (n × l)
-    std::mt19937_64 rng(20240101ULL);
-    std::normal_distribution<double> nd(0.0, 1.0);
-    DynamicMatrix Omega(n, l);
-    for (size_t i = 0; i < n; ++i)
-        for (size_t j = 0; j < l; ++j)
-            Omega(i, j) = nd(rng);
-
-    // Y = A * Omega  (m × l)
-    DynamicMatrix Y = A * Omega;
-
-    // --- Step 2: power iteration  Y = (A A^T)^q Y
-    DynamicMatrix At = A.transposed();   // n × m
-    for (size_t iter = 0; iter < n_power_iter; ++iter) {
-        // Y = A * (A^T * Y)
-        DynamicMatrix Z = At * Y;   // n × l
-        Y = A * Z;                  // m × l
-    }
-
-    // --- Step 3: orthonormalise Y via QR
-    auto [Q_big, R_big] = qr(Y);   // Q_big: m × m
-    // Keep only first l columns
-    DynamicMatrix Q(m, l);
-    for (size_t i = 0; i < m; ++i)
-        for (size_t j = 0; j < l; ++j)
-            Q(i, j) = Q_big(i, j);
-
-    // --- Step 4: B = Q^T * A  (l × n)
-    DynamicMatrix Qt = Q.transposed();  // l × m
-    DynamicMatrix B  = Qt * A;          // l × n
-
-    // --- Step 5: thin SVD of B
-    auto [Ub, S_full, Vt] = svd(B);    // Ub: l×l, S_full: l, Vt: l×n
-
-    // --- Step 6: U = Q * Ub  (m × l), keep first k
-    DynamicMatrix Ub_k(l, k);
-    for (size_t i = 0; i < l; ++i)
-        for (size_t j = 0; j < k; ++j)
-            Ub_k(i, j) = Ub(i, j);
-
-    DynamicMatrix U = Q * Ub_k;  // m × k
-
-    std::vector<double> S(S_full.begin(), S_full.begin() + k);
-
-    DynamicMatrix Vt_k(k, n);
-    for (size_t i = 0; i < k; ++i)
-        for (size_t j = 0; j < n; ++j)
-            Vt_k(i, j) = Vt(i, j);
-
-    return {U, S, Vt_k};
+    LowRankSVD f = randomizedSVD(A_abs, k, {n_oversampling, n_power_iter, 20240101});
+    return {std::move(f.U), std::move(f.S), std::move(f.Vt)};
 }
 
 // ─── Structured matrix generators ────────────────────────────────────────────
@@ -1,5 +1,8 @@
 #include "LinearAlgebra/PCA.h"
 #include "LinearAlgebra/MatrixFunctions.h"
+#include "LinearAlgebra/Gemm.h"
+#include "LinearAlgebra/LinearOperator.h"
+#include "LinearAlgebra/Randomized.h"
 
 #include <cmath>
 #include <numeric>
@@ -8,6 +11,59 @@
 
 namespace SharedMath::LinearAlgebra {
 
+namespace {
+
+// Xc = X − 1·μᵀ applied without forming it:
+//   Xc·V  = X·V  − 1·(μᵀV)      Xcᵀ·U = Xᵀ·U − μ·(1ᵀU)
+class CentredOperator final : public LinearOperator {
+public:
+    CentredOperator(const DynamicMatrix& X, const DynamicVector& mean)
+        : X_(X), mean_(mean) {}
+
+    size_t rows() const noexcept override { return X_.rows(); }
+    size_t cols() const noexcept override { return X_.cols(); }
+    bool hasTranspose() const noexcept override { return true; }
+
+    void apply(const std::vector<double>& x, std::vector<double>& y) const override {
+        DynamicMatrix X(x.size(), 1, x), Y;
+        applyBlock(X, Y);
+        y = Y.data();
+    }
+    void applyTranspose(const std::vector<double>& x, std::vector<double>& y) const override {
+        DynamicMatrix X(x.size(), 1, x), Y;
+        applyTransposeBlock(X, Y);
+        y = Y.data();
+    }
+
+    void applyBlock(const DynamicMatrix& V, DynamicMatrix& Y) const override {
+        const size_t n = X_.rows(), p = X_.cols(), k = V.cols();
+        matmul_into(Y, X_, V);
+        std::vector<double> muV(k, 0.0);
+        for (size_t j = 0; j < p; ++j)
+            for (size_t c = 0; c < k; ++c) muV[c] += mean_[j] * V(j, c);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < k; ++c) Y(i, c) -= muV[c];
+    }
+
+    void applyTransposeBlock(const DynamicMatrix& U, DynamicMatrix& Y) const override {
+        const size_t n = X_.rows(), p = X_.cols(), k = U.cols();
+        Y = DynamicMatrix(p, k);
+        gemm(Transpose::Yes, Transpose::No, p, k, n, 1.0, X_.data().data(), p,
+             U.data().data(), k, 0.0, Y.data().data(), k);
+        std::vector<double> colSum(k, 0.0);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < k; ++c) colSum[c] += U(i, c);
+        for (size_t j = 0; j < p; ++j)
+            for (size_t c = 0; c < k; ++c) Y(j, c) -= mean_[j] * colSum[c];
+    }
+
+private:
+    const DynamicMatrix& X_;
+    const DynamicVector& mean_;
+};
+
+} // namespace
+
 PCA::PCA(size_t n_components, bool whiten, bool use_randomized)
     : n_components_req_(n_components)
     , whiten_(whiten)
@@ -29,45 +85,70 @@ PCA& PCA::fit(const DynamicMatrix& X) {
             mean_[j] += X(i, j);
     for (size_t j = 0; j < p; ++j) mean_[j] /= static_cast<double>(n);
 
-    DynamicMatrix Xc(n, p);
-    for (size_t i = 0; i < n; ++i)
-        for (size_t j = 0; j < p; ++j)
-            Xc(i, j) = X(i, j) - mean_[j];
-
     // 2. Determine number of components
     size_t k_max = std::min(n - 1, p);
     n_components_out_ = (n_components_req_ == 0 || n_components_req_ > k_max)
                         ? k_max : n_components_req_;
 
-    // 3. SVD of centred data (thin)
+    // 3. SVD of centred data (thin; U is not needed)
     //    Xc = U * S * Vt   (U: n×k, S: k, Vt: k×p)
-    auto [U, S, Vt] = (use_randomized_ && n_components_out_ < k_max / 2)
-        ? rsvd(Xc, n_components_out_, 10, 2)
-        : svd(Xc);
+    //    The randomized path never forms Xc: it sketches X − 1·μᵀ through
+    //    block products with X, so only O((n + p)·k) extra memory is used.
+    std::vector<double> S;
+    DynamicMatrix Vt;
+    double inv_nm1 = 1.0 / static_cast<double>(n - 1);
+    double total_var = 0.0;
+    if (use_randomized_ && n_components_out_ < k_max / 2) {
+        LowRankSVD f = randomizedSVD(CentredOperator(X, mean_), n_components_out_);
+        S  = std::move(f.S);
+        Vt = std::move(f.Vt);
+        // Total variance = ||Xc||_F² / (n-1), from one pass over X.
+        for (size_t i = 0; i < n; ++i) {
+            const double* xi = X.row_ptr(i);
+            for (size_t j = 0; j < p; ++j) {
+                const double d = xi[j] - mean_[j];
+                total_var += d * d;
+            }
+        }
+        total_var *= inv_nm1;
+    } else {
+        DynamicMatrix Xc(n, p);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < p; ++j)
+                Xc(i, j) = X(i, j) - mean_[j];
+        auto [U, S_full, Vt_full] = svd(Xc, SVDMode::RightOnly);
+        S  = std::move(S_full);
+        Vt = std::move(Vt_full);
+        for (double s : S) total_var += s * s * inv_nm1;
+    }
 
     // 4. Store results
     singular_values_.assign(S.begin(),
                              S.begin() + std::min(S.size(), n_components_out_));
 
     // Explained variance = S_i^2 / (n-1)
-    double inv_nm1 = 1.0 / static_cast<double>(n - 1);
-    double total_var = 0.0;
-    for (double s : S) total_var += s * s * inv_nm1;
-
     explained_variance_.resize(n_components_out_);
     explained_variance_ratio_.resize(n_components_out_);
+    double kept = 0.0;
     for (size_t i = 0; i < n_components_out_; ++i) {
         double var = (i < S.size()) ? S[i] * S[i] * inv_nm1 : 0.0;
+        kept += var;
         explained_variance_[i]       = var;
         explained_variance_ratio_[i] = (total_var > 0) ? var / total_var : 0.0;
     }
 
-    // Noise variance: average of discarded eigenvalues
+    // Noise variance: average of discarded eigenvalues.  The randomized path
+    // never sees them, but their sum is the variance left unexplained.
     double discarded = 0.0;
     size_t n_discarded = 0;
-    for (size_t i = n_components_out_; i < S.size(); ++i) {
-        discarded += S[i] * S[i] * inv_nm1;
-        ++n_discarded;
+    if (S.size() > n_components_out_) {
+        for (size_t i = n_components_out_; i < S.size(); ++i) {
+            discarded += S[i] * S[i] * inv_nm1;
+            ++n_discarded;
+        }
+    } else {
+        discarded   = std::max(0.0, total_var - kept);
+        n_discarded = k_max - n_components_out_;
     }
     noise_variance_ = (n_discarded > 0) ? discarded / n_discarded : 0.0;
 
@@ -0,0 +1,410 @@
+#include "LinearAlgebra/Preconditioner.h"
+#include "LinearAlgebra/LinearOperator.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+// Position of (i, i) in each CSR row, or kNone when it is not stored.
+std::vector<size_t> diagonalPositions(const SparseMatrix& A) {
+    const auto& rp = A.row_ptr();
+    const auto& ci = A.col_indices();
+    std::vector<size_t> pos(A.rows(), kNone);
+    for (size_t i = 0; i < A.rows(); ++i) {
+        auto first = ci.begin() + rp[i], last = ci.begin() + rp[i + 1];
+        auto it = std::lower_bound(first, last, i);
+        if (it != last && *it == i) pos[i] = static_cast<size_t>(it - ci.begin());
+    }
+    return pos;
+}
+
+std::vector<double> diagonal(const SparseMatrix& A) {
+    std::vector<double> d(A.rows(), 0.0);
+    auto pos = diagonalPositions(A);
+    for (size_t i = 0; i < d.size(); ++i)
+        if (pos[i] != kNone) d[i] = A.values()[pos[i]];
+    return d;
+}
+
+void requireSquare(const AbstractMatrix& A, const char* who) {
+    if (A.rows() != A.cols())
+        throw std::invalid_argument(std::string(who) + ": matrix must be square");
+}
+
+} // namespace
+
+// ── Identity ──────────────────────────────────────────────────────────────────
+
+void IdentityPreconditioner::apply(const std::vector<double>& r,
+                                   std::vector<double>& z) const {
+    std::copy(r.begin(), r.end(), z.begin());
+}
+
+// ── Jacobi ────────────────────────────────────────────────────────────────────
+
+JacobiPreconditioner::JacobiPreconditioner(const AbstractMatrix& A) {
+    requireSquare(A, "JacobiPreconditioner");
+    const size_t n = A.rows();
+    if (const auto* S = dynamic_cast<const SparseMatrix*>(&A)) {
+        inv_diag_ = diagonal(*S);
+    } else {
+        inv_diag_.resize(n);
+        for (size_t i = 0; i < n; ++i) inv_diag_[i] = A.get(i, i);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (inv_diag_[i] == 0.0)
+            throw std::invalid_argument(
+                "JacobiPreconditioner: zero diagonal entry in row " + std::to_string(i));
+        inv_diag_[i] = 1.0 / inv_diag_[i];
+    }
+}
+
+void JacobiPreconditioner::apply(const std::vector<double>& r,
+                                 std::vector<double>& z) const {
+    Core::parallel_for(0, inv_diag_.size(), 8192, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) z[i] = inv_diag_[i] * r[i];
+    });
+}
+
+// ── ILU(0) ────────────────────────────────────────────────────────────────────
+// IKJ variant (Saad, "Iterative Methods for Sparse Linear Systems", Alg. 10.4):
+// row i is eliminated against the already-factored rows k < i, and updates
+// that would land outside the pattern of A are dropped.
+
+ILU0Preconditioner::ILU0Preconditioner(const SparseMatrix& A)
+    : values_(A.values()), col_idx_(A.col_indices()), row_ptr_(A.row_ptr()),
+      diag_(diagonalPositions(A))
+{
+    requireSquare(A, "ILU0Preconditioner");
+    const size_t n = A.rows();
+    for (size_t i = 0; i < n; ++i)
+        if (diag_[i] == kNone)
+            throw std::invalid_argument(
+                "ILU0Preconditioner: missing diagonal entry in row " + std::to_string(i));
+
+    std::vector<size_t> where(n, kNone);   // column → position in the current row
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) where[col_idx_[p]] = p;
+
+        for (size_t p = row_ptr_[i]; p < diag_[i]; ++p) {
+            const size_t k = col_idx_[p];
+            const double lik = values_[p] /= values_[diag_[k]];
+            for (size_t q = diag_[k] + 1; q < row_ptr_[k + 1]; ++q) {
+                const size_t dst = where[col_idx_[q]];
+                if (dst != kNone) values_[dst] -= lik * values_[q];
+            }
+        }
+        if (values_[diag_[i]] == 0.0)
+            throw std::invalid_argument(
+                "ILU0Preconditioner: zero pivot in row " + std::to_string(i));
+
+        for (size_t p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) where[col_idx_[p]] = kNone;
+    }
+}
+
+void ILU0Preconditioner::apply(const std::vector<double>& r,
+                               std::vector<double>& z) const {
+    const size_t n = size();
+    // L·y = r   (unit lower triangular)
+    for (size_t i = 0; i < n; ++i) {
+        double s = r[i];
+        for (size_t p = row_ptr_[i]; p < diag_[i]; ++p) s -= values_[p] * z[col_idx_[p]];
+        z[i] = s;
+    }
+    // U·z = y
+    for (size_t i = n; i-- > 0; ) {
+        double s = z[i];
+        for (size_t p = diag_[i] + 1; p < row_ptr_[i + 1]; ++p) s -= values_[p] * z[col_idx_[p]];
+        z[i] = s / values_[diag_[i]];
+    }
+}
+
+// ── IC(0) ─────────────────────────────────────────────────────────────────────
+// Row-oriented (left-looking) incomplete Cholesky: L_ik for k < i needs the
+// sparse dot product of rows i and k of L over columns < k, which is a merge
+// of two sorted index lists.
+
+IC0Preconditioner::IC0Preconditioner(const SparseMatrix& A, double shift) {
+    requireSquare(A, "IC0Preconditioner");
+    const size_t n = A.rows();
+    const auto& rp  = A.row_ptr();
+    const auto& ci  = A.col_indices();
+    const auto& val = A.values();
+
+    // Lower triangle of A, including the diagonal (last in each row).
+    row_ptr_.assign(n + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        bool hasDiag = false;
+        for (size_t p = rp[i]; p < rp[i + 1] && ci[p] <= i; ++p) {
+            col_idx_.push_back(ci[p]);
+            values_.push_back(ci[p] == i ? val[p] * (1.0 + shift) : val[p]);
+            hasDiag = ci[p] == i;
+        }
+        if (!hasDiag)
+            throw std::invalid_argument(
+                "IC0Preconditioner: missing diagonal entry in row " + std::to_string(i));
+        row_ptr_[i + 1] = col_idx_.size();
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        const size_t last = row_ptr_[i + 1] - 1;   // diagonal
+        for (size_t p = row_ptr_[i]; p < last; ++p) {
+            const size_t k = col_idx_[p];
+            double s = values_[p];
+            size_t a = row_ptr_[i], b = row_ptr_[k];
+            const size_t bEnd = row_ptr_[k + 1] - 1;
+            while (a < p && b < bEnd) {
+                if      (col_idx_[a] < col_idx_[b]) ++a;
+                else if (col_idx_[a] > col_idx_[b]) ++b;
+                else s -= values_[a++] * values_[b++];
+            }
+            values_[p] = s / values_[bEnd];
+        }
+        double d = values_[last];
+        for (size_t p = row_ptr_[i]; p < last; ++p) d -= values_[p] * values_[p];
+        if (!(d > 0.0))
+            throw std::runtime_error(
+                "IC0Preconditioner: non-positive pivot in row " + std::to_string(i) +
+                " — matrix is not SPD or needs a diagonal shift");
+        values_[last] = std::sqrt(d);
+    }
+}
+
+void IC0Preconditioner::apply(const std::vector<double>& r,
+                              std::vector<double>& z) const {
+    const size_t n = size();
+    // L·y = r
+    for (size_t i = 0; i < n; ++i) {
+        const size_t last = row_ptr_[i + 1] - 1;
+        double s = r[i];
+        for (size_t p = row_ptr_[i]; p < last; ++p) s -= values_[p] * z[col_idx_[p]];
+        z[i] = s / values_[last];
+    }
+    // Lᵀ·z = y   (column sweep over the rows of L)
+    for (size_t i = n; i-- > 0; ) {
+        const size_t last = row_ptr_[i + 1] - 1;
+        z[i] /= values_[last];
+        const double zi = z[i];
+        for (size_t p = row_ptr_[i]; p < last; ++p) z[col_idx_[p]] -= values_[p] * zi;
+    }
+}
+
+// ── SSOR ──────────────────────────────────────────────────────────────────────
+
+SSORPreconditioner::SSORPreconditioner(const SparseMatrix& A, double omega)
+    : A_(A), diag_(diagonal(A)), diag_pos_(diagonalPositions(A)), omega_(omega)
+{
+    requireSquare(A, "SSORPreconditioner");
+    if (!(omega > 0.0 && omega < 2.0))
+        throw std::invalid_argument("SSORPreconditioner: omega must lie in (0, 2)");
+    for (size_t i = 0; i < diag_.size(); ++i)
+        if (diag_[i] == 0.0)
+            throw std::invalid_argument(
+                "SSORPreconditioner: zero diagonal entry in row " + std::to_string(i));
+}
+
+void SSORPreconditioner::apply(const std::vector<double>& r,
+                               std::vector<double>& z) const {
+    const auto& rp  = A_.row_ptr();
+    const auto& ci  = A_.col_indices();
+    const auto& val = A_.values();
+    const size_t n = A_.rows();
+
+    // (D + ωL)·y = r, then y ← D·y
+    for (size_t i = 0; i < n; ++i) {
+        double s = 0.0;
+        for (size_t p = rp[i]; p < rp[i + 1] && ci[p] < i; ++p) s += val[p] * z[ci[p]];
+        z[i] = (r[i] - omega_ * s) / diag_[i];
+    }
+    for (size_t i = 0; i < n; ++i) z[i] *= diag_[i];
+
+    // (D + ωU)·z = y, then scale by ω(2−ω)
+    for (size_t i = n; i-- > 0; ) {
+        double s = 0.0;
+        for (size_t p = diag_pos_[i] + 1; p < rp[i + 1]; ++p) s += val[p] * z[ci[p]];
+        z[i] = (z[i] - omega_ * s) / diag_[i];
+    }
+    const double scale = omega_ * (2.0 - omega_);
+    for (size_t i = 0; i < n; ++i) z[i] *= scale;
+}
+
+// ── Smoothed-aggregation AMG ──────────────────────────────────────────────────
+
+namespace {
+
+// Greedy aggregation on the strength graph (Vaněk, Mandel & Brezina 1996):
+//   1. a node whose strong neighbours are all free seeds a new aggregate;
+//   2. leftovers join the aggregate of a strong neighbour from step 1;
+//   3. anything still free starts an aggregate with its free neighbours.
+// Returns the aggregate index of every node and the aggregate count.
+std::vector<size_t> aggregate(const SparseMatrix& A, double theta, size_t& count) {
+    const size_t n = A.rows();
+    const auto& rp  = A.row_ptr();
+    const auto& ci  = A.col_indices();
+    const auto& val = A.values();
+    const std::vector<double> d = diagonal(A);
+
+    auto strong = [&](size_t i, size_t p) {
+        const size_t j = ci[p];
+        return j != i && std::abs(val[p]) >= theta * std::sqrt(std::abs(d[i] * d[j]));
+    };
+
+    std::vector<size_t> agg(n, kNone);
+    count = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (agg[i] != kNone) continue;
+        bool allFree = true, any = false;
+        for (size_t p = rp[i]; p < rp[i + 1] && allFree; ++p)
+            if (strong(i, p)) { any = true; allFree = agg[ci[p]] == kNone; }
+        if (!allFree || !any) continue;
+        agg[i] = count;
+        for (size_t p = rp[i]; p < rp[i + 1]; ++p)
+            if (strong(i, p)) agg[ci[p]] = count;
+        ++count;
+    }
+
+    std::vector<size_t> seeded = agg;
+    for (size_t i = 0; i < n; ++i) {
+        if (agg[i] != kNone) continue;
+        for (size_t p = rp[i]; p < rp[i + 1]; ++p)
+            if (strong(i, p) && seeded[ci[p]] != kNone) { agg[i] = seeded[ci[p]]; break; }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (agg[i] != kNone) continue;
+        agg[i] = count;
+        for (size_t p = rp[i]; p < rp[i + 1]; ++p)
+            if (strong(i, p) && agg[ci[p]] == kNone) agg[ci[p]] = count;
+        ++count;
+    }
+    return agg;
+}
+
+} // namespace
+
+AMGPreconditioner::AMGPreconditioner(const SparseMatrix& A)
+    : AMGPreconditioner(A, Options()) {}
+
+AMGPreconditioner::AMGPreconditioner(const SparseMatrix& A, const Options& opts)
+    : opts_(opts)
+{
+    requireSquare(A, "AMGPreconditioner");
+    if (A.rows() == 0)
+        throw std::invalid_argument("AMGPreconditioner: matrix is empty");
+
+    SparseMatrix cur = A;
+    for (;;) {
+        const size_t n = cur.rows();
+        std::vector<double> inv_diag = diagonal(cur);
+        for (size_t i = 0; i < n; ++i) {
+            if (inv_diag[i] == 0.0)
+                throw std::invalid_argument(
+                    "AMGPreconditioner: zero diagonal entry in row " + std::to_string(i));
+            inv_diag[i] = 1.0 / inv_diag[i];
+        }
+
+        size_t nc = 0;
+        std::vector<size_t> agg;
+        if (n > opts_.coarse_size && levels_.size() + 1 < opts_.max_levels)
+            agg = aggregate(cur, opts_.strength_threshold, nc);
+        if (nc == 0 || nc >= n) {
+            levels_.push_back({std::move(cur), SparseMatrix(0, 0), SparseMatrix(0, 0),
+                               std::move(inv_diag)});
+            break;
+        }
+
+        // Tentative prolongator: piecewise constant, columns normalised.
+        std::vector<size_t> aggSize(nc, 0);
+        for (size_t a : agg) ++aggSize[a];
+        std::vector<size_t> rows(n), cols(agg);
+        std::vector<double> vals(n);
+        for (size_t i = 0; i < n; ++i) {
+            rows[i] = i;
+            vals[i] = 1.0 / std::sqrt(static_cast<double>(aggSize[agg[i]]));
+        }
+        SparseMatrix P0 = SparseMatrix::from_triplets(n, nc, rows, cols, vals);
+
+        // Smooth it: P = P₀ − (ω/ρ)·D⁻¹A·P₀, ω = 4/3 and ρ(D⁻¹A) bounded by
+        // the largest absolute row sum of D⁻¹A (Gershgorin).
+        SparseMatrix DinvA = cur;
+        {
+            const auto& rp = DinvA.row_ptr();
+            double* v = DinvA.toPtr();
+            for (size_t i = 0; i < n; ++i)
+                for (size_t p = rp[i]; p < rp[i + 1]; ++p) v[p] *= inv_diag[i];
+        }
+        double rho = 0.0;
+        {
+            const auto& rp = DinvA.row_ptr();
+            const auto& v  = DinvA.values();
+            for (size_t i = 0; i < n; ++i) {
+                double s = 0.0;
+                for (size_t p = rp[i]; p < rp[i + 1]; ++p) s += std::abs(v[p]);
+                rho = std::max(rho, s);
+            }
+        }
+        SparseMatrix P = P0 - DinvA.matmul(P0) * ((4.0 / 3.0) / rho);
+        SparseMatrix R = P.transposed();
+        SparseMatrix coarse = R.matmul(cur.matmul(P));
+
+        levels_.push_back({std::move(cur), std::move(P), std::move(R), std::move(inv_diag)});
+        cur = std::move(coarse);
+    }
+
+    coarse_ = std::make_unique<LinearSolver>(levels_.back().A.to_dense(),
+                                             LinearSolver::Method::LU);
+}
+
+void AMGPreconditioner::smooth(const Level& L, const std::vector<double>& b,
+                               std::vector<double>& x, size_t sweeps) const {
+    const size_t n = L.A.rows();
+    const double w = opts_.jacobi_weight;
+    SparseOperator A(L.A);
+    std::vector<double> Ax(n);
+    for (size_t s = 0; s < sweeps; ++s) {
+        A.apply(x, Ax);
+        for (size_t i = 0; i < n; ++i) x[i] += w * L.inv_diag[i] * (b[i] - Ax[i]);
+    }
+}
+
+void AMGPreconditioner::cycle(size_t l, const std::vector<double>& b,
+                              std::vector<double>& x) const {
+    if (l + 1 == levels_.size()) {
+        x = coarse_->solve(b);
+        return;
+    }
+    const Level& L = levels_[l];
+    const size_t n = L.A.rows(), nc = L.P.cols();
+
+    std::fill(x.begin(), x.end(), 0.0);
+    smooth(L, b, x, opts_.pre_smooth);
+
+    // Coarse-grid correction: x += P·A_c⁻¹·R·(b − A·x)
+    std::vector<double> r(n), bc(nc), xc(nc);
+    SparseOperator(L.A).apply(x, r);
+    for (size_t i = 0; i < n; ++i) r[i] = b[i] - r[i];
+    SparseOperator(L.R).apply(r, bc);
+    cycle(l + 1, bc, xc);
+    SparseOperator(L.P).apply(xc, r);
+    for (size_t i = 0; i < n; ++i) x[i] += r[i];
+
+    smooth(L, b, x, opts_.post_smooth);
+}
+
+void AMGPreconditioner::apply(const std::vector<double>& r,
+                              std::vector<double>& z) const {
+    cycle(0, r, z);
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,292 @@
+#include "LinearAlgebra/Randomized.h"
+#include "LinearAlgebra/Gemm.h"
+#include "LinearAlgebra/LinearSolver.h"
+#include "LinearAlgebra/MatrixFunctions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+DynamicMatrix gaussian(size_t rows, size_t cols, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> nd(0.0, 1.0);
+    DynamicMatrix G(rows, cols);
+    for (double& g : G.data()) g = nd(rng);
+    return G;
+}
+
+// Orthonormal basis of the columns of Y (m×l, l ≤ m): the first l columns
+// of the Householder Q, applied to [I; 0] by the blocked reflectors.
+DynamicMatrix orth(const DynamicMatrix& Y) {
+    const size_t m = Y.rows(), l = Y.cols();
+    const LinearSolver qr = LinearSolver::qr(Y);
+    DynamicMatrix Q(m, l);
+    for (size_t j = 0; j < l; ++j) Q(j, j) = 1.0;
+    qr.apply_q(Q, /*transpose=*/false);
+    return Q;
+}
+
+// C = Aᵀ·B for row-major A (r×m) and B (r×n).
+DynamicMatrix transposeTimes(const DynamicMatrix& A, const DynamicMatrix& B) {
+    DynamicMatrix C(A.cols(), B.cols());
+    gemm(Transpose::Yes, Transpose::No, A.cols(), B.cols(), A.rows(), 1.0,
+         A.data().data(), A.cols(), B.data().data(), B.cols(), 0.0,
+         C.data().data(), C.cols());
+    return C;
+}
+
+// Leading k columns of M.
+DynamicMatrix leadingColumns(const DynamicMatrix& M, size_t k) {
+    if (k == M.cols()) return M;
+    DynamicMatrix R(M.rows(), k);
+    for (size_t i = 0; i < M.rows(); ++i)
+        std::copy(M.row_ptr(i), M.row_ptr(i) + k, R.row_ptr(i));
+    return R;
+}
+
+// Range finder behind the public entry points.  A symmetric operator is
+// its own transpose, so the power iterations only need applyBlock().
+DynamicMatrix rangeFinder(const LinearOperator& A, size_t l, size_t power_iters,
+                          std::uint64_t seed, bool symmetric) {
+    DynamicMatrix Y, Z;
+    A.applyBlock(gaussian(A.cols(), l, seed), Y);
+    DynamicMatrix Q = orth(Y);
+    for (size_t it = 0; it < power_iters; ++it) {
+        if (symmetric) A.applyBlock(Q, Z);
+        else           A.applyTransposeBlock(Q, Z);
+        A.applyBlock(orth(Z), Y);
+        Q = orth(Y);
+    }
+    return Q;
+}
+
+void requireRank(size_t k, size_t limit, const char* who) {
+    if (k == 0 || k > limit)
+        throw std::invalid_argument(std::string(who) + ": k must be in [1, " +
+                                    std::to_string(limit) + "]");
+}
+
+void requireSquare(const LinearOperator& A, const char* who) {
+    if (A.rows() != A.cols())
+        throw std::invalid_argument(std::string(who) + ": operator must be square");
+}
+
+// Indices of the k entries of largest magnitude, ordered by value (descending).
+std::vector<size_t> largestMagnitude(const std::vector<double>& v, size_t k) {
+    std::vector<size_t> idx(v.size());
+    std::iota(idx.begin(), idx.end(), size_t{0});
+    std::stable_sort(idx.begin(), idx.end(),
+                     [&](size_t a, size_t b) { return std::abs(v[a]) > std::abs(v[b]); });
+    idx.resize(k);
+    std::sort(idx.begin(), idx.end(), [&](size_t a, size_t b) { return v[a] > v[b]; });
+    return idx;
+}
+
+} // namespace
+
+// ─── Range finder ─────────────────────────────────────────────────────────────
+
+DynamicMatrix randomizedRangeFinder(const LinearOperator& A, size_t l,
+                                    size_t power_iters, std::uint64_t seed) {
+    requireRank(l, std::min(A.rows(), A.cols()), "randomizedRangeFinder");
+    if (power_iters > 0 && !A.hasTranspose())
+        throw std::invalid_argument(
+            "randomizedRangeFinder: power iterations need the operator's transpose");
+    return rangeFinder(A, l, power_iters, seed, /*symmetric=*/false);
+}
+
+// ─── SVD ──────────────────────────────────────────────────────────────────────
+// Q = range(A); Bᵀ = Aᵀ·Q is n×l, and its thin SVD Bᵀ = Ub·S·Vbt gives
+// A ≈ Q·B = (Q·Vbtᵀ)·S·Ubᵀ.  The tall SVD reduces Bᵀ to its R factor first,
+// so the dense work is O(n·l²).
+
+LowRankSVD randomizedSVD(const LinearOperator& A, size_t k, const RandomizedOptions& opt) {
+    const size_t m = A.rows(), n = A.cols();
+    requireRank(k, std::min(m, n), "randomizedSVD");
+    if (!A.hasTranspose())
+        throw std::invalid_argument("randomizedSVD: operator must provide its transpose");
+    const size_t l = std::min(k + opt.oversampling, std::min(m, n));
+
+    const DynamicMatrix Q = rangeFinder(A, l, opt.power_iters, opt.seed, false);
+    DynamicMatrix Bt;
+    A.applyTransposeBlock(Q, Bt);
+    auto [Ub, S, Vbt] = svd(Bt, SVDMode::Thin);
+
+    LowRankSVD f;
+    f.U = DynamicMatrix(m, k);
+    gemm(Transpose::No, Transpose::Yes, m, k, l, 1.0, Q.data().data(), l,
+         Vbt.data().data(), l, 0.0, f.U.data().data(), k);
+    f.S.assign(S.begin(), S.begin() + k);
+    f.Vt = DynamicMatrix(k, n);
+    for (size_t j = 0; j < n; ++j)
+        for (size_t c = 0; c < k; ++c) f.Vt(c, j) = Ub(j, c);
+    return f;
+}
+
+LowRankSVD randomizedSVD(const AbstractMatrix& A, size_t k, const RandomizedOptions& opt) {
+    return randomizedSVD(*makeOperator(A), k, opt);
+}
+
+// ─── Symmetric eigendecomposition ─────────────────────────────────────────────
+// Rayleigh–Ritz on the sketched range: T = Qᵀ·A·Q, A ≈ Q·T·Qᵀ.
+
+LowRankEigen randomizedEigh(const LinearOperator& A, size_t k, const RandomizedOptions& opt) {
+    requireSquare(A, "randomizedEigh");
+    const size_t n = A.rows();
+    requireRank(k, n, "randomizedEigh");
+    const size_t l = std::min(k + opt.oversampling, n);
+
+    const DynamicMatrix Q = rangeFinder(A, l, opt.power_iters, opt.seed, true);
+    DynamicMatrix AQ;
+    A.applyBlock(Q, AQ);
+    DynamicMatrix T = transposeTimes(Q, AQ);
+    for (size_t i = 0; i < l; ++i)
+        for (size_t j = 0; j < i; ++j) T(i, j) = T(j, i) = 0.5 * (T(i, j) + T(j, i));
+    auto [lambda, W] = eig(T);
+
+    const std::vector<size_t> pick = largestMagnitude(lambda, k);
+    DynamicMatrix Wk(l, k);
+    LowRankEigen f;
+    for (size_t c = 0; c < k; ++c) {
+        f.values.push_back(lambda[pick[c]]);
+        for (size_t i = 0; i < l; ++i) Wk(i, c) = W(i, pick[c]);
+    }
+    matmul_into(f.vectors, Q, Wk);
+    return f;
+}
+
+LowRankEigen randomizedEigh(const AbstractMatrix& A, size_t k, const RandomizedOptions& opt) {
+    return randomizedEigh(*makeOperator(A), k, opt);
+}
+
+// ─── Nyström ──────────────────────────────────────────────────────────────────
+// With an orthonormal test matrix Ω and Y = A·Ω, the Nyström approximation
+// is Y·(Ωᵀ·Y)⁺·Yᵀ.  A small shift ν keeps Ωᵀ·Y well conditioned: with
+// Yν = Y + ν·Ω and M = Ωᵀ·Yν = V·D·Vᵀ, B = Yν·V·D^{-1/2} satisfies
+// B·Bᵀ = Yν·M⁺·Yνᵀ, so the eigenpairs come from the thin SVD of B, with ν
+// taken back off the squared singular values.
+
+LowRankEigen nystrom(const LinearOperator& A, size_t k, const RandomizedOptions& opt) {
+    requireSquare(A, "nystrom");
+    const size_t n = A.rows();
+    requireRank(k, n, "nystrom");
+    const size_t l = std::min(k + opt.oversampling, n);
+
+    const DynamicMatrix Omega = orth(gaussian(n, l, opt.seed));
+    DynamicMatrix Y;
+    A.applyBlock(Omega, Y);
+
+    double fro = 0.0;
+    for (double y : Y.data()) fro += y * y;
+    const double nu = std::sqrt(static_cast<double>(n)) *
+                      std::numeric_limits<double>::epsilon() * std::sqrt(fro);
+    for (size_t i = 0; i < Y.size(); ++i) Y.flat(i) += nu * Omega.flat(i);
+
+    DynamicMatrix M = transposeTimes(Omega, Y);
+    for (size_t i = 0; i < l; ++i)
+        for (size_t j = 0; j < i; ++j) M(i, j) = M(j, i) = 0.5 * (M(i, j) + M(j, i));
+    auto [d, V] = eig(M);
+    if (d.front() < 0.0 || d.back() < -std::sqrt(std::numeric_limits<double>::epsilon()) * d.front())
+        throw std::invalid_argument("nystrom: operator is not positive semidefinite");
+
+    // Directions with a negligible D carry no information about A.
+    const double cut = d.front() * static_cast<double>(l) * std::numeric_limits<double>::epsilon();
+    for (size_t c = 0; c < l; ++c) {
+        const double s = d[c] > cut ? 1.0 / std::sqrt(d[c]) : 0.0;
+        for (size_t i = 0; i < l; ++i) V(i, c) *= s;
+    }
+    DynamicMatrix B;
+    matmul_into(B, Y, V);
+    auto [U, S, Vt] = svd(B, SVDMode::Thin);
+
+    LowRankEigen f;
+    f.vectors = leadingColumns(U, k);
+    for (size_t c = 0; c < k; ++c) f.values.push_back(std::max(0.0, S[c] * S[c] - nu));
+    return f;
+}
+
+LowRankEigen nystrom(const AbstractMatrix& A, size_t k, const RandomizedOptions& opt) {
+    return nystrom(*makeOperator(A), k, opt);
+}
+
+// ─── StreamingSketch ──────────────────────────────────────────────────────────
+
+StreamingSketch::StreamingSketch(size_t cols, size_t k, const RandomizedOptions& opt)
+    : cols_(cols), k_(k), seed_(opt.seed)
+{
+    if (cols == 0)
+        throw std::invalid_argument("StreamingSketch: cols must be > 0");
+    requireRank(k, cols, "StreamingSketch");
+    l_ = std::min(k + opt.oversampling, cols);
+    s_ = 2 * l_ + 1;
+    Omega_ = gaussian(cols, l_, seed_);
+    W_ = DynamicMatrix(s_, cols);
+}
+
+void StreamingSketch::psiColumn(size_t row, double* out) const {
+    std::mt19937_64 rng(seed_ ^ (0x9E3779B97F4A7C15ULL * (row + 1)));
+    std::normal_distribution<double> nd(0.0, 1.0);
+    for (size_t i = 0; i < s_; ++i) out[i] = nd(rng);
+}
+
+void StreamingSketch::append(const DynamicMatrix& R) {
+    if (R.cols() != cols_)
+        throw std::invalid_argument(
+            "StreamingSketch::append: block has " + std::to_string(R.cols()) +
+            " columns, expected " + std::to_string(cols_));
+    const size_t b = R.rows();
+    if (b == 0) return;
+
+    // Range sketch: the new rows of Y are R·Ω.
+    Y_.resize((rows_ + b) * l_);
+    gemm(Transpose::No, Transpose::No, b, l_, cols_, 1.0, R.data().data(), cols_,
+         Omega_.data().data(), l_, 0.0, Y_.data() + rows_ * l_, l_);
+
+    // Co-range sketch: W += Ψ(:, rows)·R, with Ψ(:, rows)ᵀ built row by row.
+    DynamicMatrix Pt(b, s_);
+    for (size_t i = 0; i < b; ++i) psiColumn(rows_ + i, Pt.row_ptr(i));
+    gemm(Transpose::Yes, Transpose::No, s_, cols_, b, 1.0, Pt.data().data(), s_,
+         R.data().data(), cols_, 1.0, W_.data().data(), cols_);
+    rows_ += b;
+}
+
+LowRankSVD StreamingSketch::finalize() const {
+    if (rows_ == 0)
+        throw std::logic_error("StreamingSketch::finalize: no rows appended");
+    const size_t r = std::min(l_, rows_);
+    DynamicMatrix Y(rows_, l_, Y_);
+    const DynamicMatrix Q = orth(r == l_ ? Y : leadingColumns(Y, r));
+
+    // Ψ·Q accumulated one regenerated column of Ψ at a time.
+    DynamicMatrix PsiQ(s_, r);
+    std::vector<double> psi(s_);
+    for (size_t i = 0; i < rows_; ++i) {
+        psiColumn(i, psi.data());
+        const double* qi = Q.row_ptr(i);
+        for (size_t a = 0; a < s_; ++a) {
+            double* p = PsiQ.row_ptr(a);
+            for (size_t c = 0; c < r; ++c) p[c] += psi[a] * qi[c];
+        }
+    }
+    const DynamicMatrix X = LinearSolver::qr(PsiQ).solve(W_);    // r × cols
+    auto [Ux, S, Vt] = svd(X, SVDMode::Thin);
+
+    const size_t k = std::min(k_, r);
+    LowRankSVD f;
+    matmul_into(f.U, Q, leadingColumns(Ux, k));
+    f.S.assign(S.begin(), S.begin() + k);
+    f.Vt = DynamicMatrix(k, cols_);
+    std::copy(Vt.data().begin(), Vt.data().begin() + k * cols_, f.Vt.data().begin());
+    return f;
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -0,0 +1,494 @@
+// SVD.cpp — svd / svdvals via Golub–Kahan bidiagonalization.
+//
+// The LAPACK dgesvd structure, for m ≥ n (wide A goes through Aᵀ):
+//
+//   0. Tall A (m ≥ 1.6·n): A = Q·R by blocked QR, continue on the n×n R
+//   1. Householder bidiagonalization  A = Q_B·B·P_Bᵀ, B upper bidiagonal
+//        O(4mn² − 4/3·n³), blocked so half of the work is GEMM
+//   2. Singular values of B by implicit-shift QR (Golub–Reinsch) with
+//      deflation; with vectors the rotations of many sweeps are batched
+//      and applied to column blocks of U_Bᵀ / V_Bᵀ in parallel
+//   3. Back-transformation  U = Q_B·U_B,  V = P_B·V_B, with the reflectors
+//      applied as blocks in compact WY form (three GEMMs per block)
+//
+// AᵀA is never formed, so σ_min is accurate to ε·σ_max rather than √ε·σ_max.
+
+#include "MatrixFunctions.h"
+#include "Gemm.h"
+#include "LinearSolver.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr double kEps          = std::numeric_limits<double>::epsilon();
+constexpr double kQRCrossover  = 1.6;           // m/n above which R is bidiagonalized
+constexpr size_t kBidiagBlock  = 32;            // reflector pairs per bidiagonalization panel
+constexpr size_t kWYBlock      = 64;            // reflectors per back-transformation block
+constexpr size_t kRotBytes     = 1024 * 1024;   // Uᵀ / Vᵀ column block for batched rotations
+
+DynamicMatrix toDynamicCopy(const AbstractMatrix& A) {
+    if (const auto* d = dynamic_cast<const DynamicMatrix*>(&A))
+        return *d;
+    return DynamicMatrix(A);
+}
+
+// ─── Stage 1: bidiagonalization (m ≥ n) ───────────────────────────────────────
+// After the call, d / e hold the diagonal / superdiagonal of B (e[n−1] = 0).
+// The left reflector H_k = I − tauq[k]·v·vᵀ acts on rows k.., with v stored
+// in column k from row k down; the right reflector G_k = I − taup[k]·u·uᵀ
+// acts on columns k+1.., with u stored in row k from column k+1 on.  The
+// leading entries v[0] = u[0] = 1 are stored explicitly.
+//
+// Blocked as in LAPACK dgebrd/dlabrd: within a panel the trailing matrix is
+// left untouched, the panel's reflectors accumulate X / Y with
+//   A_trailing ← A_trailing − V·Yᵀ − X·Uᵀ
+// applied by two GEMMs at the end of the panel, and each step's two
+// matrix–vector products are corrected with the X / Y built so far.
+
+struct Bidiagonal {
+    std::vector<double> d, e, tauq, taup;
+};
+
+Bidiagonal bidiagonalize(DynamicMatrix& A) {
+    const size_t m = A.rows(), n = A.cols();
+    double* a = A.toPtr();
+    Bidiagonal B{std::vector<double>(n, 0.0), std::vector<double>(n, 0.0),
+                 std::vector<double>(n, 0.0), std::vector<double>(n, 0.0)};
+    // Panel vectors, one row per reflector, indexed by global row / column.
+    std::vector<double> Vt, Xt, Ut, Yt, t1(kBidiagBlock), t2(kBidiagBlock);
+
+    // Reflector for x = (alpha, rest…): returns tau, scales rest into v, beta into alpha.
+    auto householder = [](double& alpha, double* rest, size_t len, size_t stride) {
+        double xnorm = 0.0;
+        for (size_t i = 0; i < len; ++i) xnorm += rest[i * stride] * rest[i * stride];
+        xnorm = std::sqrt(xnorm);
+        if (xnorm == 0.0) return 0.0;                // already reduced: H = I
+        const double beta = -(alpha >= 0.0 ? 1.0 : -1.0) * std::hypot(alpha, xnorm);
+        const double tau = (beta - alpha) / beta;
+        const double scale = 1.0 / (alpha - beta);
+        for (size_t i = 0; i < len; ++i) rest[i * stride] *= scale;
+        alpha = beta;
+        return tau;
+    };
+
+    for (size_t k0 = 0; k0 < n; k0 += kBidiagBlock) {
+        const size_t nb = std::min(kBidiagBlock, n - k0);
+        Vt.assign(nb * m, 0.0);
+        Xt.assign(nb * m, 0.0);
+        Ut.assign(nb * n, 0.0);
+        Yt.assign(nb * n, 0.0);
+
+        for (size_t j = 0; j < nb; ++j) {
+            const size_t k = k0 + j;
+            double* vj = Vt.data() + j * m;
+            double* xj = Xt.data() + j * m;
+            double* uj = Ut.data() + j * n;
+            double* yj = Yt.data() + j * n;
+
+            // Column k ← column k − V·Y(k, :)ᵀ − X·U(:, k), then H_k.
+            for (size_t q = 0; q < j; ++q) {
+                const double* vq = Vt.data() + q * m;
+                const double* xq = Xt.data() + q * m;
+                const double yk = Yt[q * n + k], uk = Ut[q * n + k];
+                for (size_t r = k; r < m; ++r) a[r * n + k] -= vq[r] * yk + xq[r] * uk;
+            }
+            B.tauq[k] = householder(a[k * n + k], a + (k + 1) * n + k, m - k - 1, n);
+            B.d[k] = a[k * n + k];
+            a[k * n + k] = 1.0;
+            for (size_t r = k; r < m; ++r) vj[r] = a[r * n + k];
+            if (k + 1 == n) break;
+
+            // y = τq·(Aᵀv − Y·(Vᵀv) − Uᵀ·(Xᵀv)) over columns k+1..n−1
+            const double tq = B.tauq[k];
+            if (tq != 0.0) {
+                Core::parallel_for(k + 1, n, 256, [&](size_t lo, size_t hi) {
+                    for (size_t r = k; r < m; ++r) {
+                        const double vr = vj[r];
+                        const double* Ar = a + r * n;
+                        for (size_t c = lo; c < hi; ++c) yj[c] += vr * Ar[c];
+                    }
+                });
+                for (size_t q = 0; q < j; ++q) {
+                    const double* vq = Vt.data() + q * m;
+                    const double* xq = Xt.data() + q * m;
+                    double sv = 0.0, sx = 0.0;
+                    for (size_t r = k; r < m; ++r) {
+                        sv += vq[r] * vj[r];
+                        sx += xq[r] * vj[r];
+                    }
+                    t1[q] = sv;
+                    t2[q] = sx;
+                }
+                for (size_t q = 0; q < j; ++q) {
+                    const double* yq = Yt.data() + q * n;
+                    const double* uq = Ut.data() + q * n;
+                    for (size_t c = k + 1; c < n; ++c) yj[c] -= yq[c] * t1[q] + uq[c] * t2[q];
+                }
+                for (size_t c = k + 1; c < n; ++c) yj[c] *= tq;
+            }
+
+            // Row k ← row k − Y·V(k, :)ᵀ − X(k, :)·U, then G_k.
+            double* ak = a + k * n;
+            for (size_t q = 0; q <= j; ++q) {
+                const double* yq = Yt.data() + q * n;
+                const double vk = Vt[q * m + k];
+                for (size_t c = k + 1; c < n; ++c) ak[c] -= yq[c] * vk;
+            }
+            for (size_t q = 0; q < j; ++q) {
+                const double* uq = Ut.data() + q * n;
+                const double xk = Xt[q * m + k];
+                for (size_t c = k + 1; c < n; ++c) ak[c] -= xk * uq[c];
+            }
+            B.taup[k] = householder(ak[k + 1], ak + k + 2, n - k - 2, 1);
+            B.e[k] = ak[k + 1];
+            ak[k + 1] = 1.0;
+            std::copy(ak + k + 1, ak + n, uj + k + 1);
+
+            // x = τp·(A·u − V·(Yᵀu) − X·(Uᵀu)) over rows k+1..m−1
+            const double tp = B.taup[k];
+            if (tp == 0.0) continue;
+            Core::parallel_for(k + 1, m, 32, [&](size_t lo, size_t hi) {
+                for (size_t r = lo; r < hi; ++r) {
+                    const double* Ar = a + r * n;
+                    double s = 0.0;
+                    for (size_t c = k + 1; c < n; ++c) s += Ar[c] * uj[c];
+                    xj[r] = s;
+                }
+            });
+            for (size_t q = 0; q <= j; ++q) {
+                const double* yq = Yt.data() + q * n;
+                double s = 0.0;
+                for (size_t c = k + 1; c < n; ++c) s += yq[c] * uj[c];
+                t1[q] = s;
+            }
+            for (size_t q = 0; q < j; ++q) {
+                const double* uq = Ut.data() + q * n;
+                double s = 0.0;
+                for (size_t c = k + 1; c < n; ++c) s += uq[c] * uj[c];
+                t2[q] = s;
+            }
+            for (size_t q = 0; q <= j; ++q) {
+                const double* vq = Vt.data() + q * m;
+                const double* xq = Xt.data() + q * m;
+                const double s1 = t1[q], s2 = q < j ? t2[q] : 0.0;
+                for (size_t r = k + 1; r < m; ++r) xj[r] -= vq[r] * s1 + xq[r] * s2;
+            }
+            for (size_t r = k + 1; r < m; ++r) xj[r] *= tp;
+        }
+
+        // Trailing block ← trailing block − V·Yᵀ − X·Uᵀ
+        const size_t kend = k0 + nb;
+        if (kend < n) {
+            double* S = a + kend * n + kend;
+            gemm(Transpose::Yes, Transpose::No, m - kend, n - kend, nb, -1.0,
+                 Vt.data() + kend, m, Yt.data() + kend, n, 1.0, S, n);
+            gemm(Transpose::Yes, Transpose::No, m - kend, n - kend, nb, -1.0,
+                 Xt.data() + kend, m, Ut.data() + kend, n, 1.0, S, n);
+        }
+    }
+    return B;
+}
+
+// ─── Stage 2: implicit-shift QR on the bidiagonal ─────────────────────────────
+// Golub–Reinsch as in the classic svdcmp: split on negligible e, cancel e
+// when a diagonal entry vanishes, otherwise chase a bulge shifted by the
+// eigenvalue of the trailing 2×2 of BᵀB.  Rotations of U_B / V_B (rows are
+// the singular vectors) are recorded and applied in batches to narrow column
+// blocks, as in the symmetric QL solver.
+
+struct Rotation { size_t i, j; double c, s; };   // rows (i, j) ← (c·zi + s·zj, c·zj − s·zi)
+
+void applyRotations(const std::vector<Rotation>& rot, DynamicMatrix& Z) {
+    if (rot.empty()) return;
+    const size_t n = Z.cols();
+    double* z = Z.toPtr();
+    // n rows × W columns of doubles ≈ kRotBytes (L2-sized)
+    const size_t W = std::clamp<size_t>(kRotBytes / (8 * n), 8, 512);
+    Core::parallel_for(0, (n + W - 1) / W, 1, [&](size_t blo, size_t bhi) {
+        for (size_t blk = blo; blk < bhi; ++blk) {
+            const size_t lo = blk * W, hi = std::min(n, lo + W);
+            for (const Rotation& r : rot) {
+                double* zi = z + r.i * n;
+                double* zj = z + r.j * n;
+                for (size_t k = lo; k < hi; ++k) {
+                    const double x = zi[k], y = zj[k];
+                    zi[k] = r.c * x + r.s * y;
+                    zj[k] = r.c * y - r.s * x;
+                }
+            }
+        }
+    });
+}
+
+// On return d holds the singular values (unsorted, ≥ 0).
+void bidiagonalQR(std::vector<double>& d, const std::vector<double>& e,
+                  DynamicMatrix* Ut, DynamicMatrix* Vt, size_t max_iter, const char* who)
+{
+    const size_t n = d.size();
+    std::vector<double> f(n, 0.0);                // f[i] couples d[i−1] and d[i]
+    for (size_t i = 1; i < n; ++i) f[i] = e[i - 1];
+    double anorm = 0.0;
+    for (size_t i = 0; i < n; ++i) anorm = std::max(anorm, std::abs(d[i]) + std::abs(f[i]));
+    const double tol = kEps * anorm;
+
+    std::vector<Rotation> ru, rv;
+    std::vector<size_t> negate;
+    auto flush = [&] {
+        if (Ut) applyRotations(ru, *Ut);
+        if (Vt) applyRotations(rv, *Vt);
+        ru.clear();
+        rv.clear();
+    };
+
+    for (size_t k = n; k-- > 0; ) {
+        for (size_t its = 0; ; ++its) {
+            // Largest l with f[l] negligible (l = 0 always qualifies), or
+            // d[l−1] negligible, in which case f[l] is cancelled first.
+            size_t l = k;
+            bool cancel = false;
+            for (;; --l) {
+                if (l == 0 || std::abs(f[l]) <= tol) break;
+                if (std::abs(d[l - 1]) <= tol) { cancel = true; break; }
+            }
+            if (cancel) {
+                double c = 0.0, s = 1.0;
+                for (size_t i = l; i <= k; ++i) {
+                    const double g = s * f[i];
+                    f[i] *= c;
+                    if (std::abs(g) <= tol) break;
+                    const double h = std::hypot(g, d[i]);
+                    c = d[i] / h;
+                    s = -g / h;
+                    d[i] = h;
+                    if (Ut) ru.push_back({l - 1, i, c, s});
+                }
+            }
+            const double z = d[k];
+            if (l == k) {                         // converged
+                if (z < 0.0) {
+                    d[k] = -z;
+                    negate.push_back(k);
+                }
+                break;
+            }
+            if (its == max_iter)
+                throw std::runtime_error(std::string(who) + ": QR iteration did not converge");
+
+            // Shift from the trailing 2×2, then chase the bulge from l to k.
+            double x = d[l], y = d[k - 1], g = f[k - 1], h = f[k];
+            double p = ((y - z) * (y + z) + (g - h) * (g + h)) / (2.0 * h * y);
+            g = std::hypot(p, 1.0);
+            p = ((x - z) * (x + z) + h * ((y / (p + (p >= 0.0 ? g : -g))) - h)) / x;
+            double c = 1.0, s = 1.0;
+            for (size_t j = l; j < k; ++j) {
+                const size_t i = j + 1;
+                g = f[i];
+                y = d[i];
+                h = s * g;
+                g = c * g;
+                double r = std::hypot(p, h);
+                f[j] = r;
+                c = p / r;
+                s = h / r;
+                p = x * c + g * s;
+                g = g * c - x * s;
+                h = y * s;
+                y *= c;
+                if (Vt) rv.push_back({j, i, c, s});
+                r = std::hypot(p, h);
+                d[j] = r;
+                if (r != 0.0) {
+                    c = p / r;
+                    s = h / r;
+                }
+                p = c * g + s * y;
+                x = c * y - s * g;
+                if (Ut) ru.push_back({j, i, c, s});
+            }
+            f[l] = 0.0;
+            f[k] = p;
+            d[k] = x;
+            if (ru.size() + rv.size() >= 64 * n) flush();
+        }
+    }
+    flush();
+    // A converged index is never rotated again, so the sign flips commute
+    // with every rotation recorded after them.
+    if (Vt)
+        for (size_t k : negate) {
+            double* row = Vt->row_ptr(k);
+            for (size_t c = 0; c < n; ++c) row[c] = -row[c];
+        }
+}
+
+// ─── Stage 3: back-transformation ─────────────────────────────────────────────
+// Z ← H_0·H_1⋯H_{cnt−1}·Z, where H_k = I − τ_k·v_k·v_kᵀ acts on rows
+// k+shift..rows−1 and v_k(r) = at(k, r) (with at(k, k+shift) = 1).
+// Reflectors are taken kWYBlock at a time as I − V·T·Vᵀ, last block first.
+
+template <class At>
+void applyReflectors(size_t cnt, size_t shift, const std::vector<double>& tau, At at,
+                     DynamicMatrix& Z)
+{
+    const size_t rows = Z.rows(), nc = Z.cols();
+    if (cnt == 0 || nc == 0) return;
+    std::vector<double> V, G, Tm, W, W2;
+
+    for (size_t b1 = cnt; b1 > 0; ) {
+        const size_t b0 = b1 > kWYBlock ? b1 - kWYBlock : 0;
+        const size_t nb = b1 - b0, r0 = b0 + shift, mr = rows - r0;
+
+        V.assign(mr * nb, 0.0);
+        for (size_t r = 0; r < mr; ++r)
+            for (size_t c = 0; c < nb && c <= r; ++c) V[r * nb + c] = at(b0 + c, r0 + r);
+        // T(0:i, i) = −τ_i · T(0:i, 0:i) · V(:, 0:i)ᵀ·v_i, with VᵀV from one GEMM
+        G.assign(nb * nb, 0.0);
+        gemm(Transpose::Yes, Transpose::No, nb, nb, mr, 1.0, V.data(), nb, V.data(), nb,
+             0.0, G.data(), nb);
+        Tm.assign(nb * nb, 0.0);
+        for (size_t i = 0; i < nb; ++i) {
+            const double ti = tau[b0 + i];
+            Tm[i * nb + i] = ti;
+            if (ti == 0.0) continue;
+            for (size_t p = 0; p < i; ++p) {
+                double s = 0.0;
+                for (size_t q = p; q < i; ++q) s += Tm[p * nb + q] * G[q * nb + i];
+                Tm[p * nb + i] = -ti * s;
+            }
+        }
+
+        double* C = Z.row_ptr(r0);
+        W.assign(nb * nc, 0.0);
+        W2.assign(nb * nc, 0.0);
+        gemm(Transpose::Yes, Transpose::No, nb, nc, mr, 1.0, V.data(), nb, C, nc, 0.0, W.data(), nc);
+        gemm(Transpose::No, Transpose::No, nb, nc, nb, 1.0, Tm.data(), nb, W.data(), nc, 0.0, W2.data(), nc);
+        gemm(Transpose::No, Transpose::No, mr, nc, nb, -1.0, V.data(), nb, W2.data(), nc, 1.0, C, nc);
+        b1 = b0;
+    }
+}
+
+// ─── Driver ───────────────────────────────────────────────────────────────────
+
+struct Factors {
+    std::vector<double> S;
+    DynamicMatrix U, V;      // singular vectors as columns; 0×0 when not requested
+};
+
+// A is m×n with m ≥ n; ku = 0 (no U), n (thin) or m (full).
+Factors svdTall(DynamicMatrix A, size_t ku, bool wantV, size_t max_iter, const char* who) {
+    const size_t m = A.rows(), n = A.cols();
+    Factors F;
+    if (n == 0) {
+        if (ku) F.U = DynamicMatrix::eye(m);
+        return F;
+    }
+
+    if (static_cast<double>(m) >= kQRCrossover * static_cast<double>(n) && m > n) {
+        // Bidiagonalize R instead of A; U = Q·[U_R 0; 0 I].
+        LinearSolver qrA = LinearSolver::qr(A);
+        Factors R = svdTall(qrA.r_factor(), ku ? n : 0, wantV, max_iter, who);
+        F.S = std::move(R.S);
+        F.V = std::move(R.V);
+        if (ku) {
+            F.U = DynamicMatrix(m, ku, 0.0);
+            for (size_t r = 0; r < n; ++r)
+                std::copy(R.U.row_ptr(r), R.U.row_ptr(r) + n, F.U.row_ptr(r));
+            for (size_t c = n; c < ku; ++c) F.U(c, c) = 1.0;
+            qrA.apply_q(F.U, /*transpose=*/false);
+        }
+        return F;
+    }
+
+    Bidiagonal B = bidiagonalize(A);
+    F.S = B.d;
+    DynamicMatrix Ubt, Vbt;
+    if (ku)    Ubt = DynamicMatrix::eye(n);
+    if (wantV) Vbt = DynamicMatrix::eye(n);
+    bidiagonalQR(F.S, B.e, ku ? &Ubt : nullptr, wantV ? &Vbt : nullptr, max_iter, who);
+
+    // Descending order; column c of U / V belongs to S[c].
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return F.S[a] > F.S[b]; });
+    std::vector<double> sorted(n);
+    for (size_t c = 0; c < n; ++c) sorted[c] = F.S[order[c]];
+    F.S = std::move(sorted);
+
+    const double* a = A.toPtr();
+    if (ku) {
+        F.U = DynamicMatrix(m, ku, 0.0);
+        for (size_t c = 0; c < n; ++c) {
+            const double* src = Ubt.row_ptr(order[c]);
+            for (size_t r = 0; r < n; ++r) F.U(r, c) = src[r];
+        }
+        for (size_t c = n; c < ku; ++c) F.U(c, c) = 1.0;
+        applyReflectors(n, 0, B.tauq, [&](size_t k, size_t r) { return a[r * n + k]; }, F.U);
+    }
+    if (wantV) {
+        F.V = DynamicMatrix(n, n);
+        for (size_t c = 0; c < n; ++c) {
+            const double* src = Vbt.row_ptr(order[c]);
+            for (size_t r = 0; r < n; ++r) F.V(r, c) = src[r];
+        }
+        applyReflectors(n - 1, 1, B.taup, [&](size_t k, size_t c) { return a[k * n + c]; }, F.V);
+    }
+    return F;
+}
+
+std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
+svdDriver(const AbstractMatrix& A, SVDMode mode, size_t max_iter, const char* who) {
+    const size_t m = A.rows(), n = A.cols();
+    const bool wide = m < n;
+    const bool wantU  = mode == SVDMode::Thin || mode == SVDMode::Full;
+    const bool wantVt = mode != SVDMode::ValuesOnly;
+    const bool full   = mode == SVDMode::Full;
+
+    // Work on the tall orientation; for wide A the roles of U and V swap.
+    DynamicMatrix W = wide ? toDynamicCopy(A).transposed() : toDynamicCopy(A);
+    const size_t p = std::max(m, n), q = std::min(m, n);
+    const bool needLeft  = wide ? wantVt : wantU;
+    const bool needRight = wide ? wantU  : wantVt;
+    Factors F = svdTall(std::move(W), needLeft ? (full ? p : q) : 0, needRight, max_iter, who);
+
+    DynamicMatrix U, Vt;
+    if (!wide) {
+        if (wantU)  U  = std::move(F.U);
+        if (wantVt) Vt = F.V.transposed();
+    } else {
+        if (wantU)  U  = std::move(F.V);
+        if (wantVt) Vt = F.U.transposed();
+    }
+    return {U, F.S, Vt};
+}
+
+} // namespace
+
+// ─── Public API ───────────────────────────────────────────────────────────────
+
+std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
+svd(const AbstractMatrix& A, size_t max_iter) {
+    return svdDriver(A, SVDMode::Thin, max_iter, "svd");
+}
+
+std::tuple<DynamicMatrix, std::vector<double>, DynamicMatrix>
+svd(const AbstractMatrix& A, SVDMode mode, size_t max_iter) {
+    return svdDriver(A, mode, max_iter, "svd");
+}
+
+std::vector<double> svdvals(const AbstractMatrix& A, size_t max_iter) {
+    return std::get<1>(svdDriver(A, SVDMode::ValuesOnly, max_iter, "svdvals"));
+}
+
+} // namespace SharedMath::LinearAlgebra
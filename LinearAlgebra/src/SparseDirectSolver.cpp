@@ -0,0 +1,580 @@
+// SparseDirectSolver.cpp — supernodal multifrontal Cholesky and LU.
+//
+// Analysis (once per pattern):
+//   1. fill-reducing ordering of A + Aᵀ;
+//   2. elimination tree (Liu's algorithm with path compression) and its
+//      postorder, folded into the ordering so every subtree is a
+//      contiguous range of columns;
+//   3. column structures struct(j) = adj(j) ∪ ⋃ struct(child) \ {j},
+//      merging each column into its parent's supernode when the structures
+//      nest (fundamental supernodes) or when the explicit zeros this adds
+//      stay small (relaxed supernodes);
+//   4. for every supernode: the positions of its rows in the parent front
+//      and the positions of the entries of A it assembles.
+//
+// Factorization: supernodes are visited in postorder.  Each one builds a
+// dense front F over [own columns, rows], adds its part of A and its
+// children's update matrices (extend-add), and runs a partial dense
+// factorization of the leading block:
+//
+//   F = [F11 F12]   F11 = L11·U11,  L21 = F21·U11⁻¹,  U12 = L11⁻¹·F12,
+//       [F21 F22]   update = F22 − L21·U12 → parent
+//
+// blocked so that the bulk of the work is trsm() / gemm().  The subtrees
+// below the top few levels are independent and run as parallel tasks.
+
+#include "SparseDirectSolver.h"
+#include "Gemm.h"
+
+#include "core/Memory.h"
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr size_t kNone  = std::numeric_limits<size_t>::max();
+constexpr size_t kPanel = 48;          // columns per blocked step inside a front
+
+// Relaxed supernodes, as in CHOLMOD: merge a child into its parent while
+// the merged supernode has at most `cols` columns and explicit zeros make
+// up at most `zeros` of its entries.
+struct Relax { size_t cols; double zeros; };
+constexpr Relax kRelax[] = {{4, 1.0}, {16, 0.8}, {48, 0.1}, {kNone, 0.05}};
+
+bool isSymmetric(const SparseMatrix& A) {
+    const SparseMatrix T = A.transposed();
+    return T.row_ptr() == A.row_ptr() && T.col_indices() == A.col_indices() &&
+           T.values() == A.values();
+}
+
+bool hasPositiveDiagonal(const SparseMatrix& A) {
+    for (size_t i = 0; i < A.rows(); ++i)
+        if (!(A.get(i, i) > 0.0)) return false;
+    return true;
+}
+
+// ── Dense partial factorizations of a front ──────────────────────────────────
+//
+// F is m×m row-major; the first ns columns are eliminated and F22 becomes
+// the update matrix.
+
+// Cholesky: only the lower triangle of F is read or meaningful.
+void frontCholesky(double* F, size_t m, size_t ns) {
+    for (size_t jb = 0; jb < ns; jb += kPanel) {
+        const size_t b = std::min(kPanel, ns - jb), je = jb + b;
+
+        for (size_t i = jb; i < je; ++i) {
+            double* Fi = F + i * m;
+            for (size_t j = jb; j <= i; ++j) {
+                const double* Fj = F + j * m;
+                double s = Fi[j];
+                for (size_t k = jb; k < j; ++k) s -= Fi[k] * Fj[k];
+                if (i == j) {
+                    if (!(s > 0.0))
+                        throw std::runtime_error("SparseDirectSolver: matrix is not positive definite");
+                    Fi[i] = std::sqrt(s);
+                } else {
+                    Fi[j] = s / Fj[j];
+                }
+            }
+        }
+
+        const size_t rest = m - je;
+        if (rest == 0) continue;
+        double* L21 = F + je * m + jb;
+        trsm(Side::Right, Triangle::Lower, Transpose::Yes, Diagonal::NonUnit,
+             rest, b, 1.0, F + jb * m + jb, m, L21, m);
+        // F22 −= L21·L21ᵀ on the lower triangle, one row strip at a time.
+        constexpr size_t kStrip = 256;
+        for (size_t r0 = 0; r0 < rest; r0 += kStrip) {
+            const size_t r1 = std::min(rest, r0 + kStrip);
+            gemm(Transpose::No, Transpose::Yes, r1 - r0, r1, b,
+                 -1.0, L21 + r0 * m, m, L21, m, 1.0, F + (je + r0) * m + je, m);
+        }
+    }
+}
+
+// LU with row interchanges restricted to the ns pivot rows.
+void frontLU(double* F, size_t m, size_t ns, size_t* piv,
+             double tol, double tiny, size_t& perturbed) {
+    for (size_t jb = 0; jb < ns; jb += kPanel) {
+        const size_t b = std::min(kPanel, ns - jb), je = jb + b;
+
+        for (size_t j = jb; j < je; ++j) {
+            double colmax = 0.0, best = 0.0;
+            size_t p = j;
+            for (size_t i = j; i < m; ++i) {
+                const double a = std::abs(F[i * m + j]);
+                colmax = std::max(colmax, a);
+                if (i < ns && a > best) { best = a; p = i; }
+            }
+            if (colmax == 0.0)
+                throw std::runtime_error("SparseDirectSolver: matrix is singular");
+            if (std::abs(F[j * m + j]) >= tol * colmax) p = j;   // keep the diagonal
+            piv[j] = p;
+            if (p != j) std::swap_ranges(F + j * m, F + (j + 1) * m, F + p * m);
+
+            double& d = F[j * m + j];
+            if (std::abs(d) < tiny) { d = d < 0.0 ? -tiny : tiny; ++perturbed; }
+            const double* Fj = F + j * m;
+            for (size_t i = j + 1; i < m; ++i) {
+                double* Fi = F + i * m;
+                const double l = (Fi[j] /= d);
+                if (l != 0.0)
+                    for (size_t c = j + 1; c < je; ++c) Fi[c] -= l * Fj[c];
+            }
+        }
+
+        const size_t rest = m - je;
+        if (rest == 0) continue;
+        trsm(Side::Left, Triangle::Lower, Transpose::No, Diagonal::Unit,
+             b, rest, 1.0, F + jb * m + jb, m, F + jb * m + je, m);
+        gemm(Transpose::No, Transpose::No, rest, rest, b,
+             -1.0, F + je * m + jb, m, F + jb * m + je, m, 1.0, F + je * m + je, m);
+    }
+}
+
+} // namespace
+
+// ── Construction ──────────────────────────────────────────────────────────────
+
+SparseDirectSolver::SparseDirectSolver(const SparseMatrix& A, Method method,
+                                       SparseOrdering ordering, double pivot_tol)
+    : n_(A.rows()), requested_(method), method_(method), pivot_tol_(pivot_tol), A_(A)
+{
+    if (!A.isSquare())
+        throw std::invalid_argument("SparseDirectSolver: matrix must be square");
+    if (!(pivot_tol > 0.0 && pivot_tol <= 1.0))
+        throw std::invalid_argument("SparseDirectSolver: pivot_tol must be in (0, 1]");
+    analyse(ordering);
+    factorize();
+}
+
+void SparseDirectSolver::refactor(const SparseMatrix& A) {
+    if (A.rows() != n_ || A.cols() != n_ || A.row_ptr() != A_.row_ptr() ||
+        A.col_indices() != A_.col_indices())
+        throw std::invalid_argument(
+            "SparseDirectSolver::refactor: sparsity pattern differs from the analysed matrix");
+    A_ = A;
+    factorize();
+}
+
+size_t SparseDirectSolver::nnz_factor() const noexcept {
+    size_t nz = 0;
+    for (const Supernode& s : sn_) {
+        const size_t below = s.cols * s.rows.size();
+        nz += method_ == Method::LU ? s.cols * s.cols + 2 * below
+                                    : s.cols * (s.cols + 1) / 2 + below;
+    }
+    return nz;
+}
+
+// ── Symbolic analysis ─────────────────────────────────────────────────────────
+
+void SparseDirectSolver::analyse(SparseOrdering ordering) {
+    const size_t n = n_;
+    const auto& rp = A_.row_ptr();
+    const auto& ci = A_.col_indices();
+
+    std::vector<size_t> p0 = fillReducingOrdering(ordering, n, rp, ci);
+    std::vector<size_t> ip0(n);
+    for (size_t k = 0; k < n; ++k) ip0[p0[k]] = k;
+
+    // Off-diagonal pattern of A + Aᵀ in the given numbering: for each node
+    // the neighbours numbered below it (etree) or above it (structures).
+    auto adjacency = [&](const std::vector<size_t>& ip, bool below) {
+        std::vector<size_t> ptr(n + 1, 0), idx;
+        for (int pass = 0; pass < 2; ++pass) {
+            std::vector<size_t> next(ptr.begin(), ptr.end() - 1);
+            if (pass == 1) idx.resize(ptr[n]);
+            for (size_t i = 0; i < n; ++i)
+                for (size_t k = rp[i]; k < rp[i + 1]; ++k) {
+                    const size_t r = ip[i], c = ip[ci[k]];
+                    if (r == c) continue;
+                    const size_t a = below ? std::max(r, c) : std::min(r, c);
+                    const size_t o = below ? std::min(r, c) : std::max(r, c);
+                    if (pass == 0) ++ptr[a + 1];
+                    else           idx[next[a]++] = o;
+                }
+            if (pass == 0)
+                for (size_t i = 0; i < n; ++i) ptr[i + 1] += ptr[i];
+        }
+        return std::make_pair(std::move(ptr), std::move(idx));
+    };
+
+    // Elimination tree.
+    std::vector<size_t> parent(n, kNone);
+    {
+        auto [ptr, idx] = adjacency(ip0, true);
+        std::vector<size_t> ancestor(n, kNone);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t k = ptr[i]; k < ptr[i + 1]; ++k)
+                for (size_t j = idx[k]; j != kNone && j < i;) {
+                    const size_t up = ancestor[j];
+                    ancestor[j] = i;
+                    if (up == kNone) parent[j] = i;
+                    j = up;
+                }
+    }
+
+    // Postorder, folded into the ordering.
+    std::vector<size_t> post;
+    post.reserve(n);
+    {
+        std::vector<size_t> head(n, kNone), next(n, kNone), stack;
+        for (size_t j = n; j-- > 0;)
+            if (parent[j] != kNone) { next[j] = head[parent[j]]; head[parent[j]] = j; }
+        for (size_t r = 0; r < n; ++r) {
+            if (parent[r] != kNone) continue;
+            stack.push_back(r);
+            while (!stack.empty()) {
+                const size_t j = stack.back();
+                if (head[j] != kNone) {
+                    const size_t c = head[j];
+                    head[j] = next[c];
+                    stack.push_back(c);
+                } else {
+                    stack.pop_back();
+                    post.push_back(j);
+                }
+            }
+        }
+    }
+    std::vector<size_t> ipost(n);
+    for (size_t k = 0; k < n; ++k) ipost[post[k]] = k;
+    perm_.resize(n);
+    std::vector<size_t> ip(n), par(n, kNone);
+    for (size_t k = 0; k < n; ++k) {
+        perm_[k] = p0[post[k]];
+        ip[perm_[k]] = k;
+        if (parent[post[k]] != kNone) par[k] = ipost[parent[post[k]]];
+    }
+
+    // Column structures and supernodes, bottom-up.
+    auto [up, upIdx] = adjacency(ip, false);
+    std::vector<std::vector<size_t>> R(n);
+    std::vector<size_t> mark(n, kNone), first(n), zeros(n, 0);
+    std::vector<size_t> head(n, kNone), next(n, kNone);
+    std::vector<char> mergedUp(n, 0);
+    for (size_t j = n; j-- > 0;)
+        if (par[j] != kNone) { next[j] = head[par[j]]; head[par[j]] = j; }
+
+    for (size_t j = 0; j < n; ++j) {
+        std::vector<size_t>& Rj = R[j];
+        mark[j] = j;
+        for (size_t k = up[j]; k < up[j + 1]; ++k)
+            if (mark[upIdx[k]] != j) { mark[upIdx[k]] = j; Rj.push_back(upIdx[k]); }
+        for (size_t c = head[j]; c != kNone; c = next[c])
+            for (size_t r : R[c])
+                if (mark[r] != j) { mark[r] = j; Rj.push_back(r); }
+        std::sort(Rj.begin(), Rj.end());
+
+        first[j] = j;
+        if (j == 0 || par[j - 1] != j) continue;
+        // j − 1 ends the supernode of j's last child: try to extend it by j.
+        const size_t c = j - 1, nc = j - first[c], nm = nc + 1;
+        const size_t extra = nc * (1 + Rj.size() - R[c].size());
+        const size_t z = zeros[c] + extra;
+        const double entries = double(nm) * double(nm + 1) / 2.0 + double(nm) * double(Rj.size());
+        bool merge = extra == 0;
+        for (const Relax& r : kRelax)
+            if (nm <= r.cols && double(z) <= r.zeros * entries) { merge = true; break; }
+        if (!merge) continue;
+        first[j] = first[c];
+        zeros[j] = z;
+        mergedUp[c] = 1;
+        std::vector<size_t>().swap(R[c]);
+    }
+
+    sn_.clear();
+    std::vector<size_t> colSn(n);
+    for (size_t j = 0; j < n; ++j) {
+        if (mergedUp[j]) continue;
+        Supernode s;
+        s.first = first[j];
+        s.cols  = j + 1 - first[j];
+        s.rows  = std::move(R[j]);
+        for (size_t c = s.first; c <= j; ++c) colSn[c] = sn_.size();
+        sn_.push_back(std::move(s));
+    }
+    const size_t S = sn_.size();
+
+    // Supernodal tree, relative indices and subtree ranges.
+    std::vector<double> work(S);
+    firstDesc_.assign(S, 0);
+    for (size_t s = 0; s < S; ++s) {
+        Supernode& sn = sn_[s];
+        sn.parent = sn.rows.empty() ? S : colSn[sn.rows.front()];
+        const double m = double(sn.cols + sn.rows.size());
+        work[s] += double(sn.cols) * m * m;
+        firstDesc_[s] = s;
+        for (size_t c : sn.children) firstDesc_[s] = std::min(firstDesc_[s], firstDesc_[c]);
+        if (sn.parent == S) continue;
+        Supernode& pn = sn_[sn.parent];
+        pn.children.push_back(s);
+        work[sn.parent] += work[s];
+        sn.relind.resize(sn.rows.size());
+        size_t q = 0;
+        for (size_t i = 0; i < sn.rows.size(); ++i) {
+            const size_t r = sn.rows[i];
+            if (r < pn.first + pn.cols) { sn.relind[i] = r - pn.first; continue; }
+            while (pn.rows[q] < r) ++q;
+            sn.relind[i] = pn.cols + q;
+        }
+    }
+
+    // Where every entry of A lands: the supernode of its first pivot.
+    auto position = [&](const Supernode& sn, size_t x) {
+        if (x < sn.first + sn.cols) return x - sn.first;
+        return sn.cols + size_t(std::lower_bound(sn.rows.begin(), sn.rows.end(), x) - sn.rows.begin());
+    };
+    asmPtr_.assign(S + 1, 0);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t k = rp[i]; k < rp[i + 1]; ++k)
+            ++asmPtr_[colSn[std::min(ip[i], ip[ci[k]])] + 1];
+    for (size_t s = 0; s < S; ++s) asmPtr_[s + 1] += asmPtr_[s];
+    asmSrc_.resize(A_.nnz());
+    asmDst_.resize(A_.nnz());
+    {
+        std::vector<size_t> fill(asmPtr_.begin(), asmPtr_.end() - 1);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t k = rp[i]; k < rp[i + 1]; ++k) {
+                const size_t r = ip[i], c = ip[ci[k]];
+                const size_t s = colSn[std::min(r, c)];
+                const Supernode& sn = sn_[s];
+                const size_t m = sn.cols + sn.rows.size();
+                asmSrc_[fill[s]] = k;
+                asmDst_[fill[s]++] = position(sn, r) * m + position(sn, c);
+            }
+    }
+
+    // Subtree-to-task mapping (Geist & Ng): split the heaviest task into
+    // its children until no task carries more than a share of the work;
+    // the split nodes run afterwards, in postorder.
+    tasks_.clear();
+    top_.clear();
+    for (size_t s = 0; s < S; ++s)
+        if (sn_[s].parent == S) tasks_.push_back(s);
+    const size_t threads = Core::ThreadPool::numThreads();
+    if (threads > 1) {
+        double total = 0.0;
+        for (size_t t : tasks_) total += work[t];
+        while (!tasks_.empty()) {
+            auto heavy = std::max_element(tasks_.begin(), tasks_.end(),
+                                          [&](size_t a, size_t b) { return work[a] < work[b]; });
+            const size_t s = *heavy;
+            if (work[s] <= total / double(2 * threads) || sn_[s].children.empty()) break;
+            tasks_.erase(heavy);
+            top_.push_back(s);
+            const double m = double(sn_[s].cols + sn_[s].rows.size());
+            total -= double(sn_[s].cols) * m * m;
+            tasks_.insert(tasks_.end(), sn_[s].children.begin(), sn_[s].children.end());
+        }
+        std::sort(top_.begin(), top_.end());
+        std::sort(tasks_.begin(), tasks_.end(), [&](size_t a, size_t b) { return work[a] > work[b]; });
+    }
+}
+
+// ── Numeric factorization ─────────────────────────────────────────────────────
+
+void SparseDirectSolver::factorize() {
+    if (requested_ == Method::LU) { factorizeAs(Method::LU); return; }
+    const bool symmetric = isSymmetric(A_);
+    if (requested_ == Method::Cholesky) {
+        if (!symmetric)
+            throw std::invalid_argument("SparseDirectSolver (Cholesky): matrix must be symmetric");
+        factorizeAs(Method::Cholesky);
+        return;
+    }
+    if (symmetric && hasPositiveDiagonal(A_)) {
+        try {
+            factorizeAs(Method::Cholesky);
+            return;
+        } catch (const std::runtime_error&) {
+            // indefinite: fall through to LU
+        }
+    }
+    factorizeAs(Method::LU);
+}
+
+void SparseDirectSolver::factorizeAs(Method method) {
+    method_ = method;
+    const size_t S = sn_.size();
+    factors_.assign(S, Factor{});
+    std::vector<std::vector<double>> updates(S);
+
+    double amax = 0.0;
+    for (double v : A_.values()) amax = std::max(amax, std::abs(v));
+    const double tiny = std::sqrt(std::numeric_limits<double>::epsilon()) * amax;
+
+    std::atomic<size_t> perturbed{0};
+    auto run = [&](size_t lo, size_t hi) {
+        size_t count = 0;
+        for (size_t s = lo; s <= hi; ++s) factorFront(s, updates, tiny, count);
+        perturbed += count;
+    };
+    Core::parallel_for(0, tasks_.size(), 1, [&](size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; ++t) run(firstDesc_[tasks_[t]], tasks_[t]);
+    });
+    for (size_t s : top_) run(s, s);
+    perturbed_ = perturbed;
+}
+
+void SparseDirectSolver::factorFront(size_t s, std::vector<std::vector<double>>& updates,
+                                     double tiny, size_t& perturbed) {
+    const Supernode& sn = sn_[s];
+    const size_t ns = sn.cols, nr = sn.rows.size(), m = ns + nr;
+    const bool lu = method_ == Method::LU;
+
+    // The front only lives for this call: bump-allocate it on the thread's
+    // arena.  A task stolen while gemm() waits nests its own scope above it.
+    Core::ArenaScope scratch;
+    Core::ScratchVector<double> F(m * m, 0.0);
+    const auto& Ax = A_.values();
+    for (size_t k = asmPtr_[s]; k < asmPtr_[s + 1]; ++k) F[asmDst_[k]] += Ax[asmSrc_[k]];
+
+    for (size_t c : sn.children) {
+        std::vector<double>& U = updates[c];
+        const std::vector<size_t>& rel = sn_[c].relind;
+        const size_t mc = rel.size();
+        for (size_t a = 0; a < mc; ++a) {
+            double* Fa = F.data() + rel[a] * m;
+            const double* Ua = U.data() + a * mc;
+            const size_t bend = lu ? mc : a + 1;
+            for (size_t b = 0; b < bend; ++b) Fa[rel[b]] += Ua[b];
+        }
+        std::vector<double>().swap(U);
+    }
+
+    Factor& f = factors_[s];
+    if (lu) {
+        f.piv.resize(ns);
+        frontLU(F.data(), m, ns, f.piv.data(), pivot_tol_, tiny, perturbed);
+        f.top.assign(F.begin(), F.begin() + std::ptrdiff_t(ns * m));
+    } else {
+        frontCholesky(F.data(), m, ns);
+        f.top.resize(ns * ns);
+        for (size_t i = 0; i < ns; ++i)
+            std::copy_n(F.data() + i * m, ns, f.top.data() + i * ns);
+    }
+    f.bottom.resize(nr * ns);
+    for (size_t i = 0; i < nr; ++i)
+        std::copy_n(F.data() + (ns + i) * m, ns, f.bottom.data() + i * ns);
+    if (nr == 0) return;
+    std::vector<double>& U = updates[s];
+    U.resize(nr * nr);
+    for (size_t i = 0; i < nr; ++i)
+        std::copy_n(F.data() + (ns + i) * m + ns, nr, U.data() + i * nr);
+}
+
+// ── Solve ─────────────────────────────────────────────────────────────────────
+
+// X is n×k row-major in pivot order; overwritten with the solution.
+void SparseDirectSolver::solvePermuted(double* X, size_t k) const {
+    const bool lu = method_ == Method::LU;
+    std::vector<double> W;
+
+    for (size_t s = 0; s < sn_.size(); ++s) {
+        const Supernode& sn = sn_[s];
+        const Factor& f = factors_[s];
+        const size_t ns = sn.cols, nr = sn.rows.size(), ld = lu ? ns + nr : ns;
+        double* Xs = X + sn.first * k;
+        if (lu)
+            for (size_t j = 0; j < ns; ++j)
+                if (f.piv[j] != j) std::swap_ranges(Xs + j * k, Xs + (j + 1) * k, Xs + f.piv[j] * k);
+        trsm(Side::Left, Triangle::Lower, Transpose::No, lu ? Diagonal::Unit : Diagonal::NonUnit,
+             ns, k, 1.0, f.top.data(), ld, Xs, k);
+        if (nr == 0) continue;
+        W.resize(nr * k);
+        gemm(Transpose::No, Transpose::No, nr, k, ns, 1.0, f.bottom.data(), ns, Xs, k, 0.0, W.data(), k);
+        for (size_t i = 0; i < nr; ++i) {
+            double* xr = X + sn.rows[i] * k;
+            for (size_t c = 0; c < k; ++c) xr[c] -= W[i * k + c];
+        }
+    }
+
+    for (size_t s = sn_.size(); s-- > 0;) {
+        const Supernode& sn = sn_[s];
+        const Factor& f = factors_[s];
+        const size_t ns = sn.cols, nr = sn.rows.size(), ld = lu ? ns + nr : ns;
+        double* Xs = X + sn.first * k;
+        if (nr > 0) {
+            W.resize(nr * k);
+            for (size_t i = 0; i < nr; ++i)
+                std::copy_n(X + sn.rows[i] * k, k, W.data() + i * k);
+            if (lu)
+                gemm(Transpose::No, Transpose::No, ns, k, nr, -1.0, f.top.data() + ns, ld,
+                     W.data(), k, 1.0, Xs, k);
+            else
+                gemm(Transpose::Yes, Transpose::No, ns, k, nr, -1.0, f.bottom.data(), ns,
+                     W.data(), k, 1.0, Xs, k);
+        }
+        if (lu)
+            trsm(Side::Left, Triangle::Upper, Transpose::No, Diagonal::NonUnit,
+                 ns, k, 1.0, f.top.data(), ld, Xs, k);
+        else
+            trsm(Side::Left, Triangle::Lower, Transpose::Yes, Diagonal::NonUnit,
+                 ns, k, 1.0, f.top.data(), ld, Xs, k);
+    }
+}
+
+// B is n×k row-major in the original order.  Perturbed pivots make the
+// factorization that of a nearby matrix, so a few steps of iterative
+// refinement against A recover the accuracy.
+std::vector<double> SparseDirectSolver::solveRefined(const std::vector<double>& B, size_t k) const {
+    const size_t n = n_;
+    std::vector<double> X(n * k), Y(n * k);
+    auto solveOnce = [&](const std::vector<double>& rhs, std::vector<double>& out) {
+        for (size_t i = 0; i < n; ++i)
+            std::copy_n(rhs.data() + perm_[i] * k, k, Y.data() + i * k);
+        solvePermuted(Y.data(), k);
+        for (size_t i = 0; i < n; ++i)
+            std::copy_n(Y.data() + i * k, k, out.data() + perm_[i] * k);
+    };
+    solveOnce(B, X);
+    if (perturbed_ == 0) return X;
+
+    const auto& rp = A_.row_ptr();
+    const auto& ci = A_.col_indices();
+    const auto& Ax = A_.values();
+    std::vector<double> R(n * k), D(n * k);
+    for (int step = 0; step < 3; ++step) {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < k; ++c) {
+                double r = B[i * k + c];
+                for (size_t q = rp[i]; q < rp[i + 1]; ++q) r -= Ax[q] * X[ci[q] * k + c];
+                R[i * k + c] = r;
+            }
+        solveOnce(R, D);
+        for (size_t i = 0; i < n * k; ++i) X[i] += D[i];
+    }
+    return X;
+}
+
+DynamicVector SparseDirectSolver::solve(const DynamicVector& b) const {
+    if (b.size() != n_)
+        throw std::invalid_argument("SparseDirectSolver::solve: dimension mismatch");
+    return DynamicVector(solveRefined(std::vector<double>(b.begin(), b.end()), 1));
+}
+
+std::vector<double> SparseDirectSolver::solve(const std::vector<double>& b) const {
+    if (b.size() != n_)
+        throw std::invalid_argument("SparseDirectSolver::solve: dimension mismatch");
+    return solveRefined(b, 1);
+}
+
+DynamicMatrix SparseDirectSolver::solve(const DynamicMatrix& B) const {
+    if (B.rows() != n_)
+        throw std::invalid_argument("SparseDirectSolver::solve: dimension mismatch");
+    return DynamicMatrix(n_, B.cols(), solveRefined(B.data(), B.cols()));
+}
+
+} // namespace SharedMath::LinearAlgebra
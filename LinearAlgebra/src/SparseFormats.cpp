@@ -0,0 +1,275 @@
+#include "LinearAlgebra/SparseFormats.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr size_t kGrain    = 8192;   // stored entries per task, at least
+constexpr size_t kMaxChunk = 64;     // SELL-C-σ: upper bound on C
+
+void checkSizes(const char* who, size_t xs, size_t xn, size_t ys, size_t yn) {
+    if (xs != xn || ys != yn)
+        throw std::invalid_argument(std::string(who) + ": dimension mismatch");
+}
+
+} // namespace
+
+// ─── CSCMatrix ────────────────────────────────────────────────────────────────
+
+CSCMatrix::CSCMatrix(const SparseMatrix& A)
+    : rows_(A.rows()), cols_(A.cols())
+{
+    // The CSR arrays of Aᵀ are exactly the CSC arrays of A.
+    SparseMatrix T = A.transposed();
+    values_  = T.values();
+    row_idx_ = T.col_indices();
+    col_ptr_ = T.row_ptr();
+}
+
+void CSCMatrix::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("CSCMatrix::apply", x.size(), cols_, y.size(), rows_);
+    // Columns scatter into overlapping rows, so this direction stays serial.
+    std::fill(y.begin(), y.end(), 0.0);
+    for (size_t j = 0; j < cols_; ++j) {
+        const double xj = x[j];
+        if (xj == 0.0) continue;
+        for (size_t k = col_ptr_[j]; k < col_ptr_[j + 1]; ++k)
+            y[row_idx_[k]] += values_[k] * xj;
+    }
+}
+
+void CSCMatrix::applyTranspose(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("CSCMatrix::applyTranspose", x.size(), rows_, y.size(), cols_);
+    Core::parallel_for_balanced(col_ptr_, kGrain, [&](size_t lo, size_t hi) {
+        for (size_t j = lo; j < hi; ++j) {
+            double s = 0.0;
+            for (size_t k = col_ptr_[j]; k < col_ptr_[j + 1]; ++k)
+                s += values_[k] * x[row_idx_[k]];
+            y[j] = s;
+        }
+    });
+}
+
+SparseMatrix CSCMatrix::to_csr() const {
+    SparseMatrix T = SparseMatrix::from_csr(cols_, rows_, col_ptr_, row_idx_, values_);
+    return T.transposed();
+}
+
+// ─── SELLMatrix ───────────────────────────────────────────────────────────────
+
+SELLMatrix::SELLMatrix(const SparseMatrix& A, size_t C, size_t sigma)
+    : rows_(A.rows()), cols_(A.cols()), nnz_(A.nnz()), C_(C), sigma_(sigma)
+{
+    if (C == 0 || C > kMaxChunk)
+        throw std::invalid_argument("SELLMatrix: chunk size C must be in [1, 64]");
+    if (sigma == 0)
+        throw std::invalid_argument("SELLMatrix: sorting window sigma must be positive");
+
+    const auto& rp  = A.row_ptr();
+    const auto& ci  = A.col_indices();
+    const auto& val = A.values();
+    auto len = [&](size_t i) { return rp[i + 1] - rp[i]; };
+
+    // Sort rows by decreasing length inside each σ-window.  The sort is
+    // stable so σ = 1 (or a regular matrix) keeps the original order.
+    perm_.resize(rows_);
+    std::iota(perm_.begin(), perm_.end(), size_t{0});
+    for (size_t w = 0; w < rows_; w += sigma_) {
+        auto first = perm_.begin() + w;
+        auto last  = perm_.begin() + std::min(rows_, w + sigma_);
+        std::stable_sort(first, last, [&](size_t a, size_t b) { return len(a) > len(b); });
+    }
+
+    const size_t slices = (rows_ + C_ - 1) / C_;
+    row_len_.assign(slices * C_, 0);
+    for (size_t r = 0; r < rows_; ++r) row_len_[r] = len(perm_[r]);
+
+    slice_len_.assign(slices, 0);
+    slice_ptr_.assign(slices + 1, 0);
+    for (size_t s = 0; s < slices; ++s) {
+        slice_len_[s] = *std::max_element(row_len_.begin() + s * C_,
+                                          row_len_.begin() + (s + 1) * C_);
+        slice_ptr_[s + 1] = slice_ptr_[s] + slice_len_[s] * C_;
+    }
+
+    col_idx_.assign(slice_ptr_[slices], 0);
+    values_.assign(slice_ptr_[slices], 0.0);
+    for (size_t s = 0; s < slices; ++s) {
+        for (size_t r = 0; r < C_ && s * C_ + r < rows_; ++r) {
+            const size_t row = perm_[s * C_ + r];
+            const size_t n   = len(row);
+            // Padding repeats the row's last column: a valid, already cached x index.
+            const size_t pad = n ? ci[rp[row + 1] - 1] : 0;
+            for (size_t j = 0; j < slice_len_[s]; ++j) {
+                const size_t slot = slice_ptr_[s] + j * C_ + r;
+                if (j < n) {
+                    col_idx_[slot] = ci[rp[row] + j];
+                    values_[slot]  = val[rp[row] + j];
+                } else {
+                    col_idx_[slot] = pad;
+                }
+            }
+        }
+    }
+}
+
+double SELLMatrix::fillRatio() const noexcept {
+    return nnz_ ? static_cast<double>(values_.size()) / static_cast<double>(nnz_) : 1.0;
+}
+
+void SELLMatrix::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("SELLMatrix::apply", x.size(), cols_, y.size(), rows_);
+    Core::parallel_for_balanced(slice_ptr_, kGrain, [&](size_t lo, size_t hi) {
+        double acc[kMaxChunk];
+        for (size_t s = lo; s < hi; ++s) {
+            std::fill(acc, acc + C_, 0.0);
+            const double* v = values_.data()  + slice_ptr_[s];
+            const size_t* c = col_idx_.data() + slice_ptr_[s];
+            for (size_t j = 0; j < slice_len_[s]; ++j, v += C_, c += C_)
+                for (size_t r = 0; r < C_; ++r)        // unit stride, no branches
+                    acc[r] += v[r] * x[c[r]];
+            const size_t rEnd = std::min(C_, rows_ - s * C_);
+            for (size_t r = 0; r < rEnd; ++r) y[perm_[s * C_ + r]] = acc[r];
+        }
+    });
+}
+
+void SELLMatrix::applyTranspose(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("SELLMatrix::applyTranspose", x.size(), rows_, y.size(), cols_);
+    std::fill(y.begin(), y.end(), 0.0);
+    for (size_t s = 0; s < slice_len_.size(); ++s) {
+        for (size_t j = 0; j < slice_len_[s]; ++j) {
+            const size_t base = slice_ptr_[s] + j * C_;
+            for (size_t r = 0; r < C_ && s * C_ + r < rows_; ++r)
+                y[col_idx_[base + r]] += values_[base + r] * x[perm_[s * C_ + r]];
+        }
+    }
+}
+
+SparseMatrix SELLMatrix::to_csr() const {
+    std::vector<size_t> rp(rows_ + 1, 0);
+    for (size_t r = 0; r < rows_; ++r) rp[perm_[r] + 1] = row_len_[r];
+    for (size_t i = 0; i < rows_; ++i) rp[i + 1] += rp[i];
+
+    std::vector<size_t> ci(rp[rows_]);
+    std::vector<double> vals(rp[rows_]);
+    for (size_t r = 0; r < rows_; ++r) {
+        const size_t s = r / C_, lane = r % C_, row = perm_[r];
+        for (size_t j = 0; j < row_len_[r]; ++j) {
+            const size_t slot = slice_ptr_[s] + j * C_ + lane;
+            ci[rp[row] + j]   = col_idx_[slot];
+            vals[rp[row] + j] = values_[slot];
+        }
+    }
+    return SparseMatrix::from_csr(rows_, cols_, std::move(rp), std::move(ci), std::move(vals));
+}
+
+// ─── BSRMatrix ────────────────────────────────────────────────────────────────
+
+BSRMatrix::BSRMatrix(const SparseMatrix& A, size_t block_size)
+    : rows_(A.rows()), cols_(A.cols()), b_(block_size)
+{
+    if (b_ == 0 || rows_ % b_ != 0 || cols_ % b_ != 0)
+        throw std::invalid_argument(
+            "BSRMatrix: block size " + std::to_string(block_size) +
+            " must divide both dimensions (" + std::to_string(rows_) + "x" +
+            std::to_string(cols_) + ")");
+
+    const auto& rp  = A.row_ptr();
+    const auto& ci  = A.col_indices();
+    const auto& val = A.values();
+    const size_t brows = rows_ / b_, bcols = cols_ / b_, bb = b_ * b_;
+    constexpr size_t kNone = static_cast<size_t>(-1);
+
+    // Pass 1: the distinct block columns of every block row.
+    block_row_ptr_.assign(brows + 1, 0);
+    std::vector<size_t> slot(bcols, kNone);
+    for (size_t I = 0; I < brows; ++I) {
+        const size_t start = block_col_.size();
+        for (size_t i = I * b_; i < (I + 1) * b_; ++i)
+            for (size_t k = rp[i]; k < rp[i + 1]; ++k) {
+                const size_t J = ci[k] / b_;
+                if (slot[J] == kNone) { slot[J] = 0; block_col_.push_back(J); }
+            }
+        std::sort(block_col_.begin() + start, block_col_.end());
+        for (size_t p = start; p < block_col_.size(); ++p) slot[block_col_[p]] = kNone;
+        block_row_ptr_[I + 1] = block_col_.size();
+    }
+
+    // Pass 2: scatter the entries into their (zero-filled) blocks.
+    values_.assign(block_col_.size() * bb, 0.0);
+    for (size_t I = 0; I < brows; ++I) {
+        for (size_t p = block_row_ptr_[I]; p < block_row_ptr_[I + 1]; ++p)
+            slot[block_col_[p]] = p;
+        for (size_t i = I * b_; i < (I + 1) * b_; ++i)
+            for (size_t k = rp[i]; k < rp[i + 1]; ++k) {
+                const size_t p = slot[ci[k] / b_];
+                values_[p * bb + (i - I * b_) * b_ + ci[k] % b_] = val[k];
+            }
+        for (size_t p = block_row_ptr_[I]; p < block_row_ptr_[I + 1]; ++p)
+            slot[block_col_[p]] = kNone;
+    }
+}
+
+void BSRMatrix::apply(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("BSRMatrix::apply", x.size(), cols_, y.size(), rows_);
+    const size_t bb = b_ * b_;
+    const size_t grain = std::max<size_t>(1, kGrain / bb);
+    Core::parallel_for_balanced(block_row_ptr_, grain, [&](size_t lo, size_t hi) {
+        for (size_t I = lo; I < hi; ++I) {
+            double* yI = y.data() + I * b_;
+            std::fill(yI, yI + b_, 0.0);
+            for (size_t p = block_row_ptr_[I]; p < block_row_ptr_[I + 1]; ++p) {
+                const double* blk = values_.data() + p * bb;
+                const double* xJ  = x.data() + block_col_[p] * b_;
+                for (size_t r = 0; r < b_; ++r) {
+                    double s = 0.0;
+                    for (size_t c = 0; c < b_; ++c) s += blk[r * b_ + c] * xJ[c];
+                    yI[r] += s;
+                }
+            }
+        }
+    });
+}
+
+void BSRMatrix::applyTranspose(const std::vector<double>& x, std::vector<double>& y) const {
+    checkSizes("BSRMatrix::applyTranspose", x.size(), rows_, y.size(), cols_);
+    const size_t bb = b_ * b_;
+    std::fill(y.begin(), y.end(), 0.0);
+    for (size_t I = 0; I + 1 < block_row_ptr_.size(); ++I) {
+        const double* xI = x.data() + I * b_;
+        for (size_t p = block_row_ptr_[I]; p < block_row_ptr_[I + 1]; ++p) {
+            const double* blk = values_.data() + p * bb;
+            double*       yJ  = y.data() + block_col_[p] * b_;
+            for (size_t r = 0; r < b_; ++r)
+                for (size_t c = 0; c < b_; ++c) yJ[c] += blk[r * b_ + c] * xI[r];
+        }
+    }
+}
+
+SparseMatrix BSRMatrix::to_csr() const {
+    const size_t bb = b_ * b_;
+    std::vector<size_t> rp(rows_ + 1, 0), ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < rows_; ++i) {
+        const size_t I = i / b_, r = i % b_;
+        for (size_t p = block_row_ptr_[I]; p < block_row_ptr_[I + 1]; ++p)
+            for (size_t c = 0; c < b_; ++c) {
+                const double v = values_[p * bb + r * b_ + c];
+                if (v == 0.0) continue;
+                ci.push_back(block_col_[p] * b_ + c);
+                vals.push_back(v);
+            }
+        rp[i + 1] = ci.size();
+    }
+    return SparseMatrix::from_csr(rows_, cols_, std::move(rp), std::move(ci), std::move(vals));
+}
+
+} // namespace SharedMath::LinearAlgebra
@@ -1,5 +1,7 @@
 #include "LinearAlgebra/SparseMatrix.h"
 
+#include "core/ThreadPool.h"
+
 #include <algorithm>
 #include <numeric>
 #include <iomanip>
@@ -91,6 +93,34 @@ SparseMatrix SparseMatrix::from_triplets(
     return M;
 }
 
+// ── from_csr ──────────────────────────────────────────────────────────────────
+
+SparseMatrix SparseMatrix::from_csr(size_t rows, size_t cols,
+                                    std::vector<size_t> row_ptr,
+                                    std::vector<size_t> col_idx,
+                                    std::vector<double> values)
+{
+    if (row_ptr.size() != rows + 1 || row_ptr.front() != 0 ||
+        row_ptr.back() != col_idx.size() || col_idx.size() != values.size())
+        throw std::invalid_argument("SparseMatrix::from_csr: inconsistent array sizes");
+    for (size_t i = 0; i < rows; ++i) {
+        if (row_ptr[i] > row_ptr[i + 1])
+            throw std::invalid_argument("SparseMatrix::from_csr: row_ptr must be non-decreasing");
+        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+            if (col_idx[k] >= cols)
+                throw std::invalid_argument("SparseMatrix::from_csr: column index out of range");
+            if (k > row_ptr[i] && col_idx[k] <= col_idx[k - 1])
+                throw std::invalid_argument(
+                    "SparseMatrix::from_csr: columns must be strictly ascending within a row");
+        }
+    }
+    SparseMatrix M(rows, cols);
+    M.row_ptr_ = std::move(row_ptr);
+    M.col_idx_ = std::move(col_idx);
+    M.values_  = std::move(values);
+    return M;
+}
+
 // ── from_dense ────────────────────────────────────────────────────────────────
 
 SparseMatrix SparseMatrix::from_dense(const AbstractMatrix& A, double tol) {
@@ -164,6 +194,27 @@ void SparseMatrix::set(size_t r, size_t c, double v) {
 }
 
 // ── SpMV ──────────────────────────────────────────────────────────────────────
+// Rows are independent, so both products below are split by row ranges over
+// the shared thread pool.  The ranges are cut on row_ptr_, i.e. by non-zero
+// count: a handful of dense rows no longer serialise a whole chunk.
+
+namespace {
+
+constexpr size_t kSpmvGrain = 8192;   // non-zeros per task, at least
+
+void csrMultiply(const std::vector<size_t>& rp, const std::vector<size_t>& ci,
+                 const std::vector<double>& val, const double* x, double* y) {
+    Core::parallel_for_balanced(rp, kSpmvGrain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            double s = 0.0;
+            for (size_t k = rp[i]; k < rp[i + 1]; ++k)
+                s += val[k] * x[ci[k]];
+            y[i] = s;
+        }
+    });
+}
+
+} // namespace
 
 DynamicVector SparseMatrix::operator*(const DynamicVector& x) const {
     if (x.size() != cols_)
@@ -171,30 +222,34 @@ DynamicVector SparseMatrix::operator*(const DynamicVector& x) const {
             "SparseMatrix * DynamicVector: dimension mismatch (" +
             std::to_string(cols_) + " vs " + std::to_string(x.size()) + ")");
     DynamicVector y(rows_, 0.0);
-    for (size_t i = 0; i < rows_; ++i) {
-        double s = 0.0;
-        for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k)
-            s += values_[k] * x[col_idx_[k]];
-        y[i] = s;
-    }
+    csrMultiply(row_ptr_, col_idx_, values_, x.data(), y.data());
     return y;
 }
 
+void SparseMatrix::multiply(const std::vector<double>& x, std::vector<double>& y) const {
+    if (x.size() != cols_ || y.size() != rows_)
+        throw std::invalid_argument("SparseMatrix::multiply: dimension mismatch");
+    csrMultiply(row_ptr_, col_idx_, values_, x.data(), y.data());
+}
+
 // ── Sparse × Dense ────────────────────────────────────────────────────────────
 
 DynamicMatrix SparseMatrix::operator*(const DynamicMatrix& B) const {
     if (cols_ != B.rows())
         throw std::invalid_argument("SparseMatrix * DynamicMatrix: inner dim mismatch");
     DynamicMatrix C(rows_, B.cols(), 0.0);
-    for (size_t i = 0; i < rows_; ++i) {
-        double* Ci = C.row_ptr(i);
-        for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k) {
-            double   aik = values_[k];
-            size_t   col = col_idx_[k];
-            const double* Bk = B.row_ptr(col);
-            for (size_t j = 0; j < B.cols(); ++j) Ci[j] += aik * Bk[j];
+    const size_t grain = std::max<size_t>(1, kSpmvGrain / std::max<size_t>(1, B.cols()));
+    Core::parallel_for_balanced(row_ptr_, grain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            double* Ci = C.row_ptr(i);
+            for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k) {
+                double   aik = values_[k];
+                size_t   col = col_idx_[k];
+                const double* Bk = B.row_ptr(col);
+                for (size_t j = 0; j < B.cols(); ++j) Ci[j] += aik * Bk[j];
+            }
         }
-    }
+    });
     return C;
 }
 
@@ -264,51 +319,86 @@ SparseMatrix SparseMatrix::operator*(double s) const {
 SparseMatrix SparseMatrix::operator/(double s) const { return *this * (1.0 / s); }
 
 // ── Sparse–sparse multiply ────────────────────────────────────────────────────
+// Gustavson's row-by-row product, C[i,:] = Σ_k A[i,k]·B[k,:], in two passes
+// over nnz-balanced row ranges:
+//   symbolic — count the distinct columns of every C row (marker array),
+//   numeric  — prefix-sum the counts, then each range writes its rows
+//              straight into the final CSR arrays with a dense accumulator.
+// The scratch arrays are sized by B.cols() and allocated per task, so at
+// most one set per thread is alive at a time.
 
 SparseMatrix SparseMatrix::matmul(const SparseMatrix& B) const {
     if (cols_ != B.rows_)
         throw std::invalid_argument("SparseMatrix::matmul: inner dim mismatch");
-    // Row-by-row: C[i,:] = sum_k A[i,k] * B[k,:]
-    std::vector<size_t> ri, ci;
-    std::vector<double>  vals;
-    std::vector<double>  acc(B.cols_, 0.0);  // dense accumulator for current row
-    std::vector<size_t>  touched;
-
-    for (size_t i = 0; i < rows_; ++i) {
-        touched.clear();
-        for (size_t ka = row_ptr_[i]; ka < row_ptr_[i + 1]; ++ka) {
-            size_t k = col_idx_[ka];
-            double aik = values_[ka];
-            for (size_t kb = B.row_ptr_[k]; kb < B.row_ptr_[k + 1]; ++kb) {
-                size_t j = B.col_idx_[kb];
-                if (acc[j] == 0.0) touched.push_back(j);
-                acc[j] += aik * B.values_[kb];
+    constexpr size_t kNone = static_cast<size_t>(-1);
+
+    std::vector<size_t> rp(rows_ + 1, 0);
+    Core::parallel_for_balanced(row_ptr_, kSpmvGrain, [&](size_t lo, size_t hi) {
+        std::vector<size_t> mark(B.cols_, kNone);
+        for (size_t i = lo; i < hi; ++i) {
+            size_t count = 0;
+            for (size_t ka = row_ptr_[i]; ka < row_ptr_[i + 1]; ++ka) {
+                size_t k = col_idx_[ka];
+                for (size_t kb = B.row_ptr_[k]; kb < B.row_ptr_[k + 1]; ++kb) {
+                    size_t j = B.col_idx_[kb];
+                    if (mark[j] != i) { mark[j] = i; ++count; }
+                }
             }
+            rp[i + 1] = count;
         }
-        std::sort(touched.begin(), touched.end());
-        for (size_t j : touched) {
-            if (acc[j] != 0.0) { ri.push_back(i); ci.push_back(j); vals.push_back(acc[j]); }
-            acc[j] = 0.0;
+    });
+    for (size_t i = 0; i < rows_; ++i) rp[i + 1] += rp[i];
+
+    std::vector<size_t> ci(rp[rows_]);
+    std::vector<double> vals(rp[rows_]);
+    Core::parallel_for_balanced(row_ptr_, kSpmvGrain, [&](size_t lo, size_t hi) {
+        std::vector<double> acc(B.cols_, 0.0);
+        std::vector<size_t> mark(B.cols_, kNone);
+        for (size_t i = lo; i < hi; ++i) {
+            size_t out = rp[i];
+            for (size_t ka = row_ptr_[i]; ka < row_ptr_[i + 1]; ++ka) {
+                size_t k   = col_idx_[ka];
+                double aik = values_[ka];
+                for (size_t kb = B.row_ptr_[k]; kb < B.row_ptr_[k + 1]; ++kb) {
+                    size_t j = B.col_idx_[kb];
+                    if (mark[j] != i) { mark[j] = i; ci[out++] = j; }
+                    acc[j] += aik * B.values_[kb];
+                }
+            }
+            std::sort(ci.begin() + rp[i], ci.begin() + rp[i + 1]);
+            for (size_t p = rp[i]; p < rp[i + 1]; ++p) {
+                vals[p] = acc[ci[p]];
+                acc[ci[p]] = 0.0;
+            }
         }
-    }
-    return from_triplets(rows_, B.cols_, ri, ci, vals);
+    });
+
+    SparseMatrix C(rows_, B.cols_);
+    C.row_ptr_ = std::move(rp);
+    C.col_idx_ = std::move(ci);
+    C.values_  = std::move(vals);
+    return C;
 }
 
 // ── Transpose ─────────────────────────────────────────────────────────────────
+// Counting sort on column index.  Walking the rows in order leaves every
+// row of the transpose already sorted.
 
 SparseMatrix SparseMatrix::transposed() const {
-    std::vector<size_t> ri, ci;
-    std::vector<double>  vals;
-    ri.reserve(values_.size());
-    ci.reserve(values_.size());
-    vals.reserve(values_.size());
+    SparseMatrix T(cols_, rows_);
+    for (size_t c : col_idx_) ++T.row_ptr_[c + 1];
+    for (size_t j = 0; j < cols_; ++j) T.row_ptr_[j + 1] += T.row_ptr_[j];
+
+    T.col_idx_.resize(values_.size());
+    T.values_.resize(values_.size());
+    std::vector<size_t> next(T.row_ptr_.begin(), T.row_ptr_.end() - 1);
     for (size_t i = 0; i < rows_; ++i)
         for (size_t k = row_ptr_[i]; k < row_ptr_[i + 1]; ++k) {
-            ri.push_back(col_idx_[k]);
-            ci.push_back(i);
-            vals.push_back(values_[k]);
+            size_t dst = next[col_idx_[k]]++;
+            T.col_idx_[dst] = i;
+            T.values_[dst]  = values_[k];
         }
-    return from_triplets(cols_, rows_, ri, ci, vals);
+    return T;
 }
 
 // ── to_dense ──────────────────────────────────────────────────────────────────
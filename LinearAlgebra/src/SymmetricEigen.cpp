@@ -0,0 +1,453 @@
+// SymmetricEigen.cpp — eig / eigvals / eigs for real symmetric matrices.
+//
+// The standard three-stage pipeline (LAPACK dsyev / dsyevx structure):
+//
+//   1. Householder reduction  A = Q·T·Qᵀ,  T symmetric tridiagonal
+//        O(4/3·n³), blocked so half of the work is GEMM
+//   2. Eigenvalues of T by implicit-shift QL with deflation
+//        O(n²) for values only; with vectors the rotations of many sweeps
+//        are batched and applied to column blocks of Zᵀ in parallel
+//      or, for the top-k pairs, inverse iteration on T (O(n·k))
+//   3. Back-transformation  V = Q·Z, with Q applied as blocks of reflectors
+//      in compact WY form (three GEMMs per block)
+//
+// Q is never formed explicitly.
+
+#include "MatrixFunctions.h"
+#include "Gemm.h"
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace SharedMath::LinearAlgebra {
+
+namespace {
+
+constexpr double kEps          = std::numeric_limits<double>::epsilon();
+constexpr size_t kTridiagBlock = 32;            // reflectors per tridiagonalization panel
+constexpr size_t kWYBlock      = 64;            // reflectors per back-transformation block
+constexpr size_t kRotBytes     = 1024 * 1024;   // Zᵀ column block for batched rotations
+
+DynamicMatrix toDynamicCopy(const AbstractMatrix& A) {
+    if (const auto* d = dynamic_cast<const DynamicMatrix*>(&A))
+        return *d;
+    return DynamicMatrix(A);
+}
+
+// ─── Stage 1: tridiagonalization ──────────────────────────────────────────────
+// After the call, d / e hold the diagonal / off-diagonal of T (e[n−1] = 0),
+// tau[k] the scalar of reflector H_k, and row k of `a` at columns k+1.. its
+// vector v_k (v_k[0] = 1 stored explicitly).  H_k acts on indices k+1..n−1.
+//
+// Blocked as in LAPACK dsytrd/dlatrd: within a panel of kTridiagBlock
+// reflectors the trailing matrix is left untouched and each p = τ·S·v is
+// corrected with the panel's V / W; the accumulated rank-2·nb update
+// S ← S − V·Wᵀ − W·Vᵀ then goes through two GEMMs.  Half of the flops land
+// in GEMM and the trailing matrix is only read, not rewritten, per reflector.
+
+struct Tridiagonal {
+    std::vector<double> d, e, tau;
+};
+
+Tridiagonal tridiagonalize(DynamicMatrix& A) {
+    const size_t n = A.rows();
+    double* a = A.toPtr();
+    Tridiagonal T{std::vector<double>(n, 0.0), std::vector<double>(n, 0.0),
+                  std::vector<double>(n, 0.0)};
+    std::vector<double> Vt, Wt, y(n), s1(kTridiagBlock), s2(kTridiagBlock);
+
+    for (size_t k0 = 0; k0 + 2 < n; k0 += kTridiagBlock) {
+        const size_t nb = std::min(kTridiagBlock, n - 2 - k0);
+        const size_t r0 = k0 + 1, m0 = n - r0;    // panel vectors live on rows r0..n−1
+        Vt.assign(nb * m0, 0.0);
+        Wt.assign(nb * m0, 0.0);
+
+        for (size_t j = 0; j < nb; ++j) {
+            const size_t k = k0 + j;
+            double* ak = a + k * n;               // row k = column k by symmetry
+            // Bring column k up to date with the panel's earlier reflectors.
+            for (size_t q = 0; q < j; ++q) {
+                const double* vq = Vt.data() + q * m0;
+                const double* wq = Wt.data() + q * m0;
+                const double vk = vq[k - r0], wk = wq[k - r0];
+                for (size_t c = k; c < n; ++c) ak[c] -= vk * wq[c - r0] + wk * vq[c - r0];
+            }
+
+            double* v = ak + k + 1;
+            const size_t m = n - k - 1;
+            double xnorm = 0.0;
+            for (size_t i = 1; i < m; ++i) xnorm += v[i] * v[i];
+            xnorm = std::sqrt(xnorm);
+            T.d[k] = ak[k];
+            const double alpha = v[0];
+            double tau = 0.0;
+            if (xnorm == 0.0) {                   // already reduced: H_k = I
+                T.e[k] = alpha;
+            } else {
+                const double beta = -(alpha >= 0.0 ? 1.0 : -1.0) * std::hypot(alpha, xnorm);
+                tau = (beta - alpha) / beta;
+                const double scale = 1.0 / (alpha - beta);
+                for (size_t i = 1; i < m; ++i) v[i] *= scale;
+                T.e[k] = beta;
+            }
+            v[0]     = 1.0;
+            T.tau[k] = tau;
+            double* vj = Vt.data() + j * m0;
+            double* wj = Wt.data() + j * m0;
+            std::copy(v, v + m, vj + (k + 1 - r0));
+            if (tau == 0.0) continue;
+
+            // y = S·v on the not-yet-updated trailing block, rows in parallel.
+            Core::parallel_for(k + 1, n, 32, [&](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i) {
+                    const double* Si = a + i * n + (k + 1);
+                    double s = 0.0;
+                    for (size_t c = 0; c < m; ++c) s += Si[c] * v[c];
+                    y[i - r0] = s;
+                }
+            });
+            // y −= V·(Wᵀv) + W·(Vᵀv) over the panel's earlier reflectors.
+            for (size_t q = 0; q < j; ++q) {
+                const double* vq = Vt.data() + q * m0;
+                const double* wq = Wt.data() + q * m0;
+                double sw = 0.0, sv = 0.0;
+                for (size_t c = k + 1 - r0; c < m0; ++c) {
+                    sw += wq[c] * vj[c];
+                    sv += vq[c] * vj[c];
+                }
+                s1[q] = sw;
+                s2[q] = sv;
+            }
+            for (size_t q = 0; q < j; ++q) {
+                const double* vq = Vt.data() + q * m0;
+                const double* wq = Wt.data() + q * m0;
+                for (size_t c = k + 1 - r0; c < m0; ++c) y[c] -= vq[c] * s1[q] + wq[c] * s2[q];
+            }
+            // w = τ·y − (τ²/2)(yᵀv)·v
+            double yv = 0.0;
+            for (size_t c = k + 1 - r0; c < m0; ++c) yv += y[c] * vj[c];
+            const double K = -0.5 * tau * tau * yv;
+            for (size_t c = k + 1 - r0; c < m0; ++c) wj[c] = tau * y[c] + K * vj[c];
+        }
+
+        // Trailing block S ← S − V·Wᵀ − W·Vᵀ, both triangles kept.
+        const size_t kend = k0 + nb, mt = n - kend, off = kend - r0;
+        double* S = a + kend * n + kend;
+        gemm(Transpose::Yes, Transpose::No, mt, mt, nb, -1.0,
+             Vt.data() + off, m0, Wt.data() + off, m0, 1.0, S, n);
+        gemm(Transpose::Yes, Transpose::No, mt, mt, nb, -1.0,
+             Wt.data() + off, m0, Vt.data() + off, m0, 1.0, S, n);
+    }
+    if (n >= 2) {
+        T.d[n - 2] = a[(n - 2) * n + (n - 2)];
+        T.e[n - 2] = a[(n - 2) * n + (n - 1)];
+    }
+    if (n >= 1) T.d[n - 1] = a[(n - 1) * n + (n - 1)];
+    return T;
+}
+
+// ─── Stage 2a: implicit-shift QL ──────────────────────────────────────────────
+// Classic tql2 with Wilkinson-type shift and deflation on negligible e[m].
+// If Zt is given (n×n, row i = i-th Schur vector of T), the plane rotations
+// are recorded rather than applied one by one.  Batches spanning many sweeps
+// are then applied to narrow column blocks of Zt: a block stays in cache
+// while every rotation of the batch passes over it, instead of the whole of
+// Zt streaming through memory once per sweep.  Blocks run in parallel.
+
+struct Rotation { size_t i; double c, s; };
+
+void applyRotations(const std::vector<Rotation>& rot, DynamicMatrix& Zt) {
+    if (rot.empty()) return;
+    const size_t n = Zt.cols();
+    double* z = Zt.toPtr();
+    // n rows × W columns of doubles ≈ kRotBytes (L2-sized)
+    const size_t W = std::clamp<size_t>(kRotBytes / (8 * n), 8, 512);
+    Core::parallel_for(0, (n + W - 1) / W, 1, [&](size_t blo, size_t bhi) {
+        for (size_t blk = blo; blk < bhi; ++blk) {
+            const size_t lo = blk * W, hi = std::min(n, lo + W);
+            for (const Rotation& r : rot) {
+                double* zi  = z + r.i * n;
+                double* zi1 = zi + n;
+                for (size_t k = lo; k < hi; ++k) {
+                    const double f = zi1[k];
+                    zi1[k] = r.s * zi[k] + r.c * f;
+                    zi[k]  = r.c * zi[k] - r.s * f;
+                }
+            }
+        }
+    });
+}
+
+void tql(std::vector<double>& d, std::vector<double>& e, DynamicMatrix* Zt,
+         size_t max_iter, const char* who)
+{
+    const size_t n = d.size();
+    std::vector<Rotation> rot;
+    for (size_t l = 0; l < n; ++l) {
+        size_t iter = 0;
+        size_t m;
+        do {
+            for (m = l; m + 1 < n; ++m) {
+                const double dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                if (std::abs(e[m]) <= kEps * dd) break;
+            }
+            if (m == l) break;
+            if (iter++ == max_iter)
+                throw std::runtime_error(std::string(who) + ": QL iteration did not converge");
+
+            double g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+            double r = std::hypot(g, 1.0);
+            g = d[m] - d[l] + e[l] / (g + (g >= 0.0 ? r : -r));
+            double s = 1.0, c = 1.0, p = 0.0;
+            bool underflow = false;
+            for (size_t i = m; i-- > l; ) {
+                double f = s * e[i];
+                const double b = c * e[i];
+                r = std::hypot(f, g);
+                e[i + 1] = r;
+                if (r == 0.0) {                  // recover from underflow
+                    d[i + 1] -= p;
+                    e[m] = 0.0;
+                    underflow = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2.0 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+                if (Zt) rot.push_back({i, c, s});
+            }
+            if (Zt && rot.size() >= 32 * n) {
+                applyRotations(rot, *Zt);
+                rot.clear();
+            }
+            if (underflow) continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0.0;
+        } while (m != l);
+    }
+    if (Zt) applyRotations(rot, *Zt);
+}
+
+// ─── Stage 2b: inverse iteration for selected eigenvalues ─────────────────────
+// (T − λI)·x = b solved with a pivoted tridiagonal LU (LAPACK dgttrf/dgttrs
+// layout).  Vectors whose eigenvalues are closer than 1e-3·‖T‖ form a
+// cluster and are re-orthogonalised against each other after every solve.
+
+struct TridiagonalLU {
+    std::vector<double> dl, d, du, du2;
+    std::vector<bool>   swapped;
+
+    TridiagonalLU(const std::vector<double>& diag, const std::vector<double>& off,
+                  double lambda, double tiny)
+        : dl(off), d(diag), du(off), du2(diag.size(), 0.0), swapped(diag.size(), false)
+    {
+        const size_t n = d.size();
+        for (double& x : d) x -= lambda;
+        for (size_t i = 0; i + 1 < n; ++i) {
+            if (std::abs(d[i]) >= std::abs(dl[i])) {
+                if (d[i] == 0.0) d[i] = tiny;
+                const double fact = dl[i] / d[i];
+                dl[i] = fact;
+                d[i + 1] -= fact * du[i];
+            } else {
+                const double fact = d[i] / dl[i];
+                d[i]  = dl[i];
+                dl[i] = fact;
+                const double tmp = du[i];
+                du[i]    = d[i + 1];
+                d[i + 1] = tmp - fact * d[i + 1];
+                if (i + 2 < n) {
+                    du2[i]    = du[i + 1];
+                    du[i + 1] = -fact * du[i + 1];
+                }
+                swapped[i] = true;
+            }
+        }
+        if (n && d[n - 1] == 0.0) d[n - 1] = tiny;
+    }
+
+    void solve(std::vector<double>& b) const {
+        const size_t n = d.size();
+        for (size_t i = 0; i + 1 < n; ++i) {
+            if (!swapped[i]) {
+                b[i + 1] -= dl[i] * b[i];
+            } else {
+                const double tmp = b[i];
+                b[i]     = b[i + 1];
+                b[i + 1] = tmp - dl[i] * b[i];
+            }
+        }
+        for (size_t i = n; i-- > 0; ) {
+            double s = b[i];
+            if (i + 1 < n) s -= du[i] * b[i + 1];
+            if (i + 2 < n) s -= du2[i] * b[i + 2];
+            b[i] = s / d[i];
+        }
+    }
+};
+
+// Columns of the returned n×k matrix are eigenvectors of T for `lambda`.
+DynamicMatrix inverseIteration(const Tridiagonal& T, const std::vector<double>& lambda) {
+    const size_t n = T.d.size(), k = lambda.size();
+    double tnorm = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        tnorm = std::max(tnorm, std::abs(T.d[i]) + std::abs(T.e[i]) +
+                                (i ? std::abs(T.e[i - 1]) : 0.0));
+    const double tiny = std::max(tnorm, 1.0) * kEps;
+    const double gap  = 1e-3 * tnorm;
+
+    std::vector<std::vector<double>> X(k, std::vector<double>(n));
+    size_t clusterStart = 0;
+    for (size_t j = 0; j < k; ++j) {
+        if (j == 0 || std::abs(lambda[j] - lambda[j - 1]) > gap) clusterStart = j;
+        // Nudge repeated eigenvalues apart so each solve is distinct.
+        double mu = lambda[j];
+        if (j > clusterStart) mu -= static_cast<double>(j - clusterStart) * tiny;
+        TridiagonalLU lu(T.d, T.e, mu, tiny);
+
+        std::vector<double>& x = X[j];
+        for (size_t i = 0; i < n; ++i)                        // deterministic start
+            x[i] = 1.0 + 0.5 * std::sin(0.7 * static_cast<double>(i + 1) + static_cast<double>(j));
+        for (int it = 0; it < 4; ++it) {
+            lu.solve(x);
+            for (size_t q = clusterStart; q < j; ++q) {
+                double dot = 0.0;
+                for (size_t i = 0; i < n; ++i) dot += X[q][i] * x[i];
+                for (size_t i = 0; i < n; ++i) x[i] -= dot * X[q][i];
+            }
+            double nrm = 0.0;
+            for (double v : x) nrm += v * v;
+            nrm = std::sqrt(nrm);
+            for (double& v : x) v /= nrm;
+        }
+    }
+    DynamicMatrix Z(n, k);
+    for (size_t j = 0; j < k; ++j)
+        for (size_t i = 0; i < n; ++i) Z(i, j) = X[j][i];
+    return Z;
+}
+
+// ─── Stage 3: back-transformation ─────────────────────────────────────────────
+// Z ← Q·Z with Q = H_0·H_1⋯H_{n−3}.  Reflectors are taken kWYBlock at a time
+// as I − V·T·Vᵀ and applied last block first.
+
+void backTransform(const DynamicMatrix& A, const std::vector<double>& tau, DynamicMatrix& Z) {
+    const size_t n = A.rows(), k = Z.cols();
+    if (n < 3 || k == 0) return;
+    const size_t refl = n - 2;
+    std::vector<double> V, Tm, W, W2;
+
+    for (size_t b1 = refl; b1 > 0; ) {
+        const size_t b0 = b1 > kWYBlock ? b1 - kWYBlock : 0;
+        const size_t nb = b1 - b0, r0 = b0 + 1, mr = n - r0;
+
+        // V: column c holds v_{b0+c}, which starts at row b0+c+1.
+        V.assign(mr * nb, 0.0);
+        for (size_t c = 0; c < nb; ++c) {
+            const double* v = A.row_ptr(b0 + c) + (b0 + c + 1);
+            for (size_t r = c; r < mr; ++r) V[r * nb + c] = v[r - c];
+        }
+        // T(0:i, i) = −τ_i · T(0:i, 0:i) · V(:, 0:i)ᵀ·v_i
+        Tm.assign(nb * nb, 0.0);
+        std::vector<double> z(nb);
+        for (size_t i = 0; i < nb; ++i) {
+            const double ti = tau[b0 + i];
+            Tm[i * nb + i] = ti;
+            if (i == 0 || ti == 0.0) continue;
+            std::fill(z.begin(), z.begin() + i, 0.0);
+            for (size_t r = i; r < mr; ++r)
+                for (size_t c = 0; c < i; ++c) z[c] += V[r * nb + c] * V[r * nb + i];
+            for (size_t p = 0; p < i; ++p) {
+                double s = 0.0;
+                for (size_t q = p; q < i; ++q) s += Tm[p * nb + q] * z[q];
+                Tm[p * nb + i] = -ti * s;
+            }
+        }
+
+        double* C = Z.row_ptr(r0);
+        W.assign(nb * k, 0.0);
+        W2.assign(nb * k, 0.0);
+        gemm(Transpose::Yes, Transpose::No, nb, k, mr, 1.0, V.data(), nb, C, k, 0.0, W.data(), k);
+        gemm(Transpose::No, Transpose::No, nb, k, nb, 1.0, Tm.data(), nb, W.data(), k, 0.0, W2.data(), k);
+        gemm(Transpose::No, Transpose::No, mr, k, nb, -1.0, V.data(), nb, W2.data(), k, 1.0, C, k);
+        b1 = b0;
+    }
+}
+
+void requireSquare(const AbstractMatrix& A, const char* who) {
+    if (A.rows() != A.cols())
+        throw std::invalid_argument(std::string(who) + ": requires square matrix");
+}
+
+} // namespace
+
+// ─── Public API ───────────────────────────────────────────────────────────────
+
+std::pair<std::vector<double>, DynamicMatrix>
+eig(const AbstractMatrix& A, size_t max_iter)
+{
+    requireSquare(A, "eig");
+    const size_t n = A.rows();
+    DynamicMatrix H = toDynamicCopy(A);
+    Tridiagonal T = tridiagonalize(H);
+
+    DynamicMatrix Zt = DynamicMatrix::eye(n);
+    tql(T.d, T.e, &Zt, max_iter, "eig");
+
+    // Descending order; column i of Z is the eigenvector of evals[i].
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return T.d[a] > T.d[b]; });
+    std::vector<double> evals(n);
+    DynamicMatrix Z(n, n);
+    for (size_t c = 0; c < n; ++c) {
+        evals[c] = T.d[order[c]];
+        const double* src = Zt.row_ptr(order[c]);
+        for (size_t r = 0; r < n; ++r) Z(r, c) = src[r];
+    }
+    backTransform(H, T.tau, Z);
+    return {evals, Z};
+}
+
+std::vector<double> eigvals(const AbstractMatrix& A, size_t max_iter) {
+    requireSquare(A, "eigvals");
+    DynamicMatrix H = toDynamicCopy(A);
+    Tridiagonal T = tridiagonalize(H);
+    tql(T.d, T.e, nullptr, max_iter, "eigvals");
+    std::sort(T.d.begin(), T.d.end(), std::greater<double>());
+    return T.d;
+}
+
+std::pair<std::vector<double>, DynamicMatrix>
+eigs(const AbstractMatrix& A, size_t k, size_t max_iter)
+{
+    requireSquare(A, "eigs");
+    const size_t n = A.rows();
+    if (k > n)
+        throw std::invalid_argument("eigs: k exceeds the matrix dimension");
+    DynamicMatrix H = toDynamicCopy(A);
+    Tridiagonal T = tridiagonalize(H);
+
+    std::vector<double> lambda = T.d, off = T.e;
+    tql(lambda, off, nullptr, max_iter, "eigs");
+    std::sort(lambda.begin(), lambda.end(), std::greater<double>());
+    lambda.resize(k);
+
+    DynamicMatrix Z = inverseIteration(T, lambda);
+    backTransform(H, T.tau, Z);
+    return {lambda, Z};
+}
+
+} // namespace SharedMath::LinearAlgebra
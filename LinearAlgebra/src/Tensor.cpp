@@ -1,4 +1,8 @@
 #include "Tensor.h"
+#include "Gemm.h"
+#include "Conv2d.h"
+
+#include "core/ThreadPool.h"
 
 #ifdef SHAREDMATH_CUDA
 #  include "TensorCUDA.h"   // CUDA dispatch declarations (internal header)
@@ -14,11 +18,18 @@
 #include <stdexcept>
 #include <random>
 #include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 
 namespace SharedMath::LinearAlgebra {
 
 namespace {
 
+// Element-wise loops and global reductions go to the thread pool once a
+// tensor holds more than this many elements.
+constexpr size_t kParallelGrain = size_t{1} << 15;
+
 size_t shapeSize(const Tensor::Shape& shape) {
     if (shape.empty()) return 0;
     size_t total = 1;
@@ -49,8 +60,258 @@ size_t mlOutDim(size_t input, size_t kernel, size_t stride,
     return (padded - kernel) / stride + 1;
 }
 
+// Input rows [lo, hi) under pooling window o (padding clipped away).
+std::pair<size_t, size_t> poolWindow(size_t o, size_t kernel, size_t stride,
+                                     size_t padding, size_t extent) {
+    const size_t start = o * stride;
+    const size_t lo = start > padding ? start - padding : 0;
+    const size_t hi = std::min(extent, start + kernel > padding ? start + kernel - padding : 0);
+    return {std::min(lo, hi), hi};
+}
+
+// Kernel geometry for an NCHW input and an [OC, C / groups, KH, KW] weight.
+Conv2dShape convShape(const Tensor::Shape& in, const Tensor::Shape& weight,
+                      size_t stride, size_t padding, size_t dilation,
+                      size_t groups, const char* who) {
+    if (groups == 0 || weight[1] * groups != in[1])
+        throw std::invalid_argument(std::string(who) + ": input channel mismatch");
+    Conv2dShape s;
+    s.N  = in[0];     s.C  = in[1];     s.H  = in[2];     s.W = in[3];
+    s.OC = weight[0]; s.KH = weight[2]; s.KW = weight[3];
+    s.stride = stride; s.padding = padding; s.dilation = dilation; s.groups = groups;
+    s.validate(who);
+    return s;
+}
+
+#ifdef SHAREDMATH_CUDA
+// The CUDA kernels cover square, undilated, ungrouped convolutions; the
+// rest runs on the host.
+bool cudaConvFits(const Conv2dShape& s) {
+    return s.KH == s.KW && s.dilation == 1 && s.groups == 1;
+}
+#endif
+
+// Strides of a strided tensor laid out against a broadcast result shape:
+// missing leading axes and size-1 axes get stride 0.
+std::vector<size_t> broadcastStrides(const Tensor::Shape& src,
+                                     const std::vector<size_t>& srcStrides,
+                                     const Tensor::Shape& out) {
+    std::vector<size_t> strides(out.size(), 0);
+    const size_t lead = out.size() - src.size();
+    for (size_t i = 0; i < src.size(); ++i)
+        strides[lead + i] = (src[i] == 1) ? 0 : srcStrides[i];
+    return strides;
+}
+
+// Strides of the row-major result of a reduction over `axis`, laid out
+// against the input shape: every element along the axis maps to one slot.
+std::vector<size_t> reducedStrides(const Tensor::Shape& shape, size_t axis) {
+    std::vector<size_t> strides(shape.size(), 0);
+    size_t stride = 1;
+    for (size_t i = shape.size(); i-- > 0;) {
+        if (i == axis) continue;
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+    return strides;
+}
+
+// True when `strides` walk `shape` in row-major order without gaps.  Size-1
+// axes never move the offset, so their stride is irrelevant.
+bool isRowMajor(const Tensor::Shape& shape, const std::vector<size_t>& strides) {
+    size_t expect = 1;
+    for (size_t i = shape.size(); i-- > 0;) {
+        if (shape[i] != 1 && strides[i] != expect) return false;
+        expect *= shape[i];
+    }
+    return true;
+}
+
+// Visit rows [rowLo, rowHi) of `shape` — a row being one run along the last
+// axis — and call fn(row, offA, offB) with the matching start offsets in two
+// strided operands.  Offsets are advanced odometer-style, so there is no
+// per-element unravel.
+template<typename Fn>
+void forEachRow(const Tensor::Shape& shape,
+                const std::vector<size_t>& sa, const std::vector<size_t>& sb,
+                size_t rowLo, size_t rowHi, Fn&& fn) {
+    const size_t outer = shape.size() - 1;
+    std::vector<size_t> idx(outer, 0);
+    size_t oa = 0, ob = 0, rem = rowLo;
+    for (size_t d = outer; d-- > 0;) {
+        idx[d] = rem % shape[d];
+        rem   /= shape[d];
+        oa += idx[d] * sa[d];
+        ob += idx[d] * sb[d];
+    }
+    for (size_t row = rowLo; row < rowHi; ++row) {
+        fn(row, oa, ob);
+        for (size_t d = outer; d-- > 0;) {
+            oa += sa[d];
+            ob += sb[d];
+            if (++idx[d] < shape[d]) break;
+            oa -= sa[d] * shape[d];
+            ob -= sb[d] * shape[d];
+            idx[d] = 0;
+        }
+    }
+}
+
+// Visit the elements with row-major index in [lo, hi) of a strided layout as
+// runs along the last axis: fn(off, n, step) covers n elements starting at
+// buffer offset `off`, `step` apart.
+template<typename Fn>
+void forEachRun(const Tensor::Shape& shape, const std::vector<size_t>& strides,
+                size_t lo, size_t hi, Fn&& fn) {
+    if (lo >= hi) return;
+    const size_t inner = shape.back(), step = strides.back();
+    forEachRow(shape, strides, strides, lo / inner, (hi - 1) / inner + 1,
+               [&](size_t row, size_t off, size_t) {
+        const size_t b = std::max(lo, row * inner) - row * inner;
+        const size_t e = std::min(hi, (row + 1) * inner) - row * inner;
+        fn(off + b * step, e - b, step);
+    });
+}
+
+// Index along `axis` of the best element for every slot of the reduced
+// shape.  better(x, best) must be strict so ties keep the first index.
+template<typename Better>
+Tensor argAlongAxis(const Tensor::Shape& shape, const std::vector<size_t>& strides,
+                    const double* src, size_t axis, double init, Better better) {
+    Tensor::Shape rshape = shapeWithoutAxis(shape, axis);
+    std::vector<double> best(shapeSize(rshape), init), arg(best.size(), 0.0);
+    const size_t n = shapeSize(shape);
+    if (n > 0) {
+        const auto rs = reducedStrides(shape, axis);
+        const size_t inner = shape.back(), ia = strides.back(), ir = rs.back();
+        const bool lastAxis = axis + 1 == shape.size();
+        size_t rowsPerStep = 1;   // rows between neighbours along the axis
+        for (size_t d = axis + 1; d + 1 < shape.size(); ++d) rowsPerStep *= shape[d];
+        forEachRow(shape, strides, rs, 0, n / inner,
+                   [&](size_t row, size_t oa, size_t orr) {
+            for (size_t j = 0; j < inner; ++j) {
+                const double x = src[oa + j * ia];
+                const size_t r = orr + j * ir;
+                if (better(x, best[r])) {
+                    best[r] = x;
+                    arg[r]  = static_cast<double>(
+                        lastAxis ? j : (row / rowsPerStep) % shape[axis]);
+                }
+            }
+        });
+    }
+    return Tensor(std::move(rshape), std::move(arg));
+}
+
+// How gemm can read a 2-D strided operand in place: rows with unit stride
+// (Transpose::No) or columns with unit stride (Transpose::Yes), ld being the
+// stride of the other axis.  False for any other layout.
+bool gemmLayout(const Tensor::Shape& shape, const std::vector<size_t>& strides,
+                Transpose& trans, size_t& ld) {
+    if (strides[1] == 1 && strides[0] >= shape[1]) {
+        trans = Transpose::No;
+        ld    = strides[0];
+        return true;
+    }
+    if (strides[0] == 1 && strides[1] >= shape[0]) {
+        trans = Transpose::Yes;
+        ld    = strides[1];
+        return true;
+    }
+    return false;
+}
+
+// Element type behind a storage pointer handed out by Tensor::visit.
+template<typename P>
+using Elem = std::remove_const_t<std::remove_pointer_t<P>>;
+
+bool allFloat32(std::initializer_list<const Tensor*> ts) {
+    for (const Tensor* t : ts)
+        if (t->dtype() != TensorDType::Float32) return false;
+    return true;
+}
+
+// A tensor viewed as [outer, len, inner] around one axis; element (o, a, i)
+// sits at (o * len + a) * inner + i and its reduced slot at o * inner + i.
+struct AxisSplit {
+    size_t outer = 1, len = 1, inner = 1;
+};
+
+AxisSplit splitAtAxis(const Tensor::Shape& shape, size_t axis) {
+    AxisSplit s;
+    for (size_t i = 0; i < axis; ++i)               s.outer *= shape[i];
+    s.len = shape[axis];
+    for (size_t i = axis + 1; i < shape.size(); ++i) s.inner *= shape[i];
+    return s;
+}
+
 } // namespace
 
+// ─── typed storage ───────────────────────────────────────────────────────────
+
+template<typename T>
+T* Tensor::storage() noexcept {
+    if constexpr (std::is_same_v<T, float>)
+        return m_data_f32 ? m_data_f32->data() + m_offset : nullptr;
+    else
+        return m_data ? m_data->data() + m_offset : nullptr;
+}
+
+template<typename T>
+const T* Tensor::storage() const noexcept {
+    if constexpr (std::is_same_v<T, float>)
+        return m_data_f32 ? m_data_f32->data() + m_offset : nullptr;
+    else
+        return m_data ? m_data->data() + m_offset : nullptr;
+}
+
+template<typename Fn>
+decltype(auto) Tensor::visit(Fn&& fn) const {
+    if (m_dtype == TensorDType::Float32) return fn(storage<float>());
+    return fn(storage<double>());
+}
+
+template<typename T, typename Fn>
+void Tensor::forEach(const T* p, size_t lo, size_t hi, Fn&& fn) const {
+    if (m_rowMajor) {
+        for (size_t i = lo; i < hi; ++i) fn(p[i]);
+        return;
+    }
+    forEachRun(m_shape, m_strides, lo, hi, [&](size_t off, size_t n, size_t step) {
+        for (size_t j = 0; j < n; ++j) fn(p[off + j * step]);
+    });
+}
+
+template<typename D>
+void Tensor::copyTo(D* dst) const {
+    const size_t n = size();
+    if (n == 0) return;
+    visit([&](const auto* src) {
+        if (m_rowMajor) {
+            Core::parallel_for(0, n, kParallelGrain, [&](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i) dst[i] = static_cast<D>(src[i]);
+            });
+            return;
+        }
+        const size_t inner = m_shape.back(), step = m_strides.back();
+        Core::parallel_for(0, n / inner, std::max<size_t>(1, kParallelGrain / inner),
+                           [&](size_t lo, size_t hi) {
+            forEachRow(m_shape, m_strides, m_strides, lo, hi,
+                       [&](size_t row, size_t off, size_t) {
+                D* d = dst + row * inner;
+                const auto* sp = src + off;
+                for (size_t j = 0; j < inner; ++j) d[j] = static_cast<D>(sp[j * step]);
+            });
+        });
+    });
+}
+
+// Ops without a dedicated Float32 kernel run in double precision and narrow
+// the result back, the same way GPU tensors fall back to the CPU path.
+#define F32_VIA_F64(EXPR)                                                     \
+    if (m_dtype == TensorDType::Float32)                                      \
+        return astype(TensorDType::Float64).EXPR.astype(TensorDType::Float32);
+
 // ─── TensorView ─────────────────────────────────────────────────────────────
 
 TensorView::TensorView(Tensor* base, Shape shape, Shape strides, size_t offset)
@@ -97,11 +358,13 @@ size_t TensorView::physicalIndex(const std::vector<size_t>& idx) const {
 }
 
 double& TensorView::at(const std::vector<size_t>& idx) {
-    return m_base->m_data[physicalIndex(idx)];
+    const size_t i = physicalIndex(idx);
+    m_base->prepareWrite();   // copies of the base keep their values
+    return (*m_base->m_data)[i];
 }
 
 double TensorView::at(const std::vector<size_t>& idx) const {
-    return m_base->m_data[physicalIndex(idx)];
+    return (*m_base->m_data)[physicalIndex(idx)];
 }
 
 double& TensorView::flat(size_t logical_flat) {
@@ -117,10 +380,9 @@ double TensorView::flat(size_t logical_flat) const {
 }
 
 Tensor TensorView::to_tensor() const {
-    Tensor out(m_shape);
-    for (size_t i = 0; i < out.size(); ++i)
-        out.flat(i) = flat(i);
-    return out;
+    if (!m_base)
+        throw std::runtime_error("TensorView: empty view");
+    return m_base->strided(m_shape, m_strides, m_offset);
 }
 
 // ─── size / flat (must work for both CPU and GPU tensors) ────────────────────
@@ -132,12 +394,13 @@ size_t Tensor::size() const noexcept {
     return s;
 }
 
-double& Tensor::flat(size_t i) {
+Tensor::ElementRef Tensor::flat(size_t i) {
     if (m_device != Device::CPU)
         throw std::runtime_error(
             "Tensor::flat: cannot access elements of a GPU tensor directly; "
             "call .cpu() first");
-    return m_data[i];
+    prepareWrite();
+    return elementRef(i);
 }
 
 double Tensor::flat(size_t i) const {
@@ -145,7 +408,81 @@ double Tensor::flat(size_t i) const {
         throw std::runtime_error(
             "Tensor::flat: cannot access elements of a GPU tensor directly; "
             "call .cpu() first");
-    return m_data[i];
+    const size_t off = physicalOffset(i);
+    return m_dtype == TensorDType::Float64 ? (*m_data)[off]
+                                           : static_cast<double>((*m_data_f32)[off]);
+}
+
+// ─── storage sharing ─────────────────────────────────────────────────────────
+
+namespace {
+
+template<typename T>
+const std::vector<T>& emptyBuffer() {
+    static const std::vector<T> empty;
+    return empty;
+}
+
+} // namespace
+
+const std::vector<double>& Tensor::data() const {
+    if (m_dtype == TensorDType::Float64 && !is_contiguous()) rebind(materialize());
+    return m_data ? *m_data : emptyBuffer<double>();
+}
+
+std::vector<double>& Tensor::data() {
+    if (m_dtype == TensorDType::Float64) prepareWrite();
+    if (!m_data) m_data = std::make_shared<std::vector<double>>();
+    return *m_data;
+}
+
+const std::vector<float>& Tensor::data_f32() const {
+    if (m_dtype == TensorDType::Float32 && !is_contiguous()) rebind(materialize());
+    return m_data_f32 ? *m_data_f32 : emptyBuffer<float>();
+}
+
+std::vector<float>& Tensor::data_f32() {
+    if (m_dtype == TensorDType::Float32) prepareWrite();
+    if (!m_data_f32) m_data_f32 = std::make_shared<std::vector<float>>();
+    return *m_data_f32;
+}
+
+bool Tensor::shares_storage(const Tensor& other) const noexcept {
+    return (m_data && m_data == other.m_data) ||
+           (m_data_f32 && m_data_f32 == other.m_data_f32);
+}
+
+Tensor Tensor::contiguous() const {
+    return is_contiguous() ? *this : materialize();
+}
+
+Tensor Tensor::strided(Shape shape, std::vector<size_t> strides, size_t offset) const {
+    Tensor out;
+    out.m_shape     = std::move(shape);
+    out.m_data      = m_data;
+    out.m_data_f32  = m_data_f32;
+    out.m_strides   = std::move(strides);
+    out.m_offset    = offset;
+    out.m_rowMajor  = isRowMajor(out.m_shape, out.m_strides);
+    out.m_dtype     = m_dtype;
+    out.m_cuda_buf  = m_cuda_buf;
+    out.m_device    = m_device;
+    out.m_device_id = m_device_id;
+    return out;
+}
+
+Tensor Tensor::materialize() const {
+    Tensor out = zeros(m_shape, m_dtype);
+    visit([&](const auto* p) { copyTo(out.storage<Elem<decltype(p)>>()); });
+    return out;
+}
+
+void Tensor::rebind(Tensor&& dense) const noexcept {
+    m_data     = std::move(dense.m_data);
+    m_data_f32 = std::move(dense.m_data_f32);
+    m_strides  = std::move(dense.m_strides);
+    m_offset   = dense.m_offset;
+    m_rowMajor = dense.m_rowMajor;
 }
 
 // ─── CPU stubs for cuda() / cpu() ────────────────────────────────────────────
@@ -175,16 +512,17 @@ Tensor::Tensor(Shape shape, double fill)
 {
     size_t total = 1;
     for (size_t d : m_shape) total *= d;
-    m_data.assign(total, fill);
+    m_data = std::make_shared<std::vector<double>>(total, fill);
     computeStrides();
 }
 
 Tensor::Tensor(Shape shape, std::vector<double> data)
-    : m_shape(std::move(shape)), m_data(std::move(data))
+    : m_shape(std::move(shape)),
+      m_data(std::make_shared<std::vector<double>>(std::move(data)))
 {
     size_t total = 1;
     for (size_t d : m_shape) total *= d;
-    if (m_data.size() != total)
+    if (m_data->size() != total)
         throw std::invalid_argument("Tensor: data size does not match shape");
     computeStrides();
 }
@@ -192,10 +530,10 @@ Tensor::Tensor(Shape shape, std::vector<double> data)
 Tensor::Tensor(Shape shape, std::vector<double> data, TensorDType dtype)
     : Tensor(std::move(shape), std::move(data))
 {
-    m_dtype = dtype;
-    if (m_dtype == TensorDType::Float32) {
-        for (double& v : m_data)
-            v = static_cast<double>(static_cast<float>(v));
+    if (dtype == TensorDType::Float32) {
+        m_data_f32 = std::make_shared<std::vector<float>>(m_data->begin(), m_data->end());
+        m_data.reset();
+        m_dtype = dtype;
     }
 }
 
@@ -204,6 +542,18 @@ Tensor::Tensor(Shape shape, std::vector<double> data, TensorDType dtype)
 Tensor Tensor::zeros(Shape shape) { return Tensor(std::move(shape), 0.0); }
 Tensor Tensor::ones(Shape shape)  { return Tensor(std::move(shape), 1.0); }
 
+Tensor Tensor::zeros(Shape shape, TensorDType dtype) {
+    if (dtype == TensorDType::Float64) return zeros(std::move(shape));
+    size_t total = 1;
+    for (size_t d : shape) total *= d;
+    Tensor t;
+    t.m_shape = std::move(shape);
+    t.m_data_f32 = std::make_shared<std::vector<float>>(total, 0.0f);
+    t.m_dtype = dtype;
+    t.computeStrides();
+    return t;
+}
+
 Tensor Tensor::eye(size_t n) {
     Tensor t({n, n}, 0.0);
     for (size_t i = 0; i < n; ++i) t(i, i) = 1.0;
@@ -269,6 +619,19 @@ Tensor Tensor::from_vector(const std::vector<double>& v) {
     return Tensor({v.size()}, v);
 }
 
+Tensor Tensor::from_f32(Shape shape, std::vector<float> data) {
+    size_t total = 1;
+    for (size_t d : shape) total *= d;
+    if (data.size() != total)
+        throw std::invalid_argument("Tensor::from_f32: data size does not match shape");
+    Tensor t;
+    t.m_shape    = std::move(shape);
+    t.m_data_f32 = std::make_shared<std::vector<float>>(std::move(data));
+    t.m_dtype    = TensorDType::Float32;
+    t.computeStrides();
+    return t;
+}
+
 Tensor Tensor::from_matrix(size_t rows, size_t cols,
                             const std::vector<double>& flat) {
     if (flat.size() != rows * cols)
@@ -306,7 +669,9 @@ Tensor Tensor::concat(const std::vector<Tensor>& tensors, size_t axis) {
         }
         axis_offset += t.dim(axis);
     }
-    return out;
+    for (const Tensor& t : tensors)
+        if (t.dtype() != TensorDType::Float32) return out;
+    return out.astype(TensorDType::Float32);
 }
 
 Tensor Tensor::stack(const std::vector<Tensor>& tensors, size_t axis) {
@@ -332,24 +697,28 @@ Tensor Tensor::stack(const std::vector<Tensor>& tensors, size_t axis) {
             out.at(idx) = t.flat(flat);
         }
     }
-    return out;
+    for (const Tensor& t : tensors)
+        if (t.dtype() != TensorDType::Float32) return out;
+    return out.astype(TensorDType::Float32);
 }
 
 Tensor Tensor::where(const Tensor& condition, const Tensor& x, const Tensor& y) {
     Shape out_shape = broadcastShape(broadcastShape(condition.shape(), x.shape()), y.shape());
-    Tensor c = condition.broadcast_to(out_shape);
-    Tensor xb = x.broadcast_to(out_shape);
-    Tensor yb = y.broadcast_to(out_shape);
+    const Tensor c = condition.broadcast_to(out_shape);
+    const Tensor xb = x.broadcast_to(out_shape);
+    const Tensor yb = y.broadcast_to(out_shape);
     Tensor out(out_shape);
     for (size_t i = 0; i < out.size(); ++i)
         out.flat(i) = c.flat(i) != 0.0 ? xb.flat(i) : yb.flat(i);
-    return out;
+    return allFloat32({&x, &y}) ? out.astype(TensorDType::Float32) : out;
 }
 
 // ─── stride helpers ───────────────────────────────────────────────────────────
 
 void Tensor::computeStrides() {
     m_strides.resize(m_shape.size());
+    m_offset   = 0;
+    m_rowMajor = true;
     if (m_shape.empty()) return;
     
     size_t stride = 1;
@@ -361,27 +730,43 @@ void Tensor::computeStrides() {
 }
 
 size_t Tensor::flatIndex(const std::vector<size_t>& idx) const {
-    if (idx.size() != m_shape.size())
-        throw std::invalid_argument(
-            "Tensor: index rank " + std::to_string(idx.size()) +
-            " does not match tensor rank " + std::to_string(m_shape.size()));
-    size_t flat = 0;
+    if (idx.size() != m_shape.size()) throwIndexRank(idx.size());
+    size_t flat = m_offset;
     for (size_t i = 0; i < idx.size(); ++i) {
-        if (idx[i] >= m_shape[i])
-            throw std::out_of_range(
-                "Tensor: index " + std::to_string(idx[i]) +
-                " out of range for dim " + std::to_string(i) +
-                " (size " + std::to_string(m_shape[i]) + ")");
+        if (idx[i] >= m_shape[i]) throwIndexRange(i, idx[i]);
         flat += idx[i] * m_strides[i];
     }
     return flat;
 }
 
+void Tensor::throwIndexRank(size_t rank) const {
+    throw std::invalid_argument(
+        "Tensor: index rank " + std::to_string(rank) +
+        " does not match tensor rank " + std::to_string(m_shape.size()));
+}
+
+void Tensor::throwIndexRange(size_t axis, size_t index) const {
+    throw std::out_of_range(
+        "Tensor: index " + std::to_string(index) +
+        " out of range for dim " + std::to_string(axis) +
+        " (size " + std::to_string(m_shape[axis]) + ")");
+}
+
+size_t Tensor::physicalOffset(size_t i) const noexcept {
+    if (m_rowMajor) return m_offset + i;
+    size_t off = m_offset;
+    for (size_t d = m_shape.size(); d-- > 0;) {
+        off += (i % m_shape[d]) * m_strides[d];
+        i   /= m_shape[d];
+    }
+    return off;
+}
+
 std::vector<size_t> Tensor::unravel(size_t flat) const {
     std::vector<size_t> idx(m_shape.size());
-    for (size_t i = 0; i < m_shape.size(); ++i) {
-        idx[i] = flat / m_strides[i];
-        flat   %= m_strides[i];
+    for (size_t i = m_shape.size(); i-- > 0;) {
+        idx[i] = flat % m_shape[i];
+        flat  /= m_shape[i];
     }
     return idx;
 }
@@ -394,11 +779,31 @@ size_t Tensor::dim(size_t axis) const {
 
 // ─── element access ──────────────────────────────────────────────────────────
 
-double& Tensor::at(const std::vector<size_t>& idx)       { return m_data[flatIndex(idx)]; }
-double  Tensor::at(const std::vector<size_t>& idx) const  { return m_data[flatIndex(idx)]; }
+Tensor::ElementRef Tensor::at(const std::vector<size_t>& idx) {
+    prepareWrite();
+    return elementRef(flatIndex(idx));
+}
+
+double Tensor::at(const std::vector<size_t>& idx) const {
+    const size_t off = flatIndex(idx);
+    return m_dtype == TensorDType::Float64 ? (*m_data)[off]
+                                           : static_cast<double>((*m_data_f32)[off]);
+}
 
 // ─── shape operations ────────────────────────────────────────────────────────
 
+Tensor Tensor::withShape(Shape shape) const {
+    if (!m_rowMajor) return materialize().withShape(std::move(shape));
+    Tensor out;
+    out.m_shape    = std::move(shape);
+    out.m_data     = m_data;
+    out.m_data_f32 = m_data_f32;
+    out.m_dtype    = m_dtype;
+    out.computeStrides();
+    out.m_offset   = m_offset;
+    return out;
+}
+
 Tensor Tensor::reshape(Shape new_shape) const {
     size_t total = 1;
     for (size_t d : new_shape) total *= d;
@@ -408,7 +813,7 @@ Tensor Tensor::reshape(Shape new_shape) const {
     if (m_device == Device::CUDA)
         return from_cuda(std::move(new_shape), m_cuda_buf, m_device_id);
 #endif
-    return Tensor(std::move(new_shape), m_data);
+    return withShape(std::move(new_shape));
 }
 
 Tensor Tensor::view(Shape new_shape) const {
@@ -420,14 +825,19 @@ Tensor Tensor::flatten() const {
     if (m_device == Device::CUDA)
         return from_cuda({size()}, m_cuda_buf, m_device_id);
 #endif
-    return Tensor({m_data.size()}, m_data);
+    return withShape({size()});
 }
 
 Tensor Tensor::squeeze() const {
     Shape s;
-    for (size_t d : m_shape) if (d != 1) s.push_back(d);
-    if (s.empty()) s.push_back(1);
-    return Tensor(std::move(s), m_data);
+    std::vector<size_t> st;
+    for (size_t i = 0; i < m_shape.size(); ++i) {
+        if (m_shape[i] == 1) continue;
+        s.push_back(m_shape[i]);
+        st.push_back(m_strides[i]);
+    }
+    if (s.empty()) { s.push_back(1); st.push_back(1); }
+    return strided(std::move(s), std::move(st), m_offset);
 }
 
 Tensor Tensor::squeeze(size_t axis) const {
@@ -436,17 +846,22 @@ Tensor Tensor::squeeze(size_t axis) const {
     if (m_shape[axis] != 1)
         throw std::invalid_argument("Tensor::squeeze: selected axis is not size 1");
     Shape s = m_shape;
+    std::vector<size_t> st = m_strides;
     s.erase(s.begin() + static_cast<std::ptrdiff_t>(axis));
-    if (s.empty()) s.push_back(1);
-    return Tensor(std::move(s), m_data);
+    st.erase(st.begin() + static_cast<std::ptrdiff_t>(axis));
+    if (s.empty()) { s.push_back(1); st.push_back(1); }
+    return strided(std::move(s), std::move(st), m_offset);
 }
 
 Tensor Tensor::expand_dims(size_t axis) const {
     if (axis > m_shape.size())
         throw std::out_of_range("Tensor::expand_dims: axis out of range");
     Shape s = m_shape;
+    std::vector<size_t> st = m_strides;
+    const size_t stride = axis < m_shape.size() ? m_strides[axis] * m_shape[axis] : 1;
     s.insert(s.begin() + axis, 1);
-    return Tensor(std::move(s), m_data);
+    st.insert(st.begin() + axis, stride);
+    return strided(std::move(s), std::move(st), m_offset);
 }
 
 Tensor Tensor::unsqueeze(size_t axis) const {
@@ -463,16 +878,17 @@ Tensor Tensor::transpose(std::vector<size_t> axes) const {
             if (sorted[i] != i)
                 throw std::invalid_argument("Tensor::transpose: invalid permutation");
     }
+#ifdef SHAREDMATH_CUDA
+    if (m_device == Device::CUDA) return cpu().transpose(std::move(axes)).cuda(m_device_id);
+#endif
+    // Output axis i walks the buffer with stride m_strides[axes[i]].
     Shape new_shape(ndim());
-    for (size_t i = 0; i < ndim(); ++i) new_shape[i] = m_shape[axes[i]];
-    Tensor result(new_shape);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto src = unravel(flat);
-        std::vector<size_t> dst(ndim());
-        for (size_t i = 0; i < ndim(); ++i) dst[i] = src[axes[i]];
-        result.at(dst) = m_data[flat];
+    std::vector<size_t> new_strides(ndim());
+    for (size_t i = 0; i < ndim(); ++i) {
+        new_shape[i]   = m_shape[axes[i]];
+        new_strides[i] = m_strides[axes[i]];
     }
-    return result;
+    return strided(std::move(new_shape), std::move(new_strides), m_offset);
 }
 
 Tensor Tensor::permute(std::vector<size_t> axes) const {
@@ -492,25 +908,24 @@ Tensor Tensor::slice(size_t axis, size_t start, size_t end) const {
         throw std::out_of_range("Tensor::slice: axis out of range");
     if (start >= end || end > m_shape[axis])
         throw std::invalid_argument("Tensor::slice: invalid range");
+#ifdef SHAREDMATH_CUDA
+    if (m_device == Device::CUDA) return cpu().slice(axis, start, end).cuda(m_device_id);
+#endif
     Shape new_shape = m_shape;
     new_shape[axis] = end - start;
-    Tensor result(new_shape);
-    for (size_t flat = 0; flat < result.size(); ++flat) {
-        auto dst = result.unravel(flat);
-        auto src = dst;
-        src[axis] += start;
-        result.m_data[flat] = at(src);
-    }
-    return result;
+    return strided(std::move(new_shape), m_strides, m_offset + start * m_strides[axis]);
 }
 
 TensorView Tensor::slice_view(size_t axis, size_t start, size_t end) {
     if (m_device != Device::CPU)
         throw std::runtime_error("Tensor::slice_view: only CPU tensors can be viewed");
+    if (m_dtype != TensorDType::Float64)
+        throw std::runtime_error("Tensor::slice_view: only Float64 tensors can be viewed");
     if (axis >= ndim())
         throw std::out_of_range("Tensor::slice_view: axis out of range");
     if (start >= end || end > m_shape[axis])
         throw std::invalid_argument("Tensor::slice_view: invalid range");
+    prepareWrite();   // the view writes into this tensor's own row-major buffer
     Shape view_shape = m_shape;
     view_shape[axis] = end - start;
     size_t offset = start * m_strides[axis];
@@ -525,19 +940,8 @@ Tensor Tensor::broadcast_to(Shape target_shape) const {
     if (actual != target_shape)
         throw std::invalid_argument("Tensor::broadcast_to: target shape is not compatible");
 
-    Tensor result(target_shape);
-    const size_t nr = target_shape.size();
-    const size_t ns = ndim();
-    for (size_t flat = 0; flat < result.size(); ++flat) {
-        auto ridx = result.unravel(flat);
-        std::vector<size_t> sidx(ns);
-        for (size_t i = 0; i < ns; ++i) {
-            size_t ri = ridx[nr - ns + i];
-            sidx[i] = (m_shape[i] == 1) ? 0 : ri;
-        }
-        result.flat(flat) = at(sidx);
-    }
-    return result;
+    auto strides = broadcastStrides(m_shape, m_strides, target_shape);
+    return strided(std::move(target_shape), std::move(strides), m_offset);
 }
 
 std::vector<Tensor> Tensor::split(size_t axis, const std::vector<size_t>& sections) const {
@@ -574,12 +978,10 @@ Tensor Tensor::astype(TensorDType dtype) const {
 #ifdef SHAREDMATH_CUDA
     if (m_device == Device::CUDA) return cpu().astype(dtype);
 #endif
-    Tensor out = *this;
-    out.m_dtype = dtype;
-    if (dtype == TensorDType::Float32) {
-        for (double& v : out.m_data)
-            v = static_cast<double>(static_cast<float>(v));
-    }
+    if (dtype == m_dtype) return *this;
+    Tensor out = zeros(m_shape, dtype);
+    if (dtype == TensorDType::Float32) copyTo(out.storage<float>());
+    else                               copyTo(out.storage<double>());
     return out;
 }
 
@@ -598,32 +1000,95 @@ Tensor::Shape Tensor::broadcastShape(const Shape& a, const Shape& b) {
     return result;
 }
 
-Tensor Tensor::broadcastOp(const Tensor& other,
-                            std::function<double(double, double)> op) const
+template<typename Op>
+Tensor Tensor::broadcastOp(const Tensor& other, Op op) const
 {
-    Shape rshape = broadcastShape(m_shape, other.m_shape);
-    Tensor result(rshape);
-    size_t nr = rshape.size();
-    size_t na = ndim(), nb = other.ndim();
-
-    for (size_t flat = 0; flat < result.size(); ++flat) {
-        auto ridx = result.unravel(flat);
-
-        std::vector<size_t> aidx(na), bidx(nb);
-        for (size_t i = 0; i < na; ++i) {
-            size_t ri = ridx[nr - na + i];
-            aidx[i] = (m_shape[i] == 1) ? 0 : ri;
-        }
-        for (size_t i = 0; i < nb; ++i) {
-            size_t ri = ridx[nr - nb + i];
-            bidx[i] = (other.m_shape[i] == 1) ? 0 : ri;
-        }
-        result.m_data[flat] = op(m_data[flatIndex(aidx)],
-                                 other.m_data[other.flatIndex(bidx)]);
+    // Mixed precision promotes the Float32 operand to Float64.
+    if (m_dtype != other.m_dtype) {
+        if (m_dtype == TensorDType::Float32)
+            return astype(TensorDType::Float64).broadcastOp(other, op);
+        return broadcastOp(other.astype(TensorDType::Float64), op);
     }
+    Tensor result = zeros(broadcastShape(m_shape, other.m_shape), m_dtype);
+    broadcastInto(result, other, op);
     return result;
 }
 
+template<typename Op>
+void Tensor::broadcastInto(Tensor& result, const Tensor& other, Op op) const
+{
+    if (result.size() == 0) return;
+
+    if (m_shape == other.m_shape && m_rowMajor && other.m_rowMajor) {
+        visit([&](const auto* a) {
+            using T = Elem<decltype(a)>;
+            const T* b = other.storage<T>();
+            T*       r = result.storage<T>();
+            Core::parallel_for(0, size(), kParallelGrain, [&](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i) r[i] = op(a[i], b[i]);
+            });
+        });
+        return;
+    }
+
+    // Walk the result row by row; each operand advances by its own stride
+    // (0 along broadcast axes) along the innermost axis.  `result` may be
+    // this tensor: every element is read before its own slot is written.
+    const Shape& rshape = result.m_shape;
+    const auto sa = broadcastStrides(m_shape, m_strides, rshape);
+    const auto sb = broadcastStrides(other.m_shape, other.m_strides, rshape);
+    const size_t inner = rshape.back();
+    const size_t ia = sa.back(), ib = sb.back();
+    const size_t rows = result.size() / inner;
+
+    visit([&](const auto* A) {
+        using T = Elem<decltype(A)>;
+        const T* B = other.storage<T>();
+        T*       R = result.storage<T>();
+        Core::parallel_for(0, rows, std::max<size_t>(1, kParallelGrain / inner),
+                           [&](size_t lo, size_t hi) {
+            forEachRow(rshape, sa, sb, lo, hi, [&](size_t row, size_t oa, size_t ob) {
+                T* r = R + row * inner;
+                const T* a = A + oa;
+                const T* b = B + ob;
+                if (ia == 1 && ib == 1) {
+                    for (size_t j = 0; j < inner; ++j) r[j] = op(a[j], b[j]);
+                } else if (ia == 1 && ib == 0) {
+                    const T bv = *b;
+                    for (size_t j = 0; j < inner; ++j) r[j] = op(a[j], bv);
+                } else if (ia == 0 && ib == 1) {
+                    const T av = *a;
+                    for (size_t j = 0; j < inner; ++j) r[j] = op(av, b[j]);
+                } else {
+                    for (size_t j = 0; j < inner; ++j) r[j] = op(a[j * ia], b[j * ib]);
+                }
+            });
+        });
+    });
+}
+
+// GPU tensors are left to the out-of-place operators, which dispatch to
+// CUDA.  Float32 += Float64 also takes that path so that it rounds once.
+template<typename Op>
+bool Tensor::updateInPlace(const Tensor& o, Op op)
+{
+    if (m_device != Device::CPU || o.m_device != Device::CPU ||
+        (m_dtype != o.m_dtype && m_dtype != TensorDType::Float64) ||
+        broadcastShape(m_shape, o.m_shape) != m_shape)
+        return false;
+    // Widen a Float32 operand first; o itself is not copied, so that `t += t`
+    // does not count as a second owner of the buffer.
+    const Tensor* rhs = &o;
+    Tensor widened;
+    if (o.m_dtype != m_dtype) {
+        widened = o.astype(m_dtype);
+        rhs = &widened;
+    }
+    prepareWrite();
+    broadcastInto(*this, *rhs, op);
+    return true;
+}
+
 // ─── arithmetic operators ─────────────────────────────────────────────────────
 
 // ── CUDA binary dispatch macro ────────────────────────────────────────────────
@@ -649,19 +1114,19 @@ Tensor Tensor::broadcastOp(const Tensor& other,
 
 Tensor Tensor::operator+(const Tensor& o) const {
     CUDA_BINARY_DISPATCH(Add, operator+)
-    return broadcastOp(o, [](double a, double b) { return a + b; });
+    return broadcastOp(o, [](auto a, auto b) { return a + b; });
 }
 Tensor Tensor::operator-(const Tensor& o) const {
     CUDA_BINARY_DISPATCH(Sub, operator-)
-    return broadcastOp(o, [](double a, double b) { return a - b; });
+    return broadcastOp(o, [](auto a, auto b) { return a - b; });
 }
 Tensor Tensor::operator*(const Tensor& o) const {
     CUDA_BINARY_DISPATCH(Mul, operator*)
-    return broadcastOp(o, [](double a, double b) { return a * b; });
+    return broadcastOp(o, [](auto a, auto b) { return a * b; });
 }
 Tensor Tensor::operator/(const Tensor& o) const {
     CUDA_BINARY_DISPATCH(Div, operator/)
-    return broadcastOp(o, [](double a, double b) { return a / b; });
+    return broadcastOp(o, [](auto a, auto b) { return a / b; });
 }
 
 #undef CUDA_BINARY_DISPATCH
@@ -676,16 +1141,16 @@ Tensor Tensor::operator/(const Tensor& o) const {
 #endif
 
 Tensor Tensor::operator+(double s) const {
-    CUDA_SCALAR_DISPATCH(Add, apply([s](double x){ return x + s; }))
+    CUDA_SCALAR_DISPATCH(Add, map([s](auto x){ return x + static_cast<decltype(x)>(s); }))
 }
 Tensor Tensor::operator-(double s) const {
-    CUDA_SCALAR_DISPATCH(Sub, apply([s](double x){ return x - s; }))
+    CUDA_SCALAR_DISPATCH(Sub, map([s](auto x){ return x - static_cast<decltype(x)>(s); }))
 }
 Tensor Tensor::operator*(double s) const {
-    CUDA_SCALAR_DISPATCH(Mul, apply([s](double x){ return x * s; }))
+    CUDA_SCALAR_DISPATCH(Mul, map([s](auto x){ return x * static_cast<decltype(x)>(s); }))
 }
 Tensor Tensor::operator/(double s) const {
-    CUDA_SCALAR_DISPATCH(Div, apply([s](double x){ return x / s; }))
+    CUDA_SCALAR_DISPATCH(Div, map([s](auto x){ return x / static_cast<decltype(x)>(s); }))
 }
 
 #undef CUDA_SCALAR_DISPATCH
@@ -695,79 +1160,183 @@ Tensor Tensor::operator-() const {
     if (m_device == Device::CUDA)
         return detail::cuda_unary(*this, detail::UnaryOp::Neg);
 #endif
-    return apply([](double x){ return -x; });
+    return map([](auto x){ return -x; });
 }
 
-Tensor& Tensor::operator+=(const Tensor& o) { *this = *this + o; return *this; }
-Tensor& Tensor::operator-=(const Tensor& o) { *this = *this - o; return *this; }
-Tensor& Tensor::operator*=(double s) { *this = *this * s; return *this; }
-Tensor& Tensor::operator/=(double s) { *this = *this / s; return *this; }
+#define TENSOR_UPDATE(OP)                                                   \
+    if (!updateInPlace(o, [](auto a, auto b) { return a OP b; })) {         \
+        Tensor r = *this OP o;                                              \
+        *this = r.m_dtype == m_dtype ? std::move(r) : r.astype(m_dtype);    \
+    }                                                                       \
+    return *this;
+
+Tensor& Tensor::operator+=(const Tensor& o) { TENSOR_UPDATE(+) }
+Tensor& Tensor::operator-=(const Tensor& o) { TENSOR_UPDATE(-) }
+Tensor& Tensor::operator*=(const Tensor& o) { TENSOR_UPDATE(*) }
+Tensor& Tensor::operator/=(const Tensor& o) { TENSOR_UPDATE(/) }
+
+#undef TENSOR_UPDATE
+
+#define SCALAR_UPDATE(OP)                                                   \
+    if (m_device != Device::CPU) return *this = *this OP s;                 \
+    prepareWrite();                                                         \
+    mapInto(*this, [s](auto x) { return x OP static_cast<decltype(x)>(s); });\
+    return *this;
+
+Tensor& Tensor::operator+=(double s) { SCALAR_UPDATE(+) }
+Tensor& Tensor::operator-=(double s) { SCALAR_UPDATE(-) }
+Tensor& Tensor::operator*=(double s) { SCALAR_UPDATE(*) }
+Tensor& Tensor::operator/=(double s) { SCALAR_UPDATE(/) }
+
+#undef SCALAR_UPDATE
 
 bool Tensor::operator==(const Tensor& o) const {
-    return m_shape == o.m_shape && m_data == o.m_data;
+    if (m_shape != o.m_shape) return false;
+    if (m_dtype != o.m_dtype)
+        return astype(TensorDType::Float64).data() == o.astype(TensorDType::Float64).data();
+    const Tensor a = contiguous(), b = o.contiguous();
+    return a.data() == b.data() && a.data_f32() == b.data_f32();
 }
 bool Tensor::operator!=(const Tensor& o) const { return !(*this == o); }
 
 // ─── global reductions ────────────────────────────────────────────────────────
 
+// Partial results are combined per kParallelGrain block, so the value does
+// not depend on the number of threads.  Float32 data is accumulated in double.
+
 double Tensor::sum() const {
-    return std::accumulate(m_data.begin(), m_data.end(), 0.0);
+    return visit([&](const auto* p) {
+        return Core::parallel_reduce(0, size(), kParallelGrain, 0.0,
+            [&](size_t lo, size_t hi) {
+                double a = 0.0;
+                forEach(p, lo, hi, [&](auto x) { a += x; });
+                return a;
+            },
+            [](double a, double b) { return a + b; });
+    });
 }
 double Tensor::product() const {
-    return std::accumulate(m_data.begin(), m_data.end(), 1.0,
-                           [](double a, double b){ return a * b; });
+    return visit([&](const auto* p) {
+        return Core::parallel_reduce(0, size(), kParallelGrain, 1.0,
+            [&](size_t lo, size_t hi) {
+                double a = 1.0;
+                forEach(p, lo, hi, [&](auto x) { a *= x; });
+                return a;
+            },
+            [](double a, double b) { return a * b; });
+    });
 }
 double Tensor::min() const {
-    if (m_data.empty()) throw std::runtime_error("Tensor::min: empty tensor");
-    return *std::min_element(m_data.begin(), m_data.end());
+    if (size() == 0) throw std::runtime_error("Tensor::min: empty tensor");
+    return visit([&](const auto* p) {
+        return Core::parallel_reduce(0, size(), kParallelGrain,
+            static_cast<double>(p[0]),
+            [&](size_t lo, size_t hi) {
+                auto best = p[physicalOffset(lo) - m_offset];
+                forEach(p, lo, hi, [&](auto x) { if (x < best) best = x; });
+                return static_cast<double>(best);
+            },
+            [](double a, double b) { return std::min(a, b); });
+    });
 }
 double Tensor::max() const {
-    if (m_data.empty()) throw std::runtime_error("Tensor::max: empty tensor");
-    return *std::max_element(m_data.begin(), m_data.end());
+    if (size() == 0) throw std::runtime_error("Tensor::max: empty tensor");
+    return visit([&](const auto* p) {
+        return Core::parallel_reduce(0, size(), kParallelGrain,
+            static_cast<double>(p[0]),
+            [&](size_t lo, size_t hi) {
+                auto best = p[physicalOffset(lo) - m_offset];
+                forEach(p, lo, hi, [&](auto x) { if (best < x) best = x; });
+                return static_cast<double>(best);
+            },
+            [](double a, double b) { return std::max(a, b); });
+    });
 }
 double Tensor::mean() const {
     return sum() / static_cast<double>(size());
 }
 double Tensor::var(bool ddof) const {
     double m = mean();
-    double acc = 0.0;
-    for (double v : m_data) acc += (v - m) * (v - m);
+    double acc = visit([&](const auto* p) {
+        return Core::parallel_reduce(0, size(), kParallelGrain, 0.0,
+            [&](size_t lo, size_t hi) {
+                double a = 0.0;
+                forEach(p, lo, hi, [&](auto x) {
+                    const double d = static_cast<double>(x) - m;
+                    a += d * d;
+                });
+                return a;
+            },
+            [](double a, double b) { return a + b; });
+    });
     double denom = static_cast<double>(size() - (ddof ? 1 : 0));
     if (denom <= 0.0) throw std::runtime_error("Tensor::var: not enough elements");
     return acc / denom;
 }
 double Tensor::stddev(bool ddof) const { return std::sqrt(var(ddof)); }
 
+// First index of the extreme element, as std::min_element / max_element.
 size_t Tensor::argmin() const {
-    if (m_data.empty()) throw std::runtime_error("Tensor::argmin: empty tensor");
-    return static_cast<size_t>(
-        std::min_element(m_data.begin(), m_data.end()) - m_data.begin());
+    if (size() == 0) throw std::runtime_error("Tensor::argmin: empty tensor");
+    return visit([&](const auto* p) {
+        auto best = p[0];
+        size_t arg = 0, i = 0;
+        forEach(p, 0, size(), [&](auto x) {
+            if (x < best) { best = x; arg = i; }
+            ++i;
+        });
+        return arg;
+    });
 }
 size_t Tensor::argmax() const {
-    if (m_data.empty()) throw std::runtime_error("Tensor::argmax: empty tensor");
-    return static_cast<size_t>(
-        std::max_element(m_data.begin(), m_data.end()) - m_data.begin());
+    if (size() == 0) throw std::runtime_error("Tensor::argmax: empty tensor");
+    return visit([&](const auto* p) {
+        auto best = p[0];
+        size_t arg = 0, i = 0;
+        forEach(p, 0, size(), [&](auto x) {
+            if (best < x) { best = x; arg = i; }
+            ++i;
+        });
+        return arg;
+    });
 }
 
 // ─── axis reductions ─────────────────────────────────────────────────────────
 
-Tensor Tensor::axisReduce(size_t axis,
-                           std::function<double(double, double)> reducer,
-                           double init) const
+template<typename Reducer>
+Tensor Tensor::axisReduce(size_t axis, Reducer reducer, double init) const
 {
     if (axis >= ndim()) throw std::out_of_range("Tensor: axis out of range");
-    Shape rshape = m_shape;
-    rshape.erase(rshape.begin() + axis);
-    if (rshape.empty()) rshape.push_back(1);
-    Tensor result(rshape, init);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        std::vector<size_t> ridx = idx;
-        ridx.erase(ridx.begin() + axis);
-        if (ridx.empty()) ridx.push_back(0);
-        result.at(ridx) = reducer(result.at(ridx), m_data[flat]);
-    }
-    return result;
+    // Accumulates in double for either dtype; Float32 results are narrowed.
+    Tensor result = zeros(shapeWithoutAxis(m_shape, axis));
+    axisReduceInto(result, axis, reducer, init);
+    return m_dtype == TensorDType::Float32 ? result.astype(m_dtype) : result;
+}
+
+// Rows of the input are walked in order, each element folded into its
+// result slot, so any input layout is read in place.
+template<typename Reducer>
+void Tensor::axisReduceInto(Tensor& result, size_t axis, Reducer reducer, double init) const
+{
+    double* R = result.storage<double>();
+    std::fill(R, R + result.size(), init);
+    if (size() == 0) return;
+    const auto rs = reducedStrides(m_shape, axis);
+    const size_t inner = m_shape.back(), ia = m_strides.back(), ir = rs.back();
+    visit([&](const auto* A) {
+        forEachRow(m_shape, m_strides, rs, 0, size() / inner,
+                   [&](size_t, size_t oa, size_t orr) {
+            const auto* a = A + oa;
+            double*     r = R + orr;
+            if (ir == 0) {
+                double acc = *r;
+                for (size_t j = 0; j < inner; ++j) acc = reducer(acc, a[j * ia]);
+                *r = acc;
+            } else {
+                for (size_t j = 0; j < inner; ++j) r[j] = reducer(r[j], a[j * ia]);
+            }
+        });
+    });
 }
 
 Tensor Tensor::sum(size_t axis) const {
@@ -797,6 +1366,7 @@ Tensor Tensor::var(int axis, bool ddof) const {
 
 Tensor Tensor::var(size_t axis, bool ddof) const {
     if (axis >= ndim()) throw std::out_of_range("Tensor::var: axis out of range");
+    F32_VIA_F64(var(axis, ddof))
     size_t axis_len = m_shape[axis];
     size_t correction = ddof ? 1 : 0;
     if (axis_len <= correction)
@@ -805,67 +1375,84 @@ Tensor Tensor::var(size_t axis, bool ddof) const {
     Shape rshape = shapeWithoutAxis(m_shape, axis);
     Tensor means = mean(axis);
     Tensor out(rshape, 0.0);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        auto ridx = idx;
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        double diff = m_data[flat] - means.at(ridx);
-        out.at(ridx) += diff * diff;
-    }
+    const auto rs = reducedStrides(m_shape, axis);
+    const size_t inner = m_shape.back(), ia = m_strides.back(), ir = rs.back();
+    const double* A = storage<double>();
+    const double* M = means.storage<double>();
+    double*       R = out.storage<double>();
+    if (size() > 0)
+        forEachRow(m_shape, m_strides, rs, 0, size() / inner,
+                   [&](size_t, size_t oa, size_t orr) {
+            for (size_t j = 0; j < inner; ++j) {
+                const double diff = A[oa + j * ia] - M[orr + j * ir];
+                R[orr + j * ir] += diff * diff;
+            }
+        });
     out /= static_cast<double>(axis_len - correction);
     return out;
 }
 
 Tensor Tensor::argmin(size_t axis) const {
     if (axis >= ndim()) throw std::out_of_range("Tensor::argmin: axis out of range");
-    Shape rshape = shapeWithoutAxis(m_shape, axis);
-    Tensor values(rshape, std::numeric_limits<double>::infinity());
-    Tensor indices(rshape, 0.0);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        auto ridx = idx;
-        size_t axis_idx = idx[axis];
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        if (m_data[flat] < values.at(ridx)) {
-            values.at(ridx) = m_data[flat];
-            indices.at(ridx) = static_cast<double>(axis_idx);
-        }
-    }
-    return indices;
+    F32_VIA_F64(argmin(axis))
+    return argAlongAxis(m_shape, m_strides, storage<double>(), axis,
+                        std::numeric_limits<double>::infinity(),
+                        [](double x, double best) { return x < best; });
 }
 
 Tensor Tensor::argmax(size_t axis) const {
     if (axis >= ndim()) throw std::out_of_range("Tensor::argmax: axis out of range");
-    Shape rshape = shapeWithoutAxis(m_shape, axis);
-    Tensor values(rshape, -std::numeric_limits<double>::infinity());
-    Tensor indices(rshape, 0.0);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        auto ridx = idx;
-        size_t axis_idx = idx[axis];
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        if (m_data[flat] > values.at(ridx)) {
-            values.at(ridx) = m_data[flat];
-            indices.at(ridx) = static_cast<double>(axis_idx);
-        }
-    }
-    return indices;
+    F32_VIA_F64(argmax(axis))
+    return argAlongAxis(m_shape, m_strides, storage<double>(), axis,
+                        -std::numeric_limits<double>::infinity(),
+                        [](double x, double best) { return x > best; });
 }
 
 // ─── element-wise math ────────────────────────────────────────────────────────
 
+// map(f) is the typed CPU loop behind apply() and the named ops: f is called
+// with float or double elements to match the dtype, and the result keeps the
+// dtype.  Large tensors are split across the thread pool.
+template<typename F>
+Tensor Tensor::map(F f) const {
+    Tensor result = zeros(m_shape, m_dtype);
+    mapInto(result, f);
+    return result;
+}
+
+template<typename F>
+void Tensor::mapInto(Tensor& result, F f) const {
+    if (result.size() == 0) return;
+    visit([&](const auto* src) {
+        using T = Elem<decltype(src)>;
+        T* dst = result.storage<T>();
+        if (m_rowMajor) {
+            Core::parallel_for(0, size(), kParallelGrain, [&](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i) dst[i] = static_cast<T>(f(src[i]));
+            });
+            return;
+        }
+        const size_t inner = m_shape.back(), step = m_strides.back();
+        Core::parallel_for(0, size() / inner, std::max<size_t>(1, kParallelGrain / inner),
+                           [&](size_t lo, size_t hi) {
+            forEachRow(m_shape, m_strides, m_strides, lo, hi,
+                       [&](size_t row, size_t off, size_t) {
+                T* d = dst + row * inner;
+                for (size_t j = 0; j < inner; ++j)
+                    d[j] = static_cast<T>(f(src[off + j * step]));
+            });
+        });
+    });
+}
+
 // apply(f) is CPU-only (std::function can't be passed to a CUDA kernel).
-// If the tensor is on GPU, it is first brought to CPU.
+// If the tensor is on GPU, it is first brought to CPU.  f may run
+// concurrently; Float32 elements are widened for the call.
 Tensor Tensor::apply(std::function<double(double)> f) const {
 #ifdef SHAREDMATH_CUDA
     if (m_device == Device::CUDA) return cpu().apply(f);
 #endif
-    Tensor result(m_shape);
-    for (size_t i = 0; i < m_data.size(); ++i) result.m_data[i] = f(m_data[i]);
-    return result;
+    return map([&f](auto x) { return f(static_cast<double>(x)); });
 }
 
 // Named unary ops: GPU-accelerated via dedicated CUDA kernels when on device.
@@ -878,30 +1465,56 @@ Tensor Tensor::apply(std::function<double(double)> f) const {
 #define CUDA_UNARY(OP_ENUM, CPU_EXPR) return CPU_EXPR;
 #endif
 
-Tensor Tensor::abs()   const { CUDA_UNARY(Abs,   apply([](double x){ return std::abs(x);   })) }
-Tensor Tensor::sqrt()  const { CUDA_UNARY(Sqrt,  apply([](double x){ return std::sqrt(x);  })) }
-Tensor Tensor::exp()   const { CUDA_UNARY(Exp,   apply([](double x){ return std::exp(x);   })) }
-Tensor Tensor::log()   const { CUDA_UNARY(Log,   apply([](double x){ return std::log(x);   })) }
-Tensor Tensor::log2()  const { CUDA_UNARY(Log2,  apply([](double x){ return std::log2(x);  })) }
-Tensor Tensor::log10() const { CUDA_UNARY(Log10, apply([](double x){ return std::log10(x); })) }
-Tensor Tensor::sin()   const { CUDA_UNARY(Sin,   apply([](double x){ return std::sin(x);   })) }
-Tensor Tensor::cos()   const { CUDA_UNARY(Cos,   apply([](double x){ return std::cos(x);   })) }
-Tensor Tensor::tanh()  const { CUDA_UNARY(Tanh,  apply([](double x){ return std::tanh(x);  })) }
-Tensor Tensor::relu()  const { CUDA_UNARY(Relu,  apply([](double x){ return x > 0.0 ? x : 0.0; })) }
-Tensor Tensor::sigmoid() const {
-    CUDA_UNARY(Sigmoid, apply([](double x){ return 1.0 / (1.0 + std::exp(-x)); }))
-}
-Tensor Tensor::gelu() const {
-    CUDA_UNARY(Gelu, apply([](double x){
-        return x * 0.5 * (1.0 + std::erf(x / std::sqrt(2.0)));
-    }))
-}
-Tensor Tensor::floor() const { CUDA_UNARY(Floor, apply([](double x){ return std::floor(x); })) }
-Tensor Tensor::ceil()  const { CUDA_UNARY(Ceil,  apply([](double x){ return std::ceil(x);  })) }
-Tensor Tensor::round() const { CUDA_UNARY(Round, apply([](double x){ return std::round(x); })) }
-Tensor Tensor::sign()  const {
-    CUDA_UNARY(Sign, apply([](double x){ return x > 0.0 ? 1.0 : (x < 0.0 ? -1.0 : 0.0); }))
-}
+// The functors are generic so Float32 tensors compute in single precision
+// (std::exp(float) etc.); T(c) keeps constants in the element type.  They
+// are shared with the *_into kernels below.
+namespace {
+namespace unary {
+struct Abs   { template<typename T> T operator()(T x) const { return std::abs(x);   } };
+struct Sqrt  { template<typename T> T operator()(T x) const { return std::sqrt(x);  } };
+struct Exp   { template<typename T> T operator()(T x) const { return std::exp(x);   } };
+struct Log   { template<typename T> T operator()(T x) const { return std::log(x);   } };
+struct Log2  { template<typename T> T operator()(T x) const { return std::log2(x);  } };
+struct Log10 { template<typename T> T operator()(T x) const { return std::log10(x); } };
+struct Sin   { template<typename T> T operator()(T x) const { return std::sin(x);   } };
+struct Cos   { template<typename T> T operator()(T x) const { return std::cos(x);   } };
+struct Tanh  { template<typename T> T operator()(T x) const { return std::tanh(x);  } };
+struct Floor { template<typename T> T operator()(T x) const { return std::floor(x); } };
+struct Ceil  { template<typename T> T operator()(T x) const { return std::ceil(x);  } };
+struct Round { template<typename T> T operator()(T x) const { return std::round(x); } };
+struct Relu  { template<typename T> T operator()(T x) const { return x > T(0) ? x : T(0); } };
+struct Sigmoid {
+    template<typename T> T operator()(T x) const { return T(1) / (T(1) + std::exp(-x)); }
+};
+struct Gelu {
+    template<typename T> T operator()(T x) const {
+        return x * T(0.5) * (T(1) + std::erf(x / std::sqrt(T(2))));
+    }
+};
+struct Sign {
+    template<typename T> T operator()(T x) const {
+        return x > T(0) ? T(1) : (x < T(0) ? T(-1) : T(0));
+    }
+};
+} // namespace unary
+} // namespace
+
+Tensor Tensor::abs()     const { CUDA_UNARY(Abs,     map(unary::Abs{}))     }
+Tensor Tensor::sqrt()    const { CUDA_UNARY(Sqrt,    map(unary::Sqrt{}))    }
+Tensor Tensor::exp()     const { CUDA_UNARY(Exp,     map(unary::Exp{}))     }
+Tensor Tensor::log()     const { CUDA_UNARY(Log,     map(unary::Log{}))     }
+Tensor Tensor::log2()    const { CUDA_UNARY(Log2,    map(unary::Log2{}))    }
+Tensor Tensor::log10()   const { CUDA_UNARY(Log10,   map(unary::Log10{}))   }
+Tensor Tensor::sin()     const { CUDA_UNARY(Sin,     map(unary::Sin{}))     }
+Tensor Tensor::cos()     const { CUDA_UNARY(Cos,     map(unary::Cos{}))     }
+Tensor Tensor::tanh()    const { CUDA_UNARY(Tanh,    map(unary::Tanh{}))    }
+Tensor Tensor::relu()    const { CUDA_UNARY(Relu,    map(unary::Relu{}))    }
+Tensor Tensor::sigmoid() const { CUDA_UNARY(Sigmoid, map(unary::Sigmoid{})) }
+Tensor Tensor::gelu()    const { CUDA_UNARY(Gelu,    map(unary::Gelu{}))    }
+Tensor Tensor::floor()   const { CUDA_UNARY(Floor,   map(unary::Floor{}))   }
+Tensor Tensor::ceil()    const { CUDA_UNARY(Ceil,    map(unary::Ceil{}))    }
+Tensor Tensor::round()   const { CUDA_UNARY(Round,   map(unary::Round{}))   }
+Tensor Tensor::sign()    const { CUDA_UNARY(Sign,    map(unary::Sign{}))    }
 
 #undef CUDA_UNARY
 
@@ -909,13 +1522,16 @@ Tensor Tensor::pow(double e) const {
 #ifdef SHAREDMATH_CUDA
     if (m_device == Device::CUDA) return detail::cuda_pow(*this, e);
 #endif
-    return apply([e](double x){ return std::pow(x, e); });
+    return map([e](auto x){ return std::pow(x, static_cast<decltype(x)>(e)); });
 }
 Tensor Tensor::clip(double lo, double hi) const {
 #ifdef SHAREDMATH_CUDA
     if (m_device == Device::CUDA) return detail::cuda_clip(*this, lo, hi);
 #endif
-    return apply([lo, hi](double x){ return std::clamp(x, lo, hi); });
+    return map([lo, hi](auto x){
+        using T = decltype(x);
+        return std::clamp(x, static_cast<T>(lo), static_cast<T>(hi));
+    });
 }
 
 Tensor Tensor::softmax(size_t axis) const {
@@ -924,33 +1540,31 @@ Tensor Tensor::softmax(size_t axis) const {
 #endif
     if (axis >= ndim())
         throw std::out_of_range("Tensor::softmax: axis out of range");
-    Shape rshape = shapeWithoutAxis(m_shape, axis);
-    Tensor maxes(rshape, -std::numeric_limits<double>::infinity());
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        auto ridx = idx;
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        maxes.at(ridx) = std::max(maxes.at(ridx), m_data[flat]);
-    }
-
-    Tensor sums(rshape, 0.0);
+    F32_VIA_F64(softmax(axis))
+    if (!m_rowMajor) return materialize().softmax(axis);
     Tensor out(m_shape);
-    for (size_t flat = 0; flat < size(); ++flat) {
-        auto idx = unravel(flat);
-        auto ridx = idx;
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        double e = std::exp(m_data[flat] - maxes.at(ridx));
-        out.flat(flat) = e;
-        sums.at(ridx) += e;
-    }
-    for (size_t flat = 0; flat < out.size(); ++flat) {
-        auto idx = out.unravel(flat);
-        auto ridx = idx;
-        ridx.erase(ridx.begin() + static_cast<std::ptrdiff_t>(axis));
-        if (ridx.empty()) ridx.push_back(0);
-        out.flat(flat) /= sums.at(ridx);
+    const AxisSplit s = splitAtAxis(m_shape, axis);
+    std::vector<double> maxes(s.inner), sums(s.inner);
+    for (size_t o = 0; o < s.outer; ++o) {
+        const size_t base = o * s.len * s.inner;
+        std::fill(maxes.begin(), maxes.end(), -std::numeric_limits<double>::infinity());
+        std::fill(sums.begin(), sums.end(), 0.0);
+        for (size_t a = 0; a < s.len; ++a) {
+            const double* src = storage<double>() + base + a * s.inner;
+            for (size_t i = 0; i < s.inner; ++i) maxes[i] = std::max(maxes[i], src[i]);
+        }
+        for (size_t a = 0; a < s.len; ++a) {
+            const double* src = storage<double>() + base + a * s.inner;
+            double*       dst = out.storage<double>() + base + a * s.inner;
+            for (size_t i = 0; i < s.inner; ++i) {
+                dst[i]   = std::exp(src[i] - maxes[i]);
+                sums[i] += dst[i];
+            }
+        }
+        for (size_t a = 0; a < s.len; ++a) {
+            double* dst = out.storage<double>() + base + a * s.inner;
+            for (size_t i = 0; i < s.inner; ++i) dst[i] /= sums[i];
+        }
     }
     return out;
 }
@@ -975,27 +1589,209 @@ Tensor Tensor::matmul(const Tensor& other) const {
         return detail::cuda_matmul(*this, other);
 #endif
 
-    // CPU path — cache-friendly i-l-j loop
-    Tensor result({m, n}, 0.0);
-    for (size_t i = 0; i < m; ++i)
-        for (size_t l = 0; l < k; ++l) {
-            double a = (*this)(i, l);
-            for (size_t j = 0; j < n; ++j)
-                result(i, j) += a * other(l, j);
-        }
+    if (m_dtype != other.m_dtype) {
+        if (m_dtype == TensorDType::Float32)
+            return astype(TensorDType::Float64).matmul(other);
+        return matmul(other.astype(TensorDType::Float64));
+    }
+
+    // CPU path — shared blocked GEMM kernel (float or double).  Transposed
+    // and sliced operands are read in place through the transpose flag and
+    // leading dimension; other layouts are copied once.
+    Transpose ta, tb;
+    size_t lda, ldb;
+    if (!gemmLayout(m_shape, m_strides, ta, lda)) return materialize().matmul(other);
+    if (!gemmLayout(other.m_shape, other.m_strides, tb, ldb))
+        return matmul(other.materialize());
+    Tensor result = zeros({m, n}, m_dtype);
+    visit([&](const auto* a) {
+        using T = Elem<decltype(a)>;
+        gemm(ta, tb, m, n, k,
+             T(1), a, lda, other.storage<T>(), ldb,
+             T(0), result.storage<T>(), n);
+    });
     return result;
 }
 
+// ─── out-parameter kernels ───────────────────────────────────────────────────
+
+namespace detail {
+
+struct TensorInto {
+    // Whether `out` can take a result of this shape and dtype in its own
+    // buffer.  An exact shape match means the layout is never rewritten, so
+    // an operand that is `out` itself still reads correctly.
+    static bool reusable(const Tensor& out, const Tensor::Shape& shape, TensorDType dtype) {
+        return out.m_device == Device::CPU && out.m_dtype == dtype &&
+               out.m_shape == shape && out.is_contiguous() && !out.sharedBuffer();
+    }
+
+    template<typename Op>
+    static Tensor& binary(Tensor& out, const Tensor& a, const Tensor& b, Op op) {
+        if (a.m_dtype != b.m_dtype) {
+            if (a.m_dtype == TensorDType::Float32)
+                return binary(out, a.astype(TensorDType::Float64), b, op);
+            return binary(out, a, b.astype(TensorDType::Float64), op);
+        }
+        const Tensor::Shape shape = Tensor::broadcastShape(a.m_shape, b.m_shape);
+        if (reusable(out, shape, a.m_dtype)) {
+            a.broadcastInto(out, b, op);
+            return out;
+        }
+        Tensor r = Tensor::zeros(shape, a.m_dtype);
+        a.broadcastInto(r, b, op);
+        return out = std::move(r);
+    }
+
+    template<typename F>
+    static Tensor& unary(Tensor& out, const Tensor& t, F f) {
+        if (reusable(out, t.m_shape, t.m_dtype)) {
+            t.mapInto(out, f);
+            return out;
+        }
+        Tensor r = Tensor::zeros(t.m_shape, t.m_dtype);
+        t.mapInto(r, f);
+        return out = std::move(r);
+    }
+
+    static Tensor& sum(Tensor& out, const Tensor& t, size_t axis) {
+        const auto add = [](double a, double b) { return a + b; };
+        const Tensor::Shape shape = shapeWithoutAxis(t.m_shape, axis);
+        if (reusable(out, shape, TensorDType::Float64)) {
+            t.axisReduceInto(out, axis, add, 0.0);
+            return out;
+        }
+        Tensor r = Tensor::zeros(shape);
+        t.axisReduceInto(r, axis, add, 0.0);
+        return out = std::move(r);
+    }
+
+    static Tensor& matmul(Tensor& C, const Tensor& A, const Tensor& B,
+                          double alpha, double beta) {
+        Transpose ta, tb;
+        size_t lda, ldb;
+        if (!gemmLayout(A.m_shape, A.m_strides, ta, lda))
+            return matmul(C, A.materialize(), B, alpha, beta);
+        if (!gemmLayout(B.m_shape, B.m_strides, tb, ldb))
+            return matmul(C, A, B.materialize(), alpha, beta);
+        const size_t m = A.m_shape[0], k = A.m_shape[1], n = B.m_shape[1];
+        const auto run = [&](Tensor& R) {
+            A.visit([&](const auto* a) {
+                using T = Elem<decltype(a)>;
+                gemm(ta, tb, m, n, k, T(alpha), a, lda, B.storage<T>(), ldb,
+                     T(beta), R.storage<T>(), n);
+            });
+        };
+        // gemm must not write to an operand it is still reading.
+        if (reusable(C, {m, n}, A.m_dtype) && &C != &A && &C != &B) {
+            run(C);
+            return C;
+        }
+        Tensor R = beta != 0.0 ? C.astype(A.m_dtype).materialize()
+                               : Tensor::zeros({m, n}, A.m_dtype);
+        run(R);
+        return C = std::move(R);
+    }
+};
+
+} // namespace detail
+
+namespace {
+
+bool onCPU(const Tensor& t) { return t.device() == Device::CPU; }
+
+} // namespace
+
+Tensor& matmul_into(Tensor& C, const Tensor& A, const Tensor& B, double alpha, double beta) {
+    if (A.ndim() != 2 || B.ndim() != 2)
+        throw std::invalid_argument("matmul_into: both tensors must be 2-D");
+    const size_t m = A.dim(0), k = A.dim(1), n = B.dim(1);
+    if (k != B.dim(0))
+        throw std::invalid_argument(
+            "matmul_into: inner dimensions mismatch (" +
+            std::to_string(k) + " vs " + std::to_string(B.dim(0)) + ")");
+    if (beta != 0.0 && C.shape() != Tensor::Shape{m, n})
+        throw std::invalid_argument(
+            "matmul_into: C must have shape [" + std::to_string(m) + ", " +
+            std::to_string(n) + "] when beta != 0");
+
+    if (!onCPU(A) || !onCPU(B) || !onCPU(C) || A.dtype() != B.dtype()) {
+        Tensor P = A.matmul(B);
+        if (alpha != 1.0) P *= alpha;
+        if (beta != 0.0) P += C * beta;
+        return C = std::move(P);
+    }
+    return detail::TensorInto::matmul(C, A, B, alpha, beta);
+}
+
+#define BINARY_INTO(NAME, OP)                                               \
+    Tensor& NAME##_into(Tensor& out, const Tensor& a, const Tensor& b) {    \
+        if (!onCPU(a) || !onCPU(b)) return out = a OP b;                    \
+        return detail::TensorInto::binary(out, a, b,                        \
+                                          [](auto x, auto y) { return x OP y; }); \
+    }
+
+BINARY_INTO(add, +)
+BINARY_INTO(sub, -)
+BINARY_INTO(mul, *)
+BINARY_INTO(div, /)
+
+#undef BINARY_INTO
+
+Tensor& sum_into(Tensor& out, const Tensor& t, size_t axis) {
+    if (axis >= t.ndim()) throw std::out_of_range("sum_into: axis out of range");
+    if (!onCPU(t) || t.dtype() != TensorDType::Float64) return out = t.sum(axis);
+    return detail::TensorInto::sum(out, t, axis);
+}
+
+Tensor& mean_into(Tensor& out, const Tensor& t, size_t axis) {
+    if (axis >= t.ndim()) throw std::out_of_range("mean_into: axis out of range");
+    const double len = static_cast<double>(t.dim(axis));   // t may be out
+    sum_into(out, t, axis);
+    return out /= len;
+}
+
+Tensor& apply_into(Tensor& out, const Tensor& t, const std::function<double(double)>& f) {
+    if (!onCPU(t)) return out = t.apply(f);
+    return detail::TensorInto::unary(out, t, [&f](auto x) { return f(static_cast<double>(x)); });
+}
+
+#define UNARY_INTO(NAME, OP)                                                \
+    Tensor& NAME##_into(Tensor& out, const Tensor& t) {                     \
+        if (!onCPU(t)) return out = t.NAME();                               \
+        return detail::TensorInto::unary(out, t, unary::OP{});              \
+    }
+
+UNARY_INTO(abs,     Abs)
+UNARY_INTO(sqrt,    Sqrt)
+UNARY_INTO(exp,     Exp)
+UNARY_INTO(log,     Log)
+UNARY_INTO(log2,    Log2)
+UNARY_INTO(log10,   Log10)
+UNARY_INTO(sin,     Sin)
+UNARY_INTO(cos,     Cos)
+UNARY_INTO(tanh,    Tanh)
+UNARY_INTO(relu,    Relu)
+UNARY_INTO(sigmoid, Sigmoid)
+UNARY_INTO(gelu,    Gelu)
+UNARY_INTO(sign,    Sign)
+UNARY_INTO(floor,   Floor)
+UNARY_INTO(ceil,    Ceil)
+UNARY_INTO(round,   Round)
+
+#undef UNARY_INTO
+
 Tensor Tensor::conv2d(const Tensor& weight, const Tensor* bias,
-                      size_t stride, size_t padding) const {
+                      size_t stride, size_t padding,
+                      size_t dilation, size_t groups) const {
     if (ndim() != 4 || weight.ndim() != 4)
         throw std::invalid_argument("Tensor::conv2d: input and weight must be 4-D");
-    if (dim(1) != weight.dim(1))
-        throw std::invalid_argument("Tensor::conv2d: input channel mismatch");
     if (bias && (bias->ndim() != 1 || bias->dim(0) != weight.dim(0)))
         throw std::invalid_argument("Tensor::conv2d: bias must have shape [out_channels]");
     if (stride == 0)
         throw std::invalid_argument("Tensor::conv2d: stride must be > 0");
+    const Conv2dShape s = convShape(m_shape, weight.m_shape, stride, padding,
+                                    dilation, groups, "Tensor::conv2d");
 
 #ifdef SHAREDMATH_CUDA
     if (m_device != weight.m_device || (bias && bias->m_device != m_device))
@@ -1003,39 +1799,34 @@ Tensor Tensor::conv2d(const Tensor& weight, const Tensor* bias,
     if (m_device == Device::CUDA &&
         (m_device_id != weight.m_device_id || (bias && bias->m_device_id != m_device_id)))
         throw std::runtime_error("Tensor::conv2d: tensors must be on the same CUDA device");
-    if (m_device == Device::CUDA)
-        return detail::cuda_conv2d(*this, weight, bias, stride, padding);
+    if (m_device == Device::CUDA) {
+        if (cudaConvFits(s))
+            return detail::cuda_conv2d(*this, weight, bias, stride, padding);
+        const Tensor b = bias ? bias->cpu() : Tensor();
+        return cpu().conv2d(weight.cpu(), bias ? &b : nullptr, stride, padding, dilation, groups)
+                    .cuda(m_device_id);
+    }
 #endif
 
-    const size_t N = dim(0), C = dim(1), H = dim(2), W = dim(3);
-    const size_t OC = weight.dim(0), K = weight.dim(2);
-    if (weight.dim(3) != K)
-        throw std::invalid_argument("Tensor::conv2d: only square kernels are supported");
-    const size_t OH = mlOutDim(H, K, stride, padding, "Tensor::conv2d");
-    const size_t OW = mlOutDim(W, K, stride, padding, "Tensor::conv2d");
-
-    Tensor out({N, OC, OH, OW}, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t oc = 0; oc < OC; ++oc)
-            for (size_t oh = 0; oh < OH; ++oh)
-                for (size_t ow = 0; ow < OW; ++ow) {
-                    double sum = bias ? bias->flat(oc) : 0.0;
-                    for (size_t ic = 0; ic < C; ++ic)
-                        for (size_t kh = 0; kh < K; ++kh) {
-                            long ih = static_cast<long>(oh * stride + kh) -
-                                      static_cast<long>(padding);
-                            if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                            for (size_t kw = 0; kw < K; ++kw) {
-                                long iw = static_cast<long>(ow * stride + kw) -
-                                          static_cast<long>(padding);
-                                if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                                sum += (*this)(n, ic, static_cast<size_t>(ih),
-                                               static_cast<size_t>(iw)) *
-                                       weight(oc, ic, kh, kw);
-                            }
-                        }
-                    out(n, oc, oh, ow) = sum;
-                }
+    if (m_dtype != weight.m_dtype) {
+        if (m_dtype == TensorDType::Float32)
+            return astype(TensorDType::Float64).conv2d(weight, bias, stride, padding, dilation, groups);
+        return conv2d(weight.astype(TensorDType::Float64), bias, stride, padding, dilation, groups);
+    }
+
+    if (!m_rowMajor) return materialize().conv2d(weight, bias, stride, padding, dilation, groups);
+    if (!weight.m_rowMajor)
+        return conv2d(weight.materialize(), bias, stride, padding, dilation, groups);
+
+    // Runs in the input's precision; the bias may be either dtype.
+    Tensor out = zeros({s.N, s.OC, s.outH(), s.outW()}, m_dtype);
+    visit([&](const auto* x) {
+        using T = Elem<decltype(x)>;
+        std::vector<T> b(bias ? s.OC : 0);
+        for (size_t oc = 0; oc < b.size(); ++oc) b[oc] = static_cast<T>(bias->flat(oc));
+        LinearAlgebra::conv2d(s, x, weight.storage<T>(), bias ? b.data() : nullptr,
+                              out.storage<T>());
+    });
     return out;
 }
 
@@ -1043,88 +1834,98 @@ Tensor Tensor::conv2d_backward_input(const Tensor& grad_out,
                                      const Tensor& weight,
                                      Shape input_shape,
                                      size_t stride,
-                                     size_t padding) {
+                                     size_t padding,
+                                     size_t dilation,
+                                     size_t groups) {
     if (grad_out.ndim() != 4 || weight.ndim() != 4 || input_shape.size() != 4)
         throw std::invalid_argument("Tensor::conv2d_backward_input: invalid ranks");
     if (stride == 0)
         throw std::invalid_argument("Tensor::conv2d_backward_input: stride must be > 0");
+    const Conv2dShape s = convShape(input_shape, weight.m_shape, stride, padding,
+                                    dilation, groups, "Tensor::conv2d_backward_input");
+    if (grad_out.m_shape != Shape{s.N, s.OC, s.outH(), s.outW()})
+        throw std::invalid_argument("Tensor::conv2d_backward_input: shape mismatch");
 
 #ifdef SHAREDMATH_CUDA
     if (grad_out.m_device != weight.m_device)
         throw std::runtime_error("Tensor::conv2d_backward_input: tensors must be on the same device");
     if (grad_out.m_device == Device::CUDA && grad_out.m_device_id != weight.m_device_id)
         throw std::runtime_error("Tensor::conv2d_backward_input: tensors must be on the same CUDA device");
-    if (grad_out.m_device == Device::CUDA)
-        return detail::cuda_conv2d_backward_input(grad_out, weight, std::move(input_shape), stride, padding);
+    if (grad_out.m_device == Device::CUDA) {
+        if (cudaConvFits(s))
+            return detail::cuda_conv2d_backward_input(grad_out, weight, std::move(input_shape),
+                                                      stride, padding);
+        return conv2d_backward_input(grad_out.cpu(), weight.cpu(), std::move(input_shape),
+                                     stride, padding, dilation, groups)
+                   .cuda(grad_out.m_device_id);
+    }
 #endif
 
-    const size_t N = input_shape[0], C = input_shape[1], H = input_shape[2], W = input_shape[3];
-    const size_t OC = weight.dim(0), K = weight.dim(2);
-    const size_t OH = grad_out.dim(2), OW = grad_out.dim(3);
+    if (grad_out.m_dtype == TensorDType::Float32 || weight.m_dtype == TensorDType::Float32) {
+        Tensor dx = conv2d_backward_input(grad_out.astype(TensorDType::Float64),
+                                          weight.astype(TensorDType::Float64),
+                                          std::move(input_shape), stride, padding,
+                                          dilation, groups);
+        return allFloat32({&grad_out, &weight}) ? dx.astype(TensorDType::Float32) : dx;
+    }
+    if (!grad_out.m_rowMajor)
+        return conv2d_backward_input(grad_out.materialize(), weight, std::move(input_shape),
+                                     stride, padding, dilation, groups);
+    if (!weight.m_rowMajor)
+        return conv2d_backward_input(grad_out, weight.materialize(), std::move(input_shape),
+                                     stride, padding, dilation, groups);
+
     Tensor dx(input_shape, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t oc = 0; oc < OC; ++oc)
-            for (size_t oh = 0; oh < OH; ++oh)
-                for (size_t ow = 0; ow < OW; ++ow) {
-                    double g = grad_out(n, oc, oh, ow);
-                    for (size_t ic = 0; ic < C; ++ic)
-                        for (size_t kh = 0; kh < K; ++kh) {
-                            long ih = static_cast<long>(oh * stride + kh) -
-                                      static_cast<long>(padding);
-                            if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                            for (size_t kw = 0; kw < K; ++kw) {
-                                long iw = static_cast<long>(ow * stride + kw) -
-                                          static_cast<long>(padding);
-                                if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                                dx(n, ic, static_cast<size_t>(ih), static_cast<size_t>(iw)) +=
-                                    g * weight(oc, ic, kh, kw);
-                            }
-                        }
-                }
+    conv2dBackwardInput(s, grad_out.storage<double>(), weight.storage<double>(),
+                        dx.storage<double>());
     return dx;
 }
 
 Tensor Tensor::conv2d_backward_weight(const Tensor& input,
                                       Shape weight_shape,
                                       size_t stride,
-                                      size_t padding) const {
+                                      size_t padding,
+                                      size_t dilation,
+                                      size_t groups) const {
     if (ndim() != 4 || input.ndim() != 4 || weight_shape.size() != 4)
         throw std::invalid_argument("Tensor::conv2d_backward_weight: invalid ranks");
     if (stride == 0)
         throw std::invalid_argument("Tensor::conv2d_backward_weight: stride must be > 0");
+    const Conv2dShape s = convShape(input.m_shape, weight_shape, stride, padding,
+                                    dilation, groups, "Tensor::conv2d_backward_weight");
+    if (m_shape != Shape{s.N, s.OC, s.outH(), s.outW()})
+        throw std::invalid_argument("Tensor::conv2d_backward_weight: shape mismatch");
 
 #ifdef SHAREDMATH_CUDA
     if (m_device != input.m_device)
         throw std::runtime_error("Tensor::conv2d_backward_weight: tensors must be on the same device");
     if (m_device == Device::CUDA && m_device_id != input.m_device_id)
         throw std::runtime_error("Tensor::conv2d_backward_weight: tensors must be on the same CUDA device");
-    if (m_device == Device::CUDA)
-        return detail::cuda_conv2d_backward_weight(*this, input, std::move(weight_shape), stride, padding);
+    if (m_device == Device::CUDA) {
+        if (cudaConvFits(s))
+            return detail::cuda_conv2d_backward_weight(*this, input, std::move(weight_shape),
+                                                       stride, padding);
+        return cpu().conv2d_backward_weight(input.cpu(), std::move(weight_shape), stride,
+                                            padding, dilation, groups)
+                    .cuda(m_device_id);
+    }
 #endif
 
-    const size_t N = input.dim(0), C = input.dim(1), H = input.dim(2), W = input.dim(3);
-    const size_t OC = weight_shape[0], K = weight_shape[2];
-    const size_t OH = dim(2), OW = dim(3);
+    if (m_dtype == TensorDType::Float32 || input.m_dtype == TensorDType::Float32) {
+        Tensor dw = astype(TensorDType::Float64).conv2d_backward_weight(
+            input.astype(TensorDType::Float64), std::move(weight_shape), stride, padding,
+            dilation, groups);
+        return allFloat32({this, &input}) ? dw.astype(TensorDType::Float32) : dw;
+    }
+    if (!m_rowMajor)
+        return materialize().conv2d_backward_weight(input, std::move(weight_shape), stride,
+                                                    padding, dilation, groups);
+    if (!input.m_rowMajor)
+        return conv2d_backward_weight(input.materialize(), std::move(weight_shape), stride,
+                                      padding, dilation, groups);
+
     Tensor dw(weight_shape, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t oc = 0; oc < OC; ++oc)
-            for (size_t oh = 0; oh < OH; ++oh)
-                for (size_t ow = 0; ow < OW; ++ow) {
-                    double g = (*this)(n, oc, oh, ow);
-                    for (size_t ic = 0; ic < C; ++ic)
-                        for (size_t kh = 0; kh < K; ++kh) {
-                            long ih = static_cast<long>(oh * stride + kh) -
-                                      static_cast<long>(padding);
-                            if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                            for (size_t kw = 0; kw < K; ++kw) {
-                                long iw = static_cast<long>(ow * stride + kw) -
-                                          static_cast<long>(padding);
-                                if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                                dw(oc, ic, kh, kw) += g * input(n, ic, static_cast<size_t>(ih),
-                                                               static_cast<size_t>(iw));
-                            }
-                        }
-                }
+    conv2dBackwardWeight(s, storage<double>(), input.storage<double>(), dw.storage<double>());
     return dw;
 }
 
@@ -1135,15 +1936,28 @@ Tensor Tensor::conv2d_backward_bias() const {
     if (m_device == Device::CUDA)
         return detail::cuda_conv2d_backward_bias(*this);
 #endif
-    Tensor db({dim(1)}, 0.0);
-    for (size_t n = 0; n < dim(0); ++n)
-        for (size_t oc = 0; oc < dim(1); ++oc)
-            for (size_t oh = 0; oh < dim(2); ++oh)
-                for (size_t ow = 0; ow < dim(3); ++ow)
-                    db.flat(oc) += (*this)(n, oc, oh, ow);
+    F32_VIA_F64(conv2d_backward_bias())
+    if (!m_rowMajor) return materialize().conv2d_backward_bias();
+    const size_t N = dim(0), OC = dim(1), plane = dim(2) * dim(3);
+    const double* g = storage<double>();
+    Tensor db({OC}, 0.0);
+    double* d = db.storage<double>();
+    Core::parallel_for(0, OC, 1, [&](size_t lo, size_t hi) {
+        for (size_t oc = lo; oc < hi; ++oc) {
+            double sum = 0.0;
+            for (size_t n = 0; n < N; ++n) {
+                const double* gp = g + (n * OC + oc) * plane;
+                for (size_t i = 0; i < plane; ++i) sum += gp[i];
+            }
+            d[oc] = sum;
+        }
+    });
     return db;
 }
 
+// The pooling kernels below work on one (n, c) plane at a time; planes run in
+// parallel and each one only writes its own output (or gradient) plane.
+
 Tensor Tensor::max_pool2d(size_t kernel_size, size_t stride, size_t padding) const {
     if (ndim() != 4)
         throw std::invalid_argument("Tensor::max_pool2d: input must be 4-D NCHW");
@@ -1152,26 +1966,31 @@ Tensor Tensor::max_pool2d(size_t kernel_size, size_t stride, size_t padding) con
     if (m_device == Device::CUDA)
         return detail::cuda_max_pool2d(*this, kernel_size, stride, padding);
 #endif
+    F32_VIA_F64(max_pool2d(kernel_size, stride, padding))
+    if (!m_rowMajor) return materialize().max_pool2d(kernel_size, stride, padding);
     const size_t N = dim(0), C = dim(1), H = dim(2), W = dim(3);
     const size_t OH = mlOutDim(H, kernel_size, stride, padding, "Tensor::max_pool2d");
     const size_t OW = mlOutDim(W, kernel_size, stride, padding, "Tensor::max_pool2d");
     Tensor out({N, C, OH, OW}, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t c = 0; c < C; ++c)
-            for (size_t oh = 0; oh < OH; ++oh)
+    const double* x = storage<double>();
+    double* y = out.storage<double>();
+    Core::parallel_for(0, N * C, 1, [&](size_t lo, size_t hi) {
+        for (size_t plane = lo; plane < hi; ++plane) {
+            const double* xp = x + plane * H * W;
+            double* yp = y + plane * OH * OW;
+            for (size_t oh = 0; oh < OH; ++oh) {
+                const auto [h0, h1] = poolWindow(oh, kernel_size, stride, padding, H);
                 for (size_t ow = 0; ow < OW; ++ow) {
+                    const auto [w0, w1] = poolWindow(ow, kernel_size, stride, padding, W);
                     double best = -std::numeric_limits<double>::infinity();
-                    for (size_t kh = 0; kh < kernel_size; ++kh) {
-                        long ih = static_cast<long>(oh * stride + kh) - static_cast<long>(padding);
-                        if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                        for (size_t kw = 0; kw < kernel_size; ++kw) {
-                            long iw = static_cast<long>(ow * stride + kw) - static_cast<long>(padding);
-                            if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                            best = std::max(best, (*this)(n, c, static_cast<size_t>(ih), static_cast<size_t>(iw)));
-                        }
-                    }
-                    out(n, c, oh, ow) = best;
+                    for (size_t ih = h0; ih < h1; ++ih)
+                        for (size_t iw = w0; iw < w1; ++iw)
+                            best = std::max(best, xp[ih * W + iw]);
+                    yp[oh * OW + ow] = best;
                 }
+            }
+        }
+    });
     return out;
 }
 
@@ -1188,27 +2007,41 @@ Tensor Tensor::max_pool2d_backward(const Tensor& input, size_t kernel_size,
     if (m_device == Device::CUDA)
         return detail::cuda_max_pool2d_backward(*this, input, kernel_size, stride, padding);
 #endif
+    if (m_dtype == TensorDType::Float32 || input.m_dtype == TensorDType::Float32) {
+        Tensor dx = astype(TensorDType::Float64).max_pool2d_backward(
+            input.astype(TensorDType::Float64), kernel_size, stride, padding);
+        return allFloat32({this, &input}) ? dx.astype(TensorDType::Float32) : dx;
+    }
+    if (!m_rowMajor) return materialize().max_pool2d_backward(input, kernel_size, stride, padding);
+    if (!input.m_rowMajor)
+        return max_pool2d_backward(input.materialize(), kernel_size, stride, padding);
     const size_t N = input.dim(0), C = input.dim(1), H = input.dim(2), W = input.dim(3);
     const size_t OH = dim(2), OW = dim(3);
+    if (dim(0) != N || dim(1) != C)
+        throw std::invalid_argument("Tensor::max_pool2d_backward: shape mismatch");
     Tensor dx(input.shape(), 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t c = 0; c < C; ++c)
-            for (size_t oh = 0; oh < OH; ++oh)
+    const double* g = storage<double>();
+    const double* x = input.storage<double>();
+    double* d = dx.storage<double>();
+    Core::parallel_for(0, N * C, 1, [&](size_t lo, size_t hi) {
+        for (size_t plane = lo; plane < hi; ++plane) {
+            const double* xp = x + plane * H * W;
+            const double* gp = g + plane * OH * OW;
+            double* dp = d + plane * H * W;
+            for (size_t oh = 0; oh < OH; ++oh) {
+                const auto [h0, h1] = poolWindow(oh, kernel_size, stride, padding, H);
                 for (size_t ow = 0; ow < OW; ++ow) {
+                    const auto [w0, w1] = poolWindow(ow, kernel_size, stride, padding, W);
                     double best = -std::numeric_limits<double>::infinity();
-                    size_t bi = 0, bj = 0;
-                    for (size_t kh = 0; kh < kernel_size; ++kh) {
-                        long ih = static_cast<long>(oh * stride + kh) - static_cast<long>(padding);
-                        if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                        for (size_t kw = 0; kw < kernel_size; ++kw) {
-                            long iw = static_cast<long>(ow * stride + kw) - static_cast<long>(padding);
-                            if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                            double v = input(n, c, static_cast<size_t>(ih), static_cast<size_t>(iw));
-                            if (v > best) { best = v; bi = static_cast<size_t>(ih); bj = static_cast<size_t>(iw); }
-                        }
-                    }
-                    dx(n, c, bi, bj) += (*this)(n, c, oh, ow);
+                    size_t arg = 0;
+                    for (size_t ih = h0; ih < h1; ++ih)
+                        for (size_t iw = w0; iw < w1; ++iw)
+                            if (xp[ih * W + iw] > best) { best = xp[ih * W + iw]; arg = ih * W + iw; }
+                    dp[arg] += gp[oh * OW + ow];
                 }
+            }
+        }
+    });
     return dx;
 }
 
@@ -1220,27 +2053,31 @@ Tensor Tensor::avg_pool2d(size_t kernel_size, size_t stride, size_t padding) con
     if (m_device == Device::CUDA)
         return detail::cuda_avg_pool2d(*this, kernel_size, stride, padding);
 #endif
+    F32_VIA_F64(avg_pool2d(kernel_size, stride, padding))
+    if (!m_rowMajor) return materialize().avg_pool2d(kernel_size, stride, padding);
     const size_t N = dim(0), C = dim(1), H = dim(2), W = dim(3);
     const size_t OH = mlOutDim(H, kernel_size, stride, padding, "Tensor::avg_pool2d");
     const size_t OW = mlOutDim(W, kernel_size, stride, padding, "Tensor::avg_pool2d");
     Tensor out({N, C, OH, OW}, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t c = 0; c < C; ++c)
-            for (size_t oh = 0; oh < OH; ++oh)
+    const double* x = storage<double>();
+    double* y = out.storage<double>();
+    Core::parallel_for(0, N * C, 1, [&](size_t lo, size_t hi) {
+        for (size_t plane = lo; plane < hi; ++plane) {
+            const double* xp = x + plane * H * W;
+            double* yp = y + plane * OH * OW;
+            for (size_t oh = 0; oh < OH; ++oh) {
+                const auto [h0, h1] = poolWindow(oh, kernel_size, stride, padding, H);
                 for (size_t ow = 0; ow < OW; ++ow) {
-                    double sum = 0.0, count = 0.0;
-                    for (size_t kh = 0; kh < kernel_size; ++kh) {
-                        long ih = static_cast<long>(oh * stride + kh) - static_cast<long>(padding);
-                        if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                        for (size_t kw = 0; kw < kernel_size; ++kw) {
-                            long iw = static_cast<long>(ow * stride + kw) - static_cast<long>(padding);
-                            if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                            sum += (*this)(n, c, static_cast<size_t>(ih), static_cast<size_t>(iw));
-                            count += 1.0;
-                        }
-                    }
-                    out(n, c, oh, ow) = count > 0.0 ? sum / count : 0.0;
+                    const auto [w0, w1] = poolWindow(ow, kernel_size, stride, padding, W);
+                    double sum = 0.0;
+                    for (size_t ih = h0; ih < h1; ++ih)
+                        for (size_t iw = w0; iw < w1; ++iw) sum += xp[ih * W + iw];
+                    const size_t count = (h1 - h0) * (w1 - w0);
+                    yp[oh * OW + ow] = count > 0 ? sum / static_cast<double>(count) : 0.0;
                 }
+            }
+        }
+    });
     return out;
 }
 
@@ -1253,34 +2090,33 @@ Tensor Tensor::avg_pool2d_backward(Shape input_shape, size_t kernel_size,
     if (m_device == Device::CUDA)
         return detail::cuda_avg_pool2d_backward(*this, std::move(input_shape), kernel_size, stride, padding);
 #endif
+    F32_VIA_F64(avg_pool2d_backward(std::move(input_shape), kernel_size, stride, padding))
+    if (!m_rowMajor)
+        return materialize().avg_pool2d_backward(std::move(input_shape), kernel_size, stride, padding);
     const size_t N = input_shape[0], C = input_shape[1], H = input_shape[2], W = input_shape[3];
     const size_t OH = dim(2), OW = dim(3);
+    if (dim(0) != N || dim(1) != C)
+        throw std::invalid_argument("Tensor::avg_pool2d_backward: shape mismatch");
     Tensor dx(input_shape, 0.0);
-    for (size_t n = 0; n < N; ++n)
-        for (size_t c = 0; c < C; ++c)
-            for (size_t oh = 0; oh < OH; ++oh)
+    const double* g = storage<double>();
+    double* d = dx.storage<double>();
+    Core::parallel_for(0, N * C, 1, [&](size_t lo, size_t hi) {
+        for (size_t plane = lo; plane < hi; ++plane) {
+            const double* gp = g + plane * OH * OW;
+            double* dp = d + plane * H * W;
+            for (size_t oh = 0; oh < OH; ++oh) {
+                const auto [h0, h1] = poolWindow(oh, kernel_size, stride, padding, H);
                 for (size_t ow = 0; ow < OW; ++ow) {
-                    double count = 0.0;
-                    for (size_t kh = 0; kh < kernel_size; ++kh) {
-                        long ih = static_cast<long>(oh * stride + kh) - static_cast<long>(padding);
-                        if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                        for (size_t kw = 0; kw < kernel_size; ++kw) {
-                            long iw = static_cast<long>(ow * stride + kw) - static_cast<long>(padding);
-                            if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                            count += 1.0;
-                        }
-                    }
-                    double share = count > 0.0 ? (*this)(n, c, oh, ow) / count : 0.0;
-                    for (size_t kh = 0; kh < kernel_size; ++kh) {
-                        long ih = static_cast<long>(oh * stride + kh) - static_cast<long>(padding);
-                        if (ih < 0 || ih >= static_cast<long>(H)) continue;
-                        for (size_t kw = 0; kw < kernel_size; ++kw) {
-                            long iw = static_cast<long>(ow * stride + kw) - static_cast<long>(padding);
-                            if (iw < 0 || iw >= static_cast<long>(W)) continue;
-                            dx(n, c, static_cast<size_t>(ih), static_cast<size_t>(iw)) += share;
-                        }
-                    }
+                    const auto [w0, w1] = poolWindow(ow, kernel_size, stride, padding, W);
+                    const size_t count = (h1 - h0) * (w1 - w0);
+                    if (count == 0) continue;
+                    const double share = gp[oh * OW + ow] / static_cast<double>(count);
+                    for (size_t ih = h0; ih < h1; ++ih)
+                        for (size_t iw = w0; iw < w1; ++iw) dp[ih * W + iw] += share;
                 }
+            }
+        }
+    });
     return dx;
 }
 
@@ -1293,10 +2129,11 @@ double Tensor::trace() const {
 }
 
 Tensor Tensor::diag() const {
+    F32_VIA_F64(diag())
     if (ndim() == 1) {
         size_t n = m_shape[0];
         Tensor result({n, n}, 0.0);
-        for (size_t i = 0; i < n; ++i) result(i, i) = m_data[i];
+        for (size_t i = 0; i < n; ++i) result(i, i) = flat(i);
         return result;
     }
     if (ndim() == 2) {
@@ -1325,9 +2162,9 @@ std::string Tensor::str() const {
 
     if (ndim() == 1) {
         oss << "\n[";
-        for (size_t i = 0; i < m_data.size(); ++i) {
+        for (size_t i = 0; i < size(); ++i) {
             if (i) oss << ", ";
-            oss << m_data[i];
+            oss << flat(i);
         }
         oss << "]";
     } else if (ndim() == 2) {
@@ -1347,9 +2184,9 @@ std::string Tensor::str() const {
     } else {
         // N-D: print flat with shape info
         oss << "\n[";
-        for (size_t i = 0; i < m_data.size(); ++i) {
+        for (size_t i = 0; i < size(); ++i) {
             if (i) oss << ", ";
-            oss << m_data[i];
+            oss << flat(i);
         }
         oss << "]";
     }
@@ -1366,11 +2203,13 @@ Tensor operator/(double s, const Tensor& t) {
     if (t.device() == Device::CUDA)
         return detail::cuda_scalar(t, s, detail::ScalarOp::RDiv);
 #endif
-    return t.apply([s](double x){ return s / x; });
+    return t.map([s](auto x){ return static_cast<decltype(x)>(s) / x; });
 }
 
 std::ostream& operator<<(std::ostream& os, const Tensor& t) {
     return os << t.str();
 }
 
+#undef F32_VIA_F64
+
 } // namespace SharedMath::LinearAlgebra
@@ -160,12 +160,17 @@ Tensor Tensor::cuda(int device_id) const {
     // Graceful fallback: no GPU available → stay on CPU silently.
     if (!have_gpu()) return *this;
 
+    // Device buffers hold doubles only.
+    if (m_dtype == TensorDType::Float32)
+        return astype(TensorDType::Float64).cuda(device_id);
+
     auto& mgr = Core::CudaDeviceManager::instance();
     if (device_id < 0) device_id = mgr.leastLoadedDevice();
     if (device_id < 0 || device_id >= mgr.deviceCount())
         throw std::out_of_range("Tensor::cuda: invalid CUDA device id");
 
-    auto buf = detail::TensorCUDAImpl::make_buffer(m_data.data(), m_data.size(),
+    const std::vector<double>& host = data();   // compacts a strided view
+    auto buf = detail::TensorCUDAImpl::make_buffer(host.data(), host.size(),
                                                    device_id);
     return from_cuda(m_shape, std::move(buf), device_id);
 }
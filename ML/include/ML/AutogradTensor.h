@@ -176,6 +176,10 @@ public:
      */
     AutoTensor T() const;
 
+    /// Convert to another element type; the gradient is converted back to
+    /// this tensor's dtype on the way down.
+    AutoTensor astype(LinearAlgebra::TensorDType dtype) const;
+
     /// Reshape with gradient passthrough.
     AutoTensor reshape(Tensor::Shape new_shape) const;
 
@@ -61,6 +61,8 @@ public:
     void cuda(int device_id = -1);
     void cuda_auto();
     void cpu();
+    /// Convert every parameter (and its gradient) to `dtype`.
+    void astype(SharedMath::LinearAlgebra::TensorDType dtype);
     void save(const std::string& path) const;
     void load(const std::string& path);
 
@@ -224,7 +226,9 @@ public:
            size_t kernel_size,
            size_t stride = 1,
            size_t padding = 0,
-           bool use_bias = true);
+           bool use_bias = true,
+           size_t dilation = 1,
+           size_t groups = 1);
 
     AutoTensor forward(const AutoTensor& x) override;
     std::vector<AutoTensor*> parameters() override;
@@ -239,6 +243,8 @@ public:
     size_t kernel_size() const noexcept;
     size_t stride() const noexcept;
     size_t padding() const noexcept;
+    size_t dilation() const noexcept;
+    size_t groups() const noexcept;
 
 private:
     size_t     m_in_channels;
@@ -246,6 +252,8 @@ private:
     size_t     m_kernel_size;
     size_t     m_stride;
     size_t     m_padding;
+    size_t     m_dilation;
+    size_t     m_groups;
     bool       m_use_bias;
     AutoTensor m_weight;
     AutoTensor m_bias;
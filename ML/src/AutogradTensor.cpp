@@ -41,7 +41,7 @@ static Tensor reduceGradToShape(const Tensor& g,
 
 void AutoTensor::Impl::accumulate_grad(const Tensor& g) {
     if (!has_grad_) {
-        grad     = Tensor::zeros(data.shape());
+        grad     = Tensor::zeros(data.shape()).astype(data.dtype());
         has_grad_ = true;
     }
     grad += g;
@@ -118,7 +118,7 @@ void AutoTensor::set_grad(Tensor g) {
 }
 
 void AutoTensor::zero_grad() {
-    m_impl->grad      = Tensor::zeros(m_impl->data.shape());
+    m_impl->grad      = Tensor::zeros(m_impl->data.shape()).astype(m_impl->data.dtype());
     m_impl->has_grad_ = true;
 }
 
@@ -131,7 +131,7 @@ void AutoTensor::backward() {
         throw std::runtime_error(
             "AutoTensor::backward(): tensor must be scalar (size == 1). "
             "Call backward(upstream_grad) for non-scalar outputs.");
-    backward(Tensor::ones({1}));
+    backward(Tensor::ones({1}).astype(m_impl->data.dtype()));
 }
 
 void AutoTensor::backward(Tensor upstream) {
@@ -273,6 +273,15 @@ AutoTensor AutoTensor::T() const {
         [si](const Tensor& g) { si->propagate(g.transpose()); });
 }
 
+AutoTensor AutoTensor::astype(LinearAlgebra::TensorDType dtype) const {
+    auto out_data = m_impl->data.astype(dtype);
+    if (!m_impl->requires_grad) return AutoTensor(out_data);
+
+    auto si = m_impl;
+    return make_result(std::move(out_data), true,
+        [si](const Tensor& g) { si->propagate(g.astype(si->data.dtype())); });
+}
+
 AutoTensor AutoTensor::reshape(Tensor::Shape new_shape) const {
     Tensor::Shape original_shape = m_impl->data.shape();
     auto out_data = m_impl->data.reshape(std::move(new_shape));
@@ -291,28 +300,28 @@ AutoTensor AutoTensor::reshape(Tensor::Shape new_shape) const {
 
 AutoTensor AutoTensor::sum() const {
     double s = m_impl->data.sum();
-    Tensor out_data = Tensor::from_vector({s});
+    Tensor out_data = Tensor::from_vector({s}).astype(m_impl->data.dtype());
     if (!m_impl->requires_grad) return AutoTensor(out_data);
 
     auto si = m_impl;
     return make_result(std::move(out_data), true,
         [si](const Tensor& g) {
             double upstream = g.flat(0);
-            si->propagate(Tensor(si->data.shape(), upstream));
+            si->propagate(Tensor(si->data.shape(), upstream).astype(si->data.dtype()));
         });
 }
 
 AutoTensor AutoTensor::mean() const {
     double m   = m_impl->data.mean();
     double n   = static_cast<double>(m_impl->data.size());
-    Tensor out_data = Tensor::from_vector({m});
+    Tensor out_data = Tensor::from_vector({m}).astype(m_impl->data.dtype());
     if (!m_impl->requires_grad) return AutoTensor(out_data);
 
     auto si = m_impl;
     return make_result(std::move(out_data), true,
         [si, n](const Tensor& g) {
             double upstream = g.flat(0);
-            si->propagate(Tensor(si->data.shape(), upstream / n));
+            si->propagate(Tensor(si->data.shape(), upstream / n).astype(si->data.dtype()));
         });
 }
 
@@ -5,6 +5,18 @@
 
 namespace SharedMath::ML {
 
+namespace {
+
+using LinearAlgebra::TensorDType;
+
+// Value of a one-element upstream gradient, whatever its device and dtype.
+double scalarOf(const Tensor& t) {
+    const Tensor host = t.cpu();
+    return host.flat(0);
+}
+
+} // namespace
+
 AutoTensor Loss::operator()(const AutoTensor& y_pred, const AutoTensor& y_true) {
     return forward(y_pred, y_true);
 }
@@ -30,8 +42,8 @@ AutoTensor CrossEntropyLoss::forward(const AutoTensor& logits, const Tensor& lab
     const size_t N = logits.data().dim(0);
     const size_t C = logits.data().dim(1);
     Tensor probs = logits.data().softmax(1);
-    Tensor probs_cpu = probs.cpu();
-    Tensor labels_cpu = labels.cpu();
+    const Tensor probs_cpu = probs.cpu().astype(TensorDType::Float64);
+    const Tensor labels_cpu = labels.cpu();
 
     double loss_value = 0.0;
     Tensor grad = probs_cpu;
@@ -44,13 +56,14 @@ AutoTensor CrossEntropyLoss::forward(const AutoTensor& logits, const Tensor& lab
     }
     loss_value /= static_cast<double>(N);
     grad /= static_cast<double>(N);
-    grad = grad.to(logits.data().device(), logits.data().device_id());
+    grad = grad.astype(logits.data().dtype())
+               .to(logits.data().device(), logits.data().device_id());
 
     auto li = logits.impl();
     Tensor loss_data = Tensor::from_vector({loss_value});
     return AutoTensor::make_result(std::move(loss_data), logits.requires_grad(),
         [li, grad](const Tensor& upstream) {
-            double scale = upstream.cpu().flat(0);
+            double scale = scalarOf(upstream);
             li->propagate(grad * scale);
         });
 }
@@ -107,8 +120,8 @@ AutoTensor BCELoss::forward(const AutoTensor& y_pred, const AutoTensor& y_true)
         throw std::invalid_argument("BCELoss: size mismatch between y_pred and y_true");
 
     // loss = -mean(y*log(p) + (1-y)*log(1-p))
-    Tensor p  = y_pred.data();
-    Tensor yt = y_true.data();
+    const Tensor& p  = y_pred.data();
+    const Tensor& yt = y_true.data();
     double loss_val = 0.0;
     Tensor grad_data(p.shape());
     for (size_t i = 0; i < N; ++i) {
@@ -124,8 +137,8 @@ AutoTensor BCELoss::forward(const AutoTensor& y_pred, const AutoTensor& y_true)
     return AutoTensor::make_result(
         Tensor::from_vector({loss_val}), y_pred.requires_grad(),
         [pi_impl, grad_data](const Tensor& upstream) {
-            double s = upstream.cpu().flat(0);
-            pi_impl->propagate(grad_data * s);
+            double s = scalarOf(upstream);
+            pi_impl->propagate((grad_data * s).astype(pi_impl->data.dtype()));
         });
 }
 
@@ -139,8 +152,8 @@ AutoTensor BCEWithLogitsLoss::forward(const AutoTensor& logits, const AutoTensor
         throw std::invalid_argument("BCEWithLogitsLoss: size mismatch");
 
     // numerically stable: max(z,0) - z*y + log(1+exp(-|z|))
-    Tensor z  = logits.data();
-    Tensor yt = y_true.data();
+    const Tensor& z  = logits.data();
+    const Tensor& yt = y_true.data();
     double loss_val = 0.0;
     Tensor grad_data(z.shape());
     for (size_t i = 0; i < N; ++i) {
@@ -157,8 +170,8 @@ AutoTensor BCEWithLogitsLoss::forward(const AutoTensor& logits, const AutoTensor
     return AutoTensor::make_result(
         Tensor::from_vector({loss_val}), logits.requires_grad(),
         [li, grad_data](const Tensor& upstream) {
-            double s = upstream.cpu().flat(0);
-            li->propagate(grad_data * s);
+            double s = scalarOf(upstream);
+            li->propagate((grad_data * s).astype(li->data.dtype()));
         });
 }
 
@@ -2,6 +2,8 @@
 
 #include "functions/Activations.h"
 
+#include "core/ThreadPool.h"
+
 #include <algorithm>
 #include <limits>
 #include <random>
@@ -47,7 +49,7 @@ void LinearRegression::fit(const Tensor& X, const Tensor& y) {
         for (size_t i = 0; i < N; ++i) {
             double val = m_bias;
             for (size_t d = 0; d < D; ++d)
-                val += X(i, d) * m_theta.flat(d);
+                val += X.at_unsafe(i, d) * m_theta.flat(d);
             y_hat.flat(i) = val;
         }
 
@@ -59,7 +61,7 @@ void LinearRegression::fit(const Tensor& X, const Tensor& y) {
         for (size_t d = 0; d < D; ++d) {
             double g = 0.0;
             for (size_t i = 0; i < N; ++i)
-                g += X(i, d) * residual.flat(i);
+                g += X.at_unsafe(i, d) * residual.flat(i);
             m_theta.flat(d) -= m_lr * scale * g;
         }
 
@@ -81,7 +83,7 @@ Tensor LinearRegression::predict(const Tensor& X) const {
     for (size_t i = 0; i < N; ++i) {
         double val = m_bias;
         for (size_t d = 0; d < D; ++d)
-            val += X(i, d) * m_theta.flat(d);
+            val += X.at_unsafe(i, d) * m_theta.flat(d);
         y_hat.flat(i) = val;
     }
     return y_hat;
@@ -109,7 +111,7 @@ void LogisticRegression::fit(const Tensor& X, const Tensor& y) {
         for (size_t i = 0; i < N; ++i) {
             double z = m_bias;
             for (size_t d = 0; d < D; ++d)
-                z += X(i, d) * m_theta.flat(d);
+                z += X.at_unsafe(i, d) * m_theta.flat(d);
             p.flat(i) = SharedMath::Functions::sigmoid(z);
         }
 
@@ -117,7 +119,7 @@ void LogisticRegression::fit(const Tensor& X, const Tensor& y) {
         for (size_t d = 0; d < D; ++d) {
             double g = 0.0;
             for (size_t i = 0; i < N; ++i)
-                g += X(i, d) * (p.flat(i) - y.flat(i));
+                g += X.at_unsafe(i, d) * (p.flat(i) - y.flat(i));
             m_theta.flat(d) -= m_lr * scale * g;
         }
         double gb = 0.0;
@@ -138,7 +140,7 @@ Tensor LogisticRegression::predict_proba(const Tensor& X) const {
     for (size_t i = 0; i < N; ++i) {
         double z = m_bias;
         for (size_t d = 0; d < D; ++d)
-            z += X(i, d) * m_theta.flat(d);
+            z += X.at_unsafe(i, d) * m_theta.flat(d);
         proba.flat(i) = SharedMath::Functions::sigmoid(z);
     }
     return proba;
@@ -181,7 +183,7 @@ void KMeans::fit(const Tensor& X) {
     for (size_t c = 0; c < m_k; ++c) {
         size_t idx = dist(rng);
         for (size_t d = 0; d < D; ++d)
-            m_centroids(c, d) = X(idx, d);
+            m_centroids.at_unsafe(c, d) = X.at_unsafe(idx, d);
     }
 
     std::vector<size_t> labels(N, 0);
@@ -195,7 +197,7 @@ void KMeans::fit(const Tensor& X) {
             for (size_t c = 0; c < m_k; ++c) {
                 double d2 = 0.0;
                 for (size_t d = 0; d < D; ++d) {
-                    double diff = X(i, d) - m_centroids(c, d);
+                    double diff = X.at_unsafe(i, d) - m_centroids.at_unsafe(c, d);
                     d2 += diff * diff;
                 }
                 if (d2 < best_dist) { best_dist = d2; best = c; }
@@ -211,12 +213,12 @@ void KMeans::fit(const Tensor& X) {
             size_t c = labels[i];
             ++counts[c];
             for (size_t d = 0; d < D; ++d)
-                new_centroids(c, d) += X(i, d);
+                new_centroids.at_unsafe(c, d) += X.at_unsafe(i, d);
         }
         for (size_t c = 0; c < m_k; ++c) {
             if (counts[c] == 0) continue;
             for (size_t d = 0; d < D; ++d)
-                new_centroids(c, d) /= static_cast<double>(counts[c]);
+                new_centroids.at_unsafe(c, d) /= static_cast<double>(counts[c]);
         }
         m_centroids = new_centroids;
     }
@@ -239,7 +241,7 @@ Tensor KMeans::predict(const Tensor& X) const {
         for (size_t c = 0; c < m_k; ++c) {
             double d2 = 0.0;
             for (size_t d = 0; d < D; ++d) {
-                double diff = X(i, d) - m_centroids(c, d);
+                double diff = X.at_unsafe(i, d) - m_centroids.at_unsafe(c, d);
                 d2 += diff * diff;
             }
             if (d2 < best_dist) { best_dist = d2; best = c; }
@@ -279,37 +281,40 @@ Tensor KNNClassifier::predict(const Tensor& X) const {
 
     Tensor result = Tensor::zeros({N_test});
 
-    for (size_t i = 0; i < N_test; ++i) {
+    // Test rows are classified independently on the shared thread pool.
+    Core::parallel_for(0, N_test, 8, [&](size_t lo, size_t hi) {
         std::vector<std::pair<double, size_t>> dists(N_train);
-        for (size_t j = 0; j < N_train; ++j) {
-            double d2 = 0.0;
-            for (size_t d = 0; d < D; ++d) {
-                double diff = X(i, d) - m_X_train(j, d);
-                d2 += diff * diff;
+        for (size_t i = lo; i < hi; ++i) {
+            for (size_t j = 0; j < N_train; ++j) {
+                double d2 = 0.0;
+                for (size_t d = 0; d < D; ++d) {
+                    double diff = X.at_unsafe(i, d) - m_X_train.at_unsafe(j, d);
+                    d2 += diff * diff;
+                }
+                dists[j] = {d2, j};
             }
-            dists[j] = {d2, j};
-        }
 
-        std::partial_sort(dists.begin(), dists.begin() + k, dists.end());
-
-        std::vector<std::pair<int, size_t>> votes;
-        for (size_t n = 0; n < k; ++n) {
-            int lbl = static_cast<int>(m_y_train.flat(dists[n].second));
-            bool found = false;
-            for (auto& vote : votes) {
-                if (vote.first == lbl) {
-                    ++vote.second;
-                    found = true;
-                    break;
+            std::partial_sort(dists.begin(), dists.begin() + k, dists.end());
+
+            std::vector<std::pair<int, size_t>> votes;
+            for (size_t n = 0; n < k; ++n) {
+                int lbl = static_cast<int>(m_y_train.flat(dists[n].second));
+                bool found = false;
+                for (auto& vote : votes) {
+                    if (vote.first == lbl) {
+                        ++vote.second;
+                        found = true;
+                        break;
+                    }
                 }
+                if (!found) votes.push_back({lbl, 1});
             }
-            if (!found) votes.push_back({lbl, 1});
-        }
 
-        auto best = std::max_element(votes.begin(), votes.end(),
-            [](const auto& a, const auto& b) { return a.second < b.second; });
-        result.flat(i) = static_cast<double>(best->first);
-    }
+            auto best = std::max_element(votes.begin(), votes.end(),
+                [](const auto& a, const auto& b) { return a.second < b.second; });
+            result.flat(i) = static_cast<double>(best->first);
+        }
+    });
     return result;
 }
 
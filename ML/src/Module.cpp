@@ -22,6 +22,17 @@ size_t checkedPoolOutDim(size_t input, size_t kernel, size_t stride,
     return (padded - kernel) / stride + 1;
 }
 
+// The hand-written layer loops below index doubles directly, so their
+// operands are brought to the host as Float64 and results are converted back
+// to the dtype and device of the tensor they stand in for.
+Tensor hostF64(const Tensor& t) {
+    return t.cpu().astype(LinearAlgebra::TensorDType::Float64);
+}
+
+Tensor backTo(const Tensor& host, const Tensor& like) {
+    return host.astype(like.dtype()).to(like.device(), like.device_id());
+}
+
 } // namespace
 
 AutoTensor Module::operator()(const AutoTensor& x) {
@@ -56,6 +67,14 @@ void Module::to(SharedMath::LinearAlgebra::Device device, int device_id) {
     }
 }
 
+void Module::astype(SharedMath::LinearAlgebra::TensorDType dtype) {
+    for (auto* p : parameters()) {
+        p->data() = p->data().astype(dtype);
+        if (p->has_grad())
+            p->set_grad(p->grad().astype(dtype));
+    }
+}
+
 void Module::cuda(int device_id) {
     to(SharedMath::LinearAlgebra::Device::CUDA, device_id);
 }
@@ -77,7 +96,7 @@ void Module::save(const std::string& path) const {
     const std::uint64_t count = static_cast<std::uint64_t>(params.size());
     out.write(reinterpret_cast<const char*>(&count), sizeof(count));
     for (const auto* p : params) {
-        Tensor cpu = p->data().cpu();
+        Tensor cpu = hostF64(p->data());   // the file format stores doubles
         const std::uint64_t rank = static_cast<std::uint64_t>(cpu.ndim());
         out.write(reinterpret_cast<const char*>(&rank), sizeof(rank));
         for (size_t d : cpu.shape()) {
@@ -119,7 +138,7 @@ void Module::load(const std::string& path) {
         Tensor loaded(shape, std::move(values));
         if (loaded.shape() != p->data().shape())
             throw std::runtime_error("Module::load: parameter shape mismatch");
-        p->data() = loaded.to(p->data().device(), p->data().device_id());
+        p->data() = backTo(loaded, p->data());
     }
 }
 
@@ -216,7 +235,8 @@ AutoTensor Dropout::forward(const AutoTensor& x) {
     const double keep = 1.0 - m_p;
     const double scale = 1.0 / keep;
 
-    Tensor mask = Tensor::bernoulli(x.data().shape(), keep, m_seed++);
+    Tensor mask = Tensor::bernoulli(x.data().shape(), keep, m_seed++)
+        .astype(x.data().dtype());
     Tensor out_data = x.data() * mask * scale;
 
     if (!x.requires_grad())
@@ -336,7 +356,7 @@ AutoTensor Softmax::forward(const AutoTensor& x) {
                     }
                 }
             }
-            xi->propagate(dx);
+            xi->propagate(dx.astype(xi->data.dtype()));
         });
 }
 
@@ -363,15 +383,15 @@ AutoTensor LayerNorm::forward(const AutoTensor& x) {
     if (x.data().ndim() < 1 || x.data().shape().back() != m_normalized_shape)
         throw std::invalid_argument("LayerNorm::forward: last dimension mismatch");
 
-    Tensor x_cpu = x.data().cpu();
+    Tensor x_cpu = hostF64(x.data());
     const size_t F = m_normalized_shape;
     const size_t rows = x_cpu.size() / F;
     Tensor out_cpu = Tensor::zeros(x_cpu.shape());
     Tensor xhat_cpu = Tensor::zeros(x_cpu.shape());
     Tensor inv_std({rows});
 
-    Tensor gamma_cpu = m_affine ? m_gamma.data().cpu() : Tensor{};
-    Tensor beta_cpu = m_affine ? m_beta.data().cpu() : Tensor{};
+    Tensor gamma_cpu = m_affine ? hostF64(m_gamma.data()) : Tensor{};
+    Tensor beta_cpu = m_affine ? hostF64(m_beta.data()) : Tensor{};
 
     for (size_t r = 0; r < rows; ++r) {
         double mean = 0.0;
@@ -395,7 +415,7 @@ AutoTensor LayerNorm::forward(const AutoTensor& x) {
         }
     }
 
-    Tensor out = out_cpu.to(x.data().device(), x.data().device_id());
+    Tensor out = backTo(out_cpu, x.data());
     const bool needs_grad = x.requires_grad() ||
         (m_affine && (m_gamma.requires_grad() || m_beta.requires_grad()));
     if (!needs_grad) return AutoTensor::from(std::move(out));
@@ -407,11 +427,11 @@ AutoTensor LayerNorm::forward(const AutoTensor& x) {
 
     return AutoTensor::make_result(std::move(out), true,
         [xi, gi, bi, affine, xhat_cpu, inv_std, F, rows](const Tensor& g) {
-            Tensor g_cpu = g.cpu();
+            Tensor g_cpu = hostF64(g);
             Tensor dx_cpu = Tensor::zeros(xhat_cpu.shape());
             Tensor dgamma_cpu = affine ? Tensor::zeros({F}) : Tensor{};
             Tensor dbeta_cpu = affine ? Tensor::zeros({F}) : Tensor{};
-            Tensor gamma_cpu = affine ? gi->data.cpu() : Tensor{};
+            Tensor gamma_cpu = affine ? hostF64(gi->data) : Tensor{};
 
             for (size_t r = 0; r < rows; ++r) {
                 double sum_dy = 0.0;
@@ -436,10 +456,10 @@ AutoTensor LayerNorm::forward(const AutoTensor& x) {
                 }
             }
 
-            xi->propagate(dx_cpu.to(xi->data.device(), xi->data.device_id()));
+            xi->propagate(backTo(dx_cpu, xi->data));
             if (affine) {
-                gi->propagate(dgamma_cpu.to(gi->data.device(), gi->data.device_id()));
-                bi->propagate(dbeta_cpu.to(bi->data.device(), bi->data.device_id()));
+                gi->propagate(backTo(dgamma_cpu, gi->data));
+                bi->propagate(backTo(dbeta_cpu, bi->data));
             }
         });
 }
@@ -467,8 +487,8 @@ Embedding::Embedding(size_t num_embeddings, size_t embedding_dim)
 }
 
 AutoTensor Embedding::forward(const AutoTensor& indices) {
-    Tensor idx_cpu = indices.data().cpu();
-    Tensor w_cpu = m_weight.data().cpu();
+    Tensor idx_cpu = hostF64(indices.data());
+    Tensor w_cpu = hostF64(m_weight.data());
     Tensor out_cpu({idx_cpu.size(), m_embedding_dim});
     for (size_t i = 0; i < idx_cpu.size(); ++i) {
         int token = static_cast<int>(idx_cpu.flat(i));
@@ -477,20 +497,20 @@ AutoTensor Embedding::forward(const AutoTensor& indices) {
         for (size_t d = 0; d < m_embedding_dim; ++d)
             out_cpu(i, d) = w_cpu(static_cast<size_t>(token), d);
     }
-    Tensor out = out_cpu.to(m_weight.data().device(), m_weight.data().device_id());
+    Tensor out = backTo(out_cpu, m_weight.data());
     if (!m_weight.requires_grad()) return AutoTensor::from(std::move(out));
 
     auto wi = m_weight.impl();
     return AutoTensor::make_result(std::move(out), true,
         [wi, idx_cpu, emb_dim = m_embedding_dim](const Tensor& g) {
-            Tensor g_cpu = g.cpu();
+            Tensor g_cpu = hostF64(g);
             Tensor dw_cpu = Tensor::zeros(wi->data.cpu().shape());
             for (size_t i = 0; i < idx_cpu.size(); ++i) {
                 size_t token = static_cast<size_t>(idx_cpu.flat(i));
                 for (size_t d = 0; d < emb_dim; ++d)
                     dw_cpu(token, d) += g_cpu(i, d);
             }
-            wi->propagate(dw_cpu.to(wi->data.device(), wi->data.device_id()));
+            wi->propagate(backTo(dw_cpu, wi->data));
         });
 }
 
@@ -524,9 +544,9 @@ AutoTensor MultiHeadAttention::forward(const AutoTensor& x) {
     AutoTensor k = xf.matmul(m_wk);
     AutoTensor v = xf.matmul(m_wv);
 
-    Tensor q_cpu = q.data().cpu();
-    Tensor k_cpu = k.data().cpu();
-    Tensor v_cpu = v.data().cpu();
+    Tensor q_cpu = hostF64(q.data());
+    Tensor k_cpu = hostF64(k.data());
+    Tensor v_cpu = hostF64(v.data());
     Tensor ctx_cpu({N, S, m_embed_dim}, 0.0);
     Tensor attn_cpu({N, m_num_heads, S, S}, 0.0);
     const double scale = 1.0 / std::sqrt(static_cast<double>(m_head_dim));
@@ -540,7 +560,7 @@ AutoTensor MultiHeadAttention::forward(const AutoTensor& x) {
                     double dot = 0.0;
                     for (size_t d = 0; d < m_head_dim; ++d) {
                         size_t e = h * m_head_dim + d;
-                        dot += q_cpu(n * S + i, e) * k_cpu(n * S + j, e);
+                        dot += q_cpu.at_unsafe(n * S + i, e) * k_cpu.at_unsafe(n * S + j, e);
                     }
                     scores[j] = dot * scale;
                     max_score = std::max(max_score, scores[j]);
@@ -552,10 +572,10 @@ AutoTensor MultiHeadAttention::forward(const AutoTensor& x) {
                 }
                 for (size_t j = 0; j < S; ++j) {
                     double a = scores[j] / denom;
-                    attn_cpu(n, h, i, j) = a;
+                    attn_cpu.at_unsafe(n, h, i, j) = a;
                     for (size_t d = 0; d < m_head_dim; ++d) {
                         size_t e = h * m_head_dim + d;
-                        ctx_cpu(n, i, e) += a * v_cpu(n * S + j, e);
+                        ctx_cpu.at_unsafe(n, i, e) += a * v_cpu.at_unsafe(n * S + j, e);
                     }
                 }
             }
@@ -563,15 +583,14 @@ AutoTensor MultiHeadAttention::forward(const AutoTensor& x) {
     }
 
     const bool needs_grad = q.requires_grad() || k.requires_grad() || v.requires_grad();
-    Tensor ctx_data = ctx_cpu.reshape({N * S, m_embed_dim})
-        .to(x.data().device(), x.data().device_id());
+    Tensor ctx_data = backTo(ctx_cpu.reshape({N * S, m_embed_dim}), x.data());
     AutoTensor ctx = needs_grad
         ? AutoTensor::make_result(std::move(ctx_data), true,
               [qi = q.impl(), ki = k.impl(), vi = v.impl(),
                q_cpu, k_cpu, v_cpu, attn_cpu,
                N, S, E = m_embed_dim, Hh = m_num_heads,
                Dh = m_head_dim, scale](const Tensor& g) {
-                  Tensor grad_cpu = g.cpu().reshape({N, S, E});
+                  Tensor grad_cpu = hostF64(g).reshape({N, S, E});
                   Tensor dq({N * S, E}, 0.0);
                   Tensor dk({N * S, E}, 0.0);
                   Tensor dv({N * S, E}, 0.0);
@@ -584,29 +603,33 @@ AutoTensor MultiHeadAttention::forward(const AutoTensor& x) {
                               for (size_t j = 0; j < S; ++j) {
                                   for (size_t d = 0; d < Dh; ++d) {
                                       const size_t e = h * Dh + d;
-                                      da[j] += grad_cpu(n, i, e) * v_cpu(n * S + j, e);
-                                      dv(n * S + j, e) += attn_cpu(n, h, i, j) *
-                                                          grad_cpu(n, i, e);
+                                      da[j] += grad_cpu.at_unsafe(n, i, e) *
+                                               v_cpu.at_unsafe(n * S + j, e);
+                                      dv.at_unsafe(n * S + j, e) +=
+                                          attn_cpu.at_unsafe(n, h, i, j) *
+                                          grad_cpu.at_unsafe(n, i, e);
                                   }
-                                  weighted_da += da[j] * attn_cpu(n, h, i, j);
+                                  weighted_da += da[j] * attn_cpu.at_unsafe(n, h, i, j);
                               }
 
                               for (size_t j = 0; j < S; ++j) {
-                                  const double ds = attn_cpu(n, h, i, j) *
+                                  const double ds = attn_cpu.at_unsafe(n, h, i, j) *
                                       (da[j] - weighted_da);
                                   for (size_t d = 0; d < Dh; ++d) {
                                       const size_t e = h * Dh + d;
-                                      dq(n * S + i, e) += ds * k_cpu(n * S + j, e) * scale;
-                                      dk(n * S + j, e) += ds * q_cpu(n * S + i, e) * scale;
+                                      dq.at_unsafe(n * S + i, e) +=
+                                          ds * k_cpu.at_unsafe(n * S + j, e) * scale;
+                                      dk.at_unsafe(n * S + j, e) +=
+                                          ds * q_cpu.at_unsafe(n * S + i, e) * scale;
                                   }
                               }
                           }
                       }
                   }
 
-                  qi->propagate(dq.to(qi->data.device(), qi->data.device_id()));
-                  ki->propagate(dk.to(ki->data.device(), ki->data.device_id()));
-                  vi->propagate(dv.to(vi->data.device(), vi->data.device_id()));
+                  qi->propagate(backTo(dq, qi->data));
+                  ki->propagate(backTo(dk, ki->data));
+                  vi->propagate(backTo(dv, vi->data));
               })
         : AutoTensor::from(std::move(ctx_data));
     return ctx.matmul(m_wo).reshape({N, S, m_embed_dim});
@@ -621,21 +644,29 @@ Conv2d::Conv2d(size_t in_channels,
                size_t kernel_size,
                size_t stride,
                size_t padding,
-               bool use_bias)
+               bool use_bias,
+               size_t dilation,
+               size_t groups)
     : m_in_channels(in_channels),
       m_out_channels(out_channels),
       m_kernel_size(kernel_size),
       m_stride(stride),
       m_padding(padding),
+      m_dilation(dilation),
+      m_groups(groups),
       m_use_bias(use_bias)
 {
     if (in_channels == 0 || out_channels == 0 || kernel_size == 0 || stride == 0)
         throw std::invalid_argument("Conv2d: channels, kernel_size and stride must be > 0");
+    if (dilation == 0 || groups == 0 || in_channels % groups != 0 || out_channels % groups != 0)
+        throw std::invalid_argument(
+            "Conv2d: dilation must be > 0 and groups must divide both channel counts");
 
-    const double fan_in = static_cast<double>(in_channels * kernel_size * kernel_size);
+    const size_t group_in = in_channels / groups;
+    const double fan_in = static_cast<double>(group_in * kernel_size * kernel_size);
     const double limit = 1.0 / std::sqrt(fan_in);
     m_weight = AutoTensor::from(
-        Tensor::uniform({out_channels, in_channels, kernel_size, kernel_size},
+        Tensor::uniform({out_channels, group_in, kernel_size, kernel_size},
                         -limit, limit, 42),
         true);
     if (use_bias)
@@ -650,12 +681,14 @@ AutoTensor Conv2d::forward(const AutoTensor& x) {
 
     const size_t H = x.data().dim(2);
     const size_t W = x.data().dim(3);
-    const size_t K = m_kernel_size;
+    const size_t K = m_dilation * (m_kernel_size - 1) + 1;   // dilated extent
     (void)checkedPoolOutDim(H, K, m_stride, m_padding, "Conv2d::forward");
     (void)checkedPoolOutDim(W, K, m_stride, m_padding, "Conv2d::forward");
 
+    // Tensor::conv2d picks the kernel (im2col + GEMM, Winograd or depthwise).
     const Tensor* bias_ptr = m_use_bias ? &m_bias.data() : nullptr;
-    Tensor out = x.data().conv2d(m_weight.data(), bias_ptr, m_stride, m_padding);
+    Tensor out = x.data().conv2d(m_weight.data(), bias_ptr, m_stride, m_padding,
+                                 m_dilation, m_groups);
 
     const bool needs_grad = x.requires_grad() || m_weight.requires_grad() ||
                             (m_use_bias && m_bias.requires_grad());
@@ -667,13 +700,15 @@ AutoTensor Conv2d::forward(const AutoTensor& x) {
     const bool use_bias = m_use_bias;
     const size_t stride = m_stride;
     const size_t padding = m_padding;
+    const size_t dilation = m_dilation;
+    const size_t groups = m_groups;
 
     return AutoTensor::make_result(std::move(out), true,
-        [xi, wi, bi, use_bias, stride, padding](const Tensor& g) {
+        [xi, wi, bi, use_bias, stride, padding, dilation, groups](const Tensor& g) {
             Tensor dx = Tensor::conv2d_backward_input(
-                g, wi->data, xi->data.shape(), stride, padding);
+                g, wi->data, xi->data.shape(), stride, padding, dilation, groups);
             Tensor dw = g.conv2d_backward_weight(
-                xi->data, wi->data.shape(), stride, padding);
+                xi->data, wi->data.shape(), stride, padding, dilation, groups);
             xi->propagate(dx);
             wi->propagate(dw);
             if (use_bias) bi->propagate(g.conv2d_backward_bias());
@@ -694,6 +729,8 @@ size_t Conv2d::out_channels() const noexcept { return m_out_channels; }
 size_t Conv2d::kernel_size() const noexcept { return m_kernel_size; }
 size_t Conv2d::stride() const noexcept { return m_stride; }
 size_t Conv2d::padding() const noexcept { return m_padding; }
+size_t Conv2d::dilation() const noexcept { return m_dilation; }
+size_t Conv2d::groups() const noexcept { return m_groups; }
 
 BatchNorm1d::BatchNorm1d(size_t num_features, double eps, double momentum, bool affine)
     : m_num_features(num_features),
@@ -720,9 +757,9 @@ AutoTensor BatchNorm1d::forward(const AutoTensor& x) {
     if (x.data().ndim() != 2 || x.data().dim(1) != m_num_features)
         throw std::invalid_argument("BatchNorm1d::forward: input must be [N, C]");
 
-    Tensor x_cpu = x.data().cpu();
-    Tensor gamma_cpu = m_affine ? m_gamma.data().cpu() : Tensor{};
-    Tensor beta_cpu = m_affine ? m_beta.data().cpu() : Tensor{};
+    Tensor x_cpu = hostF64(x.data());
+    Tensor gamma_cpu = m_affine ? hostF64(m_gamma.data()) : Tensor{};
+    Tensor beta_cpu = m_affine ? hostF64(m_beta.data()) : Tensor{};
     const size_t N = x.data().dim(0);
     const size_t C = x.data().dim(1);
     Tensor mean = Tensor::zeros({C});
@@ -760,7 +797,7 @@ AutoTensor BatchNorm1d::forward(const AutoTensor& x) {
             out(n, c) = xhat(n, c) * gamma + beta;
         }
     }
-    out = out.to(x.data().device(), x.data().device_id());
+    out = backTo(out, x.data());
 
     const bool needs_grad = x.requires_grad() ||
         (m_affine && (m_gamma.requires_grad() || m_beta.requires_grad()));
@@ -775,7 +812,7 @@ AutoTensor BatchNorm1d::forward(const AutoTensor& x) {
 
     return AutoTensor::make_result(std::move(out), true,
         [xi, gi, be, affine, training, xhat, mean, var, gamma_cpu, eps, N, C](const Tensor& g) {
-            Tensor g_cpu = g.cpu();
+            Tensor g_cpu = hostF64(g);
             Tensor dx = Tensor::zeros(xi->data.cpu().shape());
             Tensor dgamma = affine ? Tensor::zeros(gi->data.cpu().shape()) : Tensor{};
             Tensor dbeta = affine ? Tensor::zeros(be->data.cpu().shape()) : Tensor{};
@@ -806,10 +843,10 @@ AutoTensor BatchNorm1d::forward(const AutoTensor& x) {
                 }
             }
 
-            xi->propagate(dx.to(xi->data.device(), xi->data.device_id()));
+            xi->propagate(backTo(dx, xi->data));
             if (affine) {
-                gi->propagate(dgamma.to(gi->data.device(), gi->data.device_id()));
-                be->propagate(dbeta.to(be->data.device(), be->data.device_id()));
+                gi->propagate(backTo(dgamma, gi->data));
+                be->propagate(backTo(dbeta, be->data));
             }
         });
 }
@@ -857,9 +894,9 @@ AutoTensor BatchNorm2d::forward(const AutoTensor& x) {
     if (x.data().ndim() != 4 || x.data().dim(1) != m_num_features)
         throw std::invalid_argument("BatchNorm2d::forward: input must be [N, C, H, W]");
 
-    Tensor x_cpu = x.data().cpu();
-    Tensor gamma_cpu = m_affine ? m_gamma.data().cpu() : Tensor{};
-    Tensor beta_cpu = m_affine ? m_beta.data().cpu() : Tensor{};
+    Tensor x_cpu = hostF64(x.data());
+    Tensor gamma_cpu = m_affine ? hostF64(m_gamma.data()) : Tensor{};
+    Tensor beta_cpu = m_affine ? hostF64(m_beta.data()) : Tensor{};
     const size_t N = x.data().dim(0);
     const size_t C = x.data().dim(1);
     const size_t H = x.data().dim(2);
@@ -906,7 +943,7 @@ AutoTensor BatchNorm2d::forward(const AutoTensor& x) {
                     const double beta = m_affine ? beta_cpu.flat(c) : 0.0;
                     out(n, c, h, w) = xhat(n, c, h, w) * gamma + beta;
                 }
-    out = out.to(x.data().device(), x.data().device_id());
+    out = backTo(out, x.data());
 
     const bool needs_grad = x.requires_grad() ||
         (m_affine && (m_gamma.requires_grad() || m_beta.requires_grad()));
@@ -921,7 +958,7 @@ AutoTensor BatchNorm2d::forward(const AutoTensor& x) {
 
     return AutoTensor::make_result(std::move(out), true,
         [xi, gi, be, affine, training, xhat, mean, var, gamma_cpu, eps, N, C, H, W, M](const Tensor& g) {
-            Tensor g_cpu = g.cpu();
+            Tensor g_cpu = hostF64(g);
             Tensor dx = Tensor::zeros(xi->data.cpu().shape());
             Tensor dgamma = affine ? Tensor::zeros(gi->data.cpu().shape()) : Tensor{};
             Tensor dbeta = affine ? Tensor::zeros(be->data.cpu().shape()) : Tensor{};
@@ -956,10 +993,10 @@ AutoTensor BatchNorm2d::forward(const AutoTensor& x) {
                         }
             }
 
-            xi->propagate(dx.to(xi->data.device(), xi->data.device_id()));
+            xi->propagate(backTo(dx, xi->data));
             if (affine) {
-                gi->propagate(dgamma.to(gi->data.device(), gi->data.device_id()));
-                be->propagate(dbeta.to(be->data.device(), be->data.device_id()));
+                gi->propagate(backTo(dgamma, gi->data));
+                be->propagate(backTo(dbeta, be->data));
             }
         });
 }
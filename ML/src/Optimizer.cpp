@@ -1,4 +1,5 @@
 #include "Optimizer.h"
+#include "LinearAlgebra/Expr.h"
 
 #include <cmath>
 #include <stdexcept>
@@ -8,9 +9,23 @@ namespace SharedMath::ML {
 
 namespace {
 
+using LinearAlgebra::assign;
+using LinearAlgebra::lazy;
+
+// Float64 CPU updates run as fused lazy expressions (one pass, no
+// temporaries); GPU and Float32 tensors keep the eager operators, which
+// dispatch to CUDA or single-precision kernels.  The optimizer state is
+// updated with the compound operators, which write into its own buffers.
+template<typename... Ts>
+bool fusable(const Ts&... ts) {
+    return ((ts.device() == LinearAlgebra::Device::CPU &&
+             ts.dtype() == LinearAlgebra::TensorDType::Float64) && ...);
+}
+
 Tensor zerosLikeParam(const AutoTensor* p) {
-    return Tensor::zeros(p->data().shape()).to(p->data().device(),
-                                               p->data().device_id());
+    return Tensor::zeros(p->data().shape())
+        .astype(p->data().dtype())
+        .to(p->data().device(), p->data().device_id());
 }
 
 } // namespace
@@ -51,8 +66,16 @@ void SGD::step() {
             if (m_velocity[i].device() != g.device() ||
                 m_velocity[i].device_id() != g.device_id())
                 m_velocity[i] = m_velocity[i].to(g.device(), g.device_id());
-            m_velocity[i] = m_velocity[i] * m_momentum + g;
-            p->data() -= m_velocity[i] * m_lr;
+            if (fusable(g, p->data(), m_velocity[i])) {
+                assign(m_velocity[i], lazy(m_velocity[i]) * m_momentum + lazy(g));
+                assign(p->data(), lazy(p->data()) - lazy(m_velocity[i]) * m_lr);
+            } else {
+                m_velocity[i] *= m_momentum;
+                m_velocity[i] += g;
+                p->data() -= m_velocity[i] * m_lr;
+            }
+        } else if (fusable(g, p->data())) {
+            assign(p->data(), lazy(p->data()) - lazy(g) * m_lr);
         } else {
             p->data() -= g * m_lr;
         }
@@ -86,6 +109,13 @@ void AdaGrad::step() {
         if (m_accumulator[i].device() != g.device() ||
             m_accumulator[i].device_id() != g.device_id())
             m_accumulator[i] = m_accumulator[i].to(g.device(), g.device_id());
+        if (fusable(g, p->data(), m_accumulator[i])) {
+            auto gl = lazy(g);
+            assign(m_accumulator[i], lazy(m_accumulator[i]) + gl * gl);
+            assign(p->data(), lazy(p->data()) -
+                   (gl / (lazy(m_accumulator[i]).sqrt() + m_eps)) * m_lr);
+            continue;
+        }
         m_accumulator[i] += g * g;
         p->data() -= (g / (m_accumulator[i].sqrt() + m_eps)) * m_lr;
     }
@@ -124,8 +154,16 @@ void RMSProp::step() {
         if (m_square_avg[i].device() != g.device() ||
             m_square_avg[i].device_id() != g.device_id())
             m_square_avg[i] = m_square_avg[i].to(g.device(), g.device_id());
-        m_square_avg[i] =
-            m_square_avg[i] * m_alpha + (g * g) * (1.0 - m_alpha);
+        if (fusable(g, p->data(), m_square_avg[i])) {
+            auto gl = lazy(g);
+            assign(m_square_avg[i],
+                   lazy(m_square_avg[i]) * m_alpha + (gl * gl) * (1.0 - m_alpha));
+            assign(p->data(), lazy(p->data()) -
+                   (gl / (lazy(m_square_avg[i]).sqrt() + m_eps)) * m_lr);
+            continue;
+        }
+        m_square_avg[i] *= m_alpha;
+        m_square_avg[i] += (g * g) * (1.0 - m_alpha);
         p->data() -= (g / (m_square_avg[i].sqrt() + m_eps)) * m_lr;
     }
 }
@@ -170,8 +208,19 @@ void Adam::step() {
             m_m[i] = m_m[i].to(g.device(), g.device_id());
             m_v[i] = m_v[i].to(g.device(), g.device_id());
         }
-        m_m[i] = m_m[i] * m_beta1 + g * (1.0 - m_beta1);
-        m_v[i] = m_v[i] * m_beta2 + (g * g) * (1.0 - m_beta2);
+        if (fusable(g, p->data(), m_m[i], m_v[i])) {
+            auto gl = lazy(g);
+            assign(m_m[i], lazy(m_m[i]) * m_beta1 + gl * (1.0 - m_beta1));
+            assign(m_v[i], lazy(m_v[i]) * m_beta2 + (gl * gl) * (1.0 - m_beta2));
+            auto mh = lazy(m_m[i]) / bc1;
+            auto vh = lazy(m_v[i]) / bc2;
+            assign(p->data(), lazy(p->data()) - (mh / (vh.sqrt() + m_eps)) * m_lr);
+            continue;
+        }
+        m_m[i] *= m_beta1;
+        m_m[i] += g * (1.0 - m_beta1);
+        m_v[i] *= m_beta2;
+        m_v[i] += (g * g) * (1.0 - m_beta2);
 
         Tensor mh = m_m[i] / bc1;
         Tensor vh = m_v[i] / bc2;
@@ -223,10 +272,24 @@ void AdamW::step() {
             m_v[i] = m_v[i].to(g.device(), g.device_id());
         }
         // Weight decay applied to parameter before gradient step
-        p->data() -= p->data() * m_weight_decay;
-
-        m_m[i] = m_m[i] * m_beta1 + g * (1.0 - m_beta1);
-        m_v[i] = m_v[i] * m_beta2 + (g * g) * (1.0 - m_beta2);
+        if (fusable(g, p->data()))
+            assign(p->data(), lazy(p->data()) - lazy(p->data()) * m_weight_decay);
+        else
+            p->data() -= p->data() * m_weight_decay;
+
+        if (fusable(g, p->data(), m_m[i], m_v[i])) {
+            auto gl = lazy(g);
+            assign(m_m[i], lazy(m_m[i]) * m_beta1 + gl * (1.0 - m_beta1));
+            assign(m_v[i], lazy(m_v[i]) * m_beta2 + (gl * gl) * (1.0 - m_beta2));
+            auto mh = lazy(m_m[i]) / bc1;
+            auto vh = lazy(m_v[i]) / bc2;
+            assign(p->data(), lazy(p->data()) - (mh / (vh.sqrt() + m_eps)) * m_lr);
+            continue;
+        }
+        m_m[i] *= m_beta1;
+        m_m[i] += g * (1.0 - m_beta1);
+        m_v[i] *= m_beta2;
+        m_v[i] += (g * g) * (1.0 - m_beta2);
 
         Tensor mh = m_m[i] / bc1;
         Tensor vh = m_v[i] / bc2;
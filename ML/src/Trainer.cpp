@@ -26,7 +26,7 @@ double Trainer::train_epoch(DataLoader& loader) {
         auto y = AutoTensor::from(batch.y);
         auto pred = m_model.forward(x);
         auto loss = m_loss.forward(pred, y);
-        total += loss.data().cpu().flat(0);
+        total += loss.data().cpu().sum();
         ++batches;
         loss.backward();
         m_optimizer.step();
@@ -1,5 +1,7 @@
 #include "TreeModels.h"
 
+#include "core/ThreadPool.h"
+
 #include <algorithm>
 #include <cmath>
 #include <functional>
@@ -124,7 +126,7 @@ SplitResult bestSplitRegressor(const Tensor& X, const Tensor& y,
         // Collect (value, index) pairs for this feature
         std::vector<std::pair<double, size_t>> vals;
         vals.reserve(idx.size());
-        for (size_t i : idx) vals.push_back({X(i, f), i});
+        for (size_t i : idx) vals.push_back({X.at_unsafe(i, f), i});
         std::sort(vals.begin(), vals.end());
 
         for (size_t t = 0; t + 1 < vals.size(); ++t) {
@@ -178,7 +180,7 @@ SplitResult bestSplitClassifier(const Tensor& X, const Tensor& y,
     for (size_t f = 0; f < D; ++f) {
         std::vector<std::pair<double, size_t>> vals;
         vals.reserve(idx.size());
-        for (size_t i : idx) vals.push_back({X(i, f), i});
+        for (size_t i : idx) vals.push_back({X.at_unsafe(i, f), i});
         std::sort(vals.begin(), vals.end());
 
         for (size_t t = 0; t + 1 < vals.size(); ++t) {
@@ -376,6 +378,37 @@ size_t DecisionTreeRegressor::max_depth()   const noexcept { return m_max_depth;
 size_t DecisionTreeRegressor::min_samples() const noexcept { return m_min_samples; }
 bool   DecisionTreeRegressor::fitted()      const noexcept { return m_fitted; }
 
+namespace {
+
+// Bootstrap row indices for every tree, drawn from a single generator in tree
+// order so the forest does not depend on how trees are scheduled.
+std::vector<std::vector<size_t>> drawBootstraps(size_t n_trees, size_t N,
+                                                uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<size_t> row_dist(0, N - 1);
+    std::vector<std::vector<size_t>> rows(n_trees, std::vector<size_t>(N));
+    for (auto& r : rows)
+        for (size_t& idx : r) idx = row_dist(rng);
+    return rows;
+}
+
+void gatherBootstrap(const Tensor& X, const Tensor& y,
+                     const std::vector<size_t>& rows,
+                     Tensor& X_boot, Tensor& y_boot) {
+    const size_t N = rows.size();
+    const size_t D = X.dim(1);
+    X_boot = Tensor::zeros({N, D});
+    y_boot = Tensor::zeros({N});
+    for (size_t i = 0; i < N; ++i) {
+        size_t idx = rows[i];
+        y_boot.flat(i) = y.flat(idx);
+        for (size_t d = 0; d < D; ++d)
+            X_boot.at_unsafe(i, d) = X.at_unsafe(idx, d);
+    }
+}
+
+} // namespace
+
 // ─────────────────────────────────────────────────────────────────────────────
 // RandomForestClassifier
 // ─────────────────────────────────────────────────────────────────────────────
@@ -404,28 +437,19 @@ void RandomForestClassifier::fit(const Tensor& X, const Tensor& y) {
         if (c > m_num_classes) m_num_classes = c;
     }
 
-    const size_t N = X.dim(0);
-    const size_t D = X.dim(1);
-    std::mt19937_64 rng(m_seed);
-    std::uniform_int_distribution<size_t> row_dist(0, N - 1);
+    auto bootstraps = drawBootstraps(m_n_estimators, X.dim(0), m_seed);
 
-    m_trees.clear();
-    m_trees.reserve(m_n_estimators);
-
-    for (size_t t = 0; t < m_n_estimators; ++t) {
-        // Bootstrap sample
-        Tensor X_boot = Tensor::zeros({N, D});
-        Tensor y_boot = Tensor::zeros({N});
-        for (size_t i = 0; i < N; ++i) {
-            size_t idx = row_dist(rng);
-            y_boot.flat(i) = y.flat(idx);
-            for (size_t d = 0; d < D; ++d)
-                X_boot(i, d) = X(idx, d);
+    m_trees.assign(m_n_estimators,
+                   DecisionTreeClassifier(m_max_depth, m_min_samples, m_criterion));
+
+    // Trees are independent once their bootstrap rows are fixed.
+    Core::parallel_for(0, m_n_estimators, 1, [&](size_t lo, size_t hi) {
+        Tensor X_boot, y_boot;
+        for (size_t t = lo; t < hi; ++t) {
+            gatherBootstrap(X, y, bootstraps[t], X_boot, y_boot);
+            m_trees[t].fit(X_boot, y_boot);
         }
-        DecisionTreeClassifier tree(m_max_depth, m_min_samples, m_criterion);
-        tree.fit(X_boot, y_boot);
-        m_trees.push_back(std::move(tree));
-    }
+    });
     m_fitted = true;
 }
 
@@ -433,11 +457,16 @@ Tensor RandomForestClassifier::predict(const Tensor& X) const {
     if (!m_fitted)
         throw std::runtime_error("RandomForestClassifier::predict: model not fitted");
     const size_t N = X.dim(0);
+    std::vector<Tensor> per_tree(m_trees.size());
+    Core::parallel_for(0, m_trees.size(), 1, [&](size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; ++t) per_tree[t] = m_trees[t].predict(X);
+    });
+
     Tensor result = Tensor::zeros({N});
     for (size_t i = 0; i < N; ++i) {
         std::vector<size_t> votes(m_num_classes, 0);
-        for (const auto& tree : m_trees)
-            ++votes[static_cast<size_t>(tree.predict(X).flat(i))];
+        for (const auto& pred : per_tree)
+            ++votes[static_cast<size_t>(pred.flat(i))];
         result.flat(i) = static_cast<double>(
             std::max_element(votes.begin(), votes.end()) - votes.begin());
     }
@@ -467,27 +496,17 @@ void RandomForestRegressor::fit(const Tensor& X, const Tensor& y) {
     if (y.ndim() != 1) throw std::invalid_argument("RandomForestRegressor::fit: y must be 1-D");
     if (X.dim(0) != y.dim(0)) throw std::invalid_argument("RandomForestRegressor::fit: row-count mismatch");
 
-    const size_t N = X.dim(0);
-    const size_t D = X.dim(1);
-    std::mt19937_64 rng(m_seed);
-    std::uniform_int_distribution<size_t> row_dist(0, N - 1);
+    auto bootstraps = drawBootstraps(m_n_estimators, X.dim(0), m_seed);
 
-    m_trees.clear();
-    m_trees.reserve(m_n_estimators);
-
-    for (size_t t = 0; t < m_n_estimators; ++t) {
-        Tensor X_boot = Tensor::zeros({N, D});
-        Tensor y_boot = Tensor::zeros({N});
-        for (size_t i = 0; i < N; ++i) {
-            size_t idx = row_dist(rng);
-            y_boot.flat(i) = y.flat(idx);
-            for (size_t d = 0; d < D; ++d)
-                X_boot(i, d) = X(idx, d);
+    m_trees.assign(m_n_estimators, DecisionTreeRegressor(m_max_depth, m_min_samples));
+
+    Core::parallel_for(0, m_n_estimators, 1, [&](size_t lo, size_t hi) {
+        Tensor X_boot, y_boot;
+        for (size_t t = lo; t < hi; ++t) {
+            gatherBootstrap(X, y, bootstraps[t], X_boot, y_boot);
+            m_trees[t].fit(X_boot, y_boot);
         }
-        DecisionTreeRegressor tree(m_max_depth, m_min_samples);
-        tree.fit(X_boot, y_boot);
-        m_trees.push_back(std::move(tree));
-    }
+    });
     m_fitted = true;
 }
 
@@ -495,11 +514,16 @@ Tensor RandomForestRegressor::predict(const Tensor& X) const {
     if (!m_fitted)
         throw std::runtime_error("RandomForestRegressor::predict: model not fitted");
     const size_t N = X.dim(0);
+    std::vector<Tensor> per_tree(m_trees.size());
+    Core::parallel_for(0, m_trees.size(), 1, [&](size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; ++t) per_tree[t] = m_trees[t].predict(X);
+    });
+
     Tensor result = Tensor::zeros({N});
     for (size_t i = 0; i < N; ++i) {
         double sum = 0.0;
-        for (const auto& tree : m_trees)
-            sum += tree.predict(X).flat(i);
+        for (const auto& pred : per_tree)
+            sum += pred.flat(i);
         result.flat(i) = sum / static_cast<double>(m_trees.size());
     }
     return result;
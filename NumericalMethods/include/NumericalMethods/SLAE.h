@@ -11,6 +11,7 @@
 #include <vector>
 #include <cstddef>
 #include "LinearAlgebra/AbstractMatrix.h"
+#include "LinearAlgebra/Preconditioner.h"
 #include <sharedmath_numericalmethods_export.h>
 
 #ifdef SHAREDMATH_CUDA
@@ -20,6 +21,8 @@
 namespace SharedMath::NumericalMethods {
 
 using SharedMath::LinearAlgebra::AbstractMatrix;
+using SharedMath::LinearAlgebra::Preconditioner;
+using SharedMath::LinearAlgebra::IdentityPreconditioner;
 
 struct IterResult {
     std::vector<double> x;
@@ -57,6 +60,15 @@ IterResult conjugate_gradient(const AbstractMatrix& A,
                                std::vector<double> x0 = {},
                                double tol = 1e-10, size_t max_iter = 10000);
 
+/// Preconditioned CG; M must be symmetric positive-definite
+/// (e.g. LinearAlgebra::JacobiPreconditioner, IC0Preconditioner, AMGPreconditioner)
+SHAREDMATH_NUMERICALMETHODS_EXPORT
+IterResult conjugate_gradient(const AbstractMatrix& A,
+                               const std::vector<double>& b,
+                               const Preconditioner& M,
+                               std::vector<double> x0 = {},
+                               double tol = 1e-10, size_t max_iter = 10000);
+
 /// Restarted GMRES (works for any non-singular A)
 SHAREDMATH_NUMERICALMETHODS_EXPORT
 IterResult gmres(const AbstractMatrix& A,
@@ -65,6 +77,15 @@ IterResult gmres(const AbstractMatrix& A,
                   std::vector<double> x0 = {},
                   double tol = 1e-10, size_t max_iter = 10000);
 
+/// Right-preconditioned restarted GMRES (any non-singular M, e.g. ILU0Preconditioner)
+SHAREDMATH_NUMERICALMETHODS_EXPORT
+IterResult gmres(const AbstractMatrix& A,
+                  const std::vector<double>& b,
+                  const Preconditioner& M,
+                  size_t restart = 30,
+                  std::vector<double> x0 = {},
+                  double tol = 1e-10, size_t max_iter = 10000);
+
 #ifdef SHAREDMATH_CUDA
 
 /// GPU-accelerated Jacobi (embarrassingly parallel per iteration)
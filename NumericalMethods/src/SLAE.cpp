@@ -1,7 +1,11 @@
 #include "NumericalMethods/SLAE.h"
+#include "LinearAlgebra/LinearOperator.h"
+
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace SharedMath::NumericalMethods {
 
@@ -24,18 +28,6 @@ namespace {
         return std::sqrt(sum);
     }
 
-    // Matrix-vector product
-    std::vector<double> matvec(const AbstractMatrix& A,
-                                const std::vector<double>& x)
-    {
-        size_t n = x.size();
-        std::vector<double> r(n, 0.0);
-        for (size_t i = 0; i < n; ++i)
-            for (size_t j = 0; j < n; ++j)
-                r[i] += A.get(i, j) * x[j];
-        return r;
-    }
-
     double dot(const std::vector<double>& a, const std::vector<double>& b) {
         double s = 0.0;
         for (size_t i = 0; i < a.size(); ++i) s += a[i] * b[i];
@@ -154,41 +146,54 @@ IterResult conjugate_gradient(const AbstractMatrix& A,
                                const std::vector<double>& b,
                                std::vector<double> x0,
                                double tol, size_t max_iter)
+{
+    return conjugate_gradient(A, b, IdentityPreconditioner(b.size()),
+                              std::move(x0), tol, max_iter);
+}
+
+IterResult conjugate_gradient(const AbstractMatrix& A,
+                               const std::vector<double>& b,
+                               const Preconditioner& M,
+                               std::vector<double> x0,
+                               double tol, size_t max_iter)
 {
     size_t n = b.size();
+    if (M.size() != n)
+        throw std::invalid_argument("conjugate_gradient: preconditioner size does not match A");
+    auto op = LinearAlgebra::makeOperator(A);
     std::vector<double> x = init_x0(x0, n);
 
-    // r = b - A*x
-    auto Ax = matvec(A, x);
-    std::vector<double> r(n), p(n);
-    for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax[i];
-    p = r;
+    // r = b - A*x,  z = M⁻¹ r
+    std::vector<double> r(n), z(n), p(n), Ap(n);
+    op->apply(x, Ap);
+    for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ap[i];
+    M.apply(r, z);
+    p = z;
+    double rz = dot(r, z);
     double rr = dot(r, r);
 
     for (size_t iter = 0; iter < max_iter; ++iter) {
         if (std::sqrt(rr) < tol)
             return {x, iter, std::sqrt(rr), true};
 
-        auto Ap = matvec(A, p);
+        op->apply(p, Ap);
         double pAp = dot(p, Ap);
         if (std::abs(pAp) < 1e-300)
             return {x, iter, std::sqrt(rr), true};
 
-        double alpha = rr / pAp;
-        double rr_new = 0.0;
-        std::vector<double> r_new(n);
+        double alpha = rz / pAp;
         for (size_t i = 0; i < n; ++i) {
-            x[i]    += alpha * p[i];
-            r_new[i] = r[i] - alpha * Ap[i];
-            rr_new  += r_new[i] * r_new[i];
+            x[i] += alpha * p[i];
+            r[i] -= alpha * Ap[i];
         }
+        rr = dot(r, r);
 
-        double beta = rr_new / rr;
+        M.apply(r, z);
+        double rz_new = dot(r, z);
+        double beta = rz_new / rz;
         for (size_t i = 0; i < n; ++i)
-            p[i] = r_new[i] + beta * p[i];
-
-        r  = r_new;
-        rr = rr_new;
+            p[i] = z[i] + beta * p[i];
+        rz = rz_new;
     }
     return {x, max_iter, std::sqrt(rr), false};
 }
@@ -200,15 +205,38 @@ IterResult gmres(const AbstractMatrix& A,
                   size_t restart,
                   std::vector<double> x0,
                   double tol, size_t max_iter)
+{
+    return gmres(A, b, IdentityPreconditioner(b.size()), restart,
+                 std::move(x0), tol, max_iter);
+}
+
+// Right preconditioning: the Arnoldi process runs on A·M⁻¹, so g[] tracks the
+// true residual of Ax = b and the correction is mapped back through M⁻¹.
+IterResult gmres(const AbstractMatrix& A,
+                  const std::vector<double>& b,
+                  const Preconditioner& M,
+                  size_t restart,
+                  std::vector<double> x0,
+                  double tol, size_t max_iter)
 {
     size_t n = b.size();
+    if (M.size() != n)
+        throw std::invalid_argument("gmres: preconditioner size does not match A");
+    auto op = LinearAlgebra::makeOperator(A);
     std::vector<double> x = init_x0(x0, n);
+    std::vector<double> Ax(n), w(n), z(n), r(n);
     size_t total_iter = 0;
 
+    auto true_residual = [&] {
+        op->apply(x, Ax);
+        double s = 0.0;
+        for (size_t i = 0; i < n; ++i) s += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        return std::sqrt(s);
+    };
+
     while (total_iter < max_iter) {
         // Compute initial residual
-        auto Ax = matvec(A, x);
-        std::vector<double> r(n);
+        op->apply(x, Ax);
         for (size_t i = 0; i < n; ++i) r[i] = b[i] - Ax[i];
         double beta = norm2(r);
         if (beta < tol)
@@ -228,8 +256,9 @@ IterResult gmres(const AbstractMatrix& A,
 
         size_t j = 0;
         for (; j < m; ++j) {
-            // Arnoldi: w = A * V[j]
-            std::vector<double> w = matvec(A, V[j]);
+            // Arnoldi: w = A * M⁻¹ * V[j]
+            M.apply(V[j], z);
+            op->apply(z, w);
 
             // Modified Gram-Schmidt
             for (size_t k = 0; k <= j; ++k) {
@@ -279,18 +308,21 @@ IterResult gmres(const AbstractMatrix& A,
             y[k] /= H[k][k];
         }
 
-        // Update solution x += V[0..jj-1] * y
+        // Update solution x += M⁻¹ * V[0..jj-1] * y
+        std::fill(w.begin(), w.end(), 0.0);
         for (size_t k = 0; k < jj; ++k)
             for (size_t i = 0; i < n; ++i)
-                x[i] += y[k] * V[k][i];
+                w[i] += y[k] * V[k][i];
+        M.apply(w, z);
+        for (size_t i = 0; i < n; ++i) x[i] += z[i];
 
         double res = std::abs(g[jj]);
         if (res < tol)
-            return {x, total_iter, residual_norm(A, x, b), true};
+            return {x, total_iter, true_residual(), true};
 
         if (total_iter >= max_iter) break;
     }
-    return {x, total_iter, residual_norm(A, x, b), false};
+    return {x, total_iter, true_residual(), false};
 }
 
 } // namespace SharedMath::NumericalMethods
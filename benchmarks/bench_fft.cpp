@@ -0,0 +1,126 @@
+// bench_fft — complex FFT throughput of FFTPlan on the CPU backend, in the
+// usual 5·N·log2(N) "MFLOP/s" convention, for the default (mixed-radix)
+// plan and for the same size forced through Bluestein, then the cost of
+// planning on every call against FFTPlan::cached(), and real-input
+// transforms through RealFFTPlan against a complex FFT of the real signal,
+// and executeBatch against a loop of execute() calls.
+//
+//   bench_fft [n1 n2 ...]      default sizes: 256 1024 1536 3000 4096 6000
+//                                             65536 1048576
+//
+// Set SHAREDMATH_GEMM_SIMD=scalar|avx2 to pin the butterfly kernels.
+
+#include "DSP/FFTPlan.h"
+#include "DSP/RealFFTPlan.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace SharedMath::DSP;
+
+namespace {
+
+template<typename F>
+double bestSeconds(F&& f, int reps) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+double mflops(size_t n, double seconds) {
+    return 5.0 * static_cast<double>(n) * std::log2(static_cast<double>(n)) / seconds * 1e-6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {256, 1024, 1536, 3000, 4096, 6000, 65536, 1048576};
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::printf("%9s %12s %14s %14s\n", "n", "us/fft", "MFLOP/s", "Bluestein");
+    for (size_t n : sizes) {
+        std::vector<std::complex<double>> x(n);
+        for (auto& v : x) v = {dist(gen), dist(gen)};
+
+        // Enough transforms per timing for ~10 ms of work.
+        const int inner = static_cast<int>(std::max<size_t>(1, 2000000 / (n + 1)));
+        const auto plan = FFTPlan::create(n);
+        const double t = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) plan.execute(x.data());
+        }, 5) / inner;
+
+        const auto blue = FFTPlan::create(n, {FFTDirection::Forward, FFTNorm::None,
+                                              FFTAlgorithm::Bluestein});
+        const double tb = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) blue.execute(x.data());
+        }, 3) / inner;
+
+        std::printf("%9zu %12.2f %14.1f %14.1f   %s\n", n, t * 1e6, mflops(n, t),
+                    mflops(n, tb), plan.backendName());
+    }
+
+    // What helpers such as fft() and welchPSD() used to pay per call.
+    std::printf("\n%9s %16s %16s\n", "n", "create us/call", "cached us/call");
+    for (size_t n : {size_t{64}, size_t{256}, size_t{1024}, size_t{1000}}) {
+        std::vector<std::complex<double>> x(n);
+        for (auto& v : x) v = {dist(gen), dist(gen)};
+        const int inner = static_cast<int>(std::max<size_t>(1, 1000000 / n));
+        const double tc = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) FFTPlan::create(n).execute(x.data());
+        }, 3) / inner;
+        const double tk = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) FFTPlan::cached(n).execute(x.data());
+        }, 3) / inner;
+        std::printf("%9zu %16.2f %16.2f\n", n, tc * 1e6, tk * 1e6);
+    }
+
+    std::printf("\n%9s %16s %16s\n", "n (real)", "complex us/fft", "R2C us/fft");
+    for (size_t n : {size_t{256}, size_t{1024}, size_t{6000}, size_t{65536}}) {
+        std::vector<double> r(n);
+        for (auto& v : r) v = dist(gen);
+        std::vector<std::complex<double>> c(n), bins(n / 2 + 1);
+        const int inner = static_cast<int>(std::max<size_t>(1, 2000000 / n));
+        const auto cplan = FFTPlan::create(n);
+        const auto rplan = RealFFTPlan::create(n);
+        const double tc = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) {
+                std::copy(r.begin(), r.end(), c.begin());
+                cplan.execute(c.data());
+            }
+        }, 5) / inner;
+        const double tr = bestSeconds([&] {
+            for (int i = 0; i < inner; ++i) rplan.execute(r.data(), bins.data());
+        }, 5) / inner;
+        std::printf("%9zu %16.2f %16.2f\n", n, tc * 1e6, tr * 1e6);
+    }
+
+    std::printf("\n%9s %9s %16s %16s\n", "n", "howmany", "loop us/fft", "batch us/fft");
+    for (size_t n : {size_t{8}, size_t{16}, size_t{32}, size_t{64}, size_t{128}, size_t{1024}}) {
+        const size_t howmany = std::max<size_t>(8, 262144 / n);
+        std::vector<std::complex<double>> data(n * howmany);
+        for (auto& v : data) v = {dist(gen), dist(gen)};
+        const auto plan = FFTPlan::create(n, {FFTDirection::Forward, FFTNorm::BySqrtN});
+        const double tl = bestSeconds([&] {
+            for (size_t b = 0; b < howmany; ++b) plan.execute(data.data() + b * n);
+        }, 5) / static_cast<double>(howmany);
+        const double tb = bestSeconds([&] { plan.executeBatch(data); }, 5)
+                          / static_cast<double>(howmany);
+        std::printf("%9zu %9zu %16.3f %16.3f\n", n, howmany, tl * 1e6, tb * 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+// bench_gemm — GFLOP/s of the blocked GEMM kernel against the pre-blocking
+// i-k-j loop and, when available, the system reference BLAS (dgemm_).
+//
+//   bench_gemm [n1 n2 ...]        default sizes: 512 1024 2048 4096
+//
+// Set SHAREDMATH_GEMM_SIMD=scalar|avx2|avx512 to pin the micro-kernel.
+
+#include "LinearAlgebra/Gemm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#ifdef SHAREDMATH_BENCH_HAVE_BLAS
+extern "C" void dgemm_(const char* transa, const char* transb,
+                       const int* m, const int* n, const int* k,
+                       const double* alpha, const double* a, const int* lda,
+                       const double* b, const int* ldb,
+                       const double* beta, double* c, const int* ldc);
+#endif
+
+using namespace SharedMath::LinearAlgebra;
+
+namespace {
+
+template<typename F>
+double bestSeconds(F&& f, int reps) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+void naiveIkj(size_t n, const double* A, const double* B, double* C) {
+    std::fill(C, C + n * n, 0.0);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t k = 0; k < n; ++k) {
+            const double a = A[i * n + k];
+            for (size_t j = 0; j < n; ++j) C[i * n + j] += a * B[k * n + j];
+        }
+}
+
+const char* levelName(SimdLevel l) {
+    switch (l) {
+        case SimdLevel::AVX512: return "avx512";
+        case SimdLevel::AVX2:   return "avx2";
+        default:                return "scalar";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {512, 1024, 2048, 4096};
+
+    std::printf("micro-kernel: %s\n", levelName(gemmSimdLevel()));
+    std::printf("%6s %12s %12s %12s\n", "n", "gemm GF/s", "ikj GF/s", "BLAS GF/s");
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    for (size_t n : sizes) {
+        std::vector<double> A(n * n), B(n * n), C(n * n);
+        for (double& v : A) v = dist(gen);
+        for (double& v : B) v = dist(gen);
+        const double flops = 2.0 * n * n * n;
+        const int reps = n <= 1024 ? 5 : 2;
+
+        double tg = bestSeconds([&] {
+            gemm(Transpose::No, Transpose::No, n, n, n, 1.0,
+                 A.data(), n, B.data(), n, 0.0, C.data(), n);
+        }, reps);
+
+        double tn = -1.0;
+        if (n <= 2048)
+            tn = bestSeconds([&] { naiveIkj(n, A.data(), B.data(), C.data()); }, 1);
+
+        double tb = -1.0;
+#ifdef SHAREDMATH_BENCH_HAVE_BLAS
+        tb = bestSeconds([&] {
+            const int ni = static_cast<int>(n);
+            const double one = 1.0, zero = 0.0;
+            // Row-major C = A·B  ⇔  column-major Cᵀ = Bᵀ·Aᵀ
+            dgemm_("N", "N", &ni, &ni, &ni, &one, B.data(), &ni,
+                   A.data(), &ni, &zero, C.data(), &ni);
+        }, reps);
+#endif
+        std::printf("%6zu %12.2f %12.2f %12.2f\n", n, flops / tg * 1e-9,
+                    tn > 0 ? flops / tn * 1e-9 : 0.0,
+                    tb > 0 ? flops / tb * 1e-9 : 0.0);
+    }
+    return 0;
+}
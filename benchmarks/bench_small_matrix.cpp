@@ -0,0 +1,189 @@
+// bench_small_matrix — fixed-size Matrix<R,C> kernels against the generic
+// loops they replace: unrolled 2/3/4/6 products, closed-form 4×4 inverse,
+// and structure-of-arrays point batches against per-point Vector<N> loops.
+//
+//   bench_small_matrix [points]       default: 1000000 points
+//
+// Set SHAREDMATH_GEMM_SIMD=scalar|avx2 to pin the batch kernel.
+
+#include "LinearAlgebra/Matrix.h"
+#include "LinearAlgebra/MatrixBatch.h"
+#include "core/CpuFeatures.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+namespace {
+
+template<typename F>
+double bestSeconds(F&& f, int reps) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+template<size_t R, size_t C>
+Matrix<R, C> randomMatrix(std::mt19937& gen) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix<R, C> m;
+    for (size_t i = 0; i < R; ++i)
+        for (size_t j = 0; j < C; ++j) m(i, j) = dist(gen);
+    for (size_t i = 0; i < std::min(R, C); ++i) m(i, i) += 2.0;
+    return m;
+}
+
+// The generic i-k-j loop through the checked accessor.
+template<size_t N>
+Matrix<N, N> genericMul(const Matrix<N, N>& A, const Matrix<N, N>& B) {
+    Matrix<N, N> C;
+    for (size_t i = 0; i < N; ++i)
+        for (size_t k = 0; k < N; ++k) {
+            const double a = A(i, k);
+            for (size_t j = 0; j < N; ++j) C(i, j) = C(i, j) + a * B(k, j);
+        }
+    return C;
+}
+
+// Generic Gauss–Jordan through the checked accessor.
+template<size_t N>
+Matrix<N, N> genericInverse(Matrix<N, N> A) {
+    Matrix<N, N> R;
+    for (size_t i = 0; i < N; ++i) R(i, i) = 1.0;
+    for (size_t k = 0; k < N; ++k) {
+        size_t p = k;
+        for (size_t i = k + 1; i < N; ++i)
+            if (std::abs(A(i, k)) > std::abs(A(p, k))) p = i;
+        for (size_t j = 0; j < N; ++j) {
+            std::swap(A(k, j), A(p, j));
+            std::swap(R(k, j), R(p, j));
+        }
+        const double d = 1.0 / A(k, k);
+        for (size_t j = 0; j < N; ++j) { A(k, j) *= d; R(k, j) *= d; }
+        for (size_t i = 0; i < N; ++i) {
+            if (i == k) continue;
+            const double f = A(i, k);
+            for (size_t j = 0; j < N; ++j) {
+                A(i, j) -= f * A(k, j);
+                R(i, j) -= f * R(k, j);
+            }
+        }
+    }
+    return R;
+}
+
+// Products over a small rotating working set (stays in L1); returns ns/op.
+template<size_t N, typename Mul>
+double productNs(Mul&& mul, std::mt19937& gen, size_t iters, double& sink) {
+    std::vector<Matrix<N, N>> A(64), B(64), C(64);
+    for (size_t i = 0; i < 64; ++i) { A[i] = randomMatrix<N, N>(gen); B[i] = randomMatrix<N, N>(gen); }
+    const double t = bestSeconds([&] {
+        for (size_t r = 0; r < iters; ++r) C[r & 63] = mul(A[r & 63], B[(r * 7) & 63]);
+    }, 3);
+    for (const auto& c : C) sink += c(0, 0);
+    return t / static_cast<double>(iters) * 1e9;
+}
+
+template<size_t N>
+void benchProduct(std::mt19937& gen, double& sink) {
+    const size_t iters = 2000000;
+    const double tg = productNs<N>([](const auto& A, const auto& B) { return genericMul(A, B); },
+                                   gen, iters, sink);
+    const double tf = productNs<N>([](const auto& A, const auto& B) { return A.mul(B); },
+                                   gen, iters, sink);
+    std::printf("  %zux%zu mul   %10.2f %10.2f %8.2fx\n", N, N, tg, tf, tg / tf);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    double sink = 0.0;
+
+    std::printf("per-op             generic ns  fixed ns  speedup\n");
+    benchProduct<2>(gen, sink);
+    benchProduct<3>(gen, sink);
+    benchProduct<4>(gen, sink);
+    benchProduct<6>(gen, sink);
+    {
+        const size_t iters = 1000000;
+        std::vector<Matrix<4, 4>> Ms(64);
+        for (auto& M : Ms) M = randomMatrix<4, 4>(gen);
+        const double tg = bestSeconds([&] {
+            for (size_t r = 0; r < iters; ++r) sink += genericInverse(Ms[r & 63])(0, 0);
+        }, 3) / static_cast<double>(iters) * 1e9;
+        const double tf = bestSeconds([&] {
+            for (size_t r = 0; r < iters; ++r) sink += Ms[r & 63].inverse()(0, 0);
+        }, 3) / static_cast<double>(iters) * 1e9;
+        std::printf("  4x4 inverse %10.2f %10.2f %8.2fx\n", tg, tf, tg / tf);
+    }
+
+    std::printf("\n%zu points (batch: %s)\n", n,
+                SharedMath::Core::simdLevel() == SharedMath::Core::SimdLevel::Scalar
+                    ? "scalar" : "avx2");
+    std::printf("per-point          generic ns  SoA ns    speedup\n");
+    {
+        // 3-D affine: homogeneous Vector<4> per point vs the SoA batch.
+        const Matrix<4, 4> T = randomMatrix<4, 4>(gen);
+        std::vector<Vector<4>> aos(n);
+        std::vector<double> x(n), y(n), z(n), ox(n), oy(n), oz(n);
+        for (size_t p = 0; p < n; ++p) {
+            x[p] = dist(gen); y[p] = dist(gen); z[p] = dist(gen);
+            aos[p] = Vector<4>{x[p], y[p], z[p], 1.0};
+        }
+        std::vector<Vector<4>> aosOut(n);
+        const double tg = bestSeconds([&] {
+            for (size_t p = 0; p < n; ++p) aosOut[p] = T * aos[p];
+        }, 5);
+        const double tb = bestSeconds([&] {
+            transformPointsBatch(T, {x.data(), y.data(), z.data()},
+                                 {ox.data(), oy.data(), oz.data()}, n);
+        }, 5);
+        sink += aosOut[n / 2][0] + ox[n / 2];
+        std::printf("  3-D affine  %10.2f %10.2f %8.2fx\n",
+                    tg / n * 1e9, tb / n * 1e9, tg / tb);
+    }
+    {
+        // 6-state transition x ← A·x per state vs the SoA batch.
+        const Matrix<6, 6> A = randomMatrix<6, 6>(gen);
+        std::vector<Vector<6>> aos(n);
+        std::vector<std::vector<double>> soa(6, std::vector<double>(n));
+        for (size_t p = 0; p < n; ++p)
+            for (size_t j = 0; j < 6; ++j) soa[j][p] = aos[p][j] = dist(gen);
+        std::vector<Vector<6>> aosOut(n);
+        std::vector<std::vector<double>> soaOut(6, std::vector<double>(n));
+        PointsIn<6> in;
+        PointsOut<6> out;
+        for (size_t j = 0; j < 6; ++j) { in[j] = soa[j].data(); out[j] = soaOut[j].data(); }
+
+        const double tg = bestSeconds([&] {
+            for (size_t p = 0; p < n; ++p) {
+                Vector<6> r;
+                for (size_t i = 0; i < 6; ++i)
+                    for (size_t j = 0; j < 6; ++j) r[i] += A(i, j) * aos[p][j];
+                aosOut[p] = r;
+            }
+        }, 5);
+        const double tb = bestSeconds([&] { applyBatch(A, in, out, n); }, 5);
+        sink += aosOut[n / 2][0] + soaOut[0][n / 2];
+        std::printf("  6-state A*x %10.2f %10.2f %8.2fx\n",
+                    tg / n * 1e9, tb / n * 1e9, tg / tb);
+    }
+
+    std::printf("\n(checksum %g)\n", sink);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace SharedMath::Core {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// CpuFeatures  —  runtime instruction-set detection
+///
+/// The SIMD kernels (GEMM micro-kernels, FFT butterflies, batched small
+/// matrices) are compiled with function target attributes, so the library
+/// needs no global -mavx flags; each one picks its build at runtime by
+/// asking here:
+///
+///   hostSimdLevel()   the highest level the CPU and OS support (detected
+///                     once)
+///   simdLevel()       the highest level kernels may use: hostSimdLevel(),
+///                     lowered by the SHAREDMATH_SIMD environment variable
+///                     ("scalar", "avx2", "avx512") or by setSimdLevel()
+///
+/// AVX2 stands for AVX2 + FMA.  A module's own override (e.g.
+/// SHAREDMATH_GEMM_SIMD) applies to that module only.
+/// ─────────────────────────────────────────────────────────────────────────────
+
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+SimdLevel hostSimdLevel() noexcept;
+SimdLevel simdLevel() noexcept;
+
+/// Sets simdLevel() (clamped to hostSimdLevel()) and returns the level
+/// actually selected.  Mainly useful for testing and benchmarking.
+SimdLevel setSimdLevel(SimdLevel level) noexcept;
+
+} // namespace SharedMath::Core
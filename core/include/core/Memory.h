@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace SharedMath::Core {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// Memory  —  aligned allocation, arenas and pools for numeric scratch
+///
+/// Every resource here is a std::pmr::memory_resource, so it plugs into
+/// std::pmr containers as well as into the allocator below.  All of them
+/// hand out 64-byte aligned buffers.
+///
+///   heapResource()       aligned operator new / delete (the default)
+///   Arena                bump allocator; memory comes back all at once
+///                        through release(mark) / reset()
+///   PoolResource         power-of-two size classes with free lists
+///
+/// Each thread has a current resource, heapResource() unless a scope says
+/// otherwise.  NumericAllocator<T> (and ScratchVector<T>) take the current
+/// resource when they are constructed, so code written against them runs
+/// on the heap by default and on an arena inside a scope:
+///
+///   using namespace SharedMath::Core;
+///
+///   withArena([&] {
+///       ScratchVector<double> work(n);         // bump-allocated
+///       ...                                    // nothing to free
+///   });                                        // arena rewound here
+///
+/// Arena memory must not outlive its scope: copy results into ordinary
+/// containers before the scope ends.  For that reason the value types
+/// (DynamicMatrix, DynamicVector, Tensor) stay on std::vector<double>;
+/// kernels put their own workspace in ScratchVectors instead.  Scopes nest (including the nested
+/// tasks a ThreadPool worker may run while it waits), because each one
+/// rewinds the arena only to where it started.
+/// ─────────────────────────────────────────────────────────────────────────────
+
+/// One cache line; enough for any AVX-512 load.
+inline constexpr size_t kSimdAlignment = 64;
+
+/// Heap block aligned to max(alignment, kSimdAlignment).
+void* alignedAllocate(size_t bytes, size_t alignment = kSimdAlignment);
+void  alignedDeallocate(void* p, size_t bytes, size_t alignment = kSimdAlignment) noexcept;
+
+/// The process-wide aligned heap.  Thread-safe.
+std::pmr::memory_resource* heapResource() noexcept;
+
+/// ── Arena ────────────────────────────────────────────────────────────────────
+
+/// Bump allocator over a list of heap blocks.  Allocation is a pointer
+/// increment; deallocate() is a no-op and memory is reclaimed by rewinding
+/// to a mark.  When a request does not fit, the next block is used (a new
+/// one, at least twice the previous size, if none fits); reset() folds all
+/// blocks into one big enough for the whole high-water mark, so a loop that
+/// repeats the same work settles into a single block.  Not thread-safe.
+class Arena final : public std::pmr::memory_resource {
+public:
+    struct Mark {
+        size_t block  = 0;
+        size_t offset = 0;
+    };
+
+    explicit Arena(size_t initialBytes = size_t(1) << 16);
+    ~Arena() override;
+
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Current position; release(mark()) later frees everything after it.
+    Mark mark() const noexcept { return {current_, offset_}; }
+    void release(Mark m) noexcept;
+
+    /// Free every allocation and coalesce the blocks.
+    void reset();
+
+    /// Return all blocks to the heap.  Nothing may be in use.
+    void trim() noexcept;
+
+    size_t used()     const noexcept;   // bytes handed out (padding included)
+    size_t capacity() const noexcept;   // bytes held
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t     size;
+    };
+    std::vector<Block> blocks_;
+    size_t current_ = 0, offset_ = 0;
+    size_t initial_;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void*, size_t, size_t) override {}
+    bool  do_is_equal(const std::pmr::memory_resource& o) const noexcept override {
+        return this == &o;
+    }
+};
+
+/// ── PoolResource ─────────────────────────────────────────────────────────────
+
+/// Size-class pool.  Requests up to kMaxPooled bytes are rounded up to a
+/// power of two (at least kMinClass) and served from that class's free
+/// list; deallocate() pushes the block back for reuse.  Larger requests go
+/// straight to the heap.  Cached blocks are returned by release() or the
+/// destructor; blocks still in use must be deallocated first.  Not
+/// thread-safe: deallocate on the thread that owns the pool.
+class PoolResource final : public std::pmr::memory_resource {
+public:
+    static constexpr size_t kMinClass  = 64;
+    static constexpr size_t kMaxPooled = size_t(1) << 24;
+
+    PoolResource() = default;
+    ~PoolResource() override { release(); }
+
+    PoolResource(const PoolResource&)            = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    /// Give every cached block back to the heap.
+    void release() noexcept;
+
+    /// Bytes sitting in the free lists.
+    size_t cached() const noexcept;
+
+private:
+    static constexpr size_t kClasses = 19;   // 64 B … 16 MiB
+    std::vector<void*> free_[kClasses];
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& o) const noexcept override {
+        return this == &o;
+    }
+};
+
+/// ── Per-thread resources and scopes ──────────────────────────────────────────
+
+/// The calling thread's arena and pool (created on first use).
+Arena&        threadLocalArena();
+PoolResource& threadLocalPool();
+
+/// The calling thread's current resource.
+std::pmr::memory_resource* currentResource() noexcept;
+
+/// Makes `resource` the calling thread's current resource for its lifetime.
+class ResourceScope {
+public:
+    explicit ResourceScope(std::pmr::memory_resource* resource) noexcept;
+    ~ResourceScope();
+
+    ResourceScope(const ResourceScope&)            = delete;
+    ResourceScope& operator=(const ResourceScope&) = delete;
+
+private:
+    std::pmr::memory_resource* previous_;
+};
+
+/// Runs the enclosing block on an arena (the thread's own by default): the
+/// arena becomes the current resource and is rewound to its entry mark on
+/// exit.
+class ArenaScope {
+public:
+    ArenaScope() : ArenaScope(threadLocalArena()) {}
+    explicit ArenaScope(Arena& arena) noexcept
+        : arena_(arena), mark_(arena.mark()), use_(&arena) {}
+    ~ArenaScope() { arena_.release(mark_); }
+
+    ArenaScope(const ArenaScope&)            = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    Arena& arena() noexcept { return arena_; }
+
+private:
+    Arena&        arena_;
+    Arena::Mark   mark_;
+    ResourceScope use_;
+};
+
+/// f() inside an ArenaScope on the thread's arena.  The result must not
+/// point into the arena.
+template<typename F>
+decltype(auto) withArena(F&& f) {
+    ArenaScope scope;
+    return std::forward<F>(f)();
+}
+
+/// ── Allocator ────────────────────────────────────────────────────────────────
+
+/// Standard allocator over a memory resource, 64-byte aligned.  A default
+/// constructed allocator binds to the thread's current resource at that
+/// moment, and so do container copies (as with std::pmr).
+template<typename T>
+class NumericAllocator {
+public:
+    using value_type = T;
+
+    NumericAllocator() noexcept : resource_(currentResource()) {}
+    NumericAllocator(std::pmr::memory_resource* r) noexcept : resource_(r) {}
+    template<typename U>
+    NumericAllocator(const NumericAllocator<U>& o) noexcept : resource_(o.resource()) {}
+
+    T* allocate(size_t n) {
+        if (n > size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), kAlign));
+    }
+    void deallocate(T* p, size_t n) noexcept {
+        resource_->deallocate(p, n * sizeof(T), kAlign);
+    }
+
+    NumericAllocator select_on_container_copy_construction() const noexcept {
+        return NumericAllocator();
+    }
+
+    std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    template<typename U>
+    bool operator==(const NumericAllocator<U>& o) const noexcept {
+        return resource_ == o.resource() || resource_->is_equal(*o.resource());
+    }
+    template<typename U>
+    bool operator!=(const NumericAllocator<U>& o) const noexcept { return !(*this == o); }
+
+private:
+    static constexpr size_t kAlign = std::max(alignof(T), kSimdAlignment);
+    std::pmr::memory_resource* resource_;
+};
+
+/// Scratch buffer on the current resource.
+template<typename T>
+using ScratchVector = std::vector<T, NumericAllocator<T>>;
+
+} // namespace SharedMath::Core
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SharedMath::Core {
+
+/// ─────────────────────────────────────────────────────────────────────────────
+/// ThreadPool  —  shared CPU execution backend
+///
+/// A fixed set of worker threads, each owning a task deque.  A worker pops
+/// its own newest task first and, when its deque is empty, steals the oldest
+/// task from another worker.  The thread that starts a parallel loop always
+/// takes part in it, so parallel_for may be nested (e.g. a parallel GEMM
+/// inside a parallel tree fit) without deadlocking.
+///
+/// The process-wide pool is created on first use.  Its size is, in order of
+/// precedence:
+///
+///   1. the last value passed to ThreadPool::setNumThreads(),
+///   2. the SHAREDMATH_NUM_THREADS environment variable,
+///   3. std::thread::hardware_concurrency().
+///
+/// A size of 1 runs everything on the calling thread.
+///
+/// Usage:
+///
+///   using namespace SharedMath::Core;
+///
+///   parallel_for(0, n, 4096, [&](size_t lo, size_t hi) {
+///       for (size_t i = lo; i < hi; ++i) y[i] = f(x[i]);
+///   });
+///
+///   double s = parallel_reduce(0, n, 4096, 0.0,
+///       [&](size_t lo, size_t hi) { double a = 0; for (...) a += x[i]; return a; },
+///       std::plus<>());
+///
+/// ─────────────────────────────────────────────────────────────────────────────
+class ThreadPool {
+public:
+    /// ── Global pool ──────────────────────────────────────────────────────────
+
+    /// The shared pool used by parallel_for / parallel_reduce.
+    static ThreadPool& instance();
+
+    /// Resize the shared pool (0 restores the default size).  The old
+    /// workers are joined after finishing their queued tasks, so this must
+    /// not be called from inside a parallel region.
+    static void setNumThreads(size_t n);
+
+    /// Number of threads (workers + caller) the shared pool runs with.
+    static size_t numThreads();
+
+    /// Size picked when no explicit size was set: SHAREDMATH_NUM_THREADS or
+    /// the hardware concurrency, never less than 1.
+    static size_t defaultNumThreads();
+
+    /// ── Construction ─────────────────────────────────────────────────────────
+
+    /// Creates a pool running `threads` threads in total: the calling thread
+    /// plus `threads - 1` workers.
+    explicit ThreadPool(size_t threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Total concurrency (workers + calling thread).
+    size_t size() const noexcept { return workers_.size() + 1; }
+
+    /// True when the calling thread is one of this pool's workers.
+    bool isWorkerThread() const noexcept;
+
+    /// ── Task submission ──────────────────────────────────────────────────────
+
+    /// Run a callable asynchronously on a worker.  With no workers the task
+    /// runs immediately on the calling thread.
+    template<typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+
+    /// Invoke chunk(c) for every c in [0, chunks), spreading the chunks over
+    /// the pool.  Blocks until all chunks have run; the first exception
+    /// thrown by a chunk is rethrown here (remaining chunks are skipped).
+    void run(size_t chunks, const std::function<void(size_t)>& chunk);
+
+private:
+    struct Worker;
+    struct Job;
+    struct State;
+
+    void enqueue(std::function<void()> task);
+    bool tryRunOne(size_t self);
+    void workerLoop(size_t self);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::unique_ptr<State>               state_;
+};
+
+// ─── Template implementation ──────────────────────────────────────────────────
+
+template<typename F>
+auto ThreadPool::submit(F&& task)
+    -> std::future<std::invoke_result_t<std::decay_t<F>>>
+{
+    using R = std::invoke_result_t<std::decay_t<F>>;
+    auto pt  = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+    auto fut = pt->get_future();
+    if (workers_.empty()) {
+        (*pt)();
+        return fut;
+    }
+    enqueue([pt]() { (*pt)(); });
+    return fut;
+}
+
+/// Apply body(lo, hi) to consecutive sub-ranges of [begin, end) in parallel.
+/// Sub-ranges hold at least `grain` indices; ranges no larger than one grain
+/// run inline on the calling thread.
+template<typename F>
+void parallel_for(size_t begin, size_t end, size_t grain, F&& body) {
+    if (end <= begin) return;
+    const size_t n = end - begin;
+    grain = std::max<size_t>(grain, 1);
+
+    ThreadPool& pool = ThreadPool::instance();
+    if (n <= grain || pool.size() == 1) {
+        body(begin, end);
+        return;
+    }
+
+    // A few chunks per thread lets idle workers even out uneven chunks.
+    size_t chunk  = std::max(grain, (n + 4 * pool.size() - 1) / (4 * pool.size()));
+    size_t chunks = (n + chunk - 1) / chunk;
+    pool.run(chunks, [&](size_t c) {
+        size_t lo = begin + c * chunk;
+        body(lo, std::min(end, lo + chunk));
+    });
+}
+
+/// Apply body(lo, hi) to sub-ranges of [0, n), n = prefix.size() − 1, cut so
+/// that every range carries about the same work, where item i costs
+/// prefix[i+1] − prefix[i] plus one (a CSR row_ptr is the typical prefix).
+/// Use this instead of parallel_for when item costs are skewed, e.g. sparse
+/// rows of very different lengths.  Ranges carry at least `grain` units.
+template<typename F>
+void parallel_for_balanced(const std::vector<size_t>& prefix, size_t grain, F&& body) {
+    if (prefix.size() < 2) return;
+    const size_t n     = prefix.size() - 1;
+    const size_t total = prefix[n] - prefix[0] + n;   // +1 per item: empty rows still cost
+    grain = std::max<size_t>(grain, 1);
+
+    ThreadPool& pool = ThreadPool::instance();
+    if (total <= grain || pool.size() == 1) {
+        body(size_t{0}, n);
+        return;
+    }
+
+    const size_t chunks = std::min(4 * pool.size(), total / grain);
+    std::vector<size_t> bounds(chunks + 1, n);
+    bounds[0] = 0;
+    for (size_t c = 1; c < chunks; ++c) {
+        // first i whose cumulative cost reaches c/chunks of the total
+        const size_t target = total / chunks * c;
+        size_t lo = bounds[c - 1], hi = n;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (prefix[mid] - prefix[0] + mid < target) lo = mid + 1;
+            else                                        hi = mid;
+        }
+        bounds[c] = lo;
+    }
+    pool.run(chunks, [&](size_t c) {
+        if (bounds[c] < bounds[c + 1]) body(bounds[c], bounds[c + 1]);
+    });
+}
+
+/// Reduce [begin, end) in parallel: map(lo, hi) produces a partial result for
+/// each sub-range of `grain` indices and the partials are folded left to
+/// right with reduce(acc, partial), starting from `identity`.
+///
+/// The sub-ranges depend only on `grain`, never on the pool size, so the
+/// result is bit-for-bit identical for any number of threads.
+template<typename T, typename Map, typename Reduce>
+T parallel_reduce(size_t begin, size_t end, size_t grain, T identity,
+                  Map&& map, Reduce&& reduce) {
+    if (end <= begin) return identity;
+    grain = std::max<size_t>(grain, 1);
+    const size_t chunks = (end - begin + grain - 1) / grain;
+
+    std::vector<T> partial(chunks, identity);
+    auto body = [&](size_t c) {
+        size_t lo = begin + c * grain;
+        partial[c] = map(lo, std::min(end, lo + grain));
+    };
+
+    ThreadPool& pool = ThreadPool::instance();
+    if (chunks == 1 || pool.size() == 1)
+        for (size_t c = 0; c < chunks; ++c) body(c);
+    else
+        pool.run(chunks, body);
+
+    T acc = std::move(identity);
+    for (T& p : partial) acc = reduce(std::move(acc), std::move(p));
+    return acc;
+}
+
+} // namespace SharedMath::Core
@@ -0,0 +1,86 @@
+#include "core/CpuFeatures.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SM_CPU_X86 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define SM_CPU_X86 1
+#  include <immintrin.h>
+#  include <intrin.h>
+#endif
+
+namespace SharedMath::Core {
+
+namespace {
+
+SimdLevel detectSimdLevel() noexcept {
+#if defined(SM_CPU_X86) && defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 0);
+    const int maxLeaf = r[0];
+    __cpuid(r, 1);
+    const bool osxsave = (r[2] & (1 << 27)) != 0;
+    const bool avx     = (r[2] & (1 << 28)) != 0;
+    const bool fma     = (r[2] & (1 << 12)) != 0;
+    if (!osxsave || !avx || maxLeaf < 7) return SimdLevel::Scalar;
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6) return SimdLevel::Scalar;   // XMM + YMM state
+    __cpuidex(r, 7, 0);
+    const bool avx2    = (r[1] & (1 << 5))  != 0;
+    const bool avx512f = (r[1] & (1 << 16)) != 0;
+    if (avx512f && (xcr0 & 0xE6) == 0xE6) return SimdLevel::AVX512;
+    if (avx2 && fma) return SimdLevel::AVX2;
+    return SimdLevel::Scalar;
+#elif defined(SM_CPU_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SimdLevel::AVX2;
+    return SimdLevel::Scalar;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel clamp(SimdLevel level) noexcept {
+    return static_cast<int>(level) > static_cast<int>(hostSimdLevel())
+        ? hostSimdLevel() : level;
+}
+
+SimdLevel initialSimdLevel() noexcept {
+    SimdLevel level = hostSimdLevel();
+    if (const char* env = std::getenv("SHAREDMATH_SIMD")) {
+        const std::string name(env);
+        if      (name == "scalar") level = SimdLevel::Scalar;
+        else if (name == "avx2")   level = SimdLevel::AVX2;
+        else if (name == "avx512") level = SimdLevel::AVX512;
+    }
+    return clamp(level);
+}
+
+std::atomic<SimdLevel>& activeSimdLevel() noexcept {
+    static std::atomic<SimdLevel> level{initialSimdLevel()};
+    return level;
+}
+
+} // namespace
+
+SimdLevel hostSimdLevel() noexcept {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+SimdLevel simdLevel() noexcept {
+    return activeSimdLevel().load(std::memory_order_relaxed);
+}
+
+SimdLevel setSimdLevel(SimdLevel level) noexcept {
+    level = clamp(level);
+    activeSimdLevel().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+} // namespace SharedMath::Core
@@ -0,0 +1,168 @@
+#include "core/Memory.h"
+
+#include <bit>
+#include <cstdint>
+
+namespace SharedMath::Core {
+
+// ── Aligned heap ──────────────────────────────────────────────────────────────
+
+void* alignedAllocate(size_t bytes, size_t alignment) {
+    return ::operator new(bytes, std::align_val_t{std::max(alignment, kSimdAlignment)});
+}
+
+void alignedDeallocate(void* p, size_t bytes, size_t alignment) noexcept {
+    ::operator delete(p, bytes, std::align_val_t{std::max(alignment, kSimdAlignment)});
+}
+
+namespace {
+
+class HeapResource final : public std::pmr::memory_resource {
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return alignedAllocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        alignedDeallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override {
+        return dynamic_cast<const HeapResource*>(&o) != nullptr;
+    }
+};
+
+thread_local std::pmr::memory_resource* tlsCurrent = nullptr;
+
+} // namespace
+
+std::pmr::memory_resource* heapResource() noexcept {
+    static HeapResource heap;
+    return &heap;
+}
+
+// ── Arena ─────────────────────────────────────────────────────────────────────
+
+Arena::Arena(size_t initialBytes) : initial_(std::max(initialBytes, kSimdAlignment)) {}
+
+Arena::~Arena() { trim(); }
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    alignment = std::max(alignment, kSimdAlignment);
+    bytes = std::max<size_t>(bytes, 1);
+    for (; current_ < blocks_.size(); ++current_, offset_ = 0) {
+        const Block& b = blocks_[current_];
+        const auto base = reinterpret_cast<std::uintptr_t>(b.data);
+        const size_t at = ((base + offset_ + alignment - 1) & ~(alignment - 1)) - base;
+        if (at <= b.size && bytes <= b.size - at) {
+            offset_ = at + bytes;
+            return b.data + at;
+        }
+    }
+    // Blocks are 64-byte aligned; the slack covers any larger alignment.
+    const size_t last = blocks_.empty() ? initial_ / 2 : blocks_.back().size;
+    const size_t size = std::max(2 * last, bytes + alignment);
+    blocks_.push_back({static_cast<std::byte*>(alignedAllocate(size)), size});
+    current_ = blocks_.size() - 1;
+    offset_  = 0;
+    return do_allocate(bytes, alignment);
+}
+
+void Arena::release(Mark m) noexcept {
+    if (m.block < current_ || (m.block == current_ && m.offset < offset_)) {
+        current_ = m.block;
+        offset_  = m.offset;
+    }
+}
+
+void Arena::reset() {
+    if (blocks_.size() > 1) {
+        const size_t total = capacity();
+        trim();
+        blocks_.push_back({static_cast<std::byte*>(alignedAllocate(total)), total});
+    }
+    current_ = 0;
+    offset_  = 0;
+}
+
+void Arena::trim() noexcept {
+    for (const Block& b : blocks_) alignedDeallocate(b.data, b.size);
+    blocks_.clear();
+    current_ = 0;
+    offset_  = 0;
+}
+
+size_t Arena::used() const noexcept {
+    size_t n = offset_;
+    for (size_t b = 0; b < current_ && b < blocks_.size(); ++b) n += blocks_[b].size;
+    return n;
+}
+
+size_t Arena::capacity() const noexcept {
+    size_t n = 0;
+    for (const Block& b : blocks_) n += b.size;
+    return n;
+}
+
+// ── PoolResource ──────────────────────────────────────────────────────────────
+
+namespace {
+
+size_t sizeClass(size_t bytes) {
+    const size_t rounded = std::bit_ceil(std::max(bytes, PoolResource::kMinClass));
+    return size_t(std::countr_zero(rounded) - std::countr_zero(PoolResource::kMinClass));
+}
+
+} // namespace
+
+void* PoolResource::do_allocate(size_t bytes, size_t alignment) {
+    if (bytes > kMaxPooled || alignment > kMinClass) return alignedAllocate(bytes, alignment);
+    std::vector<void*>& list = free_[sizeClass(bytes)];
+    if (!list.empty()) {
+        void* p = list.back();
+        list.pop_back();
+        return p;
+    }
+    return alignedAllocate(kMinClass << sizeClass(bytes));
+}
+
+void PoolResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    if (bytes > kMaxPooled || alignment > kMinClass) {
+        alignedDeallocate(p, bytes, alignment);
+        return;
+    }
+    free_[sizeClass(bytes)].push_back(p);
+}
+
+void PoolResource::release() noexcept {
+    for (size_t c = 0; c < kClasses; ++c) {
+        for (void* p : free_[c]) alignedDeallocate(p, kMinClass << c);
+        free_[c].clear();
+    }
+}
+
+size_t PoolResource::cached() const noexcept {
+    size_t n = 0;
+    for (size_t c = 0; c < kClasses; ++c) n += free_[c].size() * (kMinClass << c);
+    return n;
+}
+
+// ── Per-thread state ──────────────────────────────────────────────────────────
+
+Arena& threadLocalArena() {
+    thread_local Arena arena;
+    return arena;
+}
+
+PoolResource& threadLocalPool() {
+    thread_local PoolResource pool;
+    return pool;
+}
+
+std::pmr::memory_resource* currentResource() noexcept {
+    return tlsCurrent ? tlsCurrent : heapResource();
+}
+
+ResourceScope::ResourceScope(std::pmr::memory_resource* resource) noexcept
+    : previous_(tlsCurrent) { tlsCurrent = resource; }
+
+ResourceScope::~ResourceScope() { tlsCurrent = previous_; }
+
+} // namespace SharedMath::Core
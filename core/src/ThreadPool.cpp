@@ -0,0 +1,253 @@
+#include "core/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace SharedMath::Core {
+
+namespace {
+
+// Bounded condition wait: the predicate is re-checked at least every 10 ms,
+// so a lost notification can delay a waiter but never hang it.
+template<typename Pred>
+void waitUntil(std::condition_variable& cv, std::unique_lock<std::mutex>& lk,
+               Pred pred) {
+    while (!pred()) cv.wait_for(lk, std::chrono::milliseconds(10));
+}
+
+} // namespace
+
+// ── Internal state ────────────────────────────────────────────────────────────
+
+struct ThreadPool::Worker {
+    std::thread                       thread;
+    std::mutex                        mutex;
+    std::deque<std::function<void()>> tasks;   // owner: back, thieves: front
+};
+
+struct ThreadPool::State {
+    std::mutex              sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t>     queued{0};         // tasks sitting in any deque
+    std::atomic<size_t>     nextTarget{0};     // round-robin for outside callers
+    bool                    stop = false;      // guarded by sleepMutex
+};
+
+// One parallel loop.  Helper tasks and the calling thread all pull chunk
+// indices from `next`; the caller blocks until `done` reaches `total`.
+// A helper only dereferences `fn` after claiming a valid chunk, and the caller
+// cannot return before that chunk is counted, so `fn` may live on the
+// caller's stack.
+struct ThreadPool::Job {
+    const std::function<void(size_t)>* fn = nullptr;
+    size_t                  total = 0;
+    std::atomic<size_t>     next{0};
+    std::atomic<size_t>     done{0};
+    std::atomic<bool>       failed{false};
+    std::exception_ptr      error;
+    std::mutex              mutex;
+    std::condition_variable finished;
+
+    void work() {
+        for (;;) {
+            size_t c = next.fetch_add(1, std::memory_order_relaxed);
+            if (c >= total) return;
+            if (!failed.load(std::memory_order_relaxed)) {
+                try {
+                    (*fn)(c);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lk(mutex);
+                    if (!error) error = std::current_exception();
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == total) {
+                std::lock_guard<std::mutex> lk(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lk(mutex);
+        waitUntil(finished, lk, [this] {
+            return done.load(std::memory_order_acquire) == total;
+        });
+    }
+};
+
+namespace {
+
+thread_local const ThreadPool* tlsPool  = nullptr;
+thread_local size_t            tlsIndex = 0;
+
+std::mutex& globalMutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::unique_ptr<ThreadPool>& globalPool() {
+    static std::unique_ptr<ThreadPool> pool;
+    return pool;
+}
+
+size_t& requestedThreads() {
+    static size_t n = 0;   // 0 = use defaultNumThreads()
+    return n;
+}
+
+} // namespace
+
+// ── Global pool ───────────────────────────────────────────────────────────────
+
+size_t ThreadPool::defaultNumThreads() {
+    if (const char* env = std::getenv("SHAREDMATH_NUM_THREADS")) {
+        try {
+            long v = std::stol(env);
+            if (v > 0) return static_cast<size_t>(v);
+        } catch (const std::exception&) {
+            // malformed value — fall back to the hardware default
+        }
+    }
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+ThreadPool& ThreadPool::instance() {
+    std::lock_guard<std::mutex> lk(globalMutex());
+    auto& pool = globalPool();
+    if (!pool) {
+        size_t n = requestedThreads();
+        pool = std::make_unique<ThreadPool>(n > 0 ? n : defaultNumThreads());
+    }
+    return *pool;
+}
+
+void ThreadPool::setNumThreads(size_t n) {
+    std::unique_ptr<ThreadPool> old;
+    {
+        std::lock_guard<std::mutex> lk(globalMutex());
+        requestedThreads() = n;
+        old = std::move(globalPool());   // recreated lazily with the new size
+    }
+    // `old` joins its workers here, outside the lock.
+}
+
+size_t ThreadPool::numThreads() {
+    return instance().size();
+}
+
+// ── Construction / destruction ────────────────────────────────────────────────
+
+ThreadPool::ThreadPool(size_t threads)
+    : state_(std::make_unique<State>())
+{
+    const size_t workers = threads > 1 ? threads - 1 : 0;
+    workers_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i)
+        workers_.push_back(std::make_unique<Worker>());
+    // Start threads only once every deque exists: workers steal from each other.
+    for (size_t i = 0; i < workers; ++i)
+        workers_[i]->thread = std::thread([this, i] { workerLoop(i); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(state_->sleepMutex);
+        state_->stop = true;
+    }
+    state_->wake.notify_all();
+    for (auto& w : workers_)
+        if (w->thread.joinable()) w->thread.join();
+}
+
+bool ThreadPool::isWorkerThread() const noexcept {
+    return tlsPool == this;
+}
+
+// ── Scheduling ────────────────────────────────────────────────────────────────
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    // Workers push onto their own deque (hot in cache, popped LIFO); outside
+    // callers spread tasks round-robin.
+    const size_t target = isWorkerThread()
+        ? tlsIndex
+        : state_->nextTarget.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+        std::lock_guard<std::mutex> lk(workers_[target]->mutex);
+        workers_[target]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lk(state_->sleepMutex);
+        state_->queued.fetch_add(1, std::memory_order_relaxed);
+    }
+    state_->wake.notify_one();
+}
+
+bool ThreadPool::tryRunOne(size_t self) {
+    std::function<void()> task;
+    {
+        Worker& own = *workers_[self];
+        std::lock_guard<std::mutex> lk(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (size_t k = 1; !task && k < workers_.size(); ++k) {
+        Worker& victim = *workers_[(self + k) % workers_.size()];
+        std::lock_guard<std::mutex> lk(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task) return false;
+    state_->queued.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t self) {
+    tlsPool  = this;
+    tlsIndex = self;
+    for (;;) {
+        if (tryRunOne(self)) continue;
+        std::unique_lock<std::mutex> lk(state_->sleepMutex);
+        waitUntil(state_->wake, lk, [this] {
+            return state_->stop || state_->queued.load(std::memory_order_relaxed) > 0;
+        });
+        if (state_->stop && state_->queued.load(std::memory_order_relaxed) == 0)
+            return;
+    }
+}
+
+void ThreadPool::run(size_t chunks, const std::function<void(size_t)>& chunk) {
+    if (chunks == 0) return;
+    if (workers_.empty() || chunks == 1) {
+        for (size_t c = 0; c < chunks; ++c) chunk(c);
+        return;
+    }
+
+    auto job   = std::make_shared<Job>();
+    job->fn    = &chunk;
+    job->total = chunks;
+
+    const size_t helpers = std::min(workers_.size(), chunks - 1);
+    for (size_t h = 0; h < helpers; ++h)
+        enqueue([job] { job->work(); });
+
+    job->work();   // the caller takes chunks too
+    job->wait();
+
+    if (job->error) std::rethrow_exception(job->error);
+}
+
+} // namespace SharedMath::Core
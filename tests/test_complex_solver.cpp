@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/ComplexSolver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+ComplexMatrix randomComplex(size_t m, size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    ComplexMatrix A(m, n);
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j) A(i, j) = Complex(dist(gen), dist(gen));
+    return A;
+}
+
+ComplexVector randomVector(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    ComplexVector v(n);
+    for (size_t i = 0; i < n; ++i) v[i] = Complex(dist(gen), dist(gen));
+    return v;
+}
+
+double maxAbsDiff(const ComplexVector& a, const ComplexVector& b) {
+    double d = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) d = std::max(d, std::abs(a[i] - b[i]));
+    return d;
+}
+
+// Admittance-like matrix of a k×k resistor / capacitor grid:
+// Y(ω) = G + jωC with G the grid Laplacian plus a leak to ground and C
+// a diagonal plus a few off-diagonal coupling capacitors.
+struct GridCircuit {
+    SparseMatrix G, C;
+};
+
+GridCircuit gridCircuit(size_t k) {
+    const size_t n = k * k;
+    std::vector<size_t> gi, gj, ci, cj;
+    std::vector<double> gv, cv;
+    auto stamp = [](std::vector<size_t>& ri, std::vector<size_t>& rj, std::vector<double>& v,
+                    size_t a, size_t b, double g) {
+        ri.insert(ri.end(), {a, b, a, b});
+        rj.insert(rj.end(), {a, b, b, a});
+        v.insert(v.end(), {g, g, -g, -g});
+    };
+    for (size_t r = 0; r < k; ++r)
+        for (size_t c = 0; c < k; ++c) {
+            const size_t u = r * k + c;
+            if (c + 1 < k) stamp(gi, gj, gv, u, u + 1, 1.0 + 0.1 * (u % 7));
+            if (r + 1 < k) stamp(gi, gj, gv, u, u + k, 2.0 - 0.1 * (u % 5));
+            gi.push_back(u); gj.push_back(u); gv.push_back(0.01);
+            ci.push_back(u); cj.push_back(u); cv.push_back(1e-3 * (1 + u % 3));
+            if (r + 1 < k && c + 1 < k) stamp(ci, cj, cv, u, u + k + 1, 2e-4);
+        }
+    return {SparseMatrix::from_triplets(n, n, gi, gj, gv),
+            SparseMatrix::from_triplets(n, n, ci, cj, cv)};
+}
+
+// Y(ω) on the union pattern of G and C, so every frequency has the same pattern.
+ComplexSparseMatrix admittance(const GridCircuit& ckt, double omega) {
+    return ComplexSparseMatrix::from_parts(ckt.G, ckt.C * omega);
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Dense complex LU
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(ComplexLU, SolvesAcrossSeveralPanels) {
+    const size_t n = 157;                      // two full panels plus a ragged one
+    ComplexMatrix A = randomComplex(n, n, 1);
+    ComplexVector x = randomVector(n, 2);
+    ComplexVector b = matvec(A, x);
+
+    ComplexLU lu(A);
+    EXPECT_LT(maxAbsDiff(lu.solve(b), x), 1e-10);
+    EXPECT_LT(maxAbsDiff(solve(A, b), x), 1e-10);
+
+    ComplexMatrix Ai = lu.inverse();
+    ComplexMatrix I = A * Ai;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+            EXPECT_NEAR(std::abs(I(i, j) - (i == j ? Complex(1.0) : Complex(0.0))), 0.0, 1e-10);
+}
+
+TEST(ComplexLU, DeterminantAndPivoting) {
+    // Zero leading pivot forces a row swap.
+    ComplexMatrix A(3, 3, std::vector<Complex>{
+        {0, 0}, {2, 1}, {1, 0},
+        {1, 0}, {1, -1}, {0, 2},
+        {2, 1}, {0, 0}, {3, 0}});
+    // Cofactor expansion along the first row
+    const Complex det = A(0, 0) * (A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1))
+                      - A(0, 1) * (A(1, 0) * A(2, 2) - A(1, 2) * A(2, 0))
+                      + A(0, 2) * (A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0));
+    EXPECT_NEAR(std::abs(ComplexLU(A).determinant() - det), 0.0, 1e-12);
+
+    ComplexMatrix S(4, 4, Complex(1.0, 1.0));   // rank one
+    EXPECT_THROW(ComplexLU{S}, std::runtime_error);
+    EXPECT_THROW(ComplexLU(ComplexMatrix(3, 4)), std::invalid_argument);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Complex CSR
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(ComplexSparseMatrix, TripletsPartsAndMatVec) {
+    auto M = ComplexSparseMatrix::from_triplets(3, 3,
+        {0, 2, 0, 1, 2}, {1, 0, 1, 1, 2},
+        {{1, 1}, {2, 0}, {0.5, 0}, {0, -3}, {4, 4}});
+    EXPECT_EQ(M.nnz(), 4u);                                  // (0,1) summed
+    EXPECT_EQ(M.get(0, 1), Complex(1.5, 1.0));
+    EXPECT_EQ(M.get(1, 0), Complex(0.0, 0.0));
+
+    ComplexVector x = randomVector(3, 3);
+    EXPECT_LT(maxAbsDiff(M * x, matvec(M.to_dense(), x)), 1e-14);
+
+    const auto ckt = gridCircuit(6);
+    auto Y = ComplexSparseMatrix::from_parts(ckt.G, ckt.C);
+    for (size_t i = 0; i < 36; ++i)
+        for (size_t j = 0; j < 36; ++j)
+            EXPECT_EQ(Y.get(i, j), Complex(ckt.G.get(i, j), ckt.C.get(i, j)));
+    EXPECT_TRUE(Y.same_pattern(admittance(ckt, 1e4)));
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// AMD ordering
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseOrdering, AMDIsAPermutationAndReducesFill) {
+    auto ckt = gridCircuit(30);
+    std::vector<size_t> perm = amdOrdering(ckt.G);
+    ASSERT_EQ(perm.size(), 900u);
+    std::vector<size_t> sorted = perm;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) ASSERT_EQ(sorted[i], i);
+
+    auto Y = admittance(ckt, 1e3);
+    SparseComplexLU natural(Y, SparseOrdering::Natural);
+    SparseComplexLU amd(Y, SparseOrdering::AMD);
+    EXPECT_LT(amd.nnz_L() + amd.nnz_U(), (natural.nnz_L() + natural.nnz_U()) * 2 / 3);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Sparse complex LU
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseComplexLU, MatchesDenseSolve) {
+    auto ckt = gridCircuit(12);
+    auto Y = admittance(ckt, 2.0e3);
+    ComplexVector x = randomVector(Y.rows(), 4);
+    ComplexVector b = Y * x;
+
+    SparseComplexLU lu(Y);
+    EXPECT_LT(maxAbsDiff(lu.solve(b), x), 1e-9);
+    EXPECT_LT(maxAbsDiff(ComplexLU(Y.to_dense()).solve(b), x), 1e-9);
+    EXPECT_LT(maxAbsDiff(solve(Y, b), x), 1e-9);
+
+    ComplexMatrix B(Y.rows(), 3);
+    for (size_t i = 0; i < Y.rows(); ++i)
+        for (size_t c = 0; c < 3; ++c) B(i, c) = b[i] * double(c + 1);
+    ComplexMatrix X = lu.solve(B);
+    for (size_t i = 0; i < Y.rows(); ++i)
+        EXPECT_NEAR(std::abs(X(i, 2) - 3.0 * x[i]), 0.0, 1e-9);
+}
+
+TEST(SparseComplexLU, PivotsOffTheDiagonal) {
+    // Structurally nonsymmetric, zero diagonal: only row exchanges work.
+    auto A = ComplexSparseMatrix::from_triplets(4, 4,
+        {0, 1, 2, 3, 0, 3}, {1, 2, 3, 0, 3, 2},
+        {{1, 1}, {2, 0}, {0, 3}, {4, -1}, {0.5, 0}, {1, 0}});
+    ComplexVector x = randomVector(4, 5);
+    SparseComplexLU lu(A);
+    EXPECT_LT(maxAbsDiff(lu.solve(A * x), x), 1e-12);
+
+    auto S = ComplexSparseMatrix::from_triplets(3, 3, {0, 1, 2}, {0, 0, 2},
+                                                {{1, 0}, {1, 0}, {1, 0}});
+    EXPECT_THROW(SparseComplexLU{S}, std::runtime_error);
+}
+
+TEST(SparseComplexLU, FrequencySweepReusesTheAnalysis) {
+    auto ckt = gridCircuit(15);
+    SparseComplexLU lu(admittance(ckt, 1.0));
+    const size_t nL = lu.nnz_L(), nU = lu.nnz_U();
+
+    ComplexVector I(ckt.G.rows());
+    I[0] = Complex(1.0, 0.0);                // inject at one corner
+    for (int k = 0; k <= 40; ++k) {
+        const double omega = std::pow(10.0, 1.0 + 0.1 * k);
+        auto Y = admittance(ckt, omega);
+        lu.refactor(Y);
+        ComplexVector V = lu.solve(I);
+        ComplexVector r = Y * V - I;
+        EXPECT_LT(r.norm(), 1e-10) << "omega=" << omega;
+    }
+    EXPECT_EQ(lu.nnz_L(), nL);
+    EXPECT_EQ(lu.nnz_U(), nU);
+    EXPECT_EQ(lu.repivots(), 0u);
+
+    ComplexSparseMatrix other = ComplexSparseMatrix::from_parts(ckt.G, ckt.G);
+    EXPECT_THROW(lu.refactor(other), std::invalid_argument);
+}
+
+TEST(SparseComplexLU, RefactorRepivotsWhenAPivotCollapses) {
+    // The diagonal (0,0) is a good pivot at first and exactly zero later.
+    auto make = [](Complex d) {
+        return ComplexSparseMatrix::from_triplets(3, 3,
+            {0, 0, 1, 1, 2, 2}, {0, 1, 0, 1, 1, 2},
+            {d, {1, 0}, {1, 0}, {2, 1}, {1, 0}, {3, 0}});
+    };
+    SparseComplexLU lu(make({5, 0}), SparseOrdering::Natural);
+    lu.refactor(make({0, 0}));
+    EXPECT_EQ(lu.repivots(), 1u);
+    auto A = make({0, 0});
+    ComplexVector x = randomVector(3, 6);
+    EXPECT_LT(maxAbsDiff(lu.solve(A * x), x), 1e-12);
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Conv2d.h"
+#include "LinearAlgebra/Tensor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+std::vector<double> randomBuffer(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& e : v) e = dist(gen);
+    return v;
+}
+
+size_t inputSize(const Conv2dShape& s)  { return s.N * s.C * s.H * s.W; }
+size_t weightSize(const Conv2dShape& s) { return s.OC * (s.C / s.groups) * s.KH * s.KW; }
+size_t outputSize(const Conv2dShape& s) { return s.N * s.OC * s.outH() * s.outW(); }
+
+// Calls fn(xIndex, wIndex, yIndex) for every multiply-add of the convolution.
+template<typename Fn>
+void forEachTap(const Conv2dShape& s, Fn&& fn) {
+    const size_t Cg = s.C / s.groups, OCg = s.OC / s.groups, OH = s.outH(), OW = s.outW();
+    for (size_t n = 0; n < s.N; ++n)
+        for (size_t oc = 0; oc < s.OC; ++oc)
+            for (size_t oh = 0; oh < OH; ++oh)
+                for (size_t ow = 0; ow < OW; ++ow)
+                    for (size_t c = 0; c < Cg; ++c)
+                        for (size_t kh = 0; kh < s.KH; ++kh)
+                            for (size_t kw = 0; kw < s.KW; ++kw) {
+                                const long ih = long(oh * s.stride + kh * s.dilation) - long(s.padding);
+                                const long iw = long(ow * s.stride + kw * s.dilation) - long(s.padding);
+                                if (ih < 0 || iw < 0 || ih >= long(s.H) || iw >= long(s.W)) continue;
+                                const size_t ic = (oc / OCg) * Cg + c;
+                                fn(((n * s.C + ic) * s.H + size_t(ih)) * s.W + size_t(iw),
+                                   ((oc * Cg + c) * s.KH + kh) * s.KW + kw,
+                                   ((n * s.OC + oc) * OH + oh) * OW + ow);
+                            }
+}
+
+double maxAbsDiff(const std::vector<double>& a, const std::vector<double>& b) {
+    double d = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) d = std::max(d, std::abs(a[i] - b[i]));
+    return d;
+}
+
+Conv2dShape geometry(size_t N, size_t C, size_t H, size_t W, size_t OC, size_t KH, size_t KW,
+                     size_t stride = 1, size_t padding = 0, size_t dilation = 1, size_t groups = 1) {
+    Conv2dShape s;
+    s.N = N; s.C = C; s.H = H; s.W = W; s.OC = OC; s.KH = KH; s.KW = KW;
+    s.stride = stride; s.padding = padding; s.dilation = dilation; s.groups = groups;
+    return s;
+}
+
+// Forward, backward-input and backward-weight against the reference loops.
+void checkAgainstReference(const Conv2dShape& s, ConvAlgorithm algo) {
+    const auto x = randomBuffer(inputSize(s), 1);
+    const auto w = randomBuffer(weightSize(s), 2);
+    const auto b = randomBuffer(s.OC, 3);
+    const auto g = randomBuffer(outputSize(s), 4);
+
+    std::vector<double> y(outputSize(s)), dx(inputSize(s), 0.0), dw(weightSize(s), 0.0);
+    for (size_t i = 0; i < y.size(); ++i) y[i] = b[(i / (s.outH() * s.outW())) % s.OC];
+    forEachTap(s, [&](size_t xi, size_t wi, size_t yi) {
+        y[yi]  += x[xi] * w[wi];
+        dx[xi] += g[yi] * w[wi];
+        dw[wi] += g[yi] * x[xi];
+    });
+
+    std::vector<double> got(outputSize(s), 99.0);
+    conv2d(s, x.data(), w.data(), b.data(), got.data(), algo);
+    EXPECT_LT(maxAbsDiff(got, y), 1e-12 * double(s.C * s.KH * s.KW));
+
+    std::vector<double> gdx(inputSize(s), 99.0), gdw(weightSize(s), 99.0);
+    conv2dBackwardInput(s, g.data(), w.data(), gdx.data());
+    conv2dBackwardWeight(s, g.data(), x.data(), gdw.data());
+    EXPECT_LT(maxAbsDiff(gdx, dx), 1e-11);
+    EXPECT_LT(maxAbsDiff(gdw, dw), 1e-11);
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Kernels
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Conv2dKernels, Im2colCoversEveryGeometry) {
+    checkAgainstReference(geometry(2, 3, 9, 7, 4, 3, 3), ConvAlgorithm::Im2col);
+    checkAgainstReference(geometry(1, 2, 10, 11, 3, 2, 5, 2, 1), ConvAlgorithm::Im2col);     // non-square, strided
+    checkAgainstReference(geometry(2, 3, 12, 12, 2, 3, 3, 1, 2, 2), ConvAlgorithm::Im2col);  // dilated
+    checkAgainstReference(geometry(1, 6, 8, 8, 4, 3, 1, 1, 1, 1, 2), ConvAlgorithm::Im2col); // grouped
+    checkAgainstReference(geometry(2, 5, 6, 6, 7, 1, 1), ConvAlgorithm::Im2col);             // pointwise
+    checkAgainstReference(geometry(1, 4, 9, 9, 8, 3, 3, 3, 2, 1, 4), ConvAlgorithm::Im2col); // stride 3
+}
+
+TEST(Conv2dKernels, WinogradMatchesTheReference) {
+    checkAgainstReference(geometry(2, 5, 10, 10, 6, 3, 3, 1, 1), ConvAlgorithm::Winograd);
+    checkAgainstReference(geometry(1, 4, 9, 7, 3, 3, 3, 1, 0), ConvAlgorithm::Winograd);     // odd output
+    checkAgainstReference(geometry(1, 4, 5, 6, 2, 3, 3, 1, 2), ConvAlgorithm::Winograd);     // wide padding
+    EXPECT_EQ(conv2dAlgorithm(geometry(1, 16, 32, 32, 16, 3, 3, 1, 1)), ConvAlgorithm::Winograd);
+
+    const auto s = geometry(1, 2, 8, 8, 2, 3, 3, 2, 1);
+    std::vector<double> x(inputSize(s)), w(weightSize(s)), y(outputSize(s));
+    EXPECT_THROW(conv2d(s, x.data(), w.data(), nullptr, y.data(), ConvAlgorithm::Winograd),
+                 std::invalid_argument);
+}
+
+TEST(Conv2dKernels, DepthwiseMatchesTheReference) {
+    checkAgainstReference(geometry(2, 11, 9, 10, 11, 3, 3, 1, 1, 1, 11), ConvAlgorithm::Depthwise);
+    checkAgainstReference(geometry(1, 8, 12, 12, 8, 5, 3, 2, 2, 1, 8), ConvAlgorithm::Depthwise);
+    checkAgainstReference(geometry(1, 3, 11, 11, 3, 3, 3, 1, 2, 2, 3), ConvAlgorithm::Depthwise);
+    EXPECT_EQ(conv2dAlgorithm(geometry(1, 32, 16, 16, 32, 3, 3, 1, 1, 1, 32)),
+              ConvAlgorithm::Depthwise);
+}
+
+TEST(Conv2dKernels, FloatPathsAgreeWithDouble) {
+    for (ConvAlgorithm algo : {ConvAlgorithm::Im2col, ConvAlgorithm::Winograd, ConvAlgorithm::Direct}) {
+        const auto s = geometry(1, 6, 9, 9, 5, 3, 3, 1, 1);
+        const auto x = randomBuffer(inputSize(s), 5), w = randomBuffer(weightSize(s), 6);
+        std::vector<double> y(outputSize(s));
+        conv2d(s, x.data(), w.data(), nullptr, y.data(), algo);
+        std::vector<float> xf(x.begin(), x.end()), wf(w.begin(), w.end()), yf(outputSize(s));
+        conv2d(s, xf.data(), wf.data(), nullptr, yf.data(), algo);
+        for (size_t i = 0; i < y.size(); ++i) EXPECT_NEAR(yf[i], y[i], 1e-5);
+    }
+}
+
+TEST(Conv2dKernels, RejectsImpossibleGeometry) {
+    EXPECT_THROW(geometry(1, 3, 8, 8, 4, 3, 3, 1, 0, 1, 2).validate("t"), std::invalid_argument);
+    EXPECT_THROW(geometry(1, 2, 4, 4, 2, 3, 3, 1, 0, 2).validate("t"), std::invalid_argument);
+    EXPECT_THROW(geometry(1, 2, 4, 4, 2, 3, 3, 0).validate("t"), std::invalid_argument);
+    EXPECT_NO_THROW(geometry(1, 2, 4, 4, 2, 3, 3, 1, 1, 2).validate("t"));
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Tensor entry points
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Conv2dTensor, GroupedDilatedNonSquareThroughTensor) {
+    Tensor x = Tensor::uniform({2, 4, 9, 8}, -1.0, 1.0, 7);
+    Tensor w = Tensor::uniform({6, 2, 3, 2}, -1.0, 1.0, 8);
+    Tensor b = Tensor::uniform({6}, -1.0, 1.0, 9);
+    Tensor y = x.conv2d(w, &b, 1, 1, 2, 2);
+    const auto s = geometry(2, 4, 9, 8, 6, 3, 2, 1, 1, 2, 2);
+    ASSERT_EQ(y.shape(), (Tensor::Shape{2, 6, s.outH(), s.outW()}));
+
+    std::vector<double> want(outputSize(s));
+    conv2d(s, x.data().data(), w.data().data(), b.data().data(), want.data(), ConvAlgorithm::Direct);
+    for (size_t i = 0; i < want.size(); ++i) EXPECT_NEAR(y.flat(i), want[i], 1e-12);
+
+    Tensor g = Tensor::uniform(y.shape(), -1.0, 1.0, 10);
+    Tensor dx = Tensor::conv2d_backward_input(g, w, x.shape(), 1, 1, 2, 2);
+    Tensor dw = g.conv2d_backward_weight(x, w.shape(), 1, 1, 2, 2);
+    EXPECT_EQ(dx.shape(), x.shape());
+    EXPECT_EQ(dw.shape(), w.shape());
+
+    // <g, conv(x, w)> is bilinear: its derivatives are dx and dw.
+    const double eps = 1e-6;
+    auto loss = [&](const Tensor& xx, const Tensor& ww) {
+        Tensor yy = xx.conv2d(ww, &b, 1, 1, 2, 2);
+        double l = 0.0;
+        for (size_t i = 0; i < yy.size(); ++i) l += yy.flat(i) * g.flat(i);
+        return l;
+    };
+    for (size_t i : {0u, 17u, 143u}) {
+        Tensor xp = x, xm = x;
+        xp.flat(i) += eps; xm.flat(i) -= eps;
+        EXPECT_NEAR(dx.flat(i), (loss(xp, w) - loss(xm, w)) / (2 * eps), 1e-6);
+    }
+    for (size_t i : {0u, 5u, 31u}) {
+        Tensor wp = w, wm = w;
+        wp.flat(i) += eps; wm.flat(i) -= eps;
+        EXPECT_NEAR(dw.flat(i), (loss(x, wp) - loss(x, wm)) / (2 * eps), 1e-6);
+    }
+
+    EXPECT_THROW(x.conv2d(Tensor::ones({6, 3, 3, 3}), nullptr, 1, 0, 1, 2), std::invalid_argument);
+}
+
+TEST(Conv2dTensor, Float32AndStridedInputsUseTheKernels) {
+    Tensor x = Tensor::uniform({1, 8, 10, 10}, -1.0, 1.0, 11);
+    Tensor w = Tensor::uniform({8, 8, 3, 3}, -1.0, 1.0, 12);
+    Tensor y = x.conv2d(w, nullptr, 1, 1);
+
+    Tensor yf = x.astype(TensorDType::Float32).conv2d(w.astype(TensorDType::Float32), nullptr, 1, 1);
+    EXPECT_EQ(yf.dtype(), TensorDType::Float32);
+    for (size_t i = 0; i < y.size(); ++i) EXPECT_NEAR(yf.data_f32()[i], y.flat(i), 1e-4);
+
+    // A transposed view of the spatial axes is materialized first.
+    Tensor xt = x.transpose({0, 1, 3, 2});
+    Tensor yt = xt.conv2d(w, nullptr, 1, 1);
+    Tensor ref = xt.contiguous().conv2d(w, nullptr, 1, 1);
+    for (size_t i = 0; i < yt.size(); ++i) EXPECT_DOUBLE_EQ(yt.flat(i), ref.flat(i));
+}
+
+TEST(Conv2dTensor, PoolingMatchesWindowDefinitions) {
+    Tensor x = Tensor::uniform({2, 3, 7, 6}, -1.0, 1.0, 13);
+    Tensor mx = x.max_pool2d(3, 2, 1);
+    Tensor av = x.avg_pool2d(3, 2, 1);
+    ASSERT_EQ(mx.shape(), (Tensor::Shape{2, 3, 4, 3}));
+    for (size_t n = 0; n < 2; ++n)
+        for (size_t c = 0; c < 3; ++c)
+            for (size_t oh = 0; oh < 4; ++oh)
+                for (size_t ow = 0; ow < 3; ++ow) {
+                    double best = -1e300, sum = 0.0, count = 0.0;
+                    for (long ih = long(oh * 2) - 1; ih < long(oh * 2) + 2; ++ih)
+                        for (long iw = long(ow * 2) - 1; iw < long(ow * 2) + 2; ++iw) {
+                            if (ih < 0 || iw < 0 || ih >= 7 || iw >= 6) continue;
+                            const double v = x(n, c, size_t(ih), size_t(iw));
+                            best = std::max(best, v); sum += v; count += 1.0;
+                        }
+                    EXPECT_DOUBLE_EQ(mx(n, c, oh, ow), best);
+                    EXPECT_NEAR(av(n, c, oh, ow), sum / count, 1e-15);
+                }
+
+    // Each gradient sums back to the incoming total.
+    Tensor g = Tensor::ones(mx.shape());
+    Tensor dmx = g.max_pool2d_backward(x, 3, 2, 1);
+    Tensor dav = g.avg_pool2d_backward(x.shape(), 3, 2, 1);
+    double smx = 0.0, sav = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) { smx += dmx.flat(i); sav += dav.flat(i); }
+    EXPECT_NEAR(smx, double(g.size()), 1e-12);
+    EXPECT_NEAR(sav, double(g.size()), 1e-12);
+}
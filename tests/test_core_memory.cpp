@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "core/Memory.h"
+#include "core/ThreadPool.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+using namespace SharedMath::Core;
+
+namespace {
+
+bool aligned(const void* p, size_t a = kSimdAlignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % a == 0;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Arena
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Arena, BumpAllocationIsAlignedAndRewinds) {
+    Arena arena(1024);
+    void* a = arena.allocate(3, 8);
+    void* b = arena.allocate(100, 8);
+    EXPECT_TRUE(aligned(a));
+    EXPECT_TRUE(aligned(b));
+    EXPECT_EQ(static_cast<char*>(b) - static_cast<char*>(a), 64);
+
+    const Arena::Mark m = arena.mark();
+    void* c = arena.allocate(200);
+    arena.release(m);
+    EXPECT_EQ(arena.allocate(200), c);              // same bytes handed out again
+
+    void* wide = arena.allocate(64, 256);
+    EXPECT_TRUE(aligned(wide, 256));
+}
+
+TEST(Arena, GrowsAndCoalescesOnReset) {
+    Arena arena(256);
+    for (int i = 0; i < 20; ++i) ASSERT_NE(arena.allocate(1000), nullptr);
+    const size_t high = arena.used();
+    EXPECT_GE(high, 20000u);
+    EXPECT_GE(arena.capacity(), high);
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    // The whole high-water mark now fits in the first block.
+    void* first = arena.allocate(1000);
+    for (int i = 1; i < 20; ++i) ASSERT_NE(arena.allocate(1000), nullptr);
+    EXPECT_EQ(arena.used(), 19u * 1024u + 1000u);        // one block, no gaps
+    arena.reset();
+    EXPECT_EQ(arena.allocate(1000), first);
+
+    arena.trim();
+    EXPECT_EQ(arena.capacity(), 0u);
+}
+
+TEST(Arena, ScopesNestAndRestoreTheCurrentResource) {
+    Arena& arena = threadLocalArena();
+    EXPECT_EQ(currentResource(), heapResource());
+    const size_t before = arena.used();
+    {
+        ArenaScope outer;
+        EXPECT_EQ(currentResource(), &arena);
+        ScratchVector<double> x(1000, 1.0);
+        EXPECT_TRUE(aligned(x.data()));
+        EXPECT_EQ(x.get_allocator().resource(), &arena);
+        const size_t mid = arena.used();
+        {
+            ArenaScope inner;
+            ScratchVector<double> y(5000);
+            EXPECT_GT(arena.used(), mid);
+        }
+        EXPECT_EQ(arena.used(), mid);
+        EXPECT_DOUBLE_EQ(std::accumulate(x.begin(), x.end(), 0.0), 1000.0);
+    }
+    EXPECT_EQ(arena.used(), before);
+    EXPECT_EQ(currentResource(), heapResource());
+
+    // withArena returns the callable's result.
+    const double s = withArena([] {
+        ScratchVector<double> v(64);
+        std::iota(v.begin(), v.end(), 1.0);
+        return std::accumulate(v.begin(), v.end(), 0.0);
+    });
+    EXPECT_DOUBLE_EQ(s, 64.0 * 65.0 / 2.0);
+}
+
+TEST(Arena, EveryWorkerHasItsOwnArena) {
+    ThreadPool::setNumThreads(4);
+    std::vector<double> sums(64);
+    parallel_for(0, sums.size(), 1, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i)
+            sums[i] = withArena([&] {
+                ScratchVector<double> v(1000 + i, 1.0);
+                return std::accumulate(v.begin(), v.end(), 0.0);
+            });
+    });
+    ThreadPool::setNumThreads(0);
+    for (size_t i = 0; i < sums.size(); ++i) EXPECT_DOUBLE_EQ(sums[i], 1000.0 + i);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Pool and allocator
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(PoolResource, ReusesBlocksBySizeClass) {
+    PoolResource pool;
+    void* a = pool.allocate(100);
+    EXPECT_TRUE(aligned(a));
+    pool.deallocate(a, 100);
+    EXPECT_EQ(pool.cached(), 128u);
+    EXPECT_EQ(pool.allocate(120), a);               // same 128-byte class
+    EXPECT_EQ(pool.cached(), 0u);
+
+    void* big = pool.allocate(PoolResource::kMaxPooled + 1);   // straight to the heap
+    pool.deallocate(big, PoolResource::kMaxPooled + 1);
+    EXPECT_EQ(pool.cached(), 0u);
+
+    pool.deallocate(a, 120);
+    pool.release();
+    EXPECT_EQ(pool.cached(), 0u);
+}
+
+TEST(NumericAllocator, DefaultsToTheAlignedHeapAndPlugsIntoPmr) {
+    ScratchVector<double> v(10, 2.0);
+    EXPECT_EQ(v.get_allocator().resource(), heapResource());
+    EXPECT_TRUE(aligned(v.data()));
+
+    PoolResource pool;
+    {
+        ResourceScope use(&pool);
+        ScratchVector<float> f(33);
+        EXPECT_TRUE(aligned(f.data()));
+        ScratchVector<double> copy = v;             // copies bind to the current resource
+        EXPECT_EQ(copy.get_allocator().resource(), &pool);
+    }
+    EXPECT_GT(pool.cached(), 0u);
+
+    Arena arena;
+    std::pmr::vector<int> p(&arena);
+    p.assign(100, 7);
+    EXPECT_TRUE(aligned(p.data()));
+    EXPECT_EQ(std::accumulate(p.begin(), p.end(), 0), 700);
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include "core/ThreadPool.h"
+#include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/SparseMatrix.h"
+#include "LinearAlgebra/Tensor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::Core;
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Fixture: every test runs against a 4-thread pool and restores the default.
+// ────────────────────────────────────────────────────────────────────────────
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    void SetUp()    override { ThreadPool::setNumThreads(4); }
+    void TearDown() override { ThreadPool::setNumThreads(0); }
+};
+
+namespace {
+
+std::vector<double> randomVec(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(gen);
+    return v;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Pool primitives
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST_F(ThreadPoolTest, SizeFollowsSetter) {
+    EXPECT_EQ(ThreadPool::numThreads(), 4u);
+    ThreadPool::setNumThreads(2);
+    EXPECT_EQ(ThreadPool::numThreads(), 2u);
+    ThreadPool::setNumThreads(0);
+    EXPECT_EQ(ThreadPool::numThreads(), ThreadPool::defaultNumThreads());
+}
+
+TEST_F(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    std::vector<int> hits(100003, 0);
+    parallel_for(0, hits.size(), 64, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) ++hits[i];
+    });
+    for (size_t i = 0; i < hits.size(); ++i) ASSERT_EQ(hits[i], 1) << i;
+}
+
+TEST_F(ThreadPoolTest, ParallelForEmptyAndOffsetRanges) {
+    bool called = false;
+    parallel_for(5, 5, 1, [&](size_t, size_t) { called = true; });
+    EXPECT_FALSE(called);
+
+    std::atomic<size_t> total{0};
+    parallel_for(10, 1010, 7, [&](size_t lo, size_t hi) {
+        EXPECT_GE(lo, 10u);
+        EXPECT_LE(hi, 1010u);
+        total += hi - lo;
+    });
+    EXPECT_EQ(total.load(), 1000u);
+}
+
+TEST_F(ThreadPoolTest, BalancedForSplitsSkewedCosts) {
+    // One huge item followed by many cheap ones: every item is still visited
+    // once, and the huge item ends up alone in its range.
+    const size_t n = 5000;
+    std::vector<size_t> prefix(n + 1, 0);
+    prefix[1] = 100000;
+    for (size_t i = 1; i < n; ++i) prefix[i + 1] = prefix[i] + 2;
+
+    std::vector<int> hits(n, 0);
+    std::atomic<size_t> firstRange{0};
+    parallel_for_balanced(prefix, 64, [&](size_t lo, size_t hi) {
+        if (lo == 0) firstRange = hi;
+        for (size_t i = lo; i < hi; ++i) ++hits[i];
+    });
+    for (size_t i = 0; i < n; ++i) ASSERT_EQ(hits[i], 1) << i;
+    EXPECT_EQ(firstRange.load(), 1u);
+
+    bool called = false;
+    parallel_for_balanced(std::vector<size_t>{0}, 1, [&](size_t, size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelForDoesNotDeadlock) {
+    std::atomic<size_t> count{0};
+    parallel_for(0, 16, 1, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i)
+            parallel_for(0, 1000, 10, [&](size_t a, size_t b) { count += b - a; });
+    });
+    EXPECT_EQ(count.load(), 16000u);
+}
+
+TEST_F(ThreadPoolTest, ExceptionIsRethrownInCaller) {
+    EXPECT_THROW(
+        parallel_for(0, 1000, 1, [](size_t lo, size_t) {
+            if (lo >= 500) throw std::runtime_error("boom");
+        }),
+        std::runtime_error);
+    // The pool stays usable afterwards.
+    std::atomic<size_t> n{0};
+    parallel_for(0, 100, 1, [&](size_t lo, size_t hi) { n += hi - lo; });
+    EXPECT_EQ(n.load(), 100u);
+}
+
+TEST_F(ThreadPoolTest, ParallelReduceIsIndependentOfThreadCount) {
+    auto v = randomVec(200000, 1);
+    auto sum = [&] {
+        return parallel_reduce(0, v.size(), 1000, 0.0,
+            [&](size_t lo, size_t hi) {
+                return std::accumulate(v.begin() + lo, v.begin() + hi, 0.0);
+            },
+            [](double a, double b) { return a + b; });
+    };
+    const double s4 = sum();
+    ThreadPool::setNumThreads(1);
+    const double s1 = sum();
+    EXPECT_EQ(s4, s1);   // bitwise identical
+    EXPECT_NEAR(s4, std::accumulate(v.begin(), v.end(), 0.0), 1e-9);
+}
+
+TEST_F(ThreadPoolTest, SubmitReturnsFuture) {
+    auto fut = ThreadPool::instance().submit([] { return 6 * 7; });
+    EXPECT_EQ(fut.get(), 42);
+}
+
+TEST(ThreadPool, StandalonePoolRunsAllChunks) {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+    std::vector<int> hits(50, 0);
+    pool.run(hits.size(), [&](size_t c) { ++hits[c]; });
+    for (int h : hits) EXPECT_EQ(h, 1);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Library kernels running on the pool
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST_F(ThreadPoolTest, GemmMatchesSingleThread) {
+    const size_t M = 301, K = 157, N = 203;
+    DynamicMatrix A(M, K, randomVec(M * K, 2));
+    DynamicMatrix B(K, N, randomVec(K * N, 3));
+    DynamicMatrix C4 = A * B;
+    ThreadPool::setNumThreads(1);
+    DynamicMatrix C1 = A * B;
+    for (size_t i = 0; i < M * N; ++i)
+        ASSERT_DOUBLE_EQ(C4.flat(i), C1.flat(i)) << i;
+}
+
+TEST_F(ThreadPoolTest, TensorElementwiseAndReductions) {
+    const size_t n = 100000;
+    auto a = randomVec(n, 4), b = randomVec(n, 5);
+    Tensor ta({n}, a), tb({n}, b);
+
+    Tensor sum = ta + tb;
+    Tensor sq  = ta.apply([](double x) { return x * x; });
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_DOUBLE_EQ(sum.flat(i), a[i] + b[i]);
+        ASSERT_DOUBLE_EQ(sq.flat(i), a[i] * a[i]);
+    }
+
+    const double s4 = ta.sum(), mx4 = ta.max(), v4 = ta.var();
+    ThreadPool::setNumThreads(1);
+    EXPECT_EQ(ta.sum(), s4);
+    EXPECT_EQ(ta.max(), mx4);
+    EXPECT_EQ(ta.var(), v4);
+    EXPECT_DOUBLE_EQ(mx4, *std::max_element(a.begin(), a.end()));
+}
+
+TEST_F(ThreadPoolTest, SparseMatVecMatchesDense) {
+    const size_t n = 5000;
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < n; ++i) {
+        ri.push_back(i); ci.push_back(i); vals.push_back(4.0);
+        if (i + 1 < n) { ri.push_back(i); ci.push_back(i + 1); vals.push_back(-1.0); }
+        if (i > 0)     { ri.push_back(i); ci.push_back(i - 1); vals.push_back(-1.0); }
+    }
+    SparseMatrix S = SparseMatrix::from_triplets(n, n, ri, ci, vals);
+    DynamicVector x(n, 1.0);
+    DynamicVector y = S * x;
+    EXPECT_DOUBLE_EQ(y[0], 3.0);
+    EXPECT_DOUBLE_EQ(y[n / 2], 2.0);
+    EXPECT_DOUBLE_EQ(y[n - 1], 3.0);
+}
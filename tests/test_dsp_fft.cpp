@@ -4,7 +4,13 @@
 #include <cmath>
 #include <numeric>
 #include <algorithm>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <filesystem>
 #include "DSP/dsp.h"
+#include "core/CpuFeatures.h"
+#include "core/ThreadPool.h"
 
 using namespace SharedMath::DSP;
 using cx = std::complex<double>;
@@ -400,6 +406,329 @@ TEST(FFTBluesteinTest, ParsevalArbitraryN) {
     }
 }
 
+TEST(FFTBluesteinTest, PlanReusedAcrossInputsAndThreads) {
+    // The chirp and kernel spectrum are built once per plan; repeated and
+    // concurrent executions must not disturb them or each other.
+    const size_t N = 211;  // prime
+    auto fwd = FFTPlan::create(N, {FFTDirection::Forward, FFTNorm::None});
+    auto inv = FFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::BySqrtN});
+
+    std::vector<int> ok(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < ok.size(); ++t)
+        threads.emplace_back([&, t] {
+            bool good = true;
+            for (size_t r = 0; r < 3; ++r) {
+                auto x = makeMixed(N, 1 + t, 3 + r);
+                auto X = x;
+                fwd.execute(X);
+                good = good && maxErr(X, naiveDFT(x)) < kLoose;
+
+                auto ref = naiveDFT(X, /*inverse=*/true);
+                for (auto& v : ref) v /= std::sqrt(static_cast<double>(N));
+                inv.execute(X);
+                good = good && maxErr(X, ref) < kLoose;
+            }
+            ok[t] = good;
+        });
+    for (auto& th : threads) th.join();
+
+    for (size_t t = 0; t < ok.size(); ++t) EXPECT_TRUE(ok[t]) << "thread " << t;
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+// Mixed-radix Stockham (2^a·3^b·5^c… sizes, four-step for large N)
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(FFTMixedRadixTest, AgainstNaiveDFT) {
+    // Every butterfly (2, 3, 4, 5, 8 and the generic 7/11/13) and mixes.
+    for (size_t N : {2u, 3u, 5u, 6u, 7u, 8u, 12u, 30u, 48u, 77u, 96u, 143u,
+                     169u, 240u, 1536u, 3000u}) {
+        auto x = makeMixed(N, 1, N / 3);
+        auto ref  = naiveDFT(x);
+        auto iref = naiveDFT(x, /*inverse=*/true);
+        auto y = x;
+        FFTPlan::create(N).execute(x);
+        FFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::None}).execute(y);
+        EXPECT_LT(maxErr(x, ref),  1e-9) << "N=" << N;
+        EXPECT_LT(maxErr(y, iref), 1e-9) << "N=" << N;
+    }
+}
+
+TEST(FFTMixedRadixTest, BothKernelBuildsAgree) {
+    using namespace SharedMath::Core;
+    const SimdLevel saved = simdLevel();
+    for (size_t N : {64u, 360u, 6000u}) {
+        auto signal = makeMixed(N, 5, 11);
+        setSimdLevel(SimdLevel::Scalar);
+        auto a = FFTPlan::create(N).executeConst(signal);
+        setSimdLevel(hostSimdLevel());
+        auto b = FFTPlan::create(N).executeConst(signal);
+        EXPECT_LT(maxErr(a, b), 1e-9) << "N=" << N;
+    }
+    setSimdLevel(saved);
+}
+
+TEST(FFTMixedRadixTest, FourStepLargeN) {
+    // Above the four-step threshold: compare against Bluestein and check
+    // the round trip.
+    for (size_t N : {size_t{1} << 17, size_t{3} * 5 * 8192}) {
+        auto signal = makeMixed(N, 3, 1000);
+        auto x  = signal;
+        auto bl = signal;
+        FFTPlan::create(N).execute(x);
+        FFTPlan::create(N, {FFTDirection::Forward, FFTNorm::None,
+                            FFTAlgorithm::Bluestein}).execute(bl);
+        EXPECT_LT(maxErr(x, bl), 1e-7) << "N=" << N;
+        EXPECT_NEAR(x[0].real(), static_cast<double>(N), 1e-6);
+        EXPECT_NEAR(x[3].real(), static_cast<double>(N) / 2.0, 1e-6);
+
+        FFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::ByN}).execute(x);
+        EXPECT_LT(maxErr(x, signal), 1e-10) << "N=" << N;
+    }
+}
+
+TEST(FFTMixedRadixTest, AlgorithmSelection) {
+    EXPECT_NE(std::string(FFTPlan::create(1536).backendName()).find("mixed-radix"),
+              std::string::npos);
+    EXPECT_NE(std::string(FFTPlan::create(1009).backendName()).find("Bluestein"),
+              std::string::npos);
+    EXPECT_NO_THROW(FFTPlan::create(3000, {FFTDirection::Forward, FFTNorm::None,
+                                           FFTAlgorithm::MixedRadix}));
+    EXPECT_THROW(FFTPlan::create(2 * 17, {FFTDirection::Forward, FFTNorm::None,
+                                          FFTAlgorithm::MixedRadix}),
+                 std::invalid_argument);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+// Batched execution
+// ═════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+// howmany distinct signals of length N, back to back.
+std::vector<cx> makeBatch(size_t N, size_t howmany) {
+    std::vector<cx> data(N * howmany);
+    for (size_t b = 0; b < howmany; ++b) {
+        auto x = makeMixed(N, 1 + b % 5, 2 + b % 7);
+        for (size_t j = 0; j < N; ++j) data[b * N + j] = x[j] * cx(1.0, 0.1 * b);
+    }
+    return data;
+}
+
+// Forwards to a CPUBackend but keeps IFFTBackend's default executeBatch.
+class LoopingBackend final : public IFFTBackend {
+public:
+    void prepare(size_t n, const FFTConfig& cfg) override { inner_.prepare(n, cfg); }
+    void execute(cx* data) const override { ++calls; inner_.execute(data); }
+    const char* name() const noexcept override { return "looping"; }
+    mutable size_t calls = 0;
+private:
+    CPUBackend inner_;
+};
+
+} // namespace
+
+TEST(FFTBatchTest, ContiguousMatchesSingleTransforms) {
+    // Lane-interleaved sizes (incl. generic radices and a partial lane
+    // group), Bluestein, and a size above the lane limit.
+    for (size_t N : {8u, 12u, 60u, 77u, 256u, 1009u, 2048u}) {
+        for (FFTConfig cfg : {FFTConfig{}, FFTConfig{FFTDirection::Inverse, FFTNorm::ByN}}) {
+            const auto plan = FFTPlan::create(N, cfg);
+            const size_t howmany = 13;
+            auto data = makeBatch(N, howmany);
+            auto ref  = data;
+            for (size_t b = 0; b < howmany; ++b) plan.execute(ref.data() + b * N);
+            plan.executeBatch(data);
+            EXPECT_LT(maxErr(data, ref), 1e-9) << "N=" << N;
+        }
+    }
+}
+
+TEST(FFTBatchTest, InterleavedChannels) {
+    // 6 channels of 48 samples interleaved sample by sample.
+    const size_t N = 48, channels = 6;
+    auto frames = makeBatch(N, channels);
+    std::vector<cx> iq(N * channels);
+    for (size_t c = 0; c < channels; ++c)
+        for (size_t j = 0; j < N; ++j) iq[j * channels + c] = frames[c * N + j];
+
+    const auto plan = FFTPlan::create(N);
+    plan.executeBatch(frames);
+    plan.executeBatch(iq.data(), channels, /*stride=*/channels, /*dist=*/1);
+    for (size_t c = 0; c < channels; ++c)
+        for (size_t j = 0; j < N; ++j)
+            EXPECT_LT(std::abs(iq[j * channels + c] - frames[c * N + j]), 1e-9);
+}
+
+TEST(FFTBatchTest, LargeBatchOnThreadPool) {
+    SharedMath::Core::ThreadPool::setNumThreads(4);
+    const size_t N = 64, howmany = 1500;
+    const auto plan = FFTPlan::create(N);
+    auto data = makeBatch(N, howmany);
+    auto ref  = data;
+    for (size_t b = 0; b < howmany; ++b) plan.execute(ref.data() + b * N);
+    plan.executeBatch(data);
+    SharedMath::Core::ThreadPool::setNumThreads(0);
+    EXPECT_LT(maxErr(data, ref), 1e-9);
+}
+
+TEST(FFTBatchTest, DefaultBackendLoopAndErrors) {
+    const size_t N = 32, howmany = 4;
+    auto backend = std::make_unique<LoopingBackend>();
+    const LoopingBackend* raw = backend.get();
+    const auto plan = FFTPlan::create(N, {}, std::move(backend));
+
+    auto frames = makeBatch(N, howmany);
+    std::vector<cx> iq(N * howmany);
+    for (size_t c = 0; c < howmany; ++c)
+        for (size_t j = 0; j < N; ++j) iq[j * howmany + c] = frames[c * N + j];
+    plan.executeBatch(frames);
+    plan.executeBatch(iq.data(), howmany, howmany, 1);
+    EXPECT_EQ(raw->calls, 2 * howmany);
+    for (size_t c = 0; c < howmany; ++c)
+        for (size_t j = 0; j < N; ++j)
+            EXPECT_LT(std::abs(iq[j * howmany + c] - frames[c * N + j]), 1e-12);
+
+    EXPECT_THROW(plan.executeBatch(iq.data(), 2, /*stride=*/0, N), std::invalid_argument);
+    EXPECT_THROW(plan.executeBatch(iq.data(), 2, 1, /*dist=*/0), std::invalid_argument);
+    std::vector<cx> ragged(N + 1);
+    EXPECT_THROW(plan.executeBatch(ragged), std::invalid_argument);
+    EXPECT_NO_THROW(plan.executeBatch(iq.data(), 0, 1, 0));
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+// FFTPlanCache / wisdom
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(FFTPlanCacheTest, HitSharesBackend) {
+    FFTPlanCache cache;
+    auto a = cache.get(1024);
+    auto b = cache.get(1024);
+    auto c = cache.get(1024, {FFTDirection::Inverse, FFTNorm::ByN});
+    EXPECT_EQ(a.backend(), b.backend());
+    EXPECT_NE(a.backend(), c.backend());
+    EXPECT_EQ(cache.stats().hits,   1u);
+    EXPECT_EQ(cache.stats().misses, 2u);
+    EXPECT_EQ(cache.size(), 2u);
+
+    auto x = makeMixed(1024);
+    auto y = FFTPlan::create(1024).executeConst(x);
+    a.execute(x);
+    EXPECT_LT(maxErr(x, y), kTight);
+}
+
+TEST(FFTPlanCacheTest, LeastRecentlyUsedIsEvicted) {
+    FFTPlanCache cache(2);
+    auto p64 = cache.get(64);
+    cache.get(128);
+    cache.get(64);                      // 128 is now the oldest
+    cache.get(256);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    EXPECT_EQ(cache.get(64).backend(), p64.backend());
+    EXPECT_EQ(cache.stats().misses, 3u);
+    cache.get(128);
+    EXPECT_EQ(cache.stats().misses, 4u);
+
+    // Evicted handles stay usable.
+    cache.setCapacity(0);
+    EXPECT_EQ(cache.size(), 0u);
+    auto x = makeMixed(64);
+    EXPECT_NO_THROW(p64.execute(x));
+}
+
+TEST(FFTPlanCacheTest, ConcurrentGets) {
+    FFTPlanCache cache(4);
+    std::vector<std::thread> threads;
+    std::vector<double> errs(8, 1.0);
+    for (size_t t = 0; t < errs.size(); ++t)
+        threads.emplace_back([&, t] {
+            const size_t N = (t % 2) ? 1536 : 1000;
+            auto x = makeMixed(N);
+            auto ref = naiveDFT(x);
+            for (int r = 0; r < 20; ++r) {
+                auto y = x;
+                cache.get(N).execute(y);
+                errs[t] = maxErr(y, ref);
+            }
+        });
+    for (auto& th : threads) th.join();
+    for (double e : errs) EXPECT_LT(e, 1e-8);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.stats().hits + cache.stats().misses, 160u);
+}
+
+TEST(FFTPlanCacheTest, WisdomMeasuresAndPersists) {
+    const auto path = (std::filesystem::temp_directory_path()
+                       / "sharedmath_fft_wisdom.txt").string();
+    {
+        FFTPlanCache cache;
+        EXPECT_EQ(cache.wisdom(1536, FFTDirection::Forward), FFTAlgorithm::Auto);
+        cache.setMeasure(true);
+        auto plan = cache.get(1536);
+        auto prime = cache.get(1009, {FFTDirection::Inverse, FFTNorm::ByN});
+        EXPECT_NE(cache.wisdom(1536, FFTDirection::Forward), FFTAlgorithm::Auto);
+        EXPECT_EQ(cache.wisdom(1009, FFTDirection::Inverse), FFTAlgorithm::Bluestein);
+        EXPECT_EQ(plan.config().algorithm, cache.wisdom(1536, FFTDirection::Forward));
+
+        auto x = makeMixed(1536);
+        auto ref = naiveDFT(x);
+        plan.execute(x);
+        EXPECT_LT(maxErr(x, ref), 1e-8);
+        cache.saveWisdom(path);
+    }
+
+    FFTPlanCache fresh;
+    EXPECT_FALSE(fresh.loadWisdom(path + ".missing"));
+    ASSERT_TRUE(fresh.loadWisdom(path));
+    EXPECT_EQ(fresh.wisdom(1009, FFTDirection::Inverse), FFTAlgorithm::Bluestein);
+    EXPECT_NE(fresh.wisdom(1536, FFTDirection::Forward), FFTAlgorithm::Auto);
+    // Loaded wisdom applies without measuring.
+    EXPECT_EQ(fresh.get(1536).config().algorithm,
+              fresh.wisdom(1536, FFTDirection::Forward));
+
+    {
+        std::ofstream bad(path);
+        bad << "sharedmath-fft-wisdom 1\n1536 sideways mixed-radix\n";
+    }
+    EXPECT_THROW(fresh.loadWisdom(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(FFTPlanCacheTest, WisdomSkipsAlgorithmsThatDoNotApply) {
+    const auto path = (std::filesystem::temp_directory_path()
+                       / "sharedmath_fft_wisdom_stale.txt").string();
+    {
+        std::ofstream out(path);
+        out << "sharedmath-fft-wisdom 1\n"
+               "1009 forward mixed-radix\n"        // 1009 is prime
+               "96 inverse cooley-tukey\n"         // not a power of two
+               "1536 forward bluestein\n";
+    }
+    FFTPlanCache cache;
+    ASSERT_TRUE(cache.loadWisdom(path));
+    std::filesystem::remove(path);
+    EXPECT_EQ(cache.wisdom(1009, FFTDirection::Forward), FFTAlgorithm::Auto);
+    EXPECT_EQ(cache.wisdom(96, FFTDirection::Inverse), FFTAlgorithm::Auto);
+    EXPECT_EQ(cache.wisdom(1536, FFTDirection::Forward), FFTAlgorithm::Bluestein);
+
+    auto x = makeMixed(1009);
+    auto ref = naiveDFT(x);
+    FFTPlan plan = cache.get(1009);
+    plan.execute(x);
+    EXPECT_LT(maxErr(x, ref), 1e-8);
+    EXPECT_NO_THROW(cache.get(96, {FFTDirection::Inverse}));
+}
+
+TEST(FFTPlanCacheTest, CachedPlanFromGlobalCache) {
+    auto a = FFTPlan::cached(720, {FFTDirection::Inverse, FFTNorm::ByN});
+    auto b = FFTPlan::cached(720, {FFTDirection::Inverse, FFTNorm::ByN});
+    EXPECT_EQ(a.backend(), b.backend());
+    EXPECT_TRUE(a.isInverse());
+    EXPECT_EQ(a.size(), 720u);
+}
+
 // ═════════════════════════════════════════════════════════════════════════════
 // rfft / irfft
 // ═════════════════════════════════════════════════════════════════════════════
@@ -462,6 +791,59 @@ TEST(RFFTTest, HermitianSymmetry) {
     }
 }
 
+TEST(RealFFTPlanTest, MatchesComplexFFT) {
+    // Even sizes take the N/2 packed path (incl. N = 2 and odd N/2), odd
+    // sizes the full-transform fallback.
+    for (size_t N : {1u, 2u, 4u, 6u, 10u, 64u, 96u, 127u, 1000u, 1536u, 1018u}) {
+        std::vector<double> x(N);
+        for (size_t i = 0; i < N; ++i)
+            x[i] = std::cos(0.3 * static_cast<double>(i)) + 0.1 * static_cast<double>(i % 5);
+        std::vector<cx> full(x.begin(), x.end());
+        fft(full);
+
+        std::vector<cx> bins;
+        RealFFTPlan::create(N).execute(x, bins);
+        ASSERT_EQ(bins.size(), N / 2 + 1);
+        full.resize(N / 2 + 1);
+        EXPECT_LT(maxErr(bins, full), 1e-9) << "N=" << N;
+
+        std::vector<double> back;
+        RealFFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::ByN}).execute(bins, back);
+        ASSERT_EQ(back.size(), N);
+        for (size_t i = 0; i < N; ++i) EXPECT_NEAR(back[i], x[i], 1e-10) << "N=" << N;
+    }
+}
+
+TEST(RealFFTPlanTest, NormalizationAndDirectionChecks) {
+    const size_t N = 256;
+    std::vector<double> x(N);
+    for (size_t i = 0; i < N; ++i) x[i] = std::sin(2.0 * M_PI * 9 * i / N);
+    std::vector<cx> a, b;
+    RealFFTPlan::create(N).execute(x, a);
+    RealFFTPlan::create(N, {FFTDirection::Forward, FFTNorm::BySqrtN}).execute(x, b);
+    for (size_t k = 0; k < a.size(); ++k)
+        EXPECT_NEAR(std::abs(a[k] / std::sqrt(256.0) - b[k]), 0.0, kTight);
+
+    const auto fwd = RealFFTPlan::create(N);
+    const auto inv = RealFFTPlan::create(N, {FFTDirection::Inverse, FFTNorm::ByN});
+    std::vector<double> y;
+    EXPECT_THROW(fwd.execute(a, y), std::logic_error);
+    EXPECT_THROW(inv.execute(x, a), std::logic_error);
+    EXPECT_THROW(fwd.execute(std::vector<double>(N + 1), a), std::invalid_argument);
+    EXPECT_THROW(RealFFTPlan::create(0), std::invalid_argument);
+}
+
+TEST(RealFFTPlanTest, CachedPlansShareTheComplexPlan) {
+    FFTPlanCache cache;
+    auto a = cache.getReal(512);
+    auto b = cache.getReal(512);
+    EXPECT_EQ(cache.size(), 2u);        // the real plan and its N/2 complex plan
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(a.size(), 512u);
+    EXPECT_EQ(b.bins(), 257u);
+    EXPECT_EQ(cache.get(256).backend(), cache.get(256).backend());
+}
+
 // ═════════════════════════════════════════════════════════════════════════════
 // convolve
 // ═════════════════════════════════════════════════════════════════════════════
@@ -2,6 +2,8 @@
 #include "LinearAlgebra/IterativeSolvers.h"
 #include "LinearAlgebra/MatrixFunctions.h"
 #include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/LinearOperator.h"
+#include "LinearAlgebra/SparseMatrix.h"
 #include "LinearAlgebra/Tensor.h"
 
 #include <cmath>
@@ -120,6 +122,139 @@ TEST(LSQR, DimMismatchThrows) {
     EXPECT_THROW(lsqr(A, {1.0, 2.0}), std::invalid_argument);
 }
 
+// ════════════════════════════════════════════════════════════════════════════
+// Sparse and matrix-free operators
+// ════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+// 1-D Poisson matrix tridiag(-1, 4, -1): SPD and diagonally dominant.
+SparseMatrix poisson1d(size_t n) {
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < n; ++i) {
+        ri.push_back(i); ci.push_back(i); vals.push_back(4.0);
+        if (i + 1 < n) { ri.push_back(i); ci.push_back(i + 1); vals.push_back(-1.0); }
+        if (i > 0)     { ri.push_back(i); ci.push_back(i - 1); vals.push_back(-1.0); }
+    }
+    return SparseMatrix::from_triplets(n, n, ri, ci, vals);
+}
+
+double residual(const LinearOperator& A, const std::vector<double>& x,
+                const std::vector<double>& b) {
+    std::vector<double> Ax(A.rows());
+    A.apply(x, Ax);
+    double s = 0.0;
+    for (size_t i = 0; i < b.size(); ++i) s += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+    return std::sqrt(s);
+}
+
+} // namespace
+
+TEST(SparseKrylov, LargeSparseSystemAllSolvers) {
+    // 20 000 unknowns: a dense copy would need 3.2 GB, CSR needs ~1 MB.
+    const size_t n = 20000;
+    SparseMatrix A = poisson1d(n);
+    SparseOperator op(A);
+    std::vector<double> b(n, 1.0);
+
+    EXPECT_LT(residual(op, cg(A, b),       b), kTol);
+    EXPECT_LT(residual(op, minres(A, b),   b), kTol);
+    EXPECT_LT(residual(op, bicgstab(A, b), b), kTol);
+    EXPECT_LT(residual(op, gmres(A, b, {}, 1e-10, 1000, 30), b), kTol);
+}
+
+TEST(SparseKrylov, MinresSymmetricIndefinite) {
+    // Eigenvalues of both signs: CG is not applicable, MINRES is.
+    DynamicMatrix A(3, 3, {2.0,  1.0,  0.0,
+                           1.0, -3.0,  1.0,
+                           0.0,  1.0,  1.0});
+    std::vector<double> b = {1.0, 2.0, 3.0};
+    auto x = minres(A, b);
+    EXPECT_LT(residual(DenseOperator(A), x, b), kTol);
+}
+
+TEST(SparseKrylov, SparseMatchesDense) {
+    const size_t n = 40;
+    SparseMatrix S = poisson1d(n);
+    DynamicMatrix D = S.to_dense();
+    std::vector<double> b(n);
+    for (size_t i = 0; i < n; ++i) b[i] = std::sin(0.3 * i);
+
+    auto xs = cg(S, b), xd = cg(D, b);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(xs[i], xd[i], 1e-10);
+}
+
+TEST(SparseKrylov, TransposeProductsAgree) {
+    // Rectangular 3×4 matrix; A^T·x through the CSR, dense and generic paths.
+    DynamicMatrix D(3, 4, {1, 0, 2, 0,
+                           0, 3, 0, 4,
+                           5, 0, 0, 6});
+    SparseMatrix S = SparseMatrix::from_dense(D);
+    std::vector<double> x = {1.0, -2.0, 0.5};
+    std::vector<double> ys(4), yd(4);
+    SparseOperator(S).applyTranspose(x, ys);
+    DenseOperator(D).applyTranspose(x, yd);
+    const std::vector<double> expected = {3.5, -6.0, 2.0, -5.0};
+    for (size_t j = 0; j < 4; ++j) {
+        EXPECT_DOUBLE_EQ(ys[j], expected[j]);
+        EXPECT_DOUBLE_EQ(yd[j], expected[j]);
+    }
+}
+
+TEST(SparseKrylov, LsqrOnSparseOverdetermined) {
+    // Stack the Poisson matrix on top of the identity: 2n×n least squares.
+    const size_t n = 500;
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < n; ++i) {
+        ri.push_back(i); ci.push_back(i); vals.push_back(4.0);
+        if (i + 1 < n) { ri.push_back(i); ci.push_back(i + 1); vals.push_back(-1.0); }
+        if (i > 0)     { ri.push_back(i); ci.push_back(i - 1); vals.push_back(-1.0); }
+        ri.push_back(n + i); ci.push_back(i); vals.push_back(1.0);
+    }
+    SparseMatrix A = SparseMatrix::from_triplets(2 * n, n, ri, ci, vals);
+
+    // b = A·x_true is consistent, so LSQR must recover x_true.
+    std::vector<double> x_true(n), b(2 * n);
+    for (size_t i = 0; i < n; ++i) x_true[i] = std::cos(0.01 * i);
+    SparseOperator(A).apply(x_true, b);
+
+    auto x = lsqr(A, b, 1e-12, 5000);
+    ASSERT_EQ(x.size(), n);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_true[i], 1e-6);
+}
+
+TEST(SparseKrylov, MatrixFreeOperator) {
+    // Same Poisson operator, never stored: y_i = 4x_i - x_{i-1} - x_{i+1}.
+    const size_t n = 1000;
+    size_t calls = 0;
+    FunctionOperator op(n, n, [&](const std::vector<double>& x, std::vector<double>& y) {
+        ++calls;
+        for (size_t i = 0; i < n; ++i)
+            y[i] = 4.0 * x[i] - (i > 0 ? x[i - 1] : 0.0) - (i + 1 < n ? x[i + 1] : 0.0);
+    });
+    std::vector<double> b(n, 1.0);
+
+    auto x = cg(op, b);
+    EXPECT_GT(calls, 0u);
+    EXPECT_LT(residual(op, x, b), kTol);
+
+    auto xg = gmres(op, b);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(xg[i], x[i], 1e-8);
+}
+
+TEST(SparseKrylov, LsqrWithoutTransposeThrows) {
+    FunctionOperator op(3, 3, [](const std::vector<double>& x, std::vector<double>& y) {
+        y = x;
+    });
+    EXPECT_FALSE(op.hasTranspose());
+    EXPECT_THROW(lsqr(op, {1.0, 2.0, 3.0}), std::invalid_argument);
+
+    std::vector<double> y(3);
+    EXPECT_THROW(op.applyTranspose({1.0, 2.0, 3.0}, y), std::logic_error);
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // CPU fallback when CUDA is unavailable
 // ════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Expr.h"
+#include "core/ThreadPool.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+std::vector<double> randomVec(size_t n, unsigned seed, double lo = -1.0) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(lo, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(gen);
+    return v;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Tensor expressions
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(LazyExpr, TensorChainMatchesEagerBitwise) {
+    const size_t n = 1000;
+    Tensor m({10, 100}, randomVec(n, 1));
+    Tensor v({10, 100}, randomVec(n, 2, 0.0));
+    const double eps = 1e-8, lr = 1e-3;
+
+    Tensor eager = (m / (v.sqrt() + eps)) * lr;
+    Tensor fused = ((lazy(m) / (lazy(v).sqrt() + eps)) * lr).eval();
+
+    ASSERT_EQ(fused.shape(), eager.shape());
+    for (size_t i = 0; i < n; ++i) ASSERT_EQ(fused.flat(i), eager.flat(i)) << i;
+}
+
+TEST(LazyExpr, TensorBroadcastMatchesEager) {
+    Tensor a({4, 1, 5}, randomVec(20, 3));
+    Tensor b({3, 1}, randomVec(3, 4));
+    Tensor c({5}, randomVec(5, 5));
+
+    Tensor eager = a * b - c * 2.0;
+    Tensor fused = (lazy(a) * lazy(b) - lazy(c) * 2.0).eval();
+
+    ASSERT_EQ(fused.shape(), (Tensor::Shape{4, 3, 5}));
+    for (size_t i = 0; i < eager.size(); ++i)
+        ASSERT_DOUBLE_EQ(fused.flat(i), eager.flat(i)) << i;
+}
+
+TEST(LazyExpr, UnaryAndMap) {
+    Tensor x({6}, {-3.0, -1.5, 0.0, 0.5, 2.0, 4.0});
+    Tensor r = (-lazy(x).abs().map([](double t) { return t + 1.0; })).eval();
+    for (size_t i = 0; i < 6; ++i)
+        EXPECT_DOUBLE_EQ(r.flat(i), -(std::abs(x.flat(i)) + 1.0));
+
+    Tensor s = (2.0 - lazy(x).square() / 4.0).eval();
+    for (size_t i = 0; i < 6; ++i)
+        EXPECT_DOUBLE_EQ(s.flat(i), 2.0 - x.flat(i) * x.flat(i) / 4.0);
+}
+
+TEST(LazyExpr, AssignInPlaceReusesStorage) {
+    Tensor w({3, 4}, randomVec(12, 6));
+    Tensor g({3, 4}, randomVec(12, 7));
+    Tensor expected = w - g * 0.5;
+
+    const double* before = w.data().data();
+    assign(w, lazy(w) - lazy(g) * 0.5);
+    EXPECT_EQ(w.data().data(), before);
+    for (size_t i = 0; i < 12; ++i) EXPECT_DOUBLE_EQ(w.flat(i), expected.flat(i));
+}
+
+TEST(LazyExpr, AssignReshapesDestination) {
+    Tensor row({1, 4}, {1, 2, 3, 4});
+    Tensor col({3, 1}, {10, 20, 30});
+    Tensor out;
+    assign(out, lazy(row) + lazy(col));
+    ASSERT_EQ(out.shape(), (Tensor::Shape{3, 4}));
+    EXPECT_DOUBLE_EQ(out.flat(0), 11.0);
+    EXPECT_DOUBLE_EQ(out.flat(11), 34.0);
+}
+
+TEST(LazyExpr, IncompatibleShapesThrow) {
+    Tensor a({2, 3}), b({4});
+    EXPECT_THROW((lazy(a) + lazy(b)).eval(), std::invalid_argument);
+}
+
+TEST(LazyExpr, LargeOutputMatchesSingleThread) {
+    using SharedMath::Core::ThreadPool;
+    const size_t rows = 300, cols = 700;
+    Tensor a({rows, cols}, randomVec(rows * cols, 8));
+    Tensor b({cols}, randomVec(cols, 9));
+
+    ThreadPool::setNumThreads(4);
+    Tensor dense4 = (lazy(a) * 3.0 + lazy(a).exp()).eval();
+    Tensor bcast4 = (lazy(a) - lazy(b)).eval();
+    ThreadPool::setNumThreads(1);
+    Tensor dense1 = (lazy(a) * 3.0 + lazy(a).exp()).eval();
+    Tensor bcast1 = (lazy(a) - lazy(b)).eval();
+    ThreadPool::setNumThreads(0);
+
+    for (size_t i = 0; i < rows * cols; ++i) {
+        ASSERT_EQ(dense4.flat(i), dense1.flat(i)) << i;
+        ASSERT_EQ(bcast4.flat(i), bcast1.flat(i)) << i;
+        ASSERT_EQ(bcast4.flat(i), a.flat(i) - b.flat(i % cols)) << i;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// DynamicMatrix expressions
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(LazyExpr, DynamicMatrixChain) {
+    DynamicMatrix A(5, 7, randomVec(35, 10));
+    DynamicMatrix B(5, 7, randomVec(35, 11));
+    DynamicMatrix C(5, 7, randomVec(35, 12));
+    const double s = 1.75;
+
+    DynamicMatrix eager = A + B * s - C;
+    DynamicMatrix fused = (lazy(A) + lazy(B) * s - lazy(C)).eval();
+
+    ASSERT_EQ(fused.rows(), 5u);
+    ASSERT_EQ(fused.cols(), 7u);
+    for (size_t i = 0; i < 35; ++i) EXPECT_EQ(fused.flat(i), eager.flat(i));
+
+    DynamicMatrix A0 = A;
+    assign(A, lazy(A) * 2.0 - lazy(C));
+    for (size_t i = 0; i < 35; ++i)
+        EXPECT_DOUBLE_EQ(A.flat(i), A0.flat(i) * 2.0 - C.flat(i));
+}
+
+TEST(LazyExpr, DynamicMatrixDoesNotBroadcast) {
+    DynamicMatrix A(3, 4), B(1, 4);
+    EXPECT_THROW((lazy(A) + lazy(B)).eval(), std::invalid_argument);
+}
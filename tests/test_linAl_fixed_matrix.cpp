@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Matrix.h"
+#include "LinearAlgebra/MatrixBatch.h"
+#include "LinearAlgebra/Gemm.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+template<size_t R, size_t C>
+Matrix<R, C> randomMatrix(unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix<R, C> m;
+    for (size_t i = 0; i < R; ++i)
+        for (size_t j = 0; j < C; ++j) m(i, j) = dist(gen);
+    return m;
+}
+
+// Plain triple loop through the checked accessor, as reference.
+template<size_t R, size_t K, size_t C>
+Matrix<R, C> referenceProduct(const Matrix<R, K>& A, const Matrix<K, C>& B) {
+    Matrix<R, C> out;
+    for (size_t i = 0; i < R; ++i)
+        for (size_t j = 0; j < C; ++j) {
+            double s = 0.0;
+            for (size_t k = 0; k < K; ++k) s += A(i, k) * B(k, j);
+            out(i, j) = s;
+        }
+    return out;
+}
+
+template<size_t R, size_t C>
+double maxAbsDiff(const Matrix<R, C>& A, const Matrix<R, C>& B) {
+    double d = 0.0;
+    for (size_t i = 0; i < R; ++i)
+        for (size_t j = 0; j < C; ++j) d = std::max(d, std::abs(A(i, j) - B(i, j)));
+    return d;
+}
+
+// Diagonally dominant, so well away from singular.
+template<size_t N>
+Matrix<N, N> wellConditioned(unsigned seed) {
+    Matrix<N, N> m = randomMatrix<N, N>(seed);
+    for (size_t i = 0; i < N; ++i) m(i, i) += static_cast<double>(N);
+    return m;
+}
+
+// M in the top-left corner of a 5×5 identity; same determinant as M.
+template<size_t N>
+Matrix<5, 5> embedInIdentity(const Matrix<N, N>& M) {
+    Matrix<5, 5> big = Matrix<5, 5>::identity();
+    for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j) big(i, j) = M(i, j);
+    return big;
+}
+
+constexpr Matrix<3, 3> kRotate90Translate = {
+    {0.0, -1.0, 5.0},
+    {1.0,  0.0, 7.0},
+    {0.0,  0.0, 1.0}
+};
+
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// Compile-time evaluation
+// ────────────────────────────────────────────────────────────────────────────
+
+static_assert(Vector<3>{1.0, 2.0, 3.0}.dot(Vector<3>{4.0, 5.0, 6.0}) == 32.0);
+static_assert(Vector<3>{1.0, 0.0, 0.0}.cross(Vector<3>{0.0, 1.0, 0.0}) == Vector<3>{0.0, 0.0, 1.0});
+static_assert(Matrix<2, 2>{{1.0, 2.0}, {3.0, 4.0}}.determinant() == -2.0);
+static_assert(Matrix<3, 3>::identity().mul(kRotate90Translate).at_unsafe(0, 2) == 5.0);
+static_assert(transformPoint(kRotate90Translate, Vector<2>{1.0, 0.0}) == Vector<2>{5.0, 8.0});
+static_assert(Matrix<2, 2>{{2.0, 0.0}, {0.0, 4.0}}.inverse().at_unsafe(1, 1) == 0.25);
+
+// ────────────────────────────────────────────────────────────────────────────
+// Products, determinant, inverse
+// ────────────────────────────────────────────────────────────────────────────
+
+TEST(FixedMatrixTest, UnrolledProductsMatchReference) {
+    const auto A2 = randomMatrix<2, 2>(1), B2 = randomMatrix<2, 2>(2);
+    const auto A3 = randomMatrix<3, 3>(3), B3 = randomMatrix<3, 3>(4);
+    const auto A4 = randomMatrix<4, 4>(5), B4 = randomMatrix<4, 4>(6);
+    const auto A6 = randomMatrix<6, 6>(7), B6 = randomMatrix<6, 6>(8);
+    const auto A = randomMatrix<3, 5>(9);
+    const auto B = randomMatrix<5, 2>(10);
+    const auto L = randomMatrix<8, 8>(11);   // larger than the unroll limit
+
+    EXPECT_LT(maxAbsDiff(A2.mul(B2), referenceProduct(A2, B2)), 1e-14);
+    EXPECT_LT(maxAbsDiff(A3.mul(B3), referenceProduct(A3, B3)), 1e-14);
+    EXPECT_LT(maxAbsDiff(A4.mul(B4), referenceProduct(A4, B4)), 1e-14);
+    EXPECT_LT(maxAbsDiff(A6.mul(B6), referenceProduct(A6, B6)), 1e-14);
+    EXPECT_LT(maxAbsDiff(A.mul(B), referenceProduct(A, B)), 1e-14);
+    EXPECT_LT(maxAbsDiff(L.mul(L), referenceProduct(L, L)), 1e-13);
+
+    Vector<6> v;
+    for (size_t i = 0; i < 6; ++i) v[i] = 0.5 * static_cast<double>(i) - 1.0;
+    const Vector<6> y = A6 * v;
+    for (size_t i = 0; i < 6; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j < 6; ++j) s += A6(i, j) * v[j];
+        EXPECT_NEAR(y[i], s, 1e-14);
+    }
+}
+
+TEST(FixedMatrixTest, DeterminantClosedFormsMatchElimination) {
+    // The elimination path (5×5) must agree with each closed form.
+    const auto M2 = randomMatrix<2, 2>(21);
+    const auto M3 = randomMatrix<3, 3>(22);
+    const auto M4 = randomMatrix<4, 4>(23);
+    EXPECT_NEAR(M2.determinant(), embedInIdentity(M2).determinant(), 1e-12);
+    EXPECT_NEAR(M3.determinant(), embedInIdentity(M3).determinant(), 1e-12);
+    EXPECT_NEAR(M4.determinant(), embedInIdentity(M4).determinant(), 1e-12);
+
+    const Matrix<4, 4> D = {{2, 0, 0, 0}, {0, 3, 0, 0}, {0, 0, 4, 0}, {0, 0, 0, 5}};
+    EXPECT_DOUBLE_EQ(D.determinant(), 120.0);
+
+    Matrix<4, 4> swapped = Matrix<4, 4>::identity();
+    std::swap(swapped[0], swapped[3]);
+    EXPECT_DOUBLE_EQ(swapped.determinant(), -1.0);
+}
+
+TEST(FixedMatrixTest, InverseRoundTrip) {
+    auto check = [](const auto& M, double tol) {
+        using Mat = std::decay_t<decltype(M)>;
+        const Mat I = Mat::identity();
+        EXPECT_LT(maxAbsDiff(M.mul(M.inverse()), I), tol);
+        EXPECT_LT(maxAbsDiff(M.inverse().mul(M), I), tol);
+    };
+    check(wellConditioned<2>(31), 1e-13);
+    check(wellConditioned<3>(32), 1e-13);
+    check(wellConditioned<4>(33), 1e-13);
+    check(wellConditioned<6>(34), 1e-12);
+}
+
+TEST(FixedMatrixTest, SingularInverseThrows) {
+    const Matrix<3, 3> rankTwo = {{1, 2, 3}, {2, 4, 6}, {0, 1, 1}};
+    EXPECT_EQ(rankTwo.determinant(), 0.0);
+    EXPECT_THROW(rankTwo.inverse(), std::runtime_error);
+    EXPECT_THROW((Matrix<4, 4>().inverse()), std::runtime_error);
+    EXPECT_THROW((Matrix<5, 5>().inverse()), std::runtime_error);
+}
+
+TEST(FixedMatrixTest, AccessorsAndTranspose) {
+    Matrix<2, 3> m = {{1, 2, 3}, {4, 5, 6}};
+    m.at_unsafe(1, 2) = 9.0;
+    EXPECT_EQ(m(1, 2), 9.0);
+    EXPECT_EQ(m.at(0, 1), 2.0);
+    EXPECT_THROW(m.at(2, 0), std::out_of_range);
+
+    const Matrix<3, 2> t = m.transposed();
+    EXPECT_EQ(t(2, 1), 9.0);
+    EXPECT_EQ(t(1, 0), 2.0);
+    EXPECT_DOUBLE_EQ((Matrix<3, 3>::identity().trace()), 3.0);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Homogeneous transforms
+// ────────────────────────────────────────────────────────────────────────────
+
+TEST(FixedMatrixTest, TransformPointVectorProject) {
+    const Matrix<4, 4> T = {{1, 0, 0, 10}, {0, 2, 0, 20}, {0, 0, 3, 30}, {0, 0, 0, 1}};
+    const Vector<3> p{1.0, 1.0, 1.0};
+    EXPECT_EQ(transformPoint(T, p), (Vector<3>{11.0, 22.0, 33.0}));
+    EXPECT_EQ(transformVector(T, p), (Vector<3>{1.0, 2.0, 3.0}));
+    EXPECT_EQ(projectPoint(T, p), transformPoint(T, p));
+
+    // w = z: perspective divide.
+    const Matrix<4, 4> P = {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 1, 0}};
+    const Vector<3> q = projectPoint(P, Vector<3>{2.0, 4.0, 2.0});
+    EXPECT_DOUBLE_EQ(q[0], 1.0);
+    EXPECT_DOUBLE_EQ(q[1], 2.0);
+    EXPECT_DOUBLE_EQ(q[2], 1.0);
+    EXPECT_THROW(projectPoint(P, Vector<3>{1.0, 1.0, 0.0}), std::runtime_error);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Structure-of-arrays batches
+// ────────────────────────────────────────────────────────────────────────────
+
+TEST(FixedMatrixTest, BatchesMatchPerPointOnAllKernels) {
+    constexpr size_t n = 37;   // not a multiple of the SIMD width
+    std::mt19937 gen(41);
+    std::uniform_real_distribution<double> dist(-5.0, 5.0);
+    std::vector<std::vector<double>> in(6, std::vector<double>(n));
+    for (auto& c : in) for (double& e : c) e = dist(gen);
+
+    const auto T3 = randomMatrix<4, 4>(42);
+    const auto T2 = randomMatrix<3, 3>(43);
+    const auto A6 = randomMatrix<6, 6>(44);
+    const auto A4 = randomMatrix<4, 4>(45);
+
+    const SimdLevel saved = gemmSimdLevel();
+    for (SimdLevel level : {SimdLevel::Scalar, gemmMaxSimdLevel()}) {
+        setGemmSimdLevel(level);
+        std::vector<std::vector<double>> out(6, std::vector<double>(n));
+
+        transformPointsBatch(T3, {in[0].data(), in[1].data(), in[2].data()},
+                             {out[0].data(), out[1].data(), out[2].data()}, n);
+        for (size_t p = 0; p < n; ++p) {
+            const Vector<3> r = transformPoint(T3, Vector<3>{in[0][p], in[1][p], in[2][p]});
+            for (size_t i = 0; i < 3; ++i) EXPECT_NEAR(out[i][p], r[i], 1e-12);
+        }
+
+        transformPointsBatch(T2, {in[0].data(), in[1].data()}, {out[0].data(), out[1].data()}, n);
+        for (size_t p = 0; p < n; ++p) {
+            const Vector<2> r = transformPoint(T2, Vector<2>{in[0][p], in[1][p]});
+            for (size_t i = 0; i < 2; ++i) EXPECT_NEAR(out[i][p], r[i], 1e-12);
+        }
+
+        PointsIn<6> src;
+        PointsOut<6> dst;
+        for (size_t j = 0; j < 6; ++j) { src[j] = in[j].data(); dst[j] = out[j].data(); }
+        applyBatch(A6, src, dst, n);
+        for (size_t p = 0; p < n; ++p) {
+            Vector<6> x;
+            for (size_t j = 0; j < 6; ++j) x[j] = in[j][p];
+            const Vector<6> r = A6 * x;
+            for (size_t i = 0; i < 6; ++i) EXPECT_NEAR(out[i][p], r[i], 1e-12);
+        }
+
+        // In place: output arrays are the input arrays.
+        std::vector<std::vector<double>> state(in.begin(), in.begin() + 4);
+        applyBatch(A4, {state[0].data(), state[1].data(), state[2].data(), state[3].data()},
+                   {state[0].data(), state[1].data(), state[2].data(), state[3].data()}, n);
+        for (size_t p = 0; p < n; ++p) {
+            const Vector<4> r = A4 * Vector<4>{in[0][p], in[1][p], in[2][p], in[3][p]};
+            for (size_t i = 0; i < 4; ++i) EXPECT_NEAR(state[i][p], r[i], 1e-12);
+        }
+    }
+    setGemmSimdLevel(saved);
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Gemm.h"
+#include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/Tensor.h"
+#include "LinearAlgebra/Matrix.h"
+#include "LinearAlgebra/MatrixOperations.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+std::vector<double> randomVec(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(gen);
+    return v;
+}
+
+// Reference: C = alpha * op(A) * op(B) + beta * C with plain triple loops.
+void referenceGemm(bool tA, bool tB, size_t M, size_t N, size_t K,
+                   double alpha, const std::vector<double>& A, size_t lda,
+                   const std::vector<double>& B, size_t ldb,
+                   double beta, std::vector<double>& C, size_t ldc) {
+    for (size_t i = 0; i < M; ++i)
+        for (size_t j = 0; j < N; ++j) {
+            double s = 0.0;
+            for (size_t p = 0; p < K; ++p) {
+                double a = tA ? A[p * lda + i] : A[i * lda + p];
+                double b = tB ? B[j * ldb + p] : B[p * ldb + j];
+                s += a * b;
+            }
+            C[i * ldc + j] = alpha * s + beta * C[i * ldc + j];
+        }
+}
+
+// Runs gemm for every SIMD level the host supports and compares with the
+// reference implementation.
+void checkAllLevels(bool tA, bool tB, size_t M, size_t N, size_t K,
+                    double alpha, double beta) {
+    const size_t lda = (tA ? M : K) + 3;   // padded leading dimensions
+    const size_t ldb = (tB ? K : N) + 1;
+    const size_t ldc = N + 2;
+    auto A  = randomVec((tA ? K : M) * lda, 1);
+    auto B  = randomVec((tB ? N : K) * ldb, 2);
+    auto C0 = randomVec(M * ldc, 3);
+
+    auto expected = C0;
+    referenceGemm(tA, tB, M, N, K, alpha, A, lda, B, ldb, beta, expected, ldc);
+
+    const SimdLevel saved = gemmSimdLevel();
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (setGemmSimdLevel(level) != level) continue;
+        auto C = C0;
+        gemm(tA ? Transpose::Yes : Transpose::No,
+             tB ? Transpose::Yes : Transpose::No,
+             M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < ldc; ++j) {
+                // Padding columns beyond N must be left untouched.
+                double want = j < N ? expected[i * ldc + j] : C0[i * ldc + j];
+                ASSERT_NEAR(C[i * ldc + j], want, 1e-10 * (1.0 + K))
+                    << "level=" << static_cast<int>(level)
+                    << " at (" << i << ", " << j << ")";
+            }
+    }
+    setGemmSimdLevel(saved);
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Raw gemm()
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Gemm, SmallNoTranspose) {
+    checkAllLevels(false, false, 5, 7, 3, 1.0, 0.0);
+}
+
+TEST(Gemm, BlockedEdgeTiles) {
+    // Dimensions chosen to leave partial MR/NR tiles and multiple KC blocks.
+    checkAllLevels(false, false, 131, 77, 413, 1.0, 0.0);
+}
+
+TEST(Gemm, TransposeFlags) {
+    checkAllLevels(true,  false, 67, 45, 89, 1.0, 0.0);
+    checkAllLevels(false, true,  67, 45, 89, 1.0, 0.0);
+    checkAllLevels(true,  true,  67, 45, 89, 1.0, 0.0);
+}
+
+TEST(Gemm, AlphaBeta) {
+    checkAllLevels(false, false, 50, 60, 70, -0.5, 2.0);
+    checkAllLevels(true,  true,  50, 60, 70,  3.0, 1.0);
+}
+
+TEST(Gemm, BetaZeroIgnoresNaN) {
+    std::vector<double> A = {1, 2, 3, 4};
+    std::vector<double> B = {5, 6, 7, 8};
+    std::vector<double> C(4, std::nan(""));
+    gemm(Transpose::No, Transpose::No, 2, 2, 2,
+         1.0, A.data(), 2, B.data(), 2, 0.0, C.data(), 2);
+    EXPECT_DOUBLE_EQ(C[0], 19.0);
+    EXPECT_DOUBLE_EQ(C[1], 22.0);
+    EXPECT_DOUBLE_EQ(C[2], 43.0);
+    EXPECT_DOUBLE_EQ(C[3], 50.0);
+}
+
+TEST(Gemm, ZeroInnerDimensionScalesC) {
+    std::vector<double> C = {1, 2, 3, 4};
+    gemm(Transpose::No, Transpose::No, 2, 2, 0,
+         1.0, nullptr, 1, nullptr, 2, 0.5, C.data(), 2);
+    EXPECT_DOUBLE_EQ(C[0], 0.5);
+    EXPECT_DOUBLE_EQ(C[3], 2.0);
+}
+
+TEST(Gemm, SinglePrecisionAllLevels) {
+    // Edge tiles for every float kernel (4x4, 6x16, 8x48) and two KC blocks.
+    const size_t M = 83, N = 101, K = 300, lda = K + 1, ldb = N + 2, ldc = N;
+    auto a = randomVec(M * lda, 8), b = randomVec(K * ldb, 9), c0 = randomVec(M * ldc, 10);
+    std::vector<float> A(a.begin(), a.end()), B(b.begin(), b.end());
+    std::vector<double> Ad(A.begin(), A.end()), Bd(B.begin(), B.end());
+    std::vector<double> expected(c0.begin(), c0.end());
+    for (double& x : expected) x = static_cast<float>(x);
+    referenceGemm(false, false, M, N, K, 0.5, Ad, lda, Bd, ldb, -1.0, expected, ldc);
+
+    const SimdLevel saved = gemmSimdLevel();
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (setGemmSimdLevel(level) != level) continue;
+        std::vector<float> C(c0.begin(), c0.end());
+        gemm(Transpose::No, Transpose::No, M, N, K,
+             0.5f, A.data(), lda, B.data(), ldb, -1.0f, C.data(), ldc);
+        for (size_t i = 0; i < M * N; ++i)
+            ASSERT_NEAR(C[i], expected[i], 1e-4)
+                << "level=" << static_cast<int>(level) << " at " << i;
+    }
+    setGemmSimdLevel(saved);
+}
+
+TEST(Gemm, SimdLevelIsClampedToHost) {
+    const SimdLevel saved = gemmSimdLevel();
+    SimdLevel got = setGemmSimdLevel(SimdLevel::AVX512);
+    EXPECT_LE(static_cast<int>(got), static_cast<int>(gemmMaxSimdLevel()));
+    EXPECT_EQ(setGemmSimdLevel(SimdLevel::Scalar), SimdLevel::Scalar);
+    setGemmSimdLevel(saved);
+}
+
+TEST(Gemm, SimdOverrideStaysWithGemm) {
+    // GEMM's own setting must not leak into the other SIMD kernels (FFT,
+    // MatrixBatch), which read the host level from Core.
+    namespace Core = SharedMath::Core;
+    const SimdLevel saved = gemmSimdLevel();
+    const SimdLevel core  = Core::simdLevel();
+    EXPECT_EQ(gemmMaxSimdLevel(), Core::hostSimdLevel());
+    setGemmSimdLevel(SimdLevel::Scalar);
+    EXPECT_EQ(Core::simdLevel(), core);
+    setGemmSimdLevel(saved);
+
+    EXPECT_EQ(Core::setSimdLevel(SimdLevel::AVX512), Core::hostSimdLevel());
+    EXPECT_EQ(Core::setSimdLevel(SimdLevel::Scalar), SimdLevel::Scalar);
+    EXPECT_EQ(gemmSimdLevel(), saved);
+    Core::setSimdLevel(core);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Entry points routed through gemm()
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Gemm, DynamicMatrixMultiplyMatchesReference) {
+    const size_t M = 97, K = 61, N = 83;
+    DynamicMatrix A(M, K, randomVec(M * K, 4));
+    DynamicMatrix B(K, N, randomVec(K * N, 5));
+    std::vector<double> expected(M * N, 0.0);
+    referenceGemm(false, false, M, N, K, 1.0, A.data(), K, B.data(), N,
+                  0.0, expected, N);
+    DynamicMatrix C = A * B;
+    ASSERT_EQ(C.rows(), M);
+    ASSERT_EQ(C.cols(), N);
+    for (size_t i = 0; i < M * N; ++i)
+        EXPECT_NEAR(C.flat(i), expected[i], 1e-10);
+}
+
+TEST(Gemm, TensorMatmulMatchesDynamicMatrix) {
+    const size_t M = 40, K = 50, N = 30;
+    auto a = randomVec(M * K, 6), b = randomVec(K * N, 7);
+    Tensor ta({M, K}, a), tb({K, N}, b);
+    DynamicMatrix da(M, K, a), db(K, N, b);
+    Tensor tc = ta.matmul(tb);
+    DynamicMatrix dc = da * db;
+    for (size_t i = 0; i < M * N; ++i)
+        EXPECT_NEAR(tc.flat(i), dc.flat(i), 1e-12);
+}
+
+TEST(Gemm, MultiplyStrategyGeneralPath) {
+    // Matrix<R,C> operands take the densifying path of MatrixMultiplyStrategy.
+    auto A = std::make_shared<Matrix<2, 3>>(Matrix<2, 3>{{1, 2, 3}, {4, 5, 6}});
+    auto B = std::make_shared<Matrix<3, 2>>(Matrix<3, 2>{{7, 8}, {9, 10}, {11, 12}});
+    MatrixOperations ops;
+    auto C = ops.multiply(A, B);
+    EXPECT_DOUBLE_EQ(C->get(0, 0), 58.0);
+    EXPECT_DOUBLE_EQ(C->get(0, 1), 64.0);
+    EXPECT_DOUBLE_EQ(C->get(1, 0), 139.0);
+    EXPECT_DOUBLE_EQ(C->get(1, 1), 154.0);
+}
@@ -94,6 +94,48 @@ TEST(DynamicMatrixTest, CopyConstructor) {
 }
 
 // Тесты для Matrix (шаблонной)
+TEST(DynamicMatrixTest, IntoKernelsReuseTheOutput) {
+    DynamicMatrix A(4, 3), B(3, 5), S(4, 3, 0.5);
+    for (size_t i = 0; i < 4; ++i)
+        for (size_t j = 0; j < 3; ++j) A(i, j) = double(i) - 0.5 * double(j);
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 5; ++j) B(i, j) = 0.25 * double(i + j);
+
+    DynamicMatrix C;
+    matmul_into(C, A, B);
+    const double* p = C.data().data();
+    EXPECT_EQ(C, A * B);
+    matmul_into(C, A, B, 2.0, 1.0);                 // C = 2AB + C = 3AB
+    DynamicMatrix want = A * B * 3.0;
+    for (size_t i = 0; i < C.size(); ++i) EXPECT_NEAR(C.flat(i), want.flat(i), 1e-14);
+    EXPECT_EQ(C.data().data(), p);
+
+    DynamicMatrix T;
+    transpose_into(T, A);
+    EXPECT_EQ(T.rows(), 3u);
+    EXPECT_DOUBLE_EQ(T(2, 3), A(3, 2));
+    add_into(T, A, S);
+    EXPECT_EQ(T, A + S);
+    sub_into(T, T, S);
+    EXPECT_EQ(T, A);
+    scale_into(T, T, -2.0);
+    EXPECT_EQ(T, A * -2.0);
+
+    DynamicMatrix Q = A * A.transposed();           // 4×4, then square in place
+    DynamicMatrix Q2 = Q * Q;
+    matmul_into(Q, Q, Q);
+    EXPECT_EQ(Q, Q2);
+
+    DynamicVector x(3, 1.0), y;
+    matvec_into(y, A, x);
+    EXPECT_DOUBLE_EQ(y[3], 3.0 * 3.0 - 0.5 * 3.0);
+    DynamicVector z(3, 2.0);
+    rmatvec_into(z, A, y, 1.0, 1.0);
+    EXPECT_DOUBLE_EQ(z[0], 2.0 + rmatvec(A, y)[0]);
+    EXPECT_THROW(matmul_into(C, A, A), std::invalid_argument);
+    EXPECT_THROW(matvec_into(y, B, x, 1.0, 1.0), std::invalid_argument);
+}
+
 TEST(MatrixTest, BasicCreation) {
     Matrix<3, 4> matrix;
     
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Gemm.h"
+#include "LinearAlgebra/LinearSolver.h"
+#include "LinearAlgebra/MatrixFunctions.h"
+#include "core/Memory.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+// Sizes are chosen to span several 96-wide panels plus a ragged edge.
+constexpr size_t kN = 301;
+
+DynamicMatrix randomMatrix(size_t m, size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    DynamicMatrix A(m, n);
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j) A(i, j) = dist(gen);
+    return A;
+}
+
+DynamicMatrix randomSPD(size_t n, unsigned seed) {
+    DynamicMatrix G = randomMatrix(n, n, seed);
+    DynamicMatrix A = G * G.transposed();
+    for (size_t i = 0; i < n; ++i) A(i, i) += static_cast<double>(n);
+    return A;
+}
+
+double maxAbsDiff(const DynamicMatrix& A, const DynamicMatrix& B) {
+    double d = 0.0;
+    for (size_t i = 0; i < A.rows(); ++i)
+        for (size_t j = 0; j < A.cols(); ++j) d = std::max(d, std::abs(A(i, j) - B(i, j)));
+    return d;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// TRSM
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Trsm, AllVariantsInvertTheProduct) {
+    const size_t m = 230, n = 170;
+    for (Side side : {Side::Left, Side::Right})
+    for (Triangle uplo : {Triangle::Lower, Triangle::Upper})
+    for (Transpose tr : {Transpose::No, Transpose::Yes})
+    for (Diagonal dg : {Diagonal::NonUnit, Diagonal::Unit}) {
+        const size_t k = side == Side::Left ? m : n;
+        // Well-conditioned triangle; the unused half holds junk that must be ignored.
+        DynamicMatrix A = randomMatrix(k, k, 1);
+        for (size_t i = 0; i < k; ++i) A(i, i) = 4.0 + std::abs(A(i, i));
+        DynamicMatrix T(k, k, 0.0);
+        for (size_t i = 0; i < k; ++i)
+            for (size_t j = 0; j < k; ++j) {
+                bool inTri = uplo == Triangle::Lower ? j < i : j > i;
+                if (inTri) T(i, j) = A(i, j) / k;
+                if (i == j) T(i, j) = dg == Diagonal::Unit ? 1.0 : A(i, i);
+                if (inTri) A(i, j) /= k;
+            }
+        DynamicMatrix opT = tr == Transpose::Yes ? T.transposed() : T;
+
+        const DynamicMatrix X = randomMatrix(m, n, 2);
+        DynamicMatrix B = side == Side::Left ? opT * X : X * opT;
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j) B(i, j) *= 2.0;    // alpha = 0.5 undoes this
+
+        trsm(side, uplo, tr, dg, m, n, 0.5, A.toPtr(), k, B.toPtr(), n);
+        EXPECT_LT(maxAbsDiff(B, X), 1e-10)
+            << "side=" << int(side) << " uplo=" << int(uplo)
+            << " trans=" << int(tr) << " diag=" << int(dg);
+    }
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Blocked factorizations
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(LinearSolverBlocked, LUSolvesMultipleRightHandSides) {
+    DynamicMatrix A = randomMatrix(kN, kN, 3);
+    DynamicMatrix X = randomMatrix(kN, 7, 4);
+    DynamicMatrix B = A * X;
+
+    LinearSolver sol = LinearSolver::lu(A);
+    EXPECT_LT(maxAbsDiff(sol.solve(B), X), 1e-9);
+
+    std::vector<double> b(kN);
+    for (size_t i = 0; i < kN; ++i) b[i] = B(i, 3);
+    auto x = sol.solve(b);
+    for (size_t i = 0; i < kN; ++i) EXPECT_NEAR(x[i], X(i, 3), 1e-9);
+
+    EXPECT_LT(maxAbsDiff(sol.inverse() * A, DynamicMatrix::eye(kN)), 1e-9);
+}
+
+TEST(LinearSolverBlocked, LUDeterminantAndPivoting) {
+    // Zero leading pivot forces a row swap in the first panel.
+    DynamicMatrix P(3, 3, std::vector<double>{0, 2, 1,  1, 1, 1,  2, 1, 3});
+    EXPECT_NEAR(LinearSolver::lu(P).determinant(), det(P), 1e-12);
+
+    DynamicMatrix A = randomMatrix(150, 150, 5);
+    EXPECT_NEAR(LinearSolver::lu(A).determinant() / det(A), 1.0, 1e-8);
+
+    DynamicMatrix S(kN, kN, 1.0);   // rank one
+    EXPECT_THROW(LinearSolver::lu(S), std::runtime_error);
+}
+
+TEST(LinearSolverBlocked, QRLeastSquares) {
+    const size_t m = 420, n = 260;
+    DynamicMatrix A = randomMatrix(m, n, 6);
+    DynamicMatrix B = randomMatrix(m, 3, 7);
+    LinearSolver sol = LinearSolver::qr(A);
+    DynamicMatrix X = sol.solve(B);
+    ASSERT_EQ(X.rows(), n);
+
+    // Normal equations: Aᵀ(AX − B) = 0
+    DynamicMatrix G = A.transposed() * (A * X - B);
+    EXPECT_LT(maxAbsDiff(G, DynamicMatrix(n, 3, 0.0)), 1e-9);
+
+    // Consistent system is solved exactly
+    DynamicMatrix Xt = randomMatrix(n, 2, 8);
+    EXPECT_LT(maxAbsDiff(sol.solve(A * Xt), Xt), 1e-9);
+    EXPECT_EQ(sol.rank(), n);
+}
+
+TEST(LinearSolverBlocked, QRFactorsReconstruct) {
+    const size_t m = 700, n = 230;          // tall panels split recursively
+    DynamicMatrix A = randomMatrix(m, n, 16);
+    LinearSolver sol = LinearSolver::qr(A);
+    DynamicMatrix R = sol.r_factor();
+    ASSERT_EQ(R.rows(), n);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < i; ++j) ASSERT_EQ(R(i, j), 0.0);
+
+    DynamicMatrix QR(m, n, 0.0);
+    std::copy(R.toPtr(), R.toPtr() + n * n, QR.toPtr());
+    sol.apply_q(QR, /*transpose=*/false);
+    EXPECT_LT(maxAbsDiff(QR, A), 1e-11);
+
+    DynamicMatrix QtA = A;
+    sol.apply_q(QtA, /*transpose=*/true);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j) EXPECT_NEAR(QtA(i, j), R(i, j), 1e-11);
+
+    EXPECT_THROW(LinearSolver::lu(randomMatrix(4, 4, 1)).r_factor(), std::logic_error);
+}
+
+TEST(LinearSolverBlocked, QRScratchStaysBoundedOnTallMatrix) {
+    // The factorization's workspace comes from the calling thread's arena;
+    // every recursion level must give its V/T/W back, so the arena ends up
+    // holding a few panels' worth (m·kBlock doubles each) whatever the
+    // number of panels.  A fresh thread starts from an empty arena.
+    const size_t m = 2000, n = 960, kBlock = 96;
+    DynamicMatrix A = randomMatrix(m, n, 21);
+    size_t capacity = 0, used = 0;
+    std::thread([&] {
+        LinearSolver::qr(A);
+        capacity = SharedMath::Core::threadLocalArena().capacity();
+        used     = SharedMath::Core::threadLocalArena().used();
+    }).join();
+    EXPECT_EQ(used, 0u);
+    EXPECT_LT(capacity, 8 * m * kBlock * sizeof(double));
+}
+
+TEST(LinearSolverBlocked, QRDeterminantMatchesLU) {
+    DynamicMatrix A = randomMatrix(200, 200, 9);
+    double dq = LinearSolver::qr(A).determinant();
+    double dl = LinearSolver::lu(A).determinant();
+    EXPECT_NEAR(dq / dl, 1.0, 1e-8);
+    EXPECT_THROW(LinearSolver::qr(randomMatrix(5, 3, 1)).determinant(), std::invalid_argument);
+}
+
+TEST(LinearSolverBlocked, QRUnderdeterminedGivesExactSolution) {
+    DynamicMatrix A = randomMatrix(120, 200, 10);
+    std::vector<double> b(120);
+    for (size_t i = 0; i < b.size(); ++i) b[i] = std::sin(0.1 * i);
+    auto x = LinearSolver::qr(A).solve(b);
+    ASSERT_EQ(x.size(), 200u);
+    for (size_t i = 0; i < 120; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j < 200; ++j) s += A(i, j) * x[j];
+        EXPECT_NEAR(s, b[i], 1e-9);
+    }
+}
+
+TEST(LinearSolverBlocked, CholeskyFactorAndSolve) {
+    DynamicMatrix A = randomSPD(kN, 11);
+    DynamicMatrix L = cholesky(A);
+    for (size_t i = 0; i < kN; ++i)
+        for (size_t j = i + 1; j < kN; ++j) ASSERT_EQ(L(i, j), 0.0);
+    EXPECT_LT(maxAbsDiff(L * L.transposed(), A), 1e-9);
+
+    LinearSolver sol(A);
+    EXPECT_EQ(sol.method(), LinearSolver::Method::Cholesky);
+    DynamicMatrix X = randomMatrix(kN, 4, 12);
+    EXPECT_LT(maxAbsDiff(sol.solve(A * X), X), 1e-9);
+
+    DynamicMatrix S = randomSPD(40, 15);
+    EXPECT_NEAR(LinearSolver::cholesky(S).determinant() / det(S), 1.0, 1e-9);
+}
+
+TEST(LinearSolverBlocked, AutoFallsBackToLUForIndefinite) {
+    DynamicMatrix A = randomSPD(kN, 13);
+    for (size_t i = 0; i < kN; ++i) A(i, i) -= 2.0 * kN;   // symmetric, indefinite
+    EXPECT_FALSE(isPositiveDefinite(A));
+    LinearSolver sol(A);
+    EXPECT_EQ(sol.method(), LinearSolver::Method::LU);
+    EXPECT_THROW(LinearSolver::cholesky(A), std::runtime_error);
+
+    DynamicMatrix X = randomMatrix(kN, 2, 14);
+    EXPECT_LT(maxAbsDiff(sol.solve(A * X), X), 1e-8);
+}
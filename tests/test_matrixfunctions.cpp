@@ -498,6 +498,69 @@ TEST(Eigenvalues, Identity) {
     for (double v : vals) EXPECT_NEAR(v, 1.0, kLoose);
 }
 
+// Symmetric test matrix Q·diag(spec)·Qᵀ with a random orthogonal Q.
+static DynamicMatrix symmetricWithSpectrum(const std::vector<double>& spec, unsigned seed) {
+    const size_t n = spec.size();
+    DynamicMatrix G(n, n);
+    unsigned state = seed;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            state = state * 1103515245u + 12345u;
+            G(i, j) = static_cast<double>((state >> 8) % 2001) / 1000.0 - 1.0;
+        }
+    DynamicMatrix Q = qr(G).first;
+    return Q * diag(spec) * Q.transposed();
+}
+
+TEST(Eigenvalues, LargeSymmetricResidualAndOrthogonality) {
+    const size_t n = 230;
+    std::vector<double> spec(n);
+    for (size_t i = 0; i < n; ++i) spec[i] = std::cos(0.37 * i) * (1.0 + i);
+    DynamicMatrix A = symmetricWithSpectrum(spec, 7);
+
+    auto [vals, V] = eig(A);
+    std::sort(spec.begin(), spec.end(), std::greater<double>());
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(vals[i], spec[i], 1e-8);
+
+    expectMatrixNear(V.transposed() * V, eye(n), 1e-10);
+    expectMatrixNear(A * V, V * diag(vals), 1e-8);
+
+    auto only = eigvals(A);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(only[i], vals[i], 1e-9);
+}
+
+TEST(Eigenvalues, TopKMatchesFullDecomposition) {
+    const size_t n = 180;
+    std::vector<double> spec(n);
+    for (size_t i = 0; i < n; ++i) spec[i] = 1.0 / (1.0 + i);
+    // Two exactly repeated eigenvalues at the top exercise the cluster path.
+    spec[3] = spec[2];
+    DynamicMatrix A = symmetricWithSpectrum(spec, 11);
+
+    auto [vals, V] = eigs(A, 6);
+    ASSERT_EQ(vals.size(), 6u);
+    ASSERT_EQ(V.cols(), 6u);
+    for (size_t i = 0; i < 6; ++i) EXPECT_NEAR(vals[i], spec[i], 1e-10);
+    expectMatrixNear(V.transposed() * V, eye(6), 1e-9);
+    expectMatrixNear(A * V, V * diag(vals), 1e-9);
+
+    EXPECT_THROW(eigs(A, n + 1), std::invalid_argument);
+}
+
+TEST(Eigenvalues, AlreadyTridiagonalAndTiny) {
+    DynamicMatrix T(4, 4, 0.0);
+    for (size_t i = 0; i < 4; ++i) T(i, i) = 2.0;
+    for (size_t i = 0; i + 1 < 4; ++i) T(i, i + 1) = T(i + 1, i) = -1.0;
+    auto [vals, V] = eig(T);
+    for (size_t k = 0; k < 4; ++k)
+        EXPECT_NEAR(vals[k], 2.0 - 2.0 * std::cos((4.0 - k) * M_PI / 5.0), 1e-12);
+    expectMatrixNear(T * V, V * diag(vals), 1e-12);
+
+    auto one = eig(DynamicMatrix(1, 1, 5.0));
+    EXPECT_DOUBLE_EQ(one.first[0], 5.0);
+    EXPECT_DOUBLE_EQ(std::abs(one.second(0, 0)), 1.0);
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // SVD
 // ════════════════════════════════════════════════════════════════════════════
@@ -544,6 +607,83 @@ TEST(SVD, Reconstruction) {
     expectMatrixNear(Recon, A, kLoose);
 }
 
+// Deterministic m×n matrix with entries in [−1, 1]
+static DynamicMatrix lcgMatrix(size_t m, size_t n, unsigned seed) {
+    DynamicMatrix G(m, n);
+    unsigned state = seed;
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            state = state * 1103515245u + 12345u;
+            G(i, j) = static_cast<double>((state >> 8) % 2001) / 1000.0 - 1.0;
+        }
+    return G;
+}
+
+// Thin, full, right-only and values-only results agree and reconstruct A.
+static void expectSVD(const DynamicMatrix& A) {
+    const size_t m = A.rows(), n = A.cols(), k = std::min(m, n);
+    auto [U, S, Vt] = svd(A);
+    ASSERT_EQ(U.rows(), m);  ASSERT_EQ(U.cols(), k);
+    ASSERT_EQ(Vt.rows(), k); ASSERT_EQ(Vt.cols(), n);
+    for (size_t i = 0; i + 1 < k; ++i) EXPECT_GE(S[i], S[i + 1]);
+    expectMatrixNear(U * diag(S) * Vt, A, 1e-11);
+    expectMatrixNear(U.transposed() * U, eye(k), 1e-12);
+    expectMatrixNear(Vt * Vt.transposed(), eye(k), 1e-12);
+
+    auto vals = svdvals(A);
+    for (size_t i = 0; i < k; ++i) EXPECT_NEAR(vals[i], S[i], 1e-12);
+    auto [U0, S0, Vt0] = svd(A, SVDMode::RightOnly);
+    EXPECT_EQ(U0.rows(), 0u);
+    expectMatrixNear(Vt0, Vt, 1e-12);
+
+    auto [Uf, Sf, Vtf] = svd(A, SVDMode::Full);
+    ASSERT_EQ(Uf.rows(), m);  ASSERT_EQ(Uf.cols(), m);
+    ASSERT_EQ(Vtf.rows(), n); ASSERT_EQ(Vtf.cols(), n);
+    expectMatrixNear(Uf.transposed() * Uf, eye(m), 1e-12);
+    expectMatrixNear(Vtf * Vtf.transposed(), eye(n), 1e-12);
+    DynamicMatrix Sigma(m, n, 0.0);
+    for (size_t i = 0; i < k; ++i) Sigma(i, i) = Sf[i];
+    expectMatrixNear(Uf * Sigma * Vtf, A, 1e-11);
+}
+
+TEST(SVD, BidiagonalizationTallSquareWide) {
+    expectSVD(lcgMatrix(300, 70, 3));    // tall: QR first, then R
+    expectSVD(lcgMatrix(90, 70, 4));     // bidiagonalized directly
+    expectSVD(lcgMatrix(75, 75, 5));     // several 32-wide panels
+    expectSVD(lcgMatrix(40, 110, 6));    // wide: through Aᵀ
+}
+
+TEST(SVD, RankDeficientAndDegenerate) {
+    DynamicMatrix A = lcgMatrix(60, 40, 7);
+    for (size_t i = 0; i < 60; ++i) { A(i, 5) = 0.0; A(i, 17) = 2.0 * A(i, 3); }
+    expectSVD(A);
+    auto S = svdvals(A);
+    EXPECT_LT(S[38], 1e-12);
+    EXPECT_LT(S[39], 1e-12);
+    EXPECT_GT(S[37], 1e-3);
+
+    auto Z = svdvals(DynamicMatrix(4, 3, 0.0));
+    for (double s : Z) EXPECT_EQ(s, 0.0);
+    auto [U1, S1, Vt1] = svd(DynamicMatrix(1, 1, -3.0));
+    EXPECT_DOUBLE_EQ(S1[0], 3.0);
+    EXPECT_DOUBLE_EQ(U1(0, 0) * S1[0] * Vt1(0, 0), -3.0);
+}
+
+TEST(SVD, SmallSingularValuesAreNotSquaredAway) {
+    // σ = 1, 1e-1, …, 1e-11: through AᵀA everything below ~1e-8 is noise.
+    const size_t n = 12;
+    std::vector<double> s(n);
+    for (size_t i = 0; i < n; ++i) s[i] = std::pow(10.0, -static_cast<double>(i));
+    DynamicMatrix Q1 = qr(lcgMatrix(50, 50, 8)).first;
+    DynamicMatrix Q2 = qr(lcgMatrix(n, n, 9)).first;
+    DynamicMatrix Sigma(50, n, 0.0);
+    for (size_t i = 0; i < n; ++i) Sigma(i, i) = s[i];
+    DynamicMatrix A = Q1 * Sigma * Q2.transposed();
+
+    auto S = svdvals(A);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(S[i], s[i], 1e-14) << i;
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // pinv / lstsq
 // ════════════════════════════════════════════════════════════════════════════
@@ -709,6 +849,115 @@ TEST(Einsum2, ElementWiseSum) {
     EXPECT_NEAR(r.flat(0), 70.0, kEps);
 }
 
+// ════════════════════════════════════════════════════════════════════════════
+// einsum (planned contractions)
+// ════════════════════════════════════════════════════════════════════════════
+
+// Deterministic tensor with entries in [−1, 1]
+static Tensor lcgTensor(Tensor::Shape shape, unsigned seed) {
+    Tensor t(shape, 0.0);
+    unsigned state = seed;
+    for (size_t i = 0; i < t.size(); ++i) {
+        state = state * 1103515245u + 12345u;
+        t.flat(i) = static_cast<double>((state >> 8) % 2001) / 1000.0 - 1.0;
+    }
+    return t;
+}
+
+static void expectTensorNear(const Tensor& A, const Tensor& B, double tol = 1e-10) {
+    ASSERT_EQ(A.shape(), B.shape());
+    for (size_t i = 0; i < A.size(); ++i)
+        EXPECT_NEAR(A.flat(i), B.flat(i), tol) << "at flat " << i;
+}
+
+TEST(EinsumPlanned, BatchedMatmulLargeEnoughForGemm) {
+    const size_t nb = 3, n = 40, k = 50, m = 45;
+    Tensor A = lcgTensor({nb, n, k}, 1), B = lcgTensor({nb, k, m}, 2);
+    Tensor C = einsum("bij,bjk->bik", A, B);
+    Tensor ref({nb, n, m}, 0.0);
+    for (size_t b = 0; b < nb; ++b)
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < k; ++j)
+                for (size_t l = 0; l < m; ++l)
+                    ref(b, i, l) += A(b, i, j) * B(b, j, l);
+    expectTensorNear(C, ref);
+
+    // Same subscripts and shapes again (cached plan), transposed output.
+    Tensor Ct = einsum("bij,bjk->kbi", A, B);
+    expectTensorNear(Ct, ref.permute({2, 0, 1}).contiguous());
+}
+
+TEST(EinsumPlanned, TransposedOperandsAndStridedViews) {
+    Tensor A = lcgTensor({60, 50}, 3), B = lcgTensor({70, 60}, 4);
+    // "ji,kj->ik" needs both operands transposed; the views are strided.
+    Tensor C = einsum("ji,kj->ik", A, B);
+    Tensor ref = A.transpose().contiguous().matmul(B.transpose().contiguous());
+    expectTensorNear(C, ref);
+    expectTensorNear(einsum("ij,jk->ik", A.transpose(), B.transpose()), ref);
+}
+
+TEST(EinsumPlanned, ThreeOperandChainAndHadamard) {
+    Tensor A = lcgTensor({4, 30}, 5), B = lcgTensor({30, 20}, 6), C = lcgTensor({20, 3}, 7);
+    Tensor r = einsum("ij,jk,kl->il", {A, B, C});
+    expectTensorNear(r, A.matmul(B).matmul(C));
+
+    // Shared label kept in the output: elementwise product, then a sum.
+    Tensor x = lcgTensor({5, 6}, 8), y = lcgTensor({5, 6}, 9), z = lcgTensor({6}, 10);
+    Tensor h = einsum("ij,ij,j->i", {x, y, z});
+    ASSERT_EQ(h.shape(), (Tensor::Shape{5}));
+    for (size_t i = 0; i < 5; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j < 6; ++j) s += x(i, j) * y(i, j) * z(j);
+        EXPECT_NEAR(h(i), s, 1e-12);
+    }
+}
+
+TEST(EinsumPlanned, DiagonalsAndSingleOperandSums) {
+    Tensor A = lcgTensor({4, 3, 4}, 11);
+    Tensor d = einsum("iji->j", A);
+    ASSERT_EQ(d.shape(), (Tensor::Shape{3}));
+    for (size_t j = 0; j < 3; ++j) {
+        double s = 0.0;
+        for (size_t i = 0; i < 4; ++i) s += A(i, j, i);
+        EXPECT_NEAR(d(j), s, 1e-12);
+    }
+
+    Tensor B = lcgTensor({5, 5}, 12);
+    Tensor diag = einsum("ii->i", B);
+    for (size_t i = 0; i < 5; ++i) EXPECT_EQ(diag(i), B(i, i));
+    // Trace of a product without forming it
+    Tensor C = lcgTensor({5, 5}, 13);
+    Tensor BC = B.matmul(C);
+    double tr = 0.0;
+    for (size_t i = 0; i < 5; ++i) tr += BC(i, i);
+    EXPECT_NEAR(einsum("ij,ji->", B, C).flat(0), tr, 1e-12);
+}
+
+TEST(EinsumPlanned, TensordotMultipleAxes) {
+    Tensor a = lcgTensor({3, 4, 5}, 14), b = lcgTensor({5, 2, 4}, 15);
+    Tensor r = tensordot(a, b, {2, 1}, {0, 2});
+    ASSERT_EQ(r.shape(), (Tensor::Shape{3, 2}));
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t l = 0; l < 2; ++l) {
+            double s = 0.0;
+            for (size_t j = 0; j < 4; ++j)
+                for (size_t k = 0; k < 5; ++k) s += a(i, j, k) * b(k, l, j);
+            EXPECT_NEAR(r(i, l), s, 1e-12);
+        }
+}
+
+TEST(EinsumPlanned, Float32InputsAndErrors) {
+    Tensor A = lcgTensor({3, 4}, 16), B = lcgTensor({4, 2}, 17);
+    Tensor C = einsum("ij,jk->ik", A.astype(TensorDType::Float32), B.astype(TensorDType::Float32));
+    expectTensorNear(C, A.astype(TensorDType::Float32).astype(TensorDType::Float64)
+                         .matmul(B.astype(TensorDType::Float32).astype(TensorDType::Float64)));
+
+    EXPECT_THROW(einsum("ij,jk->ik", {A}), std::invalid_argument);
+    EXPECT_THROW(einsum("ij,jk->iz", A, B), std::invalid_argument);
+    EXPECT_THROW(einsum("ij,jk->ii", A, B), std::invalid_argument);
+    EXPECT_THROW(einsum("ij,ik->jk", A, B), std::invalid_argument);
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // det / trace / cond
 // ════════════════════════════════════════════════════════════════════════════
@@ -49,3 +49,33 @@ TEST(Trainer, FitsSimpleLinearRegressionWithMSE) {
     EXPECT_NEAR(model.weight().data().flat(0), 2.0, 0.2);
     EXPECT_NEAR(model.bias().data().flat(0), 1.0, 0.3);
 }
+
+TEST(Trainer, Float32ModelTrainsEndToEnd) {
+    using SharedMath::LinearAlgebra::TensorDType;
+    const Tensor X = Tensor::uniform({16, 4}, -1.0, 1.0, 7).astype(TensorDType::Float32);
+    const Tensor y = X.sum(1).reshape({16, 1});
+
+    Sequential model({std::make_shared<Linear>(4, 8),
+                      std::make_shared<LayerNorm>(8),
+                      std::make_shared<ReLU>(),
+                      std::make_shared<Linear>(8, 1)});
+    model.astype(TensorDType::Float32);
+    Adam opt(model.parameters(), 0.02);
+    MSELoss loss_fn;
+
+    double first = 0.0, last = 0.0;
+    for (int step = 0; step < 60; ++step) {
+        opt.zero_grad();
+        auto loss = loss_fn.forward(model.forward(AutoTensor::from(X)),
+                                    AutoTensor::from(y));
+        EXPECT_EQ(loss.data().dtype(), TensorDType::Float32);
+        (step == 0 ? first : last) = loss.data().sum();
+        loss.backward();
+        opt.step();
+    }
+    EXPECT_LT(last, 0.5 * first);
+    for (auto* p : model.parameters()) {
+        EXPECT_EQ(p->data().dtype(), TensorDType::Float32);
+        EXPECT_EQ(p->grad().dtype(), TensorDType::Float32);
+    }
+}
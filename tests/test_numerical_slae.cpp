@@ -3,9 +3,11 @@
 #include <vector>
 #include "NumericalMethods/SLAE.h"
 #include "LinearAlgebra/DynamicMatrix.h"
+#include "LinearAlgebra/SparseMatrix.h"
 
 using namespace SharedMath::NumericalMethods;
 using SharedMath::LinearAlgebra::DynamicMatrix;
+using SharedMath::LinearAlgebra::SparseMatrix;
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Test fixtures
@@ -238,6 +240,47 @@ TEST(GMRES, ResidualSmall) {
     EXPECT_LT(result.residual, 1e-7);
 }
 
+// ═════════════════════════════════════════════════════════════════════════════
+// Preconditioned CG / GMRES
+// ═════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    // Badly scaled 1-D diffusion: coefficients span six orders of magnitude.
+    SparseMatrix makeScaledDiffusion(size_t n) {
+        std::vector<size_t> ri, ci;
+        std::vector<double> vals;
+        // k(f) is the coefficient on the face between cells f-1 and f
+        auto k = [n](size_t f) { return std::pow(10.0, 6.0 * static_cast<double>(f) / n); };
+        for (size_t i = 0; i < n; ++i) {
+            ri.push_back(i); ci.push_back(i); vals.push_back(1.1 * (k(i) + k(i + 1)));
+            if (i > 0)     { ri.push_back(i); ci.push_back(i - 1); vals.push_back(-k(i)); }
+            if (i + 1 < n) { ri.push_back(i); ci.push_back(i + 1); vals.push_back(-k(i + 1)); }
+        }
+        return SparseMatrix::from_triplets(n, n, ri, ci, vals);
+    }
+}
+
+TEST(PreconditionedSLAE, JacobiCGConvergesFaster) {
+    SparseMatrix A = makeScaledDiffusion(300);
+    std::vector<double> b(300, 1.0);
+    auto plain = conjugate_gradient(A, b, {}, 1e-8);
+    auto pcg   = conjugate_gradient(A, b, SharedMath::LinearAlgebra::JacobiPreconditioner(A),
+                                    {}, 1e-8);
+    EXPECT_TRUE(pcg.converged);
+    EXPECT_LT(pcg.iterations, plain.iterations);
+    EXPECT_LT(pcg.residual, 1e-8);
+}
+
+TEST(PreconditionedSLAE, ILU0GMRESConvergesFaster) {
+    SparseMatrix A = makeScaledDiffusion(300);
+    std::vector<double> b(300, 1.0);
+    auto plain = gmres(A, b, 30, {}, 1e-8);
+    auto pgm   = gmres(A, b, SharedMath::LinearAlgebra::ILU0Preconditioner(A), 30, {}, 1e-8);
+    EXPECT_TRUE(pgm.converged);
+    EXPECT_LT(pgm.iterations, plain.iterations);
+    EXPECT_LT(pgm.residual, 1e-7);
+}
+
 // ═════════════════════════════════════════════════════════════════════════════
 // Cross-method consistency
 // ═════════════════════════════════════════════════════════════════════════════
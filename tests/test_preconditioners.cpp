@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/IterativeSolvers.h"
+#include "LinearAlgebra/Preconditioner.h"
+#include "LinearAlgebra/SparseMatrix.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+// 5-point finite-volume diffusion on an m×m grid with Dirichlet boundaries.
+// The coefficient jumps by `contrast` across x = 1/2, which makes the matrix
+// badly conditioned and badly scaled — the case preconditioners are for.
+// `convection` adds an upwinded x-velocity, making the matrix non-symmetric.
+SparseMatrix diffusion2d(size_t m, double contrast = 1.0, double convection = 0.0) {
+    auto k = [&](size_t i) { return i < m / 2 ? 1.0 : contrast; };
+    auto face = [](double a, double b) { return 2.0 * a * b / (a + b); };
+    const size_t n = m * m;
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    auto put = [&](size_t r, size_t c, double v) { ri.push_back(r); ci.push_back(c); vals.push_back(v); };
+
+    for (size_t y = 0; y < m; ++y) {
+        for (size_t x = 0; x < m; ++x) {
+            const size_t row = y * m + x;
+            const double kc = k(x);
+            double diag = 0.0;
+            // west / east neighbours (coefficient may jump), boundary faces use kc
+            double kw = x > 0     ? face(kc, k(x - 1)) : kc;
+            double ke = x + 1 < m ? face(kc, k(x + 1)) : kc;
+            double cw = kw + convection, ce = ke;
+            if (x > 0)     put(row, row - 1, -cw);
+            if (x + 1 < m) put(row, row + 1, -ce);
+            diag += cw + ce;
+            // south / north
+            if (y > 0)     put(row, row - m, -kc);
+            if (y + 1 < m) put(row, row + m, -kc);
+            diag += 2.0 * kc;
+            put(row, row, diag);
+        }
+    }
+    return SparseMatrix::from_triplets(n, n, ri, ci, vals);
+}
+
+SparseMatrix tridiag(size_t n, double lo, double d, double hi) {
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < n; ++i) {
+        ri.push_back(i); ci.push_back(i); vals.push_back(d);
+        if (i > 0)     { ri.push_back(i); ci.push_back(i - 1); vals.push_back(lo); }
+        if (i + 1 < n) { ri.push_back(i); ci.push_back(i + 1); vals.push_back(hi); }
+    }
+    return SparseMatrix::from_triplets(n, n, ri, ci, vals);
+}
+
+std::vector<double> ones(size_t n) { return std::vector<double>(n, 1.0); }
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Factorisations
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Preconditioner, IdentityCopies) {
+    IdentityPreconditioner I(3);
+    std::vector<double> z(3);
+    I.apply({1.0, -2.0, 3.0}, z);
+    EXPECT_EQ(z, (std::vector<double>{1.0, -2.0, 3.0}));
+}
+
+TEST(Preconditioner, JacobiScalesByDiagonal) {
+    SparseMatrix A = tridiag(4, -1.0, 4.0, -1.0);
+    JacobiPreconditioner J(A);
+    std::vector<double> z(4);
+    J.apply({4.0, 8.0, -4.0, 2.0}, z);
+    EXPECT_DOUBLE_EQ(z[0], 1.0);
+    EXPECT_DOUBLE_EQ(z[1], 2.0);
+    EXPECT_DOUBLE_EQ(z[2], -1.0);
+    EXPECT_DOUBLE_EQ(z[3], 0.5);
+
+    // Dense input takes the generic path
+    JacobiPreconditioner Jd(A.to_dense());
+    Jd.apply({4.0, 8.0, -4.0, 2.0}, z);
+    EXPECT_DOUBLE_EQ(z[1], 2.0);
+}
+
+TEST(Preconditioner, ILU0IsExactWithoutFill) {
+    // A tridiagonal LU has no fill-in, so ILU(0) is the exact factorisation.
+    SparseMatrix A = tridiag(50, -1.0, 3.0, -1.5);
+    ILU0Preconditioner M(A);
+    std::vector<double> r(50), z(50), Az(50);
+    for (size_t i = 0; i < 50; ++i) r[i] = std::sin(0.7 * i);
+    M.apply(r, z);
+    SparseOperator(A).apply(z, Az);
+    for (size_t i = 0; i < 50; ++i) EXPECT_NEAR(Az[i], r[i], 1e-12);
+}
+
+TEST(Preconditioner, IC0IsExactWithoutFill) {
+    SparseMatrix A = tridiag(50, -1.0, 2.5, -1.0);
+    IC0Preconditioner M(A);
+    std::vector<double> r(50), z(50), Az(50);
+    for (size_t i = 0; i < 50; ++i) r[i] = std::cos(0.3 * i);
+    M.apply(r, z);
+    SparseOperator(A).apply(z, Az);
+    for (size_t i = 0; i < 50; ++i) EXPECT_NEAR(Az[i], r[i], 1e-12);
+}
+
+TEST(Preconditioner, InvalidInputsThrow) {
+    SparseMatrix indefinite = tridiag(5, -1.0, -2.0, -1.0);
+    EXPECT_THROW(IC0Preconditioner{indefinite}, std::runtime_error);
+
+    SparseMatrix A = tridiag(5, -1.0, 2.0, -1.0);
+    EXPECT_THROW(SSORPreconditioner(A, 2.0), std::invalid_argument);
+    EXPECT_THROW(SSORPreconditioner(A, 0.0), std::invalid_argument);
+
+    SparseMatrix noDiag = SparseMatrix::from_triplets(2, 2, {0, 1}, {1, 0}, {1.0, 1.0});
+    EXPECT_THROW(JacobiPreconditioner{noDiag}, std::invalid_argument);
+    EXPECT_THROW(ILU0Preconditioner{noDiag}, std::invalid_argument);
+
+    EXPECT_THROW(JacobiPreconditioner{SparseMatrix(2, 3)}, std::invalid_argument);
+}
+
+TEST(Preconditioner, AMGBuildsHierarchy) {
+    SparseMatrix A = diffusion2d(48);
+    AMGPreconditioner M(A);
+    ASSERT_GT(M.levels(), 1u);
+    EXPECT_EQ(M.levelSize(0), A.rows());
+    for (size_t l = 1; l < M.levels(); ++l)
+        EXPECT_LT(M.levelSize(l), M.levelSize(l - 1));
+    EXPECT_LE(M.levelSize(M.levels() - 1), 64u);
+
+    // A tiny matrix is solved directly on a single level.
+    AMGPreconditioner small(tridiag(10, -1.0, 2.0, -1.0));
+    EXPECT_EQ(small.levels(), 1u);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Preconditioned Krylov solvers
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(PreconditionedKrylov, CGIterationsDropOnJumpCoefficients) {
+    SparseMatrix A = diffusion2d(40, 1e3);
+    const auto b = ones(A.rows());
+    const double tol = 1e-8;
+
+    auto plain = cg(A, b, IdentityPreconditioner(A.rows()), {}, tol, 5000);
+    ASSERT_TRUE(plain.converged);
+
+    auto jac  = cg(A, b, JacobiPreconditioner(A),  {}, tol, 5000);
+    auto ic0  = cg(A, b, IC0Preconditioner(A),     {}, tol, 5000);
+    auto ssor = cg(A, b, SSORPreconditioner(A, 1.2), {}, tol, 5000);
+    auto amg  = cg(A, b, AMGPreconditioner(A),     {}, tol, 5000);
+
+    for (const auto* r : {&jac, &ic0, &ssor, &amg}) {
+        EXPECT_TRUE(r->converged);
+        EXPECT_LT(r->residual, 10 * tol);
+        EXPECT_LT(r->iterations, plain.iterations);
+    }
+    EXPECT_LT(ic0.iterations, jac.iterations);
+    EXPECT_LT(amg.iterations, ic0.iterations);
+    EXPECT_LT(amg.iterations * 5, plain.iterations);
+}
+
+TEST(PreconditionedKrylov, ReportMatchesUnpreconditionedOverload) {
+    SparseMatrix A = diffusion2d(12);
+    const auto b = ones(A.rows());
+    auto x = cg(A, b);
+    auto r = cg(A, b, IdentityPreconditioner(A.rows()));
+    ASSERT_EQ(r.x.size(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) EXPECT_DOUBLE_EQ(r.x[i], x[i]);
+    EXPECT_TRUE(r.converged);
+    EXPECT_GT(r.iterations, 0u);
+    EXPECT_LT(r.residual, 1e-9);
+}
+
+TEST(PreconditionedKrylov, NonSymmetricWithILU0) {
+    SparseMatrix A = diffusion2d(30, 10.0, 5.0);
+    const auto b = ones(A.rows());
+    ILU0Preconditioner ilu(A);
+
+    auto g0 = gmres(A, b, IdentityPreconditioner(A.rows()), {}, 1e-9, 3000, 30);
+    auto g1 = gmres(A, b, ilu, {}, 1e-9, 3000, 30);
+    ASSERT_TRUE(g0.converged);
+    ASSERT_TRUE(g1.converged);
+    EXPECT_LT(g1.iterations * 3, g0.iterations);
+    EXPECT_LT(g1.residual, 1e-8);
+
+    auto s0 = bicgstab(A, b, IdentityPreconditioner(A.rows()), {}, 1e-10, 3000);
+    auto s1 = bicgstab(A, b, ilu, {}, 1e-10, 3000);
+    ASSERT_TRUE(s1.converged);
+    EXPECT_LT(s1.iterations, s0.iterations);
+    EXPECT_LT(s1.residual, 1e-8);
+}
+
+TEST(PreconditionedKrylov, MinresWithSPDPreconditioner) {
+    SparseMatrix A = diffusion2d(30, 1e2);
+    const auto b = ones(A.rows());
+
+    auto plain = minres(A, b, IdentityPreconditioner(A.rows()), {}, 1e-10, 5000);
+    auto jac   = minres(A, b, JacobiPreconditioner(A), {}, 1e-10, 5000);
+    ASSERT_TRUE(plain.converged);
+    ASSERT_TRUE(jac.converged);
+    EXPECT_LT(jac.iterations, plain.iterations);
+    EXPECT_LT(jac.residual, 1e-7);
+
+    // An indefinite M is rejected rather than silently diverging.
+    SparseMatrix negI = SparseMatrix::eye(A.rows()) * -1.0;
+    EXPECT_THROW(minres(A, b, JacobiPreconditioner(negI)), std::invalid_argument);
+}
+
+TEST(PreconditionedKrylov, MinresLuckyBreakdownConverges) {
+    // b is an eigenvector, so the Krylov space is one-dimensional: the first
+    // step solves the system exactly and the Lanczos recurrence breaks down
+    // (β = 0).  With tol = 0 only that breakdown can end the iteration, and
+    // it must be reported as convergence.
+    const size_t n = 6;
+    std::vector<size_t> idx(n);
+    std::vector<double> diag(n);
+    for (size_t i = 0; i < n; ++i) {
+        idx[i]  = i;
+        diag[i] = (i % 2 ? -1.0 : 1.0) * static_cast<double>(i + 1);   // indefinite
+    }
+    SparseMatrix A = SparseMatrix::from_triplets(n, n, idx, idx, diag);
+    std::vector<double> b(n, 0.0);
+    b[2] = 6.0;                                                        // λ₂ = 3, x = 2·e₂
+
+    auto res = minres(A, b, IdentityPreconditioner(n), {}, 0.0, 50);
+    EXPECT_TRUE(res.converged);
+    EXPECT_EQ(res.iterations, 1u);
+    EXPECT_LT(res.residual, 1e-14);
+    EXPECT_NEAR(res.x[2], 2.0, 1e-14);
+}
+
+TEST(PreconditionedKrylov, SizeMismatchThrows) {
+    SparseMatrix A = tridiag(5, -1.0, 2.0, -1.0);
+    IdentityPreconditioner I(4);
+    const auto b = ones(5);
+    EXPECT_THROW(cg(A, b, I),       std::invalid_argument);
+    EXPECT_THROW(gmres(A, b, I),    std::invalid_argument);
+    EXPECT_THROW(bicgstab(A, b, I), std::invalid_argument);
+    EXPECT_THROW(minres(A, b, I),   std::invalid_argument);
+}
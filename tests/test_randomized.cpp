@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/Randomized.h"
+#include "LinearAlgebra/MatrixFunctions.h"
+#include "LinearAlgebra/PCA.h"
+#include "LinearAlgebra/SparseMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+DynamicMatrix randomMatrix(size_t m, size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<double> dist(0.0, 1.0);
+    DynamicMatrix A(m, n);
+    for (double& a : A.data()) a = dist(gen);
+    return A;
+}
+
+// m×n matrix with singular values 2^-i for i < rank, zero beyond.
+DynamicMatrix lowRank(size_t m, size_t n, size_t rank, unsigned seed) {
+    DynamicMatrix U = randomMatrix(m, rank, seed);
+    DynamicMatrix V = randomMatrix(rank, n, seed + 1);
+    for (size_t i = 0; i < m; ++i)
+        for (size_t c = 0; c < rank; ++c) U(i, c) *= std::pow(0.5, double(c));
+    return U * V;
+}
+
+double frobenius(const DynamicMatrix& A) {
+    double s = 0.0;
+    for (double a : A.data()) s += a * a;
+    return std::sqrt(s);
+}
+
+DynamicMatrix reconstruct(const LowRankSVD& f) {
+    DynamicMatrix US = f.U;
+    for (size_t i = 0; i < US.rows(); ++i)
+        for (size_t c = 0; c < f.S.size(); ++c) US(i, c) *= f.S[c];
+    return US * f.Vt;
+}
+
+DynamicMatrix reconstruct(const LowRankEigen& f) {
+    DynamicMatrix VL = f.vectors;
+    for (size_t i = 0; i < VL.rows(); ++i)
+        for (size_t c = 0; c < f.values.size(); ++c) VL(i, c) *= f.values[c];
+    return VL * f.vectors.transposed();
+}
+
+double orthogonalityError(const DynamicMatrix& Q) {
+    DynamicMatrix G = Q.transposed() * Q;
+    double e = 0.0;
+    for (size_t i = 0; i < G.rows(); ++i)
+        for (size_t j = 0; j < G.cols(); ++j)
+            e = std::max(e, std::abs(G(i, j) - (i == j ? 1.0 : 0.0)));
+    return e;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Range finder and SVD
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Randomized, RangeFinderCapturesALowRankRange) {
+    DynamicMatrix A = lowRank(120, 80, 6, 1);
+    DynamicMatrix Q = randomizedRangeFinder(DenseOperator(A), 10);
+    ASSERT_EQ(Q.rows(), 120u);
+    ASSERT_EQ(Q.cols(), 10u);
+    EXPECT_LT(orthogonalityError(Q), 1e-12);
+
+    DynamicMatrix R = A - Q * (Q.transposed() * A);
+    EXPECT_LT(frobenius(R), 1e-10 * frobenius(A));
+
+    FunctionOperator noTranspose(120, 80, [&](const std::vector<double>& x, std::vector<double>& y) {
+        const DynamicVector r = matvec(A, DynamicVector(x));
+        y.assign(r.begin(), r.end());
+    });
+    EXPECT_THROW(randomizedRangeFinder(noTranspose, 10, 1), std::invalid_argument);
+    EXPECT_NO_THROW(randomizedRangeFinder(noTranspose, 10, 0));
+    EXPECT_THROW(randomizedRangeFinder(DenseOperator(A), 81), std::invalid_argument);
+}
+
+TEST(Randomized, SVDMatchesTheExactLeadingTriplets) {
+    DynamicMatrix A = lowRank(200, 60, 8, 3);
+    const LowRankSVD f = randomizedSVD(A, 5);
+    auto [U, S, Vt] = svd(A);
+
+    ASSERT_EQ(f.S.size(), 5u);
+    for (size_t i = 0; i < 5; ++i) EXPECT_NEAR(f.S[i], S[i], 1e-10 * S[0]);
+    EXPECT_LT(orthogonalityError(f.U), 1e-12);
+    EXPECT_LT(orthogonalityError(f.Vt.transposed()), 1e-12);
+
+    // Rank-8 input: a rank-8 sketch reproduces A.
+    const LowRankSVD g = randomizedSVD(A, 8);
+    EXPECT_LT(frobenius(A - reconstruct(g)), 1e-10 * frobenius(A));
+
+    // rsvd is a wrapper with the same results.
+    auto [Ur, Sr, Vtr] = rsvd(A, 5);
+    for (size_t i = 0; i < 5; ++i) EXPECT_NEAR(Sr[i], f.S[i], 1e-12 * S[0]);
+    EXPECT_THROW(rsvd(A, 0), std::invalid_argument);
+}
+
+TEST(Randomized, SparseAndMatrixFreeOperatorsGiveTheSameFactors) {
+    // Sparse rank-3 matrix: three dense columns repeated with scaling.
+    std::vector<size_t> ri, ci;
+    std::vector<double> v;
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> base(3 * 300);
+    for (double& b : base) b = dist(gen);
+    for (size_t j = 0; j < 150; ++j)
+        for (size_t i = 0; i < 300; ++i)
+            if ((i + j) % 4 == 0) {
+                ri.push_back(i); ci.push_back(j);
+                v.push_back(base[(j % 3) * 300 + i] * (1.0 + double(j) / 150.0));
+            }
+    SparseMatrix S = SparseMatrix::from_triplets(300, 150, ri, ci, v);
+    DynamicMatrix D(S);
+
+    const LowRankSVD fs = randomizedSVD(S, 4);
+    const LowRankSVD fd = randomizedSVD(D, 4);
+
+    FunctionOperator op(300, 150,
+        [&](const std::vector<double>& x, std::vector<double>& y) { S.multiply(x, y); },
+        [&](const std::vector<double>& x, std::vector<double>& y) {
+            const DynamicVector r = rmatvec(D, DynamicVector(x));
+            y.assign(r.begin(), r.end());
+        });
+    const LowRankSVD ff = randomizedSVD(op, 4);
+
+    auto [U, sv, Vt] = svd(D);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_NEAR(fs.S[i], sv[i], 1e-9 * sv[0]);
+        EXPECT_NEAR(fd.S[i], sv[i], 1e-9 * sv[0]);
+        EXPECT_NEAR(ff.S[i], sv[i], 1e-9 * sv[0]);
+    }
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Symmetric eigendecomposition and Nyström
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Randomized, EighFindsTheLargestMagnitudeEigenpairs) {
+    // Symmetric indefinite with eigenvalues 10, -8, 5, then a small tail.
+    const size_t n = 90;
+    DynamicMatrix Q = randomizedRangeFinder(DenseOperator(randomMatrix(n, n, 11)), n, 0);
+    std::vector<double> lambda(n);
+    for (size_t i = 0; i < n; ++i) lambda[i] = 1e-3 * std::pow(0.9, double(i));
+    lambda[0] = 10.0; lambda[1] = -8.0; lambda[2] = 5.0;
+    DynamicMatrix A(n, n);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            double s = 0.0;
+            for (size_t c = 0; c < n; ++c) s += Q(i, c) * lambda[c] * Q(j, c);
+            A(i, j) = s;
+        }
+
+    const LowRankEigen f = randomizedEigh(A, 3);
+    ASSERT_EQ(f.values.size(), 3u);
+    EXPECT_NEAR(f.values[0], 10.0, 1e-8);
+    EXPECT_NEAR(f.values[1],  5.0, 1e-8);
+    EXPECT_NEAR(f.values[2], -8.0, 1e-8);
+    EXPECT_LT(orthogonalityError(f.vectors), 1e-12);
+    EXPECT_LT(frobenius(A - reconstruct(f)), 1e-2);
+
+    EXPECT_THROW(randomizedEigh(randomMatrix(4, 5, 1), 2), std::invalid_argument);
+}
+
+TEST(Randomized, NystromApproximatesAnRBFKernel) {
+    const size_t n = 150;
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> x(n);
+    for (double& xi : x) xi = dist(gen);
+    DynamicMatrix K(n, n);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+            K(i, j) = std::exp(-0.5 * (x[i] - x[j]) * (x[i] - x[j]) / 0.09);
+
+    const LowRankEigen f = nystrom(K, 12, {20, 0, 1});
+    auto [lambda, V] = eig(K);
+    for (size_t i = 0; i < 6; ++i)
+        EXPECT_NEAR(f.values[i], lambda[i], 1e-6 * lambda[0]);
+    for (double l : f.values) EXPECT_GE(l, 0.0);
+    EXPECT_LT(orthogonalityError(f.vectors), 1e-10);
+    EXPECT_LT(frobenius(K - reconstruct(f)), 1e-4 * frobenius(K));
+
+    // Rank-deficient PSD input stays finite.
+    DynamicMatrix B = randomMatrix(n, 4, 2);
+    const LowRankEigen g = nystrom(B * B.transposed(), 6);
+    for (double l : g.values) EXPECT_TRUE(std::isfinite(l));
+    EXPECT_LT(frobenius(B * B.transposed() - reconstruct(g)), 1e-8 * frobenius(B * B.transposed()));
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Streaming sketch
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Randomized, StreamingSketchMatchesTheBatchFactors) {
+    DynamicMatrix A = lowRank(240, 50, 5, 21);
+    StreamingSketch sk(50, 5);
+    for (size_t r = 0; r < 240; r += 37) {
+        const size_t b = std::min<size_t>(37, 240 - r);
+        DynamicMatrix block(b, 50);
+        for (size_t i = 0; i < b; ++i)
+            for (size_t j = 0; j < 50; ++j) block(i, j) = A(r + i, j);
+        sk.append(block);
+    }
+    EXPECT_EQ(sk.rows(), 240u);
+    const LowRankSVD f = sk.finalize();
+
+    auto [U, S, Vt] = svd(A);
+    for (size_t i = 0; i < 5; ++i) EXPECT_NEAR(f.S[i], S[i], 1e-8 * S[0]);
+    EXPECT_LT(frobenius(A - reconstruct(f)), 1e-8 * frobenius(A));
+
+    StreamingSketch empty(50, 5);
+    EXPECT_THROW(empty.finalize(), std::logic_error);
+    EXPECT_THROW(empty.append(DynamicMatrix(3, 49)), std::invalid_argument);
+    EXPECT_THROW(StreamingSketch(50, 0), std::invalid_argument);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// PCA
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(Randomized, PCAUsesTheCentredSketch) {
+    // 3 strong directions around a non-zero mean, plus small noise.
+    DynamicMatrix X = lowRank(400, 40, 3, 31);
+    DynamicMatrix noise = randomMatrix(400, 40, 32);
+    for (size_t i = 0; i < 400; ++i)
+        for (size_t j = 0; j < 40; ++j) X(i, j) += 5.0 + 0.5 * double(j) + 1e-3 * noise(i, j);
+
+    PCA exact(3), fast(3, false, true);
+    exact.fit(X);
+    fast.fit(X);
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(fast.explained_variance()[i], exact.explained_variance()[i],
+                    1e-6 * exact.explained_variance()[0]);
+        EXPECT_NEAR(fast.explained_variance_ratio()[i], exact.explained_variance_ratio()[i], 1e-6);
+        double dot = 0.0;
+        for (size_t j = 0; j < 40; ++j) dot += fast.components()(i, j) * exact.components()(i, j);
+        EXPECT_NEAR(std::abs(dot), 1.0, 1e-6);
+    }
+    EXPECT_NEAR(fast.noise_variance(), exact.noise_variance(), 1e-3 * exact.noise_variance());
+}
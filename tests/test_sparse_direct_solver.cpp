@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "LinearAlgebra/SparseDirectSolver.h"
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+using SharedMath::Core::ThreadPool;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+// 5-point k×k grid operator: −Δu + shift·u, plus an upwinded convection
+// term of strength `wind` (unsymmetric values on a symmetric pattern).
+SparseMatrix gridOperator(size_t k, double shift = 0.0, double wind = 0.0) {
+    std::vector<size_t> ri, ci;
+    std::vector<double> v;
+    auto add = [&](size_t i, size_t j, double x) { ri.push_back(i); ci.push_back(j); v.push_back(x); };
+    for (size_t r = 0; r < k; ++r)
+        for (size_t c = 0; c < k; ++c) {
+            const size_t u = r * k + c;
+            add(u, u, 4.0 + shift + wind);
+            if (c > 0)     add(u, u - 1, -1.0 - wind);
+            if (c + 1 < k) add(u, u + 1, -1.0);
+            if (r > 0)     add(u, u - k, -1.0);
+            if (r + 1 < k) add(u, u + k, -1.0);
+        }
+    return SparseMatrix::from_triplets(k * k, k * k, ri, ci, v);
+}
+
+std::vector<double> randomVector(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> x(n);
+    for (double& e : x) e = dist(gen);
+    return x;
+}
+
+double maxAbsDiff(const std::vector<double>& a, const std::vector<double>& b) {
+    double d = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) d = std::max(d, std::abs(a[i] - b[i]));
+    return d;
+}
+
+std::vector<double> multiply(const SparseMatrix& A, const std::vector<double>& x) {
+    std::vector<double> y(A.rows());
+    A.multiply(x, y);
+    return y;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// Nested dissection
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseOrdering, NestedDissectionIsAPermutationAndReducesFill) {
+    SparseMatrix A = gridOperator(40);
+    std::vector<size_t> perm = nestedDissectionOrdering(A);
+    ASSERT_EQ(perm.size(), 1600u);
+    std::vector<size_t> sorted = perm;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) ASSERT_EQ(sorted[i], i);
+
+    SparseDirectSolver natural(A, SparseDirectSolver::Method::Cholesky, SparseOrdering::Natural);
+    SparseDirectSolver nd(A, SparseDirectSolver::Method::Cholesky, SparseOrdering::NestedDissection);
+    EXPECT_LT(nd.nnz_factor(), natural.nnz_factor() / 2);
+
+    // Two disconnected grids are ordered one after the other.
+    auto B = SparseMatrix::from_triplets(4, 4, {0, 1, 2, 3}, {1, 0, 3, 2}, {1, 1, 1, 1});
+    EXPECT_EQ(nestedDissectionOrdering(B).size(), 4u);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Cholesky
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseDirectSolver, CholeskyForEveryOrdering) {
+    SparseMatrix A = gridOperator(30, 0.01);
+    std::vector<double> x = randomVector(A.rows(), 1);
+    std::vector<double> b = multiply(A, x);
+
+    for (SparseOrdering o : {SparseOrdering::Natural, SparseOrdering::AMD,
+                             SparseOrdering::NestedDissection}) {
+        SparseDirectSolver sol(A, SparseDirectSolver::Method::Auto, o);
+        EXPECT_EQ(sol.method(), SparseDirectSolver::Method::Cholesky);
+        EXPECT_LT(sol.supernodes(), A.rows());
+        EXPECT_LT(maxAbsDiff(sol.solve(b), x), 1e-10);
+    }
+}
+
+TEST(SparseDirectSolver, MultipleRightHandSides) {
+    SparseMatrix A = gridOperator(20, 0.5);
+    SparseDirectSolver sol(A);
+    DynamicMatrix X(A.rows(), 3);
+    for (size_t i = 0; i < A.rows(); ++i)
+        for (size_t c = 0; c < 3; ++c) X(i, c) = std::sin(double(i * (c + 1)));
+    DynamicMatrix B = A * X;
+    DynamicMatrix Y = sol.solve(B);
+    for (size_t i = 0; i < A.rows(); ++i)
+        for (size_t c = 0; c < 3; ++c) EXPECT_NEAR(Y(i, c), X(i, c), 1e-11);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// LU
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseDirectSolver, LUOnConvectionDiffusion) {
+    SparseMatrix A = gridOperator(25, 0.0, 3.0);
+    std::vector<double> x = randomVector(A.rows(), 2);
+    std::vector<double> b = multiply(A, x);
+
+    SparseDirectSolver sol(A, SparseDirectSolver::Method::Auto, SparseOrdering::NestedDissection);
+    EXPECT_EQ(sol.method(), SparseDirectSolver::Method::LU);
+    EXPECT_LT(maxAbsDiff(sol.solve(b), x), 1e-10);
+    EXPECT_EQ(sol.perturbed_pivots(), 0u);
+}
+
+TEST(SparseDirectSolver, AutoFallsBackToLUWhenIndefinite) {
+    SparseMatrix A = gridOperator(15, -3.0);       // positive diagonal, indefinite
+    std::vector<double> x = randomVector(A.rows(), 3);
+    SparseDirectSolver sol(A);
+    EXPECT_EQ(sol.method(), SparseDirectSolver::Method::LU);
+    EXPECT_LT(maxAbsDiff(sol.solve(multiply(A, x)), x), 1e-9);
+    EXPECT_THROW(SparseDirectSolver(A, SparseDirectSolver::Method::Cholesky), std::runtime_error);
+}
+
+TEST(SparseDirectSolver, PivotsOffTheDiagonal) {
+    // Saddle-point system [K Bᵀ; B 0]: the constraint rows have a zero diagonal.
+    const size_t k = 8, nk = k * k, nc = k;
+    SparseMatrix K = gridOperator(k, 0.1);
+    std::vector<size_t> ri, ci;
+    std::vector<double> v;
+    for (size_t i = 0; i < nk; ++i)
+        for (size_t q = K.row_ptr()[i]; q < K.row_ptr()[i + 1]; ++q) {
+            ri.push_back(i); ci.push_back(K.col_indices()[q]); v.push_back(K.values()[q]);
+        }
+    for (size_t c = 0; c < nc; ++c) {                // constraint c ties two unknowns
+        const size_t a = c * k + c, b = (c * k + 3 * c + 1) % nk;
+        for (auto [i, w] : {std::pair<size_t, double>{a, 1.0}, {b, -2.0}}) {
+            ri.insert(ri.end(), {nk + c, i});
+            ci.insert(ci.end(), {i, nk + c});
+            v.insert(v.end(), {w, w});
+        }
+    }
+    SparseMatrix A = SparseMatrix::from_triplets(nk + nc, nk + nc, ri, ci, v);
+    std::vector<double> x = randomVector(A.rows(), 4);
+
+    SparseDirectSolver sol(A);
+    EXPECT_EQ(sol.method(), SparseDirectSolver::Method::LU);
+    EXPECT_LT(maxAbsDiff(sol.solve(multiply(A, x)), x), 1e-9);
+
+    // A pure permutation: every pivot is off the diagonal.
+    auto P = SparseMatrix::from_triplets(3, 3, {0, 1, 2}, {1, 2, 0}, {2.0, -1.0, 4.0});
+    SparseDirectSolver perm(P, SparseDirectSolver::Method::LU, SparseOrdering::Natural);
+    std::vector<double> y = perm.solve(std::vector<double>{2.0, -3.0, 8.0});
+    EXPECT_LT(maxAbsDiff(y, {2.0, 1.0, 3.0}), 1e-14);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Refactorization, threading and errors
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseDirectSolver, RefactorReusesTheAnalysis) {
+    SparseDirectSolver sol(gridOperator(20, 1.0));
+    const size_t S = sol.supernodes(), nz = sol.nnz_factor();
+    std::vector<double> x = randomVector(400, 5);
+    for (double shift : {0.5, 0.1, 0.01}) {
+        SparseMatrix A = gridOperator(20, shift);
+        sol.refactor(A);
+        EXPECT_LT(maxAbsDiff(sol.solve(multiply(A, x)), x), 1e-9) << "shift=" << shift;
+    }
+    EXPECT_EQ(sol.supernodes(), S);
+    EXPECT_EQ(sol.nnz_factor(), nz);
+
+    // Unsymmetric values on the same pattern switch Auto over to LU.
+    SparseMatrix W = gridOperator(20, 0.0, 1.0);
+    sol.refactor(W);
+    EXPECT_EQ(sol.method(), SparseDirectSolver::Method::LU);
+    EXPECT_LT(maxAbsDiff(sol.solve(multiply(W, x)), x), 1e-9);
+
+    EXPECT_THROW(sol.refactor(gridOperator(19)), std::invalid_argument);
+}
+
+TEST(SparseDirectSolver, TreeParallelMatchesSerial) {
+    SparseMatrix A = gridOperator(60, 0.0, 0.5);
+    std::vector<double> b = randomVector(A.rows(), 6);
+
+    ThreadPool::setNumThreads(1);
+    std::vector<double> serial =
+        SparseDirectSolver(A, SparseDirectSolver::Method::LU, SparseOrdering::NestedDissection).solve(b);
+    ThreadPool::setNumThreads(4);
+    std::vector<double> parallel =
+        SparseDirectSolver(A, SparseDirectSolver::Method::LU, SparseOrdering::NestedDissection).solve(b);
+    ThreadPool::setNumThreads(0);
+
+    EXPECT_LT(maxAbsDiff(serial, parallel), 1e-12);
+    EXPECT_LT(maxAbsDiff(multiply(A, parallel), b), 1e-10);
+}
+
+TEST(SparseDirectSolver, Errors) {
+    EXPECT_THROW(SparseDirectSolver(SparseMatrix(3, 4)), std::invalid_argument);
+    EXPECT_THROW(SparseDirectSolver(gridOperator(4), SparseDirectSolver::Method::LU,
+                                    SparseOrdering::AMD, 0.0), std::invalid_argument);
+    EXPECT_THROW(SparseDirectSolver(gridOperator(4, 0.0, 1.0), SparseDirectSolver::Method::Cholesky),
+                 std::invalid_argument);
+
+    // Column 1 is empty.
+    auto S = SparseMatrix::from_triplets(3, 3, {0, 1, 2}, {0, 0, 2}, {1.0, 1.0, 1.0});
+    EXPECT_THROW(SparseDirectSolver{S}, std::runtime_error);
+
+    SparseDirectSolver sol(gridOperator(4));
+    EXPECT_THROW(sol.solve(std::vector<double>(5)), std::invalid_argument);
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include "core/ThreadPool.h"
+#include "LinearAlgebra/IterativeSolvers.h"
+#include "LinearAlgebra/SparseFormats.h"
+#include "LinearAlgebra/SparseMatrix.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace SharedMath::LinearAlgebra;
+using SharedMath::Core::ThreadPool;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+// Random sparse matrix whose row lengths follow a power law: most rows hold a
+// couple of entries, a few hold hundreds — the case that unbalances a plain
+// row split and pads ELLPACK badly.
+SparseMatrix powerLaw(size_t rows, size_t cols, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> val(-1.0, 1.0);
+    std::uniform_int_distribution<size_t>  col(0, cols - 1);
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t i = 0; i < rows; ++i) {
+        const size_t len = std::min(cols, static_cast<size_t>(
+            2.0 / std::pow(std::uniform_real_distribution<double>(1e-3, 1.0)(gen), 1.2)));
+        for (size_t k = 0; k < len; ++k) {
+            ri.push_back(i); ci.push_back(col(gen)); vals.push_back(val(gen));
+        }
+    }
+    return SparseMatrix::from_triplets(rows, cols, ri, ci, vals);
+}
+
+// Block-tridiagonal matrix with dense b×b blocks (b unknowns per node).
+SparseMatrix blockTridiag(size_t nodes, size_t b) {
+    std::vector<size_t> ri, ci;
+    std::vector<double> vals;
+    for (size_t I = 0; I < nodes; ++I)
+        for (size_t J = (I ? I - 1 : 0); J <= std::min(nodes - 1, I + 1); ++J)
+            for (size_t r = 0; r < b; ++r)
+                for (size_t c = 0; c < b; ++c) {
+                    ri.push_back(I * b + r);
+                    ci.push_back(J * b + c);
+                    vals.push_back(I == J ? (r == c ? 4.0 * b : -0.5) : -1.0 / b);
+                }
+    return SparseMatrix::from_triplets(nodes * b, nodes * b, ri, ci, vals);
+}
+
+std::vector<double> randomVec(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(gen);
+    return v;
+}
+
+void expectSameMatrix(const SparseMatrix& A, const SparseMatrix& B) {
+    ASSERT_EQ(A.rows(), B.rows());
+    ASSERT_EQ(A.cols(), B.cols());
+    EXPECT_EQ(A.row_ptr(), B.row_ptr());
+    EXPECT_EQ(A.col_indices(), B.col_indices());
+    EXPECT_EQ(A.values(), B.values());
+}
+
+void expectNear(const std::vector<double>& a, const std::vector<double>& b, double tol) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) EXPECT_NEAR(a[i], b[i], tol) << "i=" << i;
+}
+
+} // namespace
+
+// ════════════════════════════════════════════════════════════════════════════
+// CSR kernels
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseCSR, FromCsrValidates) {
+    const SparseMatrix A = SparseMatrix::from_csr(2, 3, {0, 2, 3}, {0, 2, 1}, {1.0, 2.0, 3.0});
+    EXPECT_DOUBLE_EQ(A.get(0, 2), 2.0);
+    EXPECT_DOUBLE_EQ(A.get(1, 1), 3.0);
+
+    EXPECT_THROW(SparseMatrix::from_csr(2, 3, {0, 2}, {0, 2}, {1.0, 2.0}),       std::invalid_argument);
+    EXPECT_THROW(SparseMatrix::from_csr(2, 3, {0, 2, 1}, {0, 2}, {1.0, 2.0}),    std::invalid_argument);
+    EXPECT_THROW(SparseMatrix::from_csr(1, 3, {0, 2}, {2, 0}, {1.0, 2.0}),       std::invalid_argument);
+    EXPECT_THROW(SparseMatrix::from_csr(1, 3, {0, 2}, {1, 1}, {1.0, 2.0}),       std::invalid_argument);
+    EXPECT_THROW(SparseMatrix::from_csr(1, 3, {0, 1}, {3}, {1.0}),               std::invalid_argument);
+}
+
+TEST(SparseCSR, MultiplyMatchesDense) {
+    SparseMatrix A = powerLaw(3000, 700, 1);
+    DynamicMatrix D = A.to_dense();
+    const auto x = randomVec(700, 2);
+    std::vector<double> y(3000), ref(3000, 0.0);
+    A.multiply(x, y);
+    for (size_t i = 0; i < 3000; ++i)
+        for (size_t j = 0; j < 700; ++j) ref[i] += D(i, j) * x[j];
+    expectNear(y, ref, 1e-12);
+
+    std::vector<double> wrong(5);
+    EXPECT_THROW(A.multiply(x, wrong), std::invalid_argument);
+}
+
+TEST(SparseCSR, TransposedMatchesDense) {
+    SparseMatrix A = powerLaw(400, 250, 3);
+    SparseMatrix T = A.transposed();
+    EXPECT_EQ(T.rows(), 250u);
+    EXPECT_EQ(T.nnz(), A.nnz());
+    for (size_t j = 0; j < T.rows(); ++j)
+        for (size_t k = T.row_ptr()[j] + 1; k < T.row_ptr()[j + 1]; ++k)
+            ASSERT_LT(T.col_indices()[k - 1], T.col_indices()[k]);
+    expectSameMatrix(T.transposed(), A);
+}
+
+TEST(SparseCSR, SpGEMMMatchesDense) {
+    SparseMatrix A = powerLaw(300, 200, 4);
+    SparseMatrix B = powerLaw(200, 150, 5);
+    const SparseMatrix C = A.matmul(B);
+    DynamicMatrix ref = A.to_dense() * B.to_dense();
+    for (size_t i = 0; i < C.rows(); ++i) {
+        for (size_t k = C.row_ptr()[i] + 1; k < C.row_ptr()[i + 1]; ++k)
+            ASSERT_LT(C.col_indices()[k - 1], C.col_indices()[k]);
+        for (size_t j = 0; j < C.cols(); ++j) EXPECT_NEAR(C.get(i, j), ref(i, j), 1e-12);
+    }
+    EXPECT_THROW(A.matmul(A), std::invalid_argument);
+}
+
+TEST(SparseCSR, ParallelKernelsMatchSingleThread) {
+    SparseMatrix A = powerLaw(20000, 5000, 6);
+    SparseMatrix B = powerLaw(5000, 3000, 7);
+    const auto x = randomVec(5000, 8);
+
+    ThreadPool::setNumThreads(1);
+    std::vector<double> y1(A.rows());
+    A.multiply(x, y1);
+    SparseMatrix C1 = A.matmul(B);
+
+    ThreadPool::setNumThreads(4);
+    std::vector<double> y4(A.rows());
+    A.multiply(x, y4);
+    SparseMatrix C4 = A.matmul(B);
+    ThreadPool::setNumThreads(0);
+
+    // Each row is summed by one thread in the same order: results are identical.
+    EXPECT_EQ(y1, y4);
+    expectSameMatrix(C1, C4);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// CSC / SELL-C-σ / BSR
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(SparseFormats, RoundTripThroughCsr) {
+    SparseMatrix A = powerLaw(500, 300, 9);
+    expectSameMatrix(CSCMatrix(A).to_csr(), A);
+    expectSameMatrix(SELLMatrix(A).to_csr(), A);
+    expectSameMatrix(SELLMatrix(A, 4, 1).to_csr(), A);
+    expectSameMatrix(SELLMatrix(A, 1, 500).to_csr(), A);
+
+    SparseMatrix F = blockTridiag(40, 3);
+    expectSameMatrix(BSRMatrix(F, 3).to_csr(), F);
+    // A block size that does not match the structure just stores explicit zeros.
+    expectSameMatrix(BSRMatrix(F, 5).to_csr(), F);
+    expectSameMatrix(BSRMatrix(CSCMatrix(F).to_csr(), 3).to_csr(), F);
+}
+
+TEST(SparseFormats, ProductsMatchCsr) {
+    SparseMatrix A = powerLaw(6000, 6000, 10);
+    SparseOperator ref(A);
+    const auto x = randomVec(6000, 11);
+    std::vector<double> y0(6000), yt0(6000), y(6000), yt(6000);
+    ref.apply(x, y0);
+    ref.applyTranspose(x, yt0);
+
+    CSCMatrix csc(A);
+    SELLMatrix sell(A, 8, 64);
+    const LinearOperator* ops[] = {&csc, &sell};
+    for (const LinearOperator* op : ops) {
+        op->apply(x, y);
+        op->applyTranspose(x, yt);
+        expectNear(y, y0, 1e-12);
+        expectNear(yt, yt0, 1e-12);
+    }
+
+    SparseMatrix F = blockTridiag(1500, 4);
+    BSRMatrix bsr(F, 4);
+    EXPECT_EQ(bsr.numBlocks(), 3u * 1500 - 2);
+    const auto xf = randomVec(F.cols(), 12);
+    std::vector<double> f0(F.rows()), ft0(F.cols()), f(F.rows()), ft(F.cols());
+    SparseOperator(F).apply(xf, f0);
+    SparseOperator(F).applyTranspose(xf, ft0);
+    bsr.apply(xf, f);
+    bsr.applyTranspose(xf, ft);
+    expectNear(f, f0, 1e-12);
+    expectNear(ft, ft0, 1e-12);
+}
+
+TEST(SparseFormats, SellSortingReducesPadding) {
+    SparseMatrix A = powerLaw(4096, 2000, 13);
+    SELLMatrix unsorted(A, 8, 1);
+    SELLMatrix sorted(A, 8, 512);
+    EXPECT_GT(unsorted.fillRatio(), 1.0);
+    EXPECT_LT(sorted.fillRatio(), unsorted.fillRatio());
+
+    // A matrix with equal row lengths needs no padding at all.
+    SELLMatrix regular(blockTridiag(64, 2), 4, 1);
+    EXPECT_LT(regular.fillRatio(), 1.3);
+    EXPECT_DOUBLE_EQ(SELLMatrix(SparseMatrix::eye(16), 8, 1).fillRatio(), 1.0);
+}
+
+TEST(SparseFormats, HandleEmptyRowsAndRaggedSlices) {
+    // 13 rows (not a multiple of C), several empty rows, one dense row.
+    std::vector<size_t> ri = {0, 3, 3, 3, 3, 3, 3, 7, 12};
+    std::vector<size_t> ci = {1, 0, 1, 2, 3, 4, 5, 5, 0};
+    std::vector<double> vs = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    SparseMatrix A = SparseMatrix::from_triplets(13, 6, ri, ci, vs);
+    const std::vector<double> x = {1, -1, 2, -2, 3, -3};
+    std::vector<double> y0(13), y(13);
+    A.multiply(x, y0);
+
+    SELLMatrix sell(A, 4, 8);
+    sell.apply(x, y);
+    expectNear(y, y0, 0.0);
+    expectSameMatrix(sell.to_csr(), A);
+}
+
+TEST(SparseFormats, InvalidParametersThrow) {
+    SparseMatrix A = blockTridiag(5, 2);
+    EXPECT_THROW(BSRMatrix(A, 3), std::invalid_argument);
+    EXPECT_THROW(BSRMatrix(A, 0), std::invalid_argument);
+    EXPECT_THROW(SELLMatrix(A, 0), std::invalid_argument);
+    EXPECT_THROW(SELLMatrix(A, 65), std::invalid_argument);
+    EXPECT_THROW(SELLMatrix(A, 8, 0), std::invalid_argument);
+
+    BSRMatrix bsr(A, 2);
+    std::vector<double> x(3), y(10);
+    EXPECT_THROW(bsr.apply(x, y), std::invalid_argument);
+}
+
+TEST(SparseFormats, SolveWithKrylov) {
+    SparseMatrix F = blockTridiag(300, 3);
+    const std::vector<double> b(F.rows(), 1.0);
+    auto ref = cg(F, b);
+
+    BSRMatrix bsr(F, 3);
+    SELLMatrix sell(F);
+    expectNear(cg(bsr, b), ref, 1e-8);
+    expectNear(cg(sell, b), ref, 1e-8);
+    auto ls = lsqr(CSCMatrix(F), b, 1e-12, 5000);
+    expectNear(ls, ref, 1e-6);
+}
@@ -722,3 +722,439 @@ TEST(TensorMLPrimitives, Pool2dForwardAndBackward) {
     for (size_t i = 0; i < avg_dx.size(); ++i)
         EXPECT_DOUBLE_EQ(avg_dx.flat(i), 0.25);
 }
+
+// ════════════════════════════════════════════════════════════════════════════
+// Strided fast paths
+// ════════════════════════════════════════════════════════════════════════════
+
+// Reference broadcast through checked multi-index access.
+static Tensor referenceBroadcastAdd(const Tensor& a, const Tensor& b,
+                                    const Tensor::Shape& rshape) {
+    Tensor out(rshape);
+    const size_t nr = rshape.size();
+    for (size_t flat = 0; flat < out.size(); ++flat) {
+        auto ridx = out.unravel(flat);
+        std::vector<size_t> ai(a.ndim()), bi(b.ndim());
+        for (size_t i = 0; i < a.ndim(); ++i)
+            ai[i] = a.dim(i) == 1 ? 0 : ridx[nr - a.ndim() + i];
+        for (size_t i = 0; i < b.ndim(); ++i)
+            bi[i] = b.dim(i) == 1 ? 0 : ridx[nr - b.ndim() + i];
+        out.flat(flat) = a.at(ai) + b.at(bi);
+    }
+    return out;
+}
+
+TEST(TensorStrided, BroadcastRanksTwoToFour) {
+    const std::vector<std::pair<Tensor::Shape, Tensor::Shape>> cases = {
+        {{3, 1},       {1, 4}},
+        {{2, 3, 4},    {3, 1}},
+        {{2, 1, 4},    {5, 1}},
+        {{1, 3, 1, 5}, {2, 1, 4, 1}},
+        {{2, 3, 4, 5}, {5}},
+        {{2, 3, 4, 5}, {3, 1, 1}},
+    };
+    for (const auto& [sa, sb] : cases) {
+        Tensor a = Tensor::uniform(sa, -1.0, 1.0, 11);
+        Tensor b = Tensor::uniform(sb, -1.0, 1.0, 12);
+        Tensor got = a + b;
+        Tensor want = referenceBroadcastAdd(a, b, got.shape());
+        expectNear(got, want, 0.0);
+        expectNear(b + a, want, 0.0);
+    }
+}
+
+TEST(TensorStrided, UncheckedAccessMatchesChecked) {
+    Tensor t = Tensor::arange(0, 24).reshape({2, 3, 4});
+    EXPECT_DOUBLE_EQ(t.at_unsafe(1, 2, 3), t(1, 2, 3));
+    EXPECT_DOUBLE_EQ(t.at_unsafe(0, 1, 2), 6.0);
+    t.at_unsafe(1, 0, 0) = -1.0;
+    EXPECT_DOUBLE_EQ(t(1, 0, 0), -1.0);
+    // The checked accessor still validates rank and range.
+    EXPECT_THROW(t(0, 0), std::invalid_argument);
+    EXPECT_THROW(t(0, 3, 0), std::out_of_range);
+}
+
+TEST(TensorStrided, MiddleAxisReductions) {
+    Tensor t = Tensor::arange(0, 24).reshape({2, 3, 4});
+    Tensor s = t.sum(1);
+    ASSERT_EQ(s.shape(), (Tensor::Shape{2, 4}));
+    EXPECT_DOUBLE_EQ(s(0, 0), 0 + 4 + 8);
+    EXPECT_DOUBLE_EQ(s(1, 3), 15 + 19 + 23);
+    EXPECT_DOUBLE_EQ(t.max(1)(1, 2), 22.0);
+    EXPECT_DOUBLE_EQ(t.argmax(1)(0, 1), 2.0);
+    EXPECT_DOUBLE_EQ(t.argmin(2)(1, 1), 0.0);
+    EXPECT_NEAR(t.var(size_t{1})(0, 0), 32.0 / 3.0, kEps);
+
+    Tensor sm = t.softmax(1);
+    for (size_t o = 0; o < 2; ++o)
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_NEAR(sm(o, 0, i) + sm(o, 1, i) + sm(o, 2, i), 1.0, 1e-12);
+}
+
+TEST(TensorStrided, TransposeAndSliceMiddleAxis) {
+    Tensor t = Tensor::arange(0, 24).reshape({2, 3, 4});
+    Tensor p = t.permute({2, 0, 1});
+    ASSERT_EQ(p.shape(), (Tensor::Shape{4, 2, 3}));
+    for (size_t i = 0; i < 2; ++i)
+        for (size_t j = 0; j < 3; ++j)
+            for (size_t k = 0; k < 4; ++k)
+                EXPECT_DOUBLE_EQ(p(k, i, j), t(i, j, k));
+
+    Tensor sl = t.slice(1, 1, 3);
+    ASSERT_EQ(sl.shape(), (Tensor::Shape{2, 2, 4}));
+    EXPECT_DOUBLE_EQ(sl(0, 0, 0), 4.0);
+    EXPECT_DOUBLE_EQ(sl(1, 1, 3), 23.0);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Float32 storage
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(TensorFloat32, StorageIsSinglePrecision) {
+    const Tensor t({2, 3}, {1, 2, 3, 4, 5, 6}, TensorDType::Float32);
+    EXPECT_TRUE(t.data().empty());
+    ASSERT_EQ(t.data_f32().size(), 6u);
+    EXPECT_FLOAT_EQ(t.data_f32()[4], 5.0f);
+    EXPECT_DOUBLE_EQ(t(1, 2), 6.0);
+    EXPECT_DOUBLE_EQ(t.flat(3), 4.0);
+
+    Tensor z = Tensor::zeros({4}, TensorDType::Float32);
+    EXPECT_EQ(z.dtype(), TensorDType::Float32);
+    EXPECT_EQ(z.data_f32().size(), 4u);
+    EXPECT_THROW(Tensor::from_f32({3}, {1.0f, 2.0f}), std::invalid_argument);
+}
+
+TEST(TensorFloat32, WritableAccessNarrowsToFloat) {
+    Tensor t = Tensor::from_f32({2, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    const Tensor shared = t;                      // writes must not leak into it
+    EXPECT_DOUBLE_EQ(t(1, 0), 3.0);
+    EXPECT_DOUBLE_EQ(t.flat(1), 2.0);
+    EXPECT_DOUBLE_EQ(t.at({1, 1}), 4.0);
+
+    t(0, 0) = 1.0 / 3.0;
+    t.flat(1) += 0.5;
+    t.at({1, 1}) *= 2.0;
+    EXPECT_EQ(t.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(t.data_f32()[0], static_cast<float>(1.0 / 3.0));
+    EXPECT_DOUBLE_EQ(t(0, 0), static_cast<double>(static_cast<float>(1.0 / 3.0)));
+    EXPECT_FLOAT_EQ(t.data_f32()[1], 2.5f);
+    EXPECT_FLOAT_EQ(t.data_f32()[3], 8.0f);
+    EXPECT_FLOAT_EQ(shared.data_f32()[0], 1.0f);
+
+    EXPECT_THROW(t.slice_view(0, 0, 1), std::runtime_error);
+}
+
+TEST(TensorFloat32, ElementwiseKeepsDtype) {
+    Tensor a = Tensor::from_f32({2, 3}, {1, 2, 3, 4, 5, 6});
+    Tensor b = Tensor::from_f32({3}, {0.5f, 0.25f, 2.0f});
+
+    const Tensor sum = a + b;
+    EXPECT_EQ(sum.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(sum.data_f32()[5], 8.0f);
+
+    const Tensor e = (a * 0.5).exp();
+    EXPECT_EQ(e.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(e.data_f32()[1], std::exp(1.0f));
+
+    const Tensor r = (2.0 / a).relu().transpose();
+    EXPECT_EQ(r.dtype(), TensorDType::Float32);
+    EXPECT_EQ(r.shape(), (Tensor::Shape{3, 2}));
+    EXPECT_FLOAT_EQ(r.data_f32()[1], 0.5f);
+
+    EXPECT_EQ(a.reshape({6}).dtype(), TensorDType::Float32);
+    EXPECT_EQ(a.slice(1, 0, 2).dtype(), TensorDType::Float32);
+    EXPECT_EQ(b.broadcast_to({2, 3}).dtype(), TensorDType::Float32);
+}
+
+TEST(TensorFloat32, MixedDtypesPromote) {
+    Tensor f = Tensor::from_f32({2}, {1.5f, 2.5f});
+    Tensor d({2}, {1.0, 1.0});
+    const Tensor r = f + d;
+    EXPECT_EQ(r.dtype(), TensorDType::Float64);
+    EXPECT_DOUBLE_EQ(r(1), 3.5);
+    EXPECT_EQ((d * f).dtype(), TensorDType::Float64);
+
+    f += d;   // in-place ops keep the left operand's dtype
+    EXPECT_EQ(f.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(f.data_f32()[0], 2.5f);
+}
+
+TEST(TensorFloat32, ReductionsAccumulateInDouble) {
+    const Tensor t({2, 3}, {1, -2, 3, 4, 5, -6}, TensorDType::Float32);
+    EXPECT_DOUBLE_EQ(t.sum(), 5.0);
+    EXPECT_DOUBLE_EQ(t.min(), -6.0);
+    EXPECT_DOUBLE_EQ(t.max(), 5.0);
+    EXPECT_EQ(t.argmax(), 4u);
+
+    const Tensor s = t.sum(0);
+    EXPECT_EQ(s.dtype(), TensorDType::Float32);
+    EXPECT_DOUBLE_EQ(s(2), -3.0);
+
+    const Tensor sm = t.softmax(1);
+    EXPECT_EQ(sm.dtype(), TensorDType::Float32);
+    EXPECT_NEAR(sm.sum(), 2.0, 1e-6);
+}
+
+TEST(TensorFloat32, MatmulAndConvMatchFloat64) {
+    Tensor a64 = Tensor::uniform({17, 23}, -1.0, 1.0, 3);
+    Tensor b64 = Tensor::uniform({23, 11}, -1.0, 1.0, 4);
+    const Tensor a = a64.astype(TensorDType::Float32);
+    const Tensor b = b64.astype(TensorDType::Float32);
+
+    const Tensor c = a.matmul(b);
+    EXPECT_EQ(c.dtype(), TensorDType::Float32);
+    expectNear(c, a.astype(TensorDType::Float64).matmul(b.astype(TensorDType::Float64)), 1e-5);
+
+    Tensor x64 = Tensor::uniform({2, 3, 6, 6}, -1.0, 1.0, 5);
+    Tensor w64 = Tensor::uniform({4, 3, 3, 3}, -1.0, 1.0, 6);
+    Tensor bias({4}, {0.1, -0.2, 0.3, 0.0});
+    const Tensor x = x64.astype(TensorDType::Float32);
+    const Tensor w = w64.astype(TensorDType::Float32);
+
+    const Tensor y = x.conv2d(w, &bias, 1, 1);
+    EXPECT_EQ(y.dtype(), TensorDType::Float32);
+    expectNear(y, x.astype(TensorDType::Float64)
+                   .conv2d(w.astype(TensorDType::Float64), &bias, 1, 1), 1e-5);
+}
+
+TEST(TensorFloat32, AstypeRoundTrip) {
+    Tensor d({3}, {1.0 / 3.0, 2.0, -0.1});
+    const Tensor f = d.astype(TensorDType::Float32);
+    const Tensor back = f.astype(TensorDType::Float64);
+    EXPECT_EQ(back.dtype(), TensorDType::Float64);
+    EXPECT_DOUBLE_EQ(back(0), static_cast<double>(static_cast<float>(1.0 / 3.0)));
+    EXPECT_TRUE(f == f.astype(TensorDType::Float32));
+    EXPECT_FALSE(f == d);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Zero-copy views
+// ════════════════════════════════════════════════════════════════════════════
+
+TEST(TensorViews, ShapeOpsShareStorage) {
+    const Tensor t = Tensor::arange(0, 24).reshape({2, 3, 4});
+    EXPECT_TRUE(t.is_contiguous());
+
+    const Tensor tr = t.transpose();
+    const Tensor sl = t.slice(1, 1, 3);
+    const Tensor bc = t.slice(0, 0, 1).broadcast_to({5, 3, 4});
+    const Tensor sq = t.slice(0, 1, 2).squeeze(0);
+    for (const Tensor* v : {&tr, &sl, &bc, &sq})
+        EXPECT_TRUE(v->shares_storage(t));
+    EXPECT_FALSE(tr.is_contiguous());
+    EXPECT_EQ(tr.strides(), (std::vector<size_t>{1, 4, 12}));
+    EXPECT_EQ(bc.strides()[0], 0u);
+
+    EXPECT_DOUBLE_EQ(tr(3, 2, 1), t(1, 2, 3));
+    EXPECT_DOUBLE_EQ(sl(1, 0, 2), t(1, 1, 2));
+    EXPECT_DOUBLE_EQ(bc(4, 2, 3), t(0, 2, 3));
+    EXPECT_DOUBLE_EQ(sq(2, 1), t(1, 2, 1));
+    EXPECT_DOUBLE_EQ(tr.flat(1), 12.0);
+
+    for (const Tensor& part : t.split(2, size_t{2}))
+        EXPECT_TRUE(part.shares_storage(t));
+}
+
+TEST(TensorViews, WritesCopyOnWrite) {
+    Tensor t = Tensor::arange(0, 6).reshape({2, 3});
+    Tensor copy = t;
+    Tensor view = t.transpose();
+    EXPECT_TRUE(copy.shares_storage(t));
+
+    t(0, 1) = 100.0;
+    EXPECT_DOUBLE_EQ(t(0, 1), 100.0);
+    EXPECT_DOUBLE_EQ(copy(0, 1), 1.0);
+    EXPECT_DOUBLE_EQ(view(1, 0), 1.0);
+
+    view(2, 1) = -5.0;   // the view detaches into its own row-major buffer
+    EXPECT_TRUE(view.is_contiguous());
+    EXPECT_DOUBLE_EQ(view(2, 1), -5.0);
+    EXPECT_DOUBLE_EQ(copy(1, 2), 5.0);
+    EXPECT_DOUBLE_EQ(view(0, 1), 3.0);
+
+    std::vector<double>& raw = copy.data();
+    raw[0] = 7.0;
+    EXPECT_DOUBLE_EQ(copy(0, 0), 7.0);
+    EXPECT_DOUBLE_EQ(t(0, 0), 0.0);
+}
+
+TEST(TensorViews, StridedInputsMatchContiguous) {
+    const Tensor a = Tensor::uniform({6, 5, 4}, -1.0, 1.0, 21);
+    const Tensor b = Tensor::uniform({4, 5}, -1.0, 1.0, 22);
+    const Tensor v = a.permute({2, 1, 0}).slice(2, 1, 5);   // [4, 5, 4]
+    const Tensor c = v.contiguous();
+    ASSERT_FALSE(v.is_contiguous());
+    ASSERT_TRUE(c.is_contiguous());
+    EXPECT_FALSE(c.shares_storage(a));
+    EXPECT_TRUE(v == c);
+
+    expectNear(v + b.transpose(), c + b.transpose().contiguous(), 0.0);
+    expectNear(v * 2.0 - v.exp(), c * 2.0 - c.exp(), 0.0);
+    EXPECT_NEAR(v.sum(), c.sum(), 1e-12);
+    EXPECT_EQ(v.max(), c.max());
+    EXPECT_EQ(v.argmin(), c.argmin());
+    EXPECT_NEAR(v.var(), c.var(), 1e-12);
+    for (size_t axis = 0; axis < 3; ++axis) {
+        expectNear(v.sum(axis), c.sum(axis), 1e-12);
+        expectNear(v.var(axis), c.var(axis), 1e-12);
+        expectNear(v.argmax(axis), c.argmax(axis), 0.0);
+    }
+    expectNear(v.reshape({20, 4}), c.reshape({20, 4}), 0.0);
+
+    const Tensor f = v.astype(TensorDType::Float32);
+    EXPECT_EQ(f.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(static_cast<float>(f(3, 4, 2)), static_cast<float>(c(3, 4, 2)));
+}
+
+TEST(TensorViews, MatmulReadsTransposedAndSlicedOperands) {
+    const Tensor a = Tensor::uniform({30, 20}, -1.0, 1.0, 23);
+    const Tensor b = Tensor::uniform({40, 30}, -1.0, 1.0, 24);
+    const Tensor at = a.transpose();                        // column-major view
+    const Tensor bs = b.slice(0, 5, 35).slice(1, 5, 25);    // rows 30 apart
+    const Tensor want = at.contiguous().matmul(bs.contiguous());
+    expectNear(at.matmul(bs), want, 1e-12);
+    expectNear(bs.transpose().matmul(a.slice(1, 0, 20)),
+               bs.transpose().contiguous().matmul(a), 1e-12);
+}
+
+TEST(TensorViews, SliceViewWritesDoNotLeakIntoCopies) {
+    Tensor t({3, 4}, 1.0);
+    Tensor snapshot = t;
+    TensorView v = t.slice_view(0, 1, 2);
+    v.at({0, 0}) = 9.0;
+    EXPECT_DOUBLE_EQ(t(1, 0), 9.0);
+    EXPECT_DOUBLE_EQ(snapshot(1, 0), 1.0);
+
+    Tensor row = v.to_tensor();
+    EXPECT_TRUE(row.shares_storage(t));
+    v.at({0, 1}) = 8.0;
+    EXPECT_DOUBLE_EQ(t(1, 1), 8.0);
+    EXPECT_DOUBLE_EQ(row(0, 1), 1.0);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// In-place ops and out-parameter kernels
+// ════════════════════════════════════════════════════════════════════════════
+
+static const double* buffer(const Tensor& t) { return t.data().data(); }
+
+TEST(TensorInPlace, CompoundOpsWriteIntoTheOwnBuffer) {
+    Tensor t = Tensor::arange(0, 12).reshape({3, 4});
+    const double* p = buffer(t);
+    const Tensor row = Tensor::arange(1, 5);                 // broadcast [4]
+    t += row;
+    t *= Tensor({3, 1}, 2.0);
+    t -= 1.0;
+    t /= 2.0;
+    EXPECT_EQ(buffer(t), p);
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            EXPECT_DOUBLE_EQ(t(i, j), ((i * 4.0 + j + j + 1.0) * 2.0 - 1.0) / 2.0);
+
+    t += t;                                                  // self-aliasing
+    EXPECT_EQ(buffer(t), p);
+    EXPECT_DOUBLE_EQ(t(2, 3), 2.0 * ((11.0 + 4.0) * 2.0 - 1.0) / 2.0);
+
+    // Copies keep their values; broadcasting to a larger shape replaces t.
+    Tensor snapshot = t;
+    t *= 0.0;
+    EXPECT_NE(snapshot(1, 1), 0.0);
+    Tensor v = Tensor::arange(0, 4);
+    v += Tensor({2, 4}, 1.0);
+    EXPECT_EQ(v.shape(), (Tensor::Shape{2, 4}));
+    EXPECT_DOUBLE_EQ(v(1, 3), 4.0);
+
+    Tensor f = Tensor({2, 2}, 1.0).astype(TensorDType::Float32);
+    f += Tensor({2, 2}, 0.5);
+    EXPECT_EQ(f.dtype(), TensorDType::Float32);
+    EXPECT_FLOAT_EQ(f.data_f32()[3], 1.5f);
+}
+
+TEST(TensorInPlace, StridedTargetIsMadeContiguousFirst) {
+    const Tensor base = Tensor::arange(0, 6).reshape({2, 3});
+    Tensor t = base.transpose();                             // [3, 2] view
+    t += Tensor::arange(0, 2);
+    EXPECT_TRUE(t.is_contiguous());
+    EXPECT_FALSE(t.shares_storage(base));
+    EXPECT_DOUBLE_EQ(t(2, 1), 5.0 + 1.0);
+    EXPECT_DOUBLE_EQ(base(1, 2), 5.0);
+}
+
+TEST(TensorInto, ReusesAMatchingOutput) {
+    const Tensor a = Tensor::uniform({8, 5}, -1.0, 1.0, 31);
+    const Tensor b = Tensor::uniform({5}, -1.0, 1.0, 32);
+    Tensor out;
+    add_into(out, a, b);                                     // allocates once
+    const double* p = buffer(out);
+    expectNear(out, a + b, 0.0);
+    sub_into(out, a, b);  expectNear(out, a - b, 0.0);
+    mul_into(out, a, b);  expectNear(out, a * b, 0.0);
+    div_into(out, a, b);  expectNear(out, a / b, 0.0);
+    exp_into(out, a);     expectNear(out, a.exp(), 0.0);
+    sigmoid_into(out, a); expectNear(out, a.sigmoid(), 0.0);
+    gelu_into(out, a);    expectNear(out, a.gelu(), 0.0);
+    apply_into(out, a, [](double x) { return 3.0 * x; });
+    expectNear(out, a * 3.0, 0.0);
+    tanh_into(out, out);                                     // out as operand
+    expectNear(out, (a * 3.0).tanh(), 0.0);
+    EXPECT_EQ(buffer(out), p);
+
+    // A copy of out is not written through.
+    Tensor copy = out;
+    abs_into(out, a);
+    EXPECT_NE(buffer(out), buffer(copy));
+    expectNear(copy, (a * 3.0).tanh(), 0.0);
+
+    Tensor s;
+    sum_into(s, a, 0);
+    const double* q = buffer(s);
+    expectNear(s, a.sum(0), 0.0);
+    mean_into(s, a, 0);
+    expectNear(s, a.mean(0), 1e-15);
+    EXPECT_EQ(buffer(s), q);
+    Tensor self = a;
+    sum_into(self, self, 1);
+    expectNear(self, a.sum(1), 0.0);
+    EXPECT_THROW(sum_into(s, a, 2), std::out_of_range);
+
+    const Tensor f = a.astype(TensorDType::Float32);
+    Tensor g;
+    relu_into(g, f);
+    EXPECT_EQ(g.dtype(), TensorDType::Float32);
+    add_into(g, f, a);                                       // promotes
+    EXPECT_EQ(g.dtype(), TensorDType::Float64);
+}
+
+TEST(TensorInto, MatmulIntoScalesAndAccumulates) {
+    const Tensor A = Tensor::uniform({7, 6}, -1.0, 1.0, 33);
+    const Tensor B = Tensor::uniform({6, 9}, -1.0, 1.0, 34);
+    Tensor C;
+    matmul_into(C, A, B);
+    const double* p = buffer(C);
+    matmul_into(C, A, B);
+    EXPECT_EQ(buffer(C), p);
+    expectNear(C, A.matmul(B), 1e-14);
+
+    const Tensor C0 = Tensor::uniform({7, 9}, -1.0, 1.0, 35);
+    C = C0.contiguous() * 1.0;
+    const double* q = buffer(C);
+    matmul_into(C, A, B, 2.0, -0.5);
+    expectNear(C, A.matmul(B) * 2.0 - C0 * 0.5, 1e-13);
+    EXPECT_EQ(buffer(C), q);
+
+    matmul_into(C, B.transpose(), A.transpose());            // strided operands
+    expectNear(C, A.matmul(B).transpose(), 1e-13);
+
+    Tensor S = Tensor::uniform({6, 6}, -1.0, 1.0, 36);
+    const Tensor S0 = S.contiguous() * 1.0;
+    matmul_into(S, S, S);                                    // C aliases A and B
+    expectNear(S, S0.matmul(S0), 1e-13);
+
+    Tensor F;
+    matmul_into(F, A.astype(TensorDType::Float32), B.astype(TensorDType::Float32));
+    EXPECT_EQ(F.dtype(), TensorDType::Float32);
+
+    Tensor wrong({3, 3});
+    EXPECT_THROW(matmul_into(wrong, A, B, 1.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(matmul_into(wrong, A, A), std::invalid_argument);
+}